@@ -27,26 +27,79 @@
  */
 #define CONFIG_MEM_STACK_LIMIT (4096)
 
+/**
+ * Use 64-bit ecma values, NaN-boxing the numbers
+ *
+ * By default, ecma values are 32-bit, numbers (except small integers) are allocated on the heap,
+ * and strings and objects are referenced through compressed pointers. With NaN-boxing,
+ * 64-bit float numbers are stored in the values themselves, and strings and objects
+ * are referenced through full (up to 48-bit) pointers, so no allocation or pointer decompression
+ * is needed for accessing them, at the cost of doubled size of values.
+ *
+ * The option requires 64-bit float ecma-numbers (see also: CONFIG_ECMA_NUMBER_TYPE),
+ * and implies 32-bit compressed pointers, as values of properties are stored in 64 bits.
+ * It relies on the byte code layout of 32-bit compressed pointer builds, which keeps
+ * the literal pool aligned (see also: cbc_uint16_arguments_t).
+ *
+ * #define CONFIG_ECMA_VALUE_NAN_BOXING
+ */
+#ifdef CONFIG_ECMA_VALUE_NAN_BOXING
+# ifndef CONFIG_MEM_CPOINTER_32_BIT
+#  define CONFIG_MEM_CPOINTER_32_BIT
+# endif /* !CONFIG_MEM_CPOINTER_32_BIT */
+# ifndef CONFIG_ECMA_INTEGER_VALUES_DISABLE
+#  define CONFIG_ECMA_INTEGER_VALUES_DISABLE
+# endif /* !CONFIG_ECMA_INTEGER_VALUES_DISABLE */
+#endif /* CONFIG_ECMA_VALUE_NAN_BOXING */
+
+/**
+ * Use 32-bit compressed pointers
+ *
+ * By default, compressed pointers are 16-bit, so heap size is limited to 256 kilobytes.
+ * With 32-bit compressed pointers heaps of up to 512 megabytes are supported,
+ * at the cost of larger ECMA Object Model's data types.
+ *
+ * #define CONFIG_MEM_CPOINTER_32_BIT
+ */
+
 /**
  * Size of pool chunk
  *
  * Should not be less than size of any of ECMA Object Model's data types.
  */
-#define CONFIG_MEM_POOL_CHUNK_SIZE (8)
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+# define CONFIG_MEM_POOL_CHUNK_SIZE (8)
+#elif !defined (CONFIG_ECMA_VALUE_NAN_BOXING)
+# define CONFIG_MEM_POOL_CHUNK_SIZE (16)
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+# define CONFIG_MEM_POOL_CHUNK_SIZE (32)
+#endif /* !CONFIG_MEM_CPOINTER_32_BIT */
 
 /**
  * Size of heap
  */
-#ifndef CONFIG_MEM_HEAP_AREA_SIZE
-# define CONFIG_MEM_HEAP_AREA_SIZE (256 * 1024)
-#elif CONFIG_MEM_HEAP_AREA_SIZE > (256 * 1024)
-# error "Currently, maximum 256 kilobytes heap size is supported"
-#endif /* !CONFIG_MEM_HEAP_AREA_SIZE */
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+# ifndef CONFIG_MEM_HEAP_AREA_SIZE
+#  define CONFIG_MEM_HEAP_AREA_SIZE (256 * 1024)
+# elif CONFIG_MEM_HEAP_AREA_SIZE > (256 * 1024)
+#  error "Currently, maximum 256 kilobytes heap size is supported with 16-bit compressed pointers"
+# endif /* !CONFIG_MEM_HEAP_AREA_SIZE */
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+# ifndef CONFIG_MEM_HEAP_AREA_SIZE
+#  define CONFIG_MEM_HEAP_AREA_SIZE (64 * 1024 * 1024)
+# elif CONFIG_MEM_HEAP_AREA_SIZE > (512 * 1024 * 1024)
+#  error "Currently, maximum 512 megabytes heap size is supported with 32-bit compressed pointers"
+# endif /* !CONFIG_MEM_HEAP_AREA_SIZE */
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
 
 /**
  * Max heap usage limit
  */
-#define CONFIG_MEM_HEAP_MAX_LIMIT 8192
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+# define CONFIG_MEM_HEAP_MAX_LIMIT 8192
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+# define CONFIG_MEM_HEAP_MAX_LIMIT (1024 * 1024)
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
 
 /**
  * Desired limit of heap usage
@@ -63,7 +116,11 @@
  *
  * On the other hand, value 2 ^ CONFIG_MEM_HEAP_OFFSET_LOG should not be less than CONFIG_MEM_HEAP_AREA_SIZE.
  */
-#define CONFIG_MEM_HEAP_OFFSET_LOG (18)
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+# define CONFIG_MEM_HEAP_OFFSET_LOG (18)
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+# define CONFIG_MEM_HEAP_OFFSET_LOG (29)
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
 
 /**
  * Number of lower bits in key of literal hash table.
@@ -90,6 +147,25 @@
  */
 #define CONFIG_ECMA_STRING_MAX_CONCATENATION_LENGTH (1048576)
 
+/**
+ * Maximum depth of trees of not yet flattened concatenations (ropes)
+ *
+ * Concatenations are rebalanced, so that repeated appends build trees of logarithmic depth. Trees, that still
+ * reach the depth, are flattened on next concatenation, which bounds the recursion depth of processing the trees
+ */
+#ifndef CONFIG_ECMA_STRING_MAX_ROPE_DEPTH
+# define CONFIG_ECMA_STRING_MAX_ROPE_DEPTH (32)
+#endif /* !CONFIG_ECMA_STRING_MAX_ROPE_DEPTH */
+
+/**
+ * Number of entries in the cache of character index to byte offset mappings of non-ASCII strings
+ *
+ * The cache makes sequential access to characters of a few non-ASCII strings amortised constant time.
+ */
+#ifndef CONFIG_ECMA_STRING_INDEX_CACHE_SIZE
+# define CONFIG_ECMA_STRING_INDEX_CACHE_SIZE (4)
+#endif /* !CONFIG_ECMA_STRING_INDEX_CACHE_SIZE */
+
 /**
  * Use 32-bit/64-bit float for ecma-numbers
  */
@@ -106,6 +182,15 @@
            && CONFIG_ECMA_NUMBER_TYPE != CONFIG_ECMA_NUMBER_FLOAT64 */
 #endif /* CONFIG_ECMA_NUMBER_TYPE */
 
+#if defined (CONFIG_ECMA_VALUE_NAN_BOXING) && CONFIG_ECMA_NUMBER_TYPE != CONFIG_ECMA_NUMBER_FLOAT64
+# error "NaN-boxing of ecma values requires 64-bit float ecma-numbers"
+#endif /* CONFIG_ECMA_VALUE_NAN_BOXING && CONFIG_ECMA_NUMBER_TYPE != CONFIG_ECMA_NUMBER_FLOAT64 */
+
+/**
+ * Disable storing of small integer numbers in ecma values, i.e. allocate all numbers on the heap
+ */
+// #define CONFIG_ECMA_INTEGER_VALUES_DISABLE
+
 /**
  * Representation for ecma-characters
  */
@@ -128,13 +213,139 @@
 // #define CONFIG_ECMA_LCACHE_DISABLE
 
 /**
- * Share of newly allocated since last GC objects among all currently allocated objects,
+ * Number of rows in LCache's hash table
+ *
+ * Should be a power of 2.
+ */
+#ifndef CONFIG_ECMA_LCACHE_ROWS
+# define CONFIG_ECMA_LCACHE_ROWS (128)
+#endif /* !CONFIG_ECMA_LCACHE_ROWS */
+
+/**
+ * Number of entries in a row of LCache's hash table
+ */
+#ifndef CONFIG_ECMA_LCACHE_WAYS
+# define CONFIG_ECMA_LCACHE_WAYS (4)
+#endif /* !CONFIG_ECMA_LCACHE_WAYS */
+
+/**
+ * Disable shapes (hidden classes), i.e. store all named data properties of ordinary objects
+ * in the objects' property lists
+ */
+// #define CONFIG_ECMA_SHAPES_DISABLE
+
+/**
+ * Maximum number of an object's named data properties, that are described by the object's shape
+ *
+ * Further properties are stored in the object's property list.
+ */
+#ifndef CONFIG_ECMA_SHAPE_MAX_PROPERTIES
+# define CONFIG_ECMA_SHAPE_MAX_PROPERTIES (32)
+#endif /* !CONFIG_ECMA_SHAPE_MAX_PROPERTIES */
+
+/**
+ * Maximum number of transitions from a shape
+ *
+ * Objects, for which a new transition is required upon the limit, store their further named data properties
+ * in the property lists, so that the transition tree does not grow unboundedly, if objects are used as maps.
+ */
+#ifndef CONFIG_ECMA_SHAPE_MAX_TRANSITIONS
+# define CONFIG_ECMA_SHAPE_MAX_TRANSITIONS (32)
+#endif /* !CONFIG_ECMA_SHAPE_MAX_TRANSITIONS */
+
+/**
+ * Disable property hashmaps of objects and lexical environments with many properties
+ */
+// #define CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+
+/**
+ * Number of named properties of a property list, after visiting which upon a property lookup,
+ * a hashmap of the properties is created
+ *
+ * The hashmap is freed by GC, if the number of the properties becomes less than half of the value.
+ */
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTIES
+# define CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTIES (16)
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTIES */
+
+/**
+ * Disable interning of property names, that are built at runtime (see also: ecma-intern.c)
+ */
+// #define CONFIG_ECMA_INTERN_DISABLE
+
+/**
+ * Growth of heap usage since last GC, in percents of the heap usage, that remained after the GC,
  * after achieving which, GC is started upon low severity try-give-memory-back requests.
  *
- * Share is calculated as the following:
- *                1.0 / CONFIG_ECMA_GC_NEW_OBJECTS_SHARE_TO_START_GC
+ * The default value can be changed at engine initialization (see also: jerry_init_with_gc_policy).
+ */
+#ifndef CONFIG_ECMA_GC_HEAP_GROWTH_PERCENT
+# define CONFIG_ECMA_GC_HEAP_GROWTH_PERCENT (50)
+#endif /* !CONFIG_ECMA_GC_HEAP_GROWTH_PERCENT */
+
+/**
+ * Minimum growth of heap usage since last GC, in bytes, after achieving which, GC is started
+ * upon low severity try-give-memory-back requests.
+ *
+ * The requests are issued each time heap usage crosses a multiple of CONFIG_MEM_HEAP_DESIRED_LIMIT,
+ * so lesser values are not distinguishable.
+ *
+ * The default value can be changed at engine initialization (see also: jerry_init_with_gc_policy).
+ */
+#ifndef CONFIG_ECMA_GC_MIN_HEAP_GROWTH
+# define CONFIG_ECMA_GC_MIN_HEAP_GROWTH (CONFIG_MEM_HEAP_DESIRED_LIMIT)
+#endif /* !CONFIG_ECMA_GC_MIN_HEAP_GROWTH */
+
+/**
+ * Number of entries in the garbage collector's mark stack
+ *
+ * Upon overflow of the stack, the objects, that could not be pushed, are found
+ * by re-scanning the list of objects, so marking never requires additional memory.
+ */
+#ifndef CONFIG_ECMA_GC_MARK_STACK_SIZE
+# define CONFIG_ECMA_GC_MARK_STACK_SIZE (256)
+#endif /* !CONFIG_ECMA_GC_MARK_STACK_SIZE */
+
+/**
+ * Number of minor garbage collections, that an object should survive
+ * to be moved from the young generation (nursery) to the old generation
+ */
+#ifndef CONFIG_ECMA_GC_SURVIVALS_TO_PROMOTE
+# define CONFIG_ECMA_GC_SURVIVALS_TO_PROMOTE (2)
+#endif /* !CONFIG_ECMA_GC_SURVIVALS_TO_PROMOTE */
+
+/**
+ * Number of entries in the remembered set, i.e. in the set of old objects, that may reference young objects
+ *
+ * Upon overflow of the set, the next garbage collection traces all objects.
+ */
+#ifndef CONFIG_ECMA_GC_REMEMBERED_SET_SIZE
+# define CONFIG_ECMA_GC_REMEMBERED_SET_SIZE (256)
+#endif /* !CONFIG_ECMA_GC_REMEMBERED_SET_SIZE */
+
+/**
+ * Number of objects, marked or swept by incremental garbage collection upon each object allocation
+ *
+ * New objects are allocated gray during incremental marking, so the value should be greater than one
+ * for the marking to complete.
  */
-#define CONFIG_ECMA_GC_NEW_OBJECTS_SHARE_TO_START_GC (16)
+#ifndef CONFIG_ECMA_GC_INCREMENTAL_MARK_RATE
+# define CONFIG_ECMA_GC_INCREMENTAL_MARK_RATE (8)
+#endif /* !CONFIG_ECMA_GC_INCREMENTAL_MARK_RATE */
+
+/**
+ * Number of objects, marked or swept by a slice of incremental garbage collection upon low severity
+ * try-give-memory-back requests
+ */
+#ifndef CONFIG_ECMA_GC_INCREMENTAL_SLICE_SIZE
+# define CONFIG_ECMA_GC_INCREMENTAL_SLICE_SIZE (256)
+#endif /* !CONFIG_ECMA_GC_INCREMENTAL_SLICE_SIZE */
+
+/**
+ * Disable lazy sweeping, i.e. free unmarked objects as soon as marking of a major collection is finished,
+ * instead of freeing them in slices
+ */
+// #define CONFIG_ECMA_GC_LAZY_SWEEP_DISABLE
 
 /**
  * Link Global Environment to an empty declarative lexical environment
@@ -158,6 +369,7 @@
 #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_DATE_BUILTIN
 #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
 #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ANNEXB_BUILTIN
+#define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
 #endif /* CONFIG_ECMA_COMPACT_PROFILE */
 
 /**
@@ -165,6 +377,41 @@
  */
 #define CONFIG_VM_STACK_FRAME_INLINED_VALUES_NUMBER (16)
 
+/**
+ * Disable dense storage of arrays' elements, i.e. store all elements as named properties of the arrays
+ */
+// #define CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+
+/**
+ * Maximum number of holes, that can be created by storing an element after the end of a dense array's storage
+ *
+ * Arrays, for which more holes are required, are converted to the named properties representation.
+ */
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_MAX_GAP
+# define CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_MAX_GAP (64)
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_MAX_GAP */
+
+/**
+ * Disable inline caches of property get / put byte-code instructions
+ */
+// #define CONFIG_VM_INLINE_CACHE_DISABLE
+
+/**
+ * Number of rows in the table of inline caches, i.e. of byte-code instructions, that can be cached at once
+ *
+ * Should be a power of 2.
+ */
+#ifndef CONFIG_VM_INLINE_CACHE_SITES
+# define CONFIG_VM_INLINE_CACHE_SITES (128)
+#endif /* !CONFIG_VM_INLINE_CACHE_SITES */
+
+/**
+ * Number of receiver layouts, cached for a byte-code instruction
+ */
+#ifndef CONFIG_VM_INLINE_CACHE_WAYS
+# define CONFIG_VM_INLINE_CACHE_WAYS (4)
+#endif /* !CONFIG_VM_INLINE_CACHE_WAYS */
+
 /**
  * Run GC after execution of each byte-code instruction
  */
@@ -21,24 +21,24 @@
 #include "jrt.h"
 #include "mem-poolman.h"
 
-JERRY_STATIC_ASSERT (sizeof (ecma_property_t) <= sizeof (uint64_t),
-                     size_of_ecma_property_t_must_be_less_than_or_equal_to_8_bytes);
+JERRY_STATIC_ASSERT (sizeof (ecma_property_t) <= MEM_POOL_CHUNK_SIZE,
+                     size_of_ecma_property_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
 
-JERRY_STATIC_ASSERT (sizeof (ecma_object_t) <= sizeof (uint64_t),
-                     size_of_ecma_object_t_must_be_less_than_or_equal_to_8_bytes);
-JERRY_STATIC_ASSERT (ECMA_OBJECT_OBJ_TYPE_SIZE <= sizeof (uint64_t) * JERRY_BITSINBYTE,
-                     ECMA_OBJECT_OBJ_TYPE_SIZE_must_be_less_than_or_equal_to_64_bits);
-JERRY_STATIC_ASSERT (ECMA_OBJECT_LEX_ENV_TYPE_SIZE <= sizeof (uint64_t) * JERRY_BITSINBYTE,
-                     ECMA_OBJECT_LEX_ENV_TYPE_SIZE_must_be_less_than_or_equal_to_64_bits);
+JERRY_STATIC_ASSERT (sizeof (ecma_object_t) <= MEM_POOL_CHUNK_SIZE,
+                     size_of_ecma_object_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (ECMA_OBJECT_OBJ_TYPE_SIZE <= sizeof (ecma_object_container_t) * JERRY_BITSINBYTE,
+                     ECMA_OBJECT_OBJ_TYPE_SIZE_must_be_less_than_or_equal_to_size_of_container);
+JERRY_STATIC_ASSERT (ECMA_OBJECT_LEX_ENV_TYPE_SIZE <= sizeof (ecma_object_container_t) * JERRY_BITSINBYTE,
+                     ECMA_OBJECT_LEX_ENV_TYPE_SIZE_must_be_less_than_or_equal_to_size_of_container);
 
-JERRY_STATIC_ASSERT (sizeof (ecma_collection_header_t) == sizeof (uint64_t),
-                     size_of_ecma_collection_header_t_must_be_less_than_or_equal_to_8_bytes);
-JERRY_STATIC_ASSERT (sizeof (ecma_collection_chunk_t) == sizeof (uint64_t),
-                     size_of_ecma_collection_chunk_t_must_be_less_than_or_equal_to_8_bytes);
-JERRY_STATIC_ASSERT (sizeof (ecma_string_t) == sizeof (uint64_t),
-                     size_of_ecma_string_t_must_be_less_than_or_equal_to_8_bytes);
-JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= sizeof (uint64_t),
-                     size_of_ecma_getter_setter_pointers_t_must_be_less_than_or_equal_to_8_bytes);
+JERRY_STATIC_ASSERT (sizeof (ecma_collection_header_t) <= MEM_POOL_CHUNK_SIZE,
+                     size_of_ecma_collection_header_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_collection_chunk_t) <= MEM_POOL_CHUNK_SIZE,
+                     size_of_ecma_collection_chunk_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_string_t) <= MEM_POOL_CHUNK_SIZE,
+                     size_of_ecma_string_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= MEM_POOL_CHUNK_SIZE,
+                     size_of_ecma_getter_setter_pointers_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
 
 /** \addtogroup ecma ECMA
  * @{
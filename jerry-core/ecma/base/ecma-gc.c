@@ -28,51 +28,70 @@
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
+#include "ecma-intern.h"
 #include "ecma-lcache.h"
+#include "ecma-property-hashmap.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "jrt-bit-fields.h"
 #include "re-compiler.h"
 #include "vm-defines.h"
+#include "vm-inline-cache.h"
 #include "vm-stack.h"
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
 
+#include <sys/time.h>
+
 /**
  * TODO:
  *      Extract GC to a separate component
  */
 
 /**
- * An object's GC color
- *
  * Tri-color marking:
- *   WHITE_GRAY, unvisited -> WHITE // not referenced by a live object or the reference not found yet
- *   WHITE_GRAY, visited   -> GRAY  // referenced by some live object
- *   BLACK                 -> BLACK // all referenced objects are gray or black
+ *   unvisited        -> WHITE // not referenced by a live object or the reference not found yet
+ *   visited, pushed  -> GRAY  // referenced by some live object, the object's references are not marked yet
+ *   visited, popped  -> BLACK // all referenced objects are gray or black
+ *
+ * Gray objects are pushed to the mark stack and become black as soon as they are popped
+ * and their references are marked.
  */
-typedef enum
-{
-  ECMA_GC_COLOR_WHITE_GRAY, /**< white or gray */
-  ECMA_GC_COLOR_BLACK, /**< black */
-  ECMA_GC_COLOR__COUNT /**< number of colors */
-} ecma_gc_color_t;
 
 /**
- * List of marked (visited during current GC session) and umarked objects
+ * Number of generations: a young generation for each number of survived minor collections, and the old generation
+ */
+#define ECMA_GC_GENERATIONS_NUMBER (CONFIG_ECMA_GC_SURVIVALS_TO_PROMOTE + 1)
+
+/**
+ * Index of the old generation
+ */
+#define ECMA_GC_OLD_GENERATION (CONFIG_ECMA_GC_SURVIVALS_TO_PROMOTE)
+
+JERRY_STATIC_ASSERT (CONFIG_ECMA_GC_SURVIVALS_TO_PROMOTE >= 1,
+                     CONFIG_ECMA_GC_SURVIVALS_TO_PROMOTE_must_be_at_least_1);
+
+/**
+ * Lists of objects of the generations
+ *
+ * New objects are put to the list of the youngest generation. Survivors of a minor collection
+ * are moved to the next generation's list, and survivors of a major collection - to the old generation's list.
+ */
+static ecma_object_t *ecma_gc_objects_lists[ECMA_GC_GENERATIONS_NUMBER];
+
+/**
+ * Lists of objects of the generations, that were marked by last major collection, and are not swept yet
+ *
+ * Unmarked objects are freed lazily, in batches interleaved with execution of the program,
+ * and the marked ones are moved to the old generation's list and unmarked.
  */
-static ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT];
+static ecma_object_t *ecma_gc_sweep_lists[ECMA_GC_GENERATIONS_NUMBER];
 
 /**
- * Current state of an object's visited flag that indicates whether the object is in visited state:
- *  visited_field | visited_flip_flag | real_value
- *         false  |            false  |     false
- *         false  |             true  |      true
- *          true  |            false  |      true
- *          true  |             true  |     false
+ * Flag, indicating that sweeping of last major collection is in progress
  */
-static bool ecma_gc_visited_flip_flag = false;
+static bool ecma_gc_is_sweeping = false;
 
 /**
  * Number of currently allocated objects
@@ -80,12 +99,149 @@ static bool ecma_gc_visited_flip_flag = false;
 static size_t ecma_gc_objects_number = 0;
 
 /**
- * Number of newly allocated objects since last GC session
+ * Growth of heap usage since last collection, in percents of the heap usage, that remained after the collection,
+ * after achieving which, next collection is started
+ */
+static uint32_t ecma_gc_heap_growth_percent = CONFIG_ECMA_GC_HEAP_GROWTH_PERCENT;
+
+/**
+ * Minimum growth of heap usage since last collection, in bytes, after achieving which, next collection is started
+ */
+static size_t ecma_gc_min_heap_growth = CONFIG_ECMA_GC_MIN_HEAP_GROWTH;
+
+/**
+ * Heap usage, that remained after last collection, in bytes
+ */
+static size_t ecma_gc_live_heap_size = 0;
+
+/**
+ * Heap usage, after achieving which, next collection is started upon low severity try-give-memory-back requests
+ */
+static size_t ecma_gc_heap_usage_limit = 0;
+
+/**
+ * Number of objects, that survived last major collection
+ */
+static size_t ecma_gc_objects_after_major_gc = 0;
+
+/**
+ * Number of objects, promoted to the old generation by minor collections since last major collection
+ */
+static size_t ecma_gc_promoted_objects_since_major_gc = 0;
+
+/**
+ * Remembered set, i.e. the old objects, that may reference young objects
+ *
+ * The objects are traced by minor collections in addition to the young roots.
+ */
+static mem_cpointer_t ecma_gc_remembered_set[CONFIG_ECMA_GC_REMEMBERED_SET_SIZE];
+
+/**
+ * Number of objects in the remembered set
+ */
+static uint32_t ecma_gc_remembered_set_count = 0;
+
+/**
+ * Flag, indicating that an old object was not added to the remembered set, as the set was full,
+ * so the next collection should be a major one
+ */
+static bool ecma_gc_remembered_set_overflow = false;
+
+/**
+ * Flag, indicating that a minor collection is in progress
+ */
+static bool ecma_gc_is_minor_collection = false;
+
+/**
+ * Flag, indicating that a young object was found among references, marked during a minor collection
+ */
+static bool ecma_gc_young_reference_found = false;
+
+/**
+ * Flag, indicating that marking of a major collection is in progress
+ *
+ * Marking can be performed incrementally, in slices interleaved with execution of the program.
+ * Meanwhile, the tri-color invariant (no black object references a white one) is maintained as the following:
+ *  - new objects are allocated gray;
+ *  - objects, which reference counter is increased, are shaded gray, so objects, that become roots
+ *    after the roots were scanned, are marked;
+ *  - the write barrier pushes visited objects to the mark stack again upon storing a reference into them.
+ */
+static bool ecma_gc_is_marking = false;
+
+/**
+ * Generation, which objects are currently being scanned for roots by the marking
+ */
+static uint32_t ecma_gc_roots_scan_generation = 0;
+
+/**
+ * Next object to be checked for being a root by the marking
+ */
+static ecma_object_t *ecma_gc_roots_scan_object_p = NULL;
+
+/**
+ * Number of marked objects, after which time budget of a garbage collection step is checked
+ */
+#define ECMA_GC_STEP_TIME_CHECK_INTERVAL (32)
+
+/**
+ * Garbage collector's statistics, reported through the API
+ */
+static jerry_api_gc_stats_t ecma_gc_api_stats;
+
+/**
+ * Description of a garbage collector's pause, which is being measured
+ */
+typedef struct
+{
+  jerry_api_gc_pause_kind_t kind; /**< kind of the pause */
+  size_t start_time_us; /**< time, at which the pause was started */
+  size_t start_used_size; /**< size of used memory at start of the pause */
+} ecma_gc_pause_t;
+
+#ifdef MEM_STATS
+/**
+ * Garbage collector's statistics, that are printed in addition to the ones, reported through the API
+ */
+typedef struct
+{
+  size_t minor_gc_pause_sum_us; /**< sum of minor collections' pause times, in microseconds */
+  size_t minor_gc_max_pause_us; /**< maximum pause time of minor collections, in microseconds */
+  size_t major_gc_pause_sum_us; /**< sum of major collections' pause times, in microseconds */
+  size_t major_gc_max_pause_us; /**< maximum pause time of major collections, in microseconds */
+  size_t promoted_objects; /**< number of objects, promoted to the old generation by minor collections */
+  size_t incremental_slice_pause_sum_us; /**< sum of incremental slices' pause times, in microseconds */
+  size_t incremental_slice_max_pause_us; /**< maximum pause time of incremental slices, in microseconds */
+  size_t trigger_requests_count; /**< number of low severity requests, checked against the heap usage limit */
+  size_t trigger_collections_count; /**< number of collections, started upon the requests */
+} ecma_gc_stats_t;
+
+/**
+ * Garbage collector's statistics
+ */
+static ecma_gc_stats_t ecma_gc_stats;
+#endif /* MEM_STATS */
+
+/**
+ * Stack of gray objects, which references are not marked yet
+ */
+static mem_cpointer_t ecma_gc_mark_stack[CONFIG_ECMA_GC_MARK_STACK_SIZE];
+
+/**
+ * Number of objects in the mark stack
  */
-static size_t ecma_gc_new_objects_since_last_gc = 0;
+static uint32_t ecma_gc_mark_stack_depth = 0;
+
+/**
+ * Flag, indicating that a gray object was not pushed to the mark stack, as the stack was full
+ */
+static bool ecma_gc_mark_stack_overflow = false;
 
 static void ecma_gc_mark (ecma_object_t *object_p);
 static void ecma_gc_sweep (ecma_object_t *object_p);
+static void ecma_gc_push_object (ecma_object_t *object_p);
+static void ecma_gc_set_object_gray (ecma_object_t *object_p);
+static void ecma_gc_run_slice (uint32_t objects_limit);
 
 /**
  * Get GC reference counter of the object.
@@ -95,7 +251,7 @@ ecma_gc_get_object_refs (ecma_object_t *object_p) /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  return (uint32_t) JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
+  return (uint32_t) JRT_EXTRACT_BIT_FIELD (ecma_object_container_t, object_p->container,
                                            ECMA_OBJECT_GC_REFS_POS,
                                            ECMA_OBJECT_GC_REFS_WIDTH);
 } /* ecma_gc_get_object_refs */
@@ -109,7 +265,7 @@ ecma_gc_set_object_refs (ecma_object_t *object_p, /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  object_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, object_p->container,
+  object_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t, object_p->container,
                                                  refs,
                                                  ECMA_OBJECT_GC_REFS_POS,
                                                  ECMA_OBJECT_GC_REFS_WIDTH);
@@ -123,10 +279,7 @@ ecma_gc_get_object_next (ecma_object_t *object_p) /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_GC_NEXT_CP_WIDTH);
-  uintptr_t next_cp = (uintptr_t) JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
-                                                         ECMA_OBJECT_GC_NEXT_CP_POS,
-                                                         ECMA_OBJECT_GC_NEXT_CP_WIDTH);
+  mem_cpointer_t next_cp = ECMA_OBJECT_GET_CP_FIELD (object_p, GC_NEXT);
 
   return ECMA_GET_POINTER (ecma_object_t,
                            next_cp);
@@ -141,14 +294,10 @@ ecma_gc_set_object_next (ecma_object_t *object_p, /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  uintptr_t next_cp;
+  mem_cpointer_t next_cp;
   ECMA_SET_POINTER (next_cp, next_object_p);
 
-  JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_GC_NEXT_CP_WIDTH);
-  object_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, object_p->container,
-                                                 next_cp,
-                                                 ECMA_OBJECT_GC_NEXT_CP_POS,
-                                                 ECMA_OBJECT_GC_NEXT_CP_WIDTH);
+  ECMA_OBJECT_SET_CP_FIELD (object_p, GC_NEXT, next_cp);
 } /* ecma_gc_set_object_next */
 
 /**
@@ -159,11 +308,9 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  bool flag_value = (bool) JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
-                                                  ECMA_OBJECT_GC_VISITED_POS,
-                                                  ECMA_OBJECT_GC_VISITED_WIDTH);
-
-  return (flag_value != ecma_gc_visited_flip_flag);
+  return (bool) JRT_EXTRACT_BIT_FIELD (ecma_object_container_t, object_p->container,
+                                       ECMA_OBJECT_GC_VISITED_POS,
+                                       ECMA_OBJECT_GC_VISITED_WIDTH);
 } /* ecma_gc_is_object_visited */
 
 /**
@@ -175,35 +322,176 @@ ecma_gc_set_object_visited (ecma_object_t *object_p, /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  if (ecma_gc_visited_flip_flag)
-  {
-    is_visited = !is_visited;
-  }
-
-  object_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, object_p->container,
+  object_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t, object_p->container,
                                                  is_visited,
                                                  ECMA_OBJECT_GC_VISITED_POS,
                                                  ECMA_OBJECT_GC_VISITED_WIDTH);
 } /* ecma_gc_set_object_visited */
 
+/**
+ * Check whether the object is in the old generation.
+ */
+static bool
+ecma_gc_is_object_old (ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+  return (bool) JRT_EXTRACT_BIT_FIELD (ecma_object_container_t, object_p->container,
+                                       ECMA_OBJECT_GC_IS_OLD_POS,
+                                       ECMA_OBJECT_GC_IS_OLD_WIDTH);
+} /* ecma_gc_is_object_old */
+
+/**
+ * Set the object's old generation flag.
+ */
+static void
+ecma_gc_set_object_old (ecma_object_t *object_p, /**< object */
+                        bool is_old) /**< flag value */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+  object_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t, object_p->container,
+                                                 is_old,
+                                                 ECMA_OBJECT_GC_IS_OLD_POS,
+                                                 ECMA_OBJECT_GC_IS_OLD_WIDTH);
+} /* ecma_gc_set_object_old */
+
+/**
+ * Check whether the object is in the remembered set.
+ */
+static bool
+ecma_gc_is_object_remembered (ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+  return (bool) JRT_EXTRACT_BIT_FIELD (ecma_object_container_t, object_p->container,
+                                       ECMA_OBJECT_GC_IS_REMEMBERED_POS,
+                                       ECMA_OBJECT_GC_IS_REMEMBERED_WIDTH);
+} /* ecma_gc_is_object_remembered */
+
+/**
+ * Set the object's remembered set membership flag.
+ */
+static void
+ecma_gc_set_object_remembered (ecma_object_t *object_p, /**< object */
+                               bool is_remembered) /**< flag value */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+  object_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t, object_p->container,
+                                                 is_remembered,
+                                                 ECMA_OBJECT_GC_IS_REMEMBERED_POS,
+                                                 ECMA_OBJECT_GC_IS_REMEMBERED_WIDTH);
+} /* ecma_gc_set_object_remembered */
+
+/**
+ * Add the old object to the remembered set
+ */
+static void
+ecma_gc_remember_object (ecma_object_t *object_p) /**< old object */
+{
+  JERRY_ASSERT (ecma_gc_is_object_old (object_p));
+  JERRY_ASSERT (!ecma_gc_is_object_remembered (object_p));
+
+  if (likely (ecma_gc_remembered_set_count < CONFIG_ECMA_GC_REMEMBERED_SET_SIZE))
+  {
+    ECMA_SET_NON_NULL_POINTER (ecma_gc_remembered_set[ecma_gc_remembered_set_count], object_p);
+    ecma_gc_remembered_set_count++;
+
+    ecma_gc_set_object_remembered (object_p, true);
+  }
+  else
+  {
+    ecma_gc_remembered_set_overflow = true;
+  }
+} /* ecma_gc_remember_object */
+
+/**
+ * Empty the remembered set
+ */
+static void
+ecma_gc_clear_remembered_set (void)
+{
+  for (uint32_t i = 0; i < ecma_gc_remembered_set_count; i++)
+  {
+    ecma_object_t *object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_remembered_set[i]);
+
+    ecma_gc_set_object_remembered (object_p, false);
+  }
+
+  ecma_gc_remembered_set_count = 0;
+  ecma_gc_remembered_set_overflow = false;
+} /* ecma_gc_clear_remembered_set */
+
+/**
+ * Write barrier, that should be executed upon storing a reference to an object into the specified object
+ *
+ * If the object is old, it is added to the remembered set, so that the referenced object
+ * is not freed by minor collections, in case it is young.
+ *
+ * During marking, the object is pushed to the mark stack again, if it is already visited,
+ * so that the referenced object is marked, in case it is white.
+ *
+ * During sweeping, objects, that survived the major collection, are considered old,
+ * even if they are not moved to the old generation's list yet.
+ */
+void
+ecma_gc_write_barrier (ecma_object_t *object_p) /**< object, to which the reference is stored */
+{
+  if (unlikely (ecma_gc_is_marking))
+  {
+    /* The remembered set is not used during major collections */
+    if (ecma_gc_is_object_visited (object_p))
+    {
+      ecma_gc_push_object (object_p);
+    }
+  }
+  else
+  {
+    if (unlikely (ecma_gc_is_sweeping)
+        && ecma_gc_is_object_visited (object_p))
+    {
+      ecma_gc_set_object_old (object_p, true);
+    }
+
+    if (ecma_gc_is_object_old (object_p)
+        && !ecma_gc_is_object_remembered (object_p))
+    {
+      ecma_gc_remember_object (object_p);
+    }
+  }
+} /* ecma_gc_write_barrier */
+
 /**
  * Initialize GC information for the object
  */
 void
 ecma_init_gc_info (ecma_object_t *object_p) /**< object */
 {
-  ecma_gc_objects_number++;
-  ecma_gc_new_objects_since_last_gc++;
+  if (unlikely (ecma_gc_is_marking || ecma_gc_is_sweeping))
+  {
+    /* The new object is not linked to the list of objects yet, so it is not accessed by the slice */
+    ecma_gc_run_slice (CONFIG_ECMA_GC_INCREMENTAL_MARK_RATE);
+  }
 
-  JERRY_ASSERT (ecma_gc_new_objects_since_last_gc <= ecma_gc_objects_number);
+  ecma_gc_objects_number++;
 
   ecma_gc_set_object_refs (object_p, 1);
 
-  ecma_gc_set_object_next (object_p, ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY]);
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = object_p;
+  ecma_gc_set_object_next (object_p, ecma_gc_objects_lists[0]);
+  ecma_gc_objects_lists[0] = object_p;
 
   /* Should be set to false at the beginning of garbage collection */
   ecma_gc_set_object_visited (object_p, false);
+
+  ecma_gc_set_object_old (object_p, false);
+  ecma_gc_set_object_remembered (object_p, false);
+
+  if (unlikely (ecma_gc_is_marking))
+  {
+    /* References, stored into new objects, are not tracked by the write barrier, so the objects are scanned later */
+    ecma_gc_set_object_gray (object_p);
+  }
 } /* ecma_init_gc_info */
 
 /**
@@ -214,7 +502,13 @@ ecma_ref_object (ecma_object_t *object_p) /**< object */
 {
   uint32_t ref_cnt = ecma_gc_get_object_refs (object_p);
 
-  if (ref_cnt < (uint32_t) CONFIG_ECMA_REFERENCE_COUNTER_LIMIT)
+  if (unlikely (ecma_gc_is_marking))
+  {
+    /* The object becomes a root, and the roots could already be scanned */
+    ecma_gc_set_object_gray (object_p);
+  }
+
+  if (ref_cnt < ECMA_OBJECT_GC_REFS_LIMIT)
   {
     ecma_gc_set_object_refs (object_p, ref_cnt + 1);
   }
@@ -234,27 +528,167 @@ ecma_deref_object (ecma_object_t *object_p) /**< object */
   ecma_gc_set_object_refs (object_p, ecma_gc_get_object_refs (object_p) - 1);
 } /* ecma_deref_object */
 
+/**
+ * Get size of memory, that is in use, as free pool chunks are not returned to the heap immediately
+ *
+ * @return size, in bytes
+ */
+static size_t
+ecma_gc_get_used_memory_size (void)
+{
+  return mem_heap_get_allocated_size () - mem_pools_get_free_size ();
+} /* ecma_gc_get_used_memory_size */
+
+/**
+ * Calculate heap usage, after achieving which, next collection is started, from current heap usage
+ *
+ * Note:
+ *      should be called upon completion of a collection
+ */
+static void
+ecma_gc_update_heap_usage_limit (void)
+{
+  ecma_gc_live_heap_size = ecma_gc_get_used_memory_size ();
+
+  size_t growth = ecma_gc_live_heap_size / 100u * ecma_gc_heap_growth_percent;
+
+  ecma_gc_heap_usage_limit = ecma_gc_live_heap_size + JERRY_MAX (growth, ecma_gc_min_heap_growth);
+
+  /*
+   * Low severity requests are issued only upon crossing multiples of CONFIG_MEM_HEAP_DESIRED_LIMIT,
+   * so the limit is kept at least one step below the heap's size, as otherwise GC would be started
+   * only upon allocation failures.
+   */
+  ecma_gc_heap_usage_limit = JERRY_MIN (ecma_gc_heap_usage_limit,
+                                        CONFIG_MEM_HEAP_AREA_SIZE - CONFIG_MEM_HEAP_DESIRED_LIMIT);
+} /* ecma_gc_update_heap_usage_limit */
+
+/**
+ * Set policy of starting garbage collections upon low severity try-give-memory-back requests
+ *
+ * A collection is started, if heap usage has grown since last collection by the specified share
+ * of the heap usage, that remained after the collection, and by at least the specified number of bytes.
+ */
+void
+ecma_gc_set_policy (uint32_t heap_growth_percent, /**< share of the heap usage after last collection,
+                                                   *   in percents */
+                    size_t min_heap_growth) /**< minimum growth, in bytes */
+{
+  ecma_gc_heap_growth_percent = heap_growth_percent;
+  ecma_gc_min_heap_growth = min_heap_growth;
+
+  ecma_gc_update_heap_usage_limit ();
+} /* ecma_gc_set_policy */
+
 /**
  * Initialize garbage collector
  */
 void
 ecma_gc_init (void)
 {
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = NULL;
-  ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
-  ecma_gc_visited_flip_flag = false;
+  for (uint32_t generation = 0; generation < ECMA_GC_GENERATIONS_NUMBER; generation++)
+  {
+    ecma_gc_objects_lists[generation] = NULL;
+    ecma_gc_sweep_lists[generation] = NULL;
+  }
+
+  ecma_gc_is_sweeping = false;
+  ecma_gc_mark_stack_depth = 0;
+  ecma_gc_mark_stack_overflow = false;
   ecma_gc_objects_number = 0;
-  ecma_gc_new_objects_since_last_gc = 0;
+  ecma_gc_objects_after_major_gc = 0;
+  ecma_gc_promoted_objects_since_major_gc = 0;
+  ecma_gc_remembered_set_count = 0;
+  ecma_gc_remembered_set_overflow = false;
+  ecma_gc_is_minor_collection = false;
+  ecma_gc_is_marking = false;
+  ecma_gc_roots_scan_generation = 0;
+  ecma_gc_roots_scan_object_p = NULL;
+
+  ecma_gc_set_policy (CONFIG_ECMA_GC_HEAP_GROWTH_PERCENT, CONFIG_ECMA_GC_MIN_HEAP_GROWTH);
+
+  memset (&ecma_gc_api_stats, 0, sizeof (ecma_gc_api_stats));
+
+#ifdef MEM_STATS
+  memset (&ecma_gc_stats, 0, sizeof (ecma_gc_stats));
+#endif /* MEM_STATS */
 } /* ecma_gc_init */
 
 /**
- * Mark objects as visited starting from specified object as root
+ * Push the visited object to the mark stack, or, if the stack is full, leave it
+ * to be found during re-scan of the list of objects.
+ */
+static void
+ecma_gc_push_object (ecma_object_t *object_p) /**< visited object */
+{
+  JERRY_ASSERT (ecma_gc_is_object_visited (object_p));
+
+  if (likely (ecma_gc_mark_stack_depth < CONFIG_ECMA_GC_MARK_STACK_SIZE))
+  {
+    ECMA_SET_NON_NULL_POINTER (ecma_gc_mark_stack[ecma_gc_mark_stack_depth], object_p);
+    ecma_gc_mark_stack_depth++;
+  }
+  else
+  {
+    ecma_gc_mark_stack_overflow = true;
+  }
+} /* ecma_gc_push_object */
+
+/**
+ * Mark object as gray (visited, with unmarked references), if it is not visited yet
+ */
+static void
+ecma_gc_set_object_gray (ecma_object_t *object_p) /**< object */
+{
+  if (ecma_gc_is_minor_collection)
+  {
+    if (ecma_gc_is_object_old (object_p))
+    {
+      /* Old objects are neither traced nor freed by minor collections */
+      return;
+    }
+
+    ecma_gc_young_reference_found = true;
+  }
+
+  if (ecma_gc_is_object_visited (object_p))
+  {
+    return;
+  }
+
+  ecma_gc_set_object_visited (object_p, true);
+  ecma_gc_push_object (object_p);
+
+  ecma_gc_api_stats.marked_objects++;
+} /* ecma_gc_set_object_gray */
+
+/**
+ * Mark references of the objects in the mark stack, until the stack is empty
+ */
+static void
+ecma_gc_process_mark_stack (void)
+{
+  while (ecma_gc_mark_stack_depth > 0)
+  {
+    ecma_gc_mark_stack_depth--;
+
+    ecma_object_t *object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
+                                                         ecma_gc_mark_stack[ecma_gc_mark_stack_depth]);
+    ecma_gc_mark (object_p);
+  }
+} /* ecma_gc_process_mark_stack */
+
+/**
+ * Mark objects, referenced by the specified object, as gray
+ *
+ * The object should be visited, or, during a minor collection, be old.
  */
 void
-ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
+ecma_gc_mark (ecma_object_t *object_p) /**< visited object */
 {
   JERRY_ASSERT (object_p != NULL);
-  JERRY_ASSERT (ecma_gc_is_object_visited (object_p));
+  JERRY_ASSERT (ecma_gc_is_object_visited (object_p)
+                || (ecma_gc_is_minor_collection && ecma_gc_is_object_old (object_p)));
 
   bool traverse_properties = true;
 
@@ -263,13 +697,13 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
     ecma_object_t *lex_env_p = ecma_get_lex_env_outer_reference (object_p);
     if (lex_env_p != NULL)
     {
-      ecma_gc_set_object_visited (lex_env_p, true);
+      ecma_gc_set_object_gray (lex_env_p);
     }
 
     if (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND)
     {
       ecma_object_t *binding_object_p = ecma_get_lex_env_binding_object (object_p);
-      ecma_gc_set_object_visited (binding_object_p, true);
+      ecma_gc_set_object_gray (binding_object_p);
 
       traverse_properties = false;
     }
@@ -279,12 +713,14 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
     ecma_object_t *proto_p = ecma_get_object_prototype (object_p);
     if (proto_p != NULL)
     {
-      ecma_gc_set_object_visited (proto_p, true);
+      ecma_gc_set_object_gray (proto_p);
     }
   }
 
   if (traverse_properties)
   {
+    uint32_t named_properties_number = 0;
+
     for (ecma_property_t *property_p = ecma_get_property_list (object_p), *next_property_p;
          property_p != NULL;
          property_p = next_property_p)
@@ -292,6 +728,11 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
       next_property_p = ECMA_GET_POINTER (ecma_property_t,
                                           property_p->next_property_p);
 
+      if (property_p->flags & (ECMA_PROPERTY_FLAG_NAMEDDATA | ECMA_PROPERTY_FLAG_NAMEDACCESSOR))
+      {
+        named_properties_number++;
+      }
+
       if (property_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
       {
         ecma_value_t value = ecma_get_named_data_property_value (property_p);
@@ -300,7 +741,7 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
         {
           ecma_object_t *value_obj_p = ecma_get_object_from_value (value);
 
-          ecma_gc_set_object_visited (value_obj_p, true);
+          ecma_gc_set_object_gray (value_obj_p);
         }
       }
       else if (property_p->flags & ECMA_PROPERTY_FLAG_NAMEDACCESSOR)
@@ -310,12 +751,31 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
 
         if (getter_obj_p != NULL)
         {
-          ecma_gc_set_object_visited (getter_obj_p, true);
+          ecma_gc_set_object_gray (getter_obj_p);
         }
 
         if (setter_obj_p != NULL)
         {
-          ecma_gc_set_object_visited (setter_obj_p, true);
+          ecma_gc_set_object_gray (setter_obj_p);
+        }
+      }
+      else if (property_p->flags == ECMA_PROPERTY_FLAG_SHAPED)
+      {
+        ecma_property_slots_header_t *slots_header_p = (ecma_property_slots_header_t *) property_p;
+
+        for (uint32_t index = 0; index < slots_header_p->slots_number; index++)
+        {
+          ecma_property_t *slot_p = ecma_get_property_slot (slots_header_p, index);
+
+          if (slot_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
+          {
+            ecma_value_t value = ecma_get_named_data_property_value (slot_p);
+
+            if (ecma_is_value_object (value))
+            {
+              ecma_gc_set_object_gray (ecma_get_object_from_value (value));
+            }
+          }
         }
       }
       else
@@ -323,11 +783,26 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
         JERRY_ASSERT (property_p->flags & ECMA_PROPERTY_FLAG_INTERNAL);
 
         ecma_internal_property_id_t property_id = (ecma_internal_property_id_t) property_p->h.internal_property_type;
-        uint32_t property_value = property_p->v.internal_property.value;
+        ecma_value_t property_value = property_p->v.internal_property.value;
 
         switch (property_id)
         {
-          case ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES: /* a collection of ecma values */
+          case ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES: /* compressed pointer to a ecma_array_elements_t */
+          {
+            ecma_array_elements_t *elements_p = ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t, property_value);
+            ecma_value_t *values_p = ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p);
+
+            for (uint32_t index = 0; index < elements_p->length; index++)
+            {
+              if (ecma_is_value_object (values_p[index]))
+              {
+                ecma_gc_set_object_gray (ecma_get_object_from_value (values_p[index]));
+              }
+            }
+
+            break;
+          }
+
           case ECMA_INTERNAL_PROPERTY_STRING_INDEXED_ARRAY_VALUES: /* a collection of ecma values */
           {
             JERRY_UNIMPLEMENTED ("Indexed array storage is not implemented yet.");
@@ -348,6 +823,7 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
           case ECMA_INTERNAL_PROPERTY_PRIMITIVE_BOOLEAN_VALUE: /* a simple boolean value */
           case ECMA_INTERNAL_PROPERTY_CLASS: /* an enum */
           case ECMA_INTERNAL_PROPERTY_CODE_BYTECODE: /* compressed pointer to a bytecode array */
+          case ECMA_INTERNAL_PROPERTY_PROPERTY_HASHMAP: /* compressed pointer to a property hashmap */
           case ECMA_INTERNAL_PROPERTY_NATIVE_CODE: /* an external pointer */
           case ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE: /* an external pointer */
           case ECMA_INTERNAL_PROPERTY_FREE_CALLBACK: /* an object's native free callback */
@@ -357,17 +833,27 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
           case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_0_31: /* an integer (bit-mask) */
           case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_32_63: /* an integer (bit-mask) */
           case ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE:
+          case ECMA_INTERNAL_PROPERTY_ARRAYBUFFER: /* compressed pointer to a ecma_arraybuffer_t */
           {
             break;
           }
 
-          case ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_BOUND_THIS: /* an ecma value */
+          case ECMA_INTERNAL_PROPERTY_ARRAYBUFFER_VIEW: /* compressed pointer to a ecma_arraybuffer_view_t */
           {
-            if (ecma_is_value_object (property_value))
-            {
+            ecma_arraybuffer_view_t *view_p = ECMA_GET_NON_NULL_POINTER (ecma_arraybuffer_view_t, property_value);
+
+            ecma_gc_set_object_gray (ECMA_GET_NON_NULL_POINTER (ecma_object_t, view_p->arraybuffer_cp));
+
+            break;
+          }
+
+          case ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_BOUND_THIS: /* an ecma value */
+          {
+            if (ecma_is_value_object (property_value))
+            {
               ecma_object_t *obj_p = ecma_get_object_from_value (property_value);
 
-              ecma_gc_set_object_visited (obj_p, true);
+              ecma_gc_set_object_gray (obj_p);
             }
 
             break;
@@ -390,7 +876,7 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
               {
                 ecma_object_t *obj_p = ecma_get_object_from_value (*bound_args_iterator.current_value_p);
 
-                ecma_gc_set_object_visited (obj_p, true);
+                ecma_gc_set_object_gray (obj_p);
               }
             }
 
@@ -403,18 +889,28 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
           {
             ecma_object_t *obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, property_value);
 
-            ecma_gc_set_object_visited (obj_p, true);
+            ecma_gc_set_object_gray (obj_p);
 
             break;
           }
         }
       }
     }
+
+    if (named_properties_number < CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTIES / 2
+        && ecma_property_hashmap_get (object_p) != NULL)
+    {
+      /* The object became small again */
+      ecma_property_hashmap_free (object_p);
+    }
   }
 } /* ecma_gc_mark */
 
 /**
  * Free specified object
+ *
+ * Note:
+ *      the inline caches should be invalidated before the sweeping, that frees the object, is started
  */
 void
 ecma_gc_sweep (ecma_object_t *object_p) /**< object to free */
@@ -461,95 +957,686 @@ ecma_gc_sweep (ecma_object_t *object_p) /**< object to free */
   JERRY_ASSERT (ecma_gc_objects_number > 0);
   ecma_gc_objects_number--;
 
+  ecma_gc_api_stats.swept_objects++;
+
   ecma_dealloc_object (object_p);
 } /* ecma_gc_sweep */
 
 /**
- * Run garbage collecting
+ * Get current time for the garbage collector's time budget and statistics
+ *
+ * @return time, in microseconds
+ */
+static size_t
+ecma_gc_get_time_us (void)
+{
+  struct timeval tv;
+  tv.tv_sec = 0;
+  tv.tv_usec = 0;
+
+  gettimeofday (&tv, NULL);
+
+  return (size_t) (tv.tv_sec * 1000000u + tv.tv_usec);
+} /* ecma_gc_get_time_us */
+
+/**
+ * Start a garbage collector's pause: invoke the embedder's callback, and start measuring the pause
+ */
+static void
+ecma_gc_start_pause (ecma_gc_pause_t *pause_p, /**< [out] description of the pause */
+                     jerry_api_gc_pause_kind_t kind) /**< kind of the pause */
+{
+  jerry_dispatch_gc_callback (true, kind);
+
+  pause_p->kind = kind;
+  pause_p->start_used_size = ecma_gc_get_used_memory_size ();
+  pause_p->start_time_us = ecma_gc_get_time_us ();
+} /* ecma_gc_start_pause */
+
+/**
+ * Finish a garbage collector's pause: account it in the statistics, and invoke the embedder's callback
+ */
+static void
+ecma_gc_finish_pause (const ecma_gc_pause_t *pause_p) /**< description of the pause */
+{
+  const size_t pause_us = ecma_gc_get_time_us () - pause_p->start_time_us;
+  const size_t used_size = ecma_gc_get_used_memory_size ();
+
+  if (used_size < pause_p->start_used_size)
+  {
+    ecma_gc_api_stats.reclaimed_bytes += pause_p->start_used_size - used_size;
+  }
+
+  ecma_gc_api_stats.pause_sum_us += pause_us;
+  ecma_gc_api_stats.pause_max_us = JERRY_MAX (ecma_gc_api_stats.pause_max_us, pause_us);
+
+  uint32_t bucket = 0;
+
+  while (bucket + 1 < JERRY_API_GC_PAUSE_HISTOGRAM_SIZE
+         && pause_us >= ((size_t) JERRY_API_GC_PAUSE_HISTOGRAM_MIN_US << bucket))
+  {
+    bucket++;
+  }
+
+  ecma_gc_api_stats.pause_histogram[bucket]++;
+
+  switch (pause_p->kind)
+  {
+    case JERRY_API_GC_PAUSE_MINOR:
+    {
+      ecma_gc_api_stats.minor_gc_count++;
+#ifdef MEM_STATS
+      ecma_gc_stats.minor_gc_pause_sum_us += pause_us;
+      ecma_gc_stats.minor_gc_max_pause_us = JERRY_MAX (ecma_gc_stats.minor_gc_max_pause_us, pause_us);
+#endif /* MEM_STATS */
+      break;
+    }
+    case JERRY_API_GC_PAUSE_MAJOR:
+    {
+      ecma_gc_api_stats.major_gc_count++;
+#ifdef MEM_STATS
+      ecma_gc_stats.major_gc_pause_sum_us += pause_us;
+      ecma_gc_stats.major_gc_max_pause_us = JERRY_MAX (ecma_gc_stats.major_gc_max_pause_us, pause_us);
+#endif /* MEM_STATS */
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (pause_p->kind == JERRY_API_GC_PAUSE_INCREMENTAL_SLICE);
+
+      ecma_gc_api_stats.incremental_slice_count++;
+#ifdef MEM_STATS
+      ecma_gc_stats.incremental_slice_pause_sum_us += pause_us;
+      ecma_gc_stats.incremental_slice_max_pause_us = JERRY_MAX (ecma_gc_stats.incremental_slice_max_pause_us,
+                                                                pause_us);
+#endif /* MEM_STATS */
+      break;
+    }
+  }
+
+  jerry_dispatch_gc_callback (false, pause_p->kind);
+} /* ecma_gc_finish_pause */
+
+/**
+ * Get the garbage collector's statistics
  */
 void
-ecma_gc_run (void)
+ecma_gc_get_stats (jerry_api_gc_stats_t *out_stats_p) /**< [out] statistics */
 {
-  ecma_gc_new_objects_since_last_gc = 0;
+  *out_stats_p = ecma_gc_api_stats;
+} /* ecma_gc_get_stats */
+
+#ifdef MEM_STATS
+/**
+ * Print the garbage collector's statistics
+ */
+void
+ecma_gc_stats_print (void)
+{
+  printf ("GC stats:\n"
+          "  Minor collections = %zu\n"
+          "  Minor collections' pause: total = %zu us, max = %zu us\n"
+          "  Major collections = %zu\n"
+          "  Major collections' pause: total = %zu us, max = %zu us\n"
+          "  Promoted objects = %zu\n"
+          "  Incremental collections = %zu\n"
+          "  Incremental slices = %zu\n"
+          "  Incremental slices' pause: total = %zu us, max = %zu us\n"
+          "  Marked objects = %zu, swept objects = %zu, reclaimed = %zu bytes\n"
+          "  Trigger requests = %zu, collections started = %zu\n"
+          "  Trigger heap usage after last collection = %zu bytes, limit = %zu bytes\n",
+          ecma_gc_api_stats.minor_gc_count,
+          ecma_gc_stats.minor_gc_pause_sum_us,
+          ecma_gc_stats.minor_gc_max_pause_us,
+          ecma_gc_api_stats.major_gc_count,
+          ecma_gc_stats.major_gc_pause_sum_us,
+          ecma_gc_stats.major_gc_max_pause_us,
+          ecma_gc_stats.promoted_objects,
+          ecma_gc_api_stats.incremental_gc_count,
+          ecma_gc_api_stats.incremental_slice_count,
+          ecma_gc_stats.incremental_slice_pause_sum_us,
+          ecma_gc_stats.incremental_slice_max_pause_us,
+          ecma_gc_api_stats.marked_objects,
+          ecma_gc_api_stats.swept_objects,
+          ecma_gc_api_stats.reclaimed_bytes,
+          ecma_gc_stats.trigger_requests_count,
+          ecma_gc_stats.trigger_collections_count,
+          ecma_gc_live_heap_size,
+          ecma_gc_heap_usage_limit);
+
+  printf ("  Pauses histogram:\n");
+
+  size_t bound_us = JERRY_API_GC_PAUSE_HISTOGRAM_MIN_US;
+
+  for (uint32_t bucket = 0; bucket + 1 < JERRY_API_GC_PAUSE_HISTOGRAM_SIZE; bucket++)
+  {
+    printf ("    < %zu us: %zu\n", bound_us, ecma_gc_api_stats.pause_histogram[bucket]);
+    bound_us *= 2;
+  }
 
-  JERRY_ASSERT (ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] == NULL);
+  printf ("    >= %zu us: %zu\n\n",
+          bound_us / 2,
+          ecma_gc_api_stats.pause_histogram[JERRY_API_GC_PAUSE_HISTOGRAM_SIZE - 1]);
+} /* ecma_gc_stats_print */
+#endif /* MEM_STATS */
 
-  /* if some object is referenced from stack or globals (i.e. it is root), mark it */
-  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY];
+/**
+ * Mark objects of the generation, that are referenced from stack or globals (i.e. are roots),
+ * and all objects, reachable from them
+ */
+static void
+ecma_gc_mark_roots (uint32_t generation) /**< generation */
+{
+  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[generation];
        obj_iter_p != NULL;
        obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
   {
-    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
-
     if (ecma_gc_get_object_refs (obj_iter_p) > 0)
     {
-      ecma_gc_set_object_visited (obj_iter_p, true);
+      ecma_gc_set_object_gray (obj_iter_p);
+      ecma_gc_process_mark_stack ();
     }
   }
+} /* ecma_gc_mark_roots */
 
-  bool marked_anything_during_current_iteration = false;
-
-  do
+/**
+ * Mark references of visited objects of the generation again, so that gray objects,
+ * that didn't fit into the mark stack, are processed
+ */
+static void
+ecma_gc_mark_visited (uint32_t generation) /**< generation */
+{
+  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[generation];
+       obj_iter_p != NULL;
+       obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
   {
-    marked_anything_during_current_iteration = false;
+    if (ecma_gc_is_object_visited (obj_iter_p))
+    {
+      ecma_gc_mark (obj_iter_p);
+      ecma_gc_process_mark_stack ();
+    }
+  }
+} /* ecma_gc_mark_visited */
+
+/**
+ * Start marking of a major collection
+ */
+static void
+ecma_gc_start_marking (void)
+{
+  JERRY_ASSERT (!ecma_gc_is_marking);
+  JERRY_ASSERT (ecma_gc_mark_stack_depth == 0 && !ecma_gc_mark_stack_overflow);
+
+  ecma_gc_is_minor_collection = false;
+
+  /* All objects are traced, so references from old objects to young ones are found anyway */
+  ecma_gc_clear_remembered_set ();
+
+  ecma_gc_roots_scan_generation = 0;
+  ecma_gc_roots_scan_object_p = ecma_gc_objects_lists[0];
+
+  ecma_gc_is_marking = true;
+} /* ecma_gc_start_marking */
+
+/**
+ * Cancel marking of a major collection, which was started incrementally
+ *
+ * Objects, that became unreachable since start of the marking, could be already marked,
+ * so the marking is restarted, when the most of memory should be freed.
+ */
+static void
+ecma_gc_cancel_marking (void)
+{
+  JERRY_ASSERT (ecma_gc_is_marking);
 
-    for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY], *obj_prev_p = NULL, *obj_next_p;
+  for (uint32_t generation = 0; generation < ECMA_GC_GENERATIONS_NUMBER; generation++)
+  {
+    for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[generation];
          obj_iter_p != NULL;
-         obj_iter_p = obj_next_p)
+         obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
     {
-      obj_next_p = ecma_gc_get_object_next (obj_iter_p);
+      ecma_gc_set_object_visited (obj_iter_p, false);
+    }
+  }
 
-      if (ecma_gc_is_object_visited (obj_iter_p))
-      {
-        /* Moving the object to list of marked objects */
-        ecma_gc_set_object_next (obj_iter_p, ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK]);
-        ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = obj_iter_p;
+  ecma_gc_mark_stack_depth = 0;
+  ecma_gc_mark_stack_overflow = false;
+  ecma_gc_is_marking = false;
+} /* ecma_gc_cancel_marking */
 
-        if (likely (obj_prev_p != NULL))
-        {
-          JERRY_ASSERT (ecma_gc_get_object_next (obj_prev_p) == obj_iter_p);
+/**
+ * Continue marking of a major collection: mark references of objects from the mark stack,
+ * and scan the lists of objects for roots, when the stack is empty
+ *
+ * @return true - if the stack is empty and all roots are scanned,
+ *         false - if the specified number of objects was processed before that
+ */
+static bool
+ecma_gc_mark_incrementally (uint32_t objects_limit) /**< maximum number of objects to process */
+{
+  JERRY_ASSERT (ecma_gc_is_marking);
 
-          ecma_gc_set_object_next (obj_prev_p, obj_next_p);
-        }
-        else
-        {
-          ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = obj_next_p;
-        }
+  for (uint32_t processed_objects = 0; processed_objects < objects_limit; processed_objects++)
+  {
+    if (ecma_gc_mark_stack_depth > 0)
+    {
+      ecma_gc_mark_stack_depth--;
 
-        ecma_gc_mark (obj_iter_p);
-        marked_anything_during_current_iteration = true;
+      ecma_object_t *object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
+                                                           ecma_gc_mark_stack[ecma_gc_mark_stack_depth]);
+      ecma_gc_mark (object_p);
+    }
+    else if (ecma_gc_roots_scan_object_p != NULL)
+    {
+      /*
+       * Objects are not freed until the marking is finished, and new objects are put
+       * to the head of the list, so the scan position remains valid.
+       */
+      ecma_object_t *object_p = ecma_gc_roots_scan_object_p;
+      ecma_gc_roots_scan_object_p = ecma_gc_get_object_next (object_p);
+
+      if (ecma_gc_get_object_refs (object_p) > 0)
+      {
+        ecma_gc_set_object_gray (object_p);
       }
-      else
+    }
+    else if (ecma_gc_roots_scan_generation + 1 < ECMA_GC_GENERATIONS_NUMBER)
+    {
+      ecma_gc_roots_scan_generation++;
+      ecma_gc_roots_scan_object_p = ecma_gc_objects_lists[ecma_gc_roots_scan_generation];
+    }
+    else
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* ecma_gc_mark_incrementally */
+
+/**
+ * Continue sweeping of last major collection: free unmarked objects, and move marked ones
+ * to the old generation's list
+ *
+ * @return true - if all objects are swept,
+ *         false - if the specified number of objects was processed before that
+ */
+static bool
+ecma_gc_sweep_incrementally (uint32_t objects_limit) /**< maximum number of objects to process */
+{
+  JERRY_ASSERT (ecma_gc_is_sweeping);
+
+  uint32_t generation = 0;
+
+  for (uint32_t processed_objects = 0; processed_objects < objects_limit; processed_objects++)
+  {
+    while (ecma_gc_sweep_lists[generation] == NULL)
+    {
+      if (++generation == ECMA_GC_GENERATIONS_NUMBER)
       {
-        obj_prev_p = obj_iter_p;
+        ecma_gc_is_sweeping = false;
+
+        ecma_gc_objects_after_major_gc = ecma_gc_objects_number;
+        ecma_gc_promoted_objects_since_major_gc = 0;
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
+        /* Free RegExp bytecodes stored in cache */
+        re_cache_gc_run ();
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
+
+        ecma_intern_free_unused_names ();
+
+        ecma_gc_update_heap_usage_limit ();
+
+        return true;
       }
     }
+
+    ecma_object_t *object_p = ecma_gc_sweep_lists[generation];
+    ecma_gc_sweep_lists[generation] = ecma_gc_get_object_next (object_p);
+
+    if (ecma_gc_is_object_visited (object_p))
+    {
+      ecma_gc_set_object_visited (object_p, false);
+      ecma_gc_set_object_old (object_p, true);
+
+      ecma_gc_set_object_next (object_p, ecma_gc_objects_lists[ECMA_GC_OLD_GENERATION]);
+      ecma_gc_objects_lists[ECMA_GC_OLD_GENERATION] = object_p;
+    }
+    else
+    {
+      ecma_gc_sweep (object_p);
+    }
+  }
+
+  return false;
+} /* ecma_gc_sweep_incrementally */
+
+/**
+ * Finish marking of a major collection, and start sweeping
+ *
+ * The lists of objects are moved to the sweep lists, so objects, allocated during the sweeping,
+ * are put to empty lists.
+ */
+static void
+ecma_gc_finish_marking (void)
+{
+  JERRY_ASSERT (ecma_gc_is_marking && !ecma_gc_is_sweeping);
+  JERRY_ASSERT (ecma_gc_mark_stack_depth == 0);
+
+  /*
+   * Gray objects, that didn't fit into the mark stack, are not distinguishable from black ones,
+   * so references of all visited objects are marked again, until nothing is left unpushed.
+   */
+  while (unlikely (ecma_gc_mark_stack_overflow))
+  {
+    ecma_gc_mark_stack_overflow = false;
+
+    for (uint32_t generation = 0; generation < ECMA_GC_GENERATIONS_NUMBER; generation++)
+    {
+      ecma_gc_mark_visited (generation);
+    }
+  }
+
+  ecma_gc_is_marking = false;
+  ecma_gc_is_sweeping = true;
+
+  for (uint32_t generation = 0; generation < ECMA_GC_GENERATIONS_NUMBER; generation++)
+  {
+    ecma_gc_sweep_lists[generation] = ecma_gc_objects_lists[generation];
+    ecma_gc_objects_lists[generation] = NULL;
+  }
+
+  /*
+   * Inline caches could refer to the unmarked objects and their properties. The objects are unreachable,
+   * so no entry, created during the sweeping, refers to them, and one invalidation covers the whole sweep.
+   */
+  vm_inline_cache_invalidate_all ();
+
+#ifdef CONFIG_ECMA_GC_LAZY_SWEEP_DISABLE
+  bool is_swept = ecma_gc_sweep_incrementally (UINT32_MAX);
+  JERRY_ASSERT (is_swept);
+#endif /* CONFIG_ECMA_GC_LAZY_SWEEP_DISABLE */
+} /* ecma_gc_finish_marking */
+
+/**
+ * Run garbage collecting of all generations (major collection)
+ *
+ * If a major collection is already started incrementally, it is restarted,
+ * so that all currently unreachable objects are freed.
+ */
+void
+ecma_gc_run (void)
+{
+  ecma_gc_pause_t pause;
+  ecma_gc_start_pause (&pause, JERRY_API_GC_PAUSE_MAJOR);
+
+  bool is_completed;
+
+  if (ecma_gc_is_sweeping)
+  {
+    is_completed = ecma_gc_sweep_incrementally (UINT32_MAX);
+    JERRY_ASSERT (is_completed);
+  }
+  else if (ecma_gc_is_marking)
+  {
+    ecma_gc_cancel_marking ();
+  }
+
+  ecma_gc_start_marking ();
+
+  is_completed = ecma_gc_mark_incrementally (UINT32_MAX);
+  JERRY_ASSERT (is_completed);
+
+  ecma_gc_finish_marking ();
+
+  if (ecma_gc_is_sweeping)
+  {
+    is_completed = ecma_gc_sweep_incrementally (UINT32_MAX);
+    JERRY_ASSERT (is_completed);
+  }
+
+  ecma_gc_finish_pause (&pause);
+} /* ecma_gc_run */
+
+/**
+ * Continue incremental major collection, which is already started
+ *
+ * @return true - if the collection is completed,
+ *         false - if the specified number of objects was processed before that
+ */
+static bool
+ecma_gc_collect_incrementally (uint32_t objects_limit) /**< maximum number of objects to process */
+{
+  if (ecma_gc_is_marking)
+  {
+    if (!ecma_gc_mark_incrementally (objects_limit))
+    {
+      return false;
+    }
+
+    ecma_gc_finish_marking ();
+
+    ecma_gc_api_stats.incremental_gc_count++;
+
+    /* Sweeping is started in the next slice, so the slice's pause is not prolonged */
+    return !ecma_gc_is_sweeping;
+  }
+
+  return ecma_gc_sweep_incrementally (objects_limit);
+} /* ecma_gc_collect_incrementally */
+
+/**
+ * Run a slice of incremental major collection, which is already started
+ */
+static void
+ecma_gc_run_slice (uint32_t objects_limit) /**< maximum number of objects to process */
+{
+  ecma_gc_pause_t pause;
+  ecma_gc_start_pause (&pause, JERRY_API_GC_PAUSE_INCREMENTAL_SLICE);
+
+  ecma_gc_collect_incrementally (objects_limit);
+
+  ecma_gc_finish_pause (&pause);
+} /* ecma_gc_run_slice */
+
+/**
+ * Run a step of incremental major collection, starting a new collection, if none is in progress
+ *
+ * Marking and sweeping are continued until the time budget is exhausted.
+ *
+ * @return true - if the collection is completed by the step,
+ *         false - otherwise
+ */
+bool
+ecma_gc_step (uint32_t budget_us) /**< time budget of the step, in microseconds */
+{
+  ecma_gc_pause_t pause;
+  ecma_gc_start_pause (&pause, JERRY_API_GC_PAUSE_INCREMENTAL_SLICE);
+
+  if (!ecma_gc_is_marking && !ecma_gc_is_sweeping)
+  {
+    ecma_gc_start_marking ();
+  }
+
+  bool is_completed;
+
+  do
+  {
+    is_completed = ecma_gc_collect_incrementally (ECMA_GC_STEP_TIME_CHECK_INTERVAL);
+  }
+  while (!is_completed
+         && ecma_gc_get_time_us () - pause.start_time_us < budget_us);
+
+  ecma_gc_finish_pause (&pause);
+
+  return is_completed;
+} /* ecma_gc_step */
+
+/**
+ * Check whether the object references young objects
+ *
+ * Note:
+ *      all live young objects should be marked
+ *
+ * @return true - if the object references young objects,
+ *         false - otherwise
+ */
+static bool
+ecma_gc_is_young_object_referenced (ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (ecma_gc_is_minor_collection);
+
+  ecma_gc_young_reference_found = false;
+  ecma_gc_mark (object_p);
+
+  /* the referenced young objects are already visited, so nothing is pushed */
+  JERRY_ASSERT (ecma_gc_mark_stack_depth == 0);
+
+  return ecma_gc_young_reference_found;
+} /* ecma_gc_is_young_object_referenced */
+
+/**
+ * Run garbage collecting of the young generations (minor collection)
+ *
+ * Only young objects are traced, starting from the young roots and the remembered set,
+ * and only young objects are freed. Survivors are moved to the next generation.
+ */
+static void
+ecma_gc_run_minor (void)
+{
+  ecma_gc_pause_t pause;
+  ecma_gc_start_pause (&pause, JERRY_API_GC_PAUSE_MINOR);
+
+  JERRY_ASSERT (!ecma_gc_remembered_set_overflow);
+  JERRY_ASSERT (!ecma_gc_is_marking && !ecma_gc_is_sweeping);
+
+  ecma_gc_is_minor_collection = true;
+
+  for (uint32_t generation = 0; generation < ECMA_GC_OLD_GENERATION; generation++)
+  {
+    ecma_gc_mark_roots (generation);
+  }
+
+  for (uint32_t i = 0; i < ecma_gc_remembered_set_count; i++)
+  {
+    ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_remembered_set[i]));
+    ecma_gc_process_mark_stack ();
+  }
+
+  while (unlikely (ecma_gc_mark_stack_overflow))
+  {
+    ecma_gc_mark_stack_overflow = false;
+
+    for (uint32_t generation = 0; generation < ECMA_GC_OLD_GENERATION; generation++)
+    {
+      ecma_gc_mark_visited (generation);
+    }
   }
-  while (marked_anything_during_current_iteration);
 
-  /* Sweeping objects that are currently unmarked */
-  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY], *obj_next_p;
+  /* Inline caches could refer to the young objects, that are freed below */
+  vm_inline_cache_invalidate_all ();
+
+  /* Promoting survivors of the oldest young generation */
+  size_t promoted_objects_number = 0;
+
+  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_OLD_GENERATION - 1], *obj_next_p;
        obj_iter_p != NULL;
        obj_iter_p = obj_next_p)
   {
     obj_next_p = ecma_gc_get_object_next (obj_iter_p);
 
-    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+    if (ecma_gc_is_object_visited (obj_iter_p))
+    {
+      ecma_gc_set_object_old (obj_iter_p, true);
+
+      ecma_gc_set_object_next (obj_iter_p, ecma_gc_objects_lists[ECMA_GC_OLD_GENERATION]);
+      ecma_gc_objects_lists[ECMA_GC_OLD_GENERATION] = obj_iter_p;
 
-    ecma_gc_sweep (obj_iter_p);
+      promoted_objects_number++;
+    }
+    else
+    {
+      ecma_gc_sweep (obj_iter_p);
+    }
   }
 
-  /* Unmarking all objects */
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK];
-  ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
+  ecma_gc_objects_lists[ECMA_GC_OLD_GENERATION - 1] = NULL;
 
-  ecma_gc_visited_flip_flag = !ecma_gc_visited_flip_flag;
+  /* Removing objects, that don't reference young objects anymore, from the remembered set */
+  uint32_t remembered_set_count = 0;
 
-#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
-  /* Free RegExp bytecodes stored in cache */
-  re_cache_gc_run ();
-#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
-} /* ecma_gc_run */
+  for (uint32_t i = 0; i < ecma_gc_remembered_set_count; i++)
+  {
+    ecma_object_t *object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_remembered_set[i]);
+
+    if (ecma_gc_is_young_object_referenced (object_p))
+    {
+      ecma_gc_remembered_set[remembered_set_count++] = ecma_gc_remembered_set[i];
+    }
+    else
+    {
+      ecma_gc_set_object_remembered (object_p, false);
+    }
+  }
+
+  ecma_gc_remembered_set_count = remembered_set_count;
+
+  /* Adding promoted objects, that reference young objects, to the remembered set, and unmarking them */
+  ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_OLD_GENERATION];
+
+  for (size_t i = 0; i < promoted_objects_number; i++)
+  {
+    if (ecma_gc_is_young_object_referenced (obj_iter_p))
+    {
+      ecma_gc_remember_object (obj_iter_p);
+    }
+
+    ecma_gc_set_object_visited (obj_iter_p, false);
+
+    obj_iter_p = ecma_gc_get_object_next (obj_iter_p);
+  }
+
+  /* Moving survivors of other young generations to the next generation, and unmarking them */
+  for (uint32_t generation = ECMA_GC_OLD_GENERATION - 1; generation > 0; generation--)
+  {
+    JERRY_ASSERT (ecma_gc_objects_lists[generation] == NULL);
+
+    for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[generation - 1], *obj_next_p;
+         obj_iter_p != NULL;
+         obj_iter_p = obj_next_p)
+    {
+      obj_next_p = ecma_gc_get_object_next (obj_iter_p);
+
+      if (ecma_gc_is_object_visited (obj_iter_p))
+      {
+        ecma_gc_set_object_visited (obj_iter_p, false);
+
+        ecma_gc_set_object_next (obj_iter_p, ecma_gc_objects_lists[generation]);
+        ecma_gc_objects_lists[generation] = obj_iter_p;
+      }
+      else
+      {
+        ecma_gc_sweep (obj_iter_p);
+      }
+    }
+
+    ecma_gc_objects_lists[generation - 1] = NULL;
+  }
+
+  ecma_gc_is_minor_collection = false;
+  ecma_gc_promoted_objects_since_major_gc += promoted_objects_number;
+
+  ecma_intern_free_unused_names ();
+
+  ecma_gc_update_heap_usage_limit ();
+
+#ifdef MEM_STATS
+  ecma_gc_stats.promoted_objects += promoted_objects_number;
+#endif /* MEM_STATS */
+
+  ecma_gc_finish_pause (&pause);
+} /* ecma_gc_run_minor */
 
 /**
  * Try to free some memory (depending on severity).
@@ -560,13 +1647,49 @@ ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity)
 {
   if (severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_LOW)
   {
-    /*
-     * If there is enough newly allocated objects since last GC, probably it is worthwhile to start GC now.
-     * Otherwise, probability to free sufficient space is considered to be low.
-     */
-    if (ecma_gc_new_objects_since_last_gc * CONFIG_ECMA_GC_NEW_OBJECTS_SHARE_TO_START_GC > ecma_gc_objects_number)
+    if (ecma_gc_is_marking || ecma_gc_is_sweeping)
     {
-      ecma_gc_run ();
+      /* Unmarked objects, pending to be swept, are freed on demand */
+      ecma_gc_run_slice (CONFIG_ECMA_GC_INCREMENTAL_SLICE_SIZE);
+    }
+    else
+    {
+#ifdef MEM_STATS
+      ecma_gc_stats.trigger_requests_count++;
+#endif /* MEM_STATS */
+
+      /*
+       * If heap usage has grown enough since last GC, probably it is worthwhile to start GC now.
+       * Otherwise, probability to free sufficient space is considered to be low.
+       *
+       * The growth is measured in bytes, so memory, used by strings, collections and byte-code,
+       * is accounted in addition to the objects, and is measured relatively to the heap usage
+       * after the GC, so that GC is run less often, if most of the memory survives it.
+       */
+      if (ecma_gc_get_used_memory_size () >= ecma_gc_heap_usage_limit)
+      {
+#ifdef MEM_STATS
+        ecma_gc_stats.trigger_collections_count++;
+#endif /* MEM_STATS */
+
+        /*
+         * Old objects are collected only by major collections, so a major collection is started
+         * as soon as the old generation was doubled since last major collection, or the remembered set overflowed.
+         *
+         * The major collection is performed incrementally, in slices, upon next requests and object allocations,
+         * and unmarked objects are swept lazily in the same way.
+         */
+        if (ecma_gc_remembered_set_overflow
+            || ecma_gc_promoted_objects_since_major_gc > ecma_gc_objects_after_major_gc)
+        {
+          ecma_gc_start_marking ();
+          ecma_gc_run_slice (CONFIG_ECMA_GC_INCREMENTAL_SLICE_SIZE);
+        }
+        else
+        {
+          ecma_gc_run_minor ();
+        }
+      }
     }
   }
   else
@@ -24,15 +24,24 @@
 #define ECMA_GC_H
 
 #include "ecma-globals.h"
+#include "jerry-api.h"
 #include "mem-allocator.h"
 
 extern void ecma_gc_init (void);
+extern void ecma_gc_set_policy (uint32_t, size_t);
 extern void ecma_init_gc_info (ecma_object_t *);
 extern void ecma_ref_object (ecma_object_t *);
 extern void ecma_deref_object (ecma_object_t *);
+extern void ecma_gc_write_barrier (ecma_object_t *);
 extern void ecma_gc_run (void);
+extern bool ecma_gc_step (uint32_t);
+extern void ecma_gc_get_stats (jerry_api_gc_stats_t *);
 extern void ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t);
 
+#ifdef MEM_STATS
+extern void ecma_gc_stats_print (void);
+#endif /* MEM_STATS */
+
 #endif /* !ECMA_GC_H */
 
 /**
@@ -57,7 +57,7 @@
 typedef enum
 {
   ECMA_TYPE_SIMPLE, /**< simple value */
-  ECMA_TYPE_NUMBER, /**< 64-bit integer */
+  ECMA_TYPE_NUMBER, /**< integer, stored in the value, or pointer to an ecma-number */
   ECMA_TYPE_STRING, /**< pointer to description of a string */
   ECMA_TYPE_OBJECT /**< pointer to description of an object */
 } ecma_type_t;
@@ -83,10 +83,16 @@ typedef enum
   ECMA_SIMPLE_VALUE__COUNT /** count of simple ecma values */
 } ecma_simple_value_t;
 
+#ifndef CONFIG_ECMA_VALUE_NAN_BOXING
+
 /**
  * Description of an ecma value
  *
- * Bit-field structure: type (2) | error (1) | value (ECMA_POINTER_FIELD_WIDTH)
+ * Bit-field structure: type (2) | error (1) | integer (1) | value (ECMA_POINTER_FIELD_WIDTH)
+ *
+ * Numbers with the integer flag set store their value in the bits above the flag
+ * (see also: ECMA_INTEGER_NUMBER_MIN, ECMA_INTEGER_NUMBER_MAX), instead of a compressed pointer
+ * to a heap-allocated ecma_number_t.
  */
 typedef uint32_t ecma_value_t;
 
@@ -103,11 +109,18 @@ typedef uint32_t ecma_value_t;
                               ECMA_VALUE_TYPE_WIDTH)
 #define ECMA_VALUE_ERROR_WIDTH (1)
 
+/**
+ * Value is a number, stored in the value itself (boolean)
+ */
+#define ECMA_VALUE_INTEGER_POS (ECMA_VALUE_ERROR_POS + \
+                                ECMA_VALUE_ERROR_WIDTH)
+#define ECMA_VALUE_INTEGER_WIDTH (1)
+
 /**
  * Simple value (ecma_simple_value_t) or compressed pointer to value (depending on value_type)
  */
-#define ECMA_VALUE_VALUE_POS (ECMA_VALUE_ERROR_POS + \
-                              ECMA_VALUE_ERROR_WIDTH)
+#define ECMA_VALUE_VALUE_POS (ECMA_VALUE_INTEGER_POS + \
+                              ECMA_VALUE_INTEGER_WIDTH)
 #define ECMA_VALUE_VALUE_WIDTH (ECMA_POINTER_FIELD_WIDTH)
 
 /**
@@ -115,6 +128,91 @@ typedef uint32_t ecma_value_t;
  */
 #define ECMA_VALUE_SIZE (ECMA_VALUE_VALUE_POS + ECMA_VALUE_VALUE_WIDTH)
 
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+
+/**
+ * Description of a NaN-boxed ecma value
+ *
+ * The value is either a 64-bit float number (NaNs being represented by ECMA_VALUE_NAN_BOXING_NAN),
+ * or a boxed value, i.e. bit pattern of a negative quiet NaN, which is never produced by the representation
+ * of numbers.
+ *
+ * Bit-field structure of boxed values: value (48) | type (2) | error (1) | tag (13)
+ *
+ * The value field of a boxed value contains a simple value (ecma_simple_value_t), or a full pointer
+ * to a string or an object. Numbers are boxed only in error values (and in values, extracted from error values),
+ * the value field pointing to a heap-allocated ecma_number_t, as an error value cannot be a float number.
+ */
+typedef uint64_t ecma_value_t;
+
+/**
+ * Simple value (ecma_simple_value_t) or pointer to value (depending on value_type)
+ */
+#define ECMA_VALUE_VALUE_POS (0)
+#define ECMA_VALUE_VALUE_WIDTH (48)
+
+/**
+ * Value type (ecma_type_t)
+ */
+#define ECMA_VALUE_TYPE_POS (ECMA_VALUE_VALUE_POS + \
+                             ECMA_VALUE_VALUE_WIDTH)
+#define ECMA_VALUE_TYPE_WIDTH (2)
+
+/**
+ * Value is error (boolean)
+ */
+#define ECMA_VALUE_ERROR_POS (ECMA_VALUE_TYPE_POS + \
+                              ECMA_VALUE_TYPE_WIDTH)
+#define ECMA_VALUE_ERROR_WIDTH (1)
+
+/**
+ * Tag, marking boxed values (sign bit, exponent bits and quiet bit of 64-bit float numbers are all set)
+ */
+#define ECMA_VALUE_NAN_BOXING_TAG (0xfff8ull << 48)
+
+/**
+ * Representation of NaN numbers
+ */
+#define ECMA_VALUE_NAN_BOXING_NAN (0x7ff8ull << 48)
+
+/**
+ * Size of ecma value description, in bits
+ */
+#define ECMA_VALUE_SIZE (64)
+
+#endif /* !CONFIG_ECMA_VALUE_NAN_BOXING */
+
+/**
+ * Type of integer numbers, stored in ecma values
+ */
+typedef int32_t ecma_integer_value_t;
+
+/**
+ * Width of integer numbers, stored in ecma values
+ *
+ * Note:
+ *      with 16-bit compressed pointers, named data properties keep only the lower 24 bits of the values
+ */
+#ifdef CONFIG_ECMA_VALUE_NAN_BOXING
+/* NaN-boxed values store every number without allocation, so integer numbers are never stored in a special way,
+ * and the range only bounds the (never taken) integer fast paths */
+#define ECMA_INTEGER_NUMBER_WIDTH (31)
+#elif defined (CONFIG_MEM_CPOINTER_32_BIT)
+#define ECMA_INTEGER_NUMBER_WIDTH (sizeof (ecma_value_t) * JERRY_BITSINBYTE - ECMA_VALUE_VALUE_POS)
+#else /* !CONFIG_ECMA_VALUE_NAN_BOXING && !CONFIG_MEM_CPOINTER_32_BIT */
+#define ECMA_INTEGER_NUMBER_WIDTH (24 - ECMA_VALUE_VALUE_POS)
+#endif /* CONFIG_ECMA_VALUE_NAN_BOXING */
+
+/**
+ * Minimum integer number, that is stored in an ecma value
+ */
+#define ECMA_INTEGER_NUMBER_MIN (-(ecma_integer_value_t) (1u << (ECMA_INTEGER_NUMBER_WIDTH - 1)))
+
+/**
+ * Maximum integer number, that is stored in an ecma value
+ */
+#define ECMA_INTEGER_NUMBER_MAX ((ecma_integer_value_t) (1u << (ECMA_INTEGER_NUMBER_WIDTH - 1)) - 1)
+
 /**
  * Internal properties' identifiers.
  */
@@ -133,7 +231,7 @@ typedef enum
   ECMA_INTERNAL_PROPERTY_PRIMITIVE_NUMBER_VALUE, /**< [[Primitive value]] for Number objects */
   ECMA_INTERNAL_PROPERTY_PRIMITIVE_BOOLEAN_VALUE, /**< [[Primitive value]] for Boolean objects */
 
-  /** Part of an array, that is indexed by numbers */
+  /** Part of an array, that is indexed by numbers (see also: ecma_array_elements_t) */
   ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES,
 
   /** Part of an array, that is indexed by strings */
@@ -170,6 +268,21 @@ typedef enum
    */
   ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE,
 
+  /**
+   * Backing store of an ArrayBuffer object (see also: ecma_arraybuffer_t)
+   */
+  ECMA_INTERNAL_PROPERTY_ARRAYBUFFER,
+
+  /**
+   * Description of a typed array or DataView object (see also: ecma_arraybuffer_view_t)
+   */
+  ECMA_INTERNAL_PROPERTY_ARRAYBUFFER_VIEW,
+
+  /**
+   * Hashmap of named properties of the property list (see also: ecma_property_hashmap_t)
+   */
+  ECMA_INTERNAL_PROPERTY_PROPERTY_HASHMAP,
+
   /**
    * Number of internal properties' types
    */
@@ -215,6 +328,8 @@ typedef enum
   ECMA_PROPERTY_FLAG_ENUMERABLE = 1u << 4, /**< property is enumerable */
   ECMA_PROPERTY_FLAG_WRITABLE = 1u << 5, /**< property is writable */
   ECMA_PROPERTY_FLAG_LCACHED = 1u << 6, /**< property is lcached */
+  ECMA_PROPERTY_FLAG_SHAPED = 1u << 7, /**< property is stored in a slot of a shaped object
+                                        *   (or, without the type flags, the record is the slots' header) */
 } ecma_property_flags_t;
 
 /**
@@ -231,21 +346,21 @@ typedef struct
  */
 typedef struct ecma_property_t
 {
-  /** Compressed pointer to next property */
-  mem_cpointer_t next_property_p;
-
   /** Property's flags (ecma_property_flags_t) */
   uint8_t flags;
 
   /** Property's header part (depending on Type) */
   union
   {
-    /** Named data property value upper bits */
+    /** Named data property value upper bits (only used with 16-bit compressed pointers) */
     uint8_t named_data_property_value_high;
     /** Internal property type */
     uint8_t internal_property_type;
   } h;
 
+  /** Compressed pointer to next property */
+  mem_cpointer_t next_property_p;
+
   /** Property's value part (depending on Type) */
   union
   {
@@ -255,8 +370,13 @@ typedef struct ecma_property_t
       /** Compressed pointer to property's name (pointer to String) */
       mem_cpointer_t name_p;
 
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
       /** Lower 16 bits of value */
       uint16_t value_low;
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+      /** Value */
+      ecma_value_t value;
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
     } named_data_property;
 
     /** Description of named accessor property (second part) */
@@ -272,12 +392,113 @@ typedef struct ecma_property_t
     /** Description of internal property (second part) */
     struct
     {
-      /** Value (may be a compressed pointer) */
+#ifndef CONFIG_ECMA_VALUE_NAN_BOXING
+      /** Value (may be a compressed pointer, or an ecma value) */
       uint32_t value;
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+      /** Value (may be a compressed pointer, or an ecma value) */
+      ecma_value_t value;
+#endif /* !CONFIG_ECMA_VALUE_NAN_BOXING */
     } internal_property;
   } v;
 } ecma_property_t;
 
+/**
+ * Description of a shape (hidden class), i.e. of a layout of named data properties,
+ * shared by objects, that got the same properties in the same order
+ *
+ * Shapes form a transition tree: each shape describes one property, and its ancestors - the preceding ones.
+ */
+typedef struct
+{
+  mem_cpointer_t parent_cp; /**< shape, describing the preceding properties (NULL - if the property is the first) */
+  mem_cpointer_t name_cp; /**< name of the property */
+  mem_cpointer_t children_cp; /**< first of the shapes, transitioned from the shape */
+  mem_cpointer_t next_sibling_cp; /**< next shape, transitioned from the same parent */
+  uint32_t refs; /**< number of objects and child shapes, referencing the shape */
+  uint8_t index; /**< index of the property's slot */
+  uint8_t children_number; /**< number of the shapes, transitioned from the shape */
+} ecma_shape_t;
+
+/**
+ * Slot of a shaped object, containing value and attributes of a named data property, described by the shape
+ *
+ * Layout of the flags and the value upper bits matches the one of ecma_property_t,
+ * so pointers to slots are used as ecma_property_t pointers (see also: ECMA_PROPERTY_FLAG_SHAPED).
+ */
+typedef struct
+{
+  /** Property's flags (ecma_property_flags_t) - zero, if the property was deleted */
+  uint8_t flags;
+
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+  /** Upper bits of value */
+  uint8_t value_high;
+
+  /** Lower 16 bits of value */
+  uint16_t value_low;
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+  /** Value */
+  ecma_value_t value;
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
+} ecma_property_slot_t;
+
+/**
+ * Header of a shaped object's slots, linked to the object's property list as the list's first record
+ *
+ * The slots are placed right after the header.
+ */
+typedef struct
+{
+  /** ECMA_PROPERTY_FLAG_SHAPED, without the property type flags */
+  uint8_t flags;
+
+  /** Number of used slots, i.e. of the properties, described by the shape */
+  uint8_t slots_number;
+
+  /** Compressed pointer to next property - placed at the same offset, as in ecma_property_t */
+  mem_cpointer_t next_property_p;
+
+  /** Compressed pointer to the shape */
+  mem_cpointer_t shape_cp;
+
+  /** Number of allocated slots */
+  uint8_t slots_capacity;
+
+  /**
+   * Flag, indicating that new named data properties are not added to the shape anymore,
+   * but stored in the property list, as the shape can't be extended, or a property was deleted
+   * (so that enumeration order of properties is kept).
+   */
+  uint8_t is_closed;
+} ecma_property_slots_header_t;
+
+/**
+ * Header of dense storage of an array's elements
+ *
+ * Arrays are created with the storage, referenced by ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES property,
+ * and keep it as long as all their elements are writable, enumerable and configurable named data properties,
+ * and the elements are not too sparse. Values of the elements with indices less than length are placed
+ * right after the header, holes being marked with ECMA_SIMPLE_VALUE_ARRAY_HOLE, and elements with greater indices
+ * are holes. The array's property list contains no elements, while the storage exists, and the storage's
+ * internal property is the first property of the list (not counting the property hashmap).
+ */
+typedef struct
+{
+  uint32_t length; /**< number of the stored values (including the holes), not greater than the array's length */
+  uint32_t capacity; /**< number of the values, the storage is allocated for */
+} ecma_array_elements_t;
+
+/**
+ * Get values of array's elements, placed right after header of the dense storage
+ */
+#define ECMA_ARRAY_ELEMENTS_GET_VALUES(elements_p) ((ecma_value_t *) ((elements_p) + 1))
+
+/**
+ * Get size of dense storage of array's elements with the specified capacity
+ */
+#define ECMA_ARRAY_ELEMENTS_GET_SIZE(capacity) (sizeof (ecma_array_elements_t) + (capacity) * sizeof (ecma_value_t))
+
 /**
  * Types of lexical environments
  */
@@ -309,6 +530,26 @@ typedef enum
   // ECMA_OBJECT_TYPE_HOST /**< Host object */
 } ecma_object_type_t;
 
+/**
+ * Width of compressed pointer fields, placed in ecma_object_t's container
+ *
+ * With 32-bit compressed pointers, the pointers are stored in separate fields of ecma_object_t.
+ */
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+# define ECMA_OBJECT_CP_FIELD_WIDTH (ECMA_POINTER_FIELD_WIDTH)
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+# define ECMA_OBJECT_CP_FIELD_WIDTH (0)
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
+
+/**
+ * Container of ecma_object_t's bit-fields
+ */
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+typedef uint64_t ecma_object_container_t;
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+typedef uint32_t ecma_object_container_t;
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
+
 /**
  * Description of ECMA-object or lexical environment
  * (depending on is_lexical_environment).
@@ -321,7 +562,8 @@ typedef struct ecma_object_t
  * Compressed pointer to property list
  */
 #define ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS   (0)
-#define ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH (ECMA_POINTER_FIELD_WIDTH)
+#define ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH (ECMA_OBJECT_CP_FIELD_WIDTH)
+#define ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_FIELD properties_or_bound_object_cp
 
 /**
  * Flag indicating whether it is a general object (false)
@@ -334,17 +576,25 @@ typedef struct ecma_object_t
 /**
  * Reference counter of the object, i.e. number of references
  * to the object from stack variables.
+ *
+ * Two bits of CONFIG_ECMA_REFERENCE_COUNTER_WIDTH are occupied by the object's generation flags.
  */
 #define ECMA_OBJECT_GC_REFS_POS (ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS + \
                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH)
-#define ECMA_OBJECT_GC_REFS_WIDTH (CONFIG_ECMA_REFERENCE_COUNTER_WIDTH)
+#define ECMA_OBJECT_GC_REFS_WIDTH (CONFIG_ECMA_REFERENCE_COUNTER_WIDTH - 2)
+
+/**
+ * Maximum value of the object's reference counter
+ */
+#define ECMA_OBJECT_GC_REFS_LIMIT ((1u << ECMA_OBJECT_GC_REFS_WIDTH) - 1u)
 
 /**
  * Compressed pointer to next object in the global list of objects with same generation.
  */
 #define ECMA_OBJECT_GC_NEXT_CP_POS (ECMA_OBJECT_GC_REFS_POS + \
                                     ECMA_OBJECT_GC_REFS_WIDTH)
-#define ECMA_OBJECT_GC_NEXT_CP_WIDTH (ECMA_POINTER_FIELD_WIDTH)
+#define ECMA_OBJECT_GC_NEXT_CP_WIDTH (ECMA_OBJECT_CP_FIELD_WIDTH)
+#define ECMA_OBJECT_GC_NEXT_CP_FIELD gc_next_cp
 
 /**
  * Marker that is set if the object was visited during graph traverse.
@@ -353,14 +603,30 @@ typedef struct ecma_object_t
                                     ECMA_OBJECT_GC_NEXT_CP_WIDTH)
 #define ECMA_OBJECT_GC_VISITED_WIDTH (1)
 
+/**
+ * Flag that is set if the object survived enough minor garbage collections
+ * to be moved from the young generation to the old one.
+ */
+#define ECMA_OBJECT_GC_IS_OLD_POS (ECMA_OBJECT_GC_VISITED_POS + \
+                                   ECMA_OBJECT_GC_VISITED_WIDTH)
+#define ECMA_OBJECT_GC_IS_OLD_WIDTH (1)
+
+/**
+ * Flag that is set if the object is an old object, registered in the remembered set,
+ * i.e. if the object may reference young objects.
+ */
+#define ECMA_OBJECT_GC_IS_REMEMBERED_POS (ECMA_OBJECT_GC_IS_OLD_POS + \
+                                          ECMA_OBJECT_GC_IS_OLD_WIDTH)
+#define ECMA_OBJECT_GC_IS_REMEMBERED_WIDTH (1)
+
 
 /* Objects' only part */
 
 /**
  * Attribute 'Extensible'
  */
-#define ECMA_OBJECT_OBJ_EXTENSIBLE_POS (ECMA_OBJECT_GC_VISITED_POS + \
-                                        ECMA_OBJECT_GC_VISITED_WIDTH)
+#define ECMA_OBJECT_OBJ_EXTENSIBLE_POS (ECMA_OBJECT_GC_IS_REMEMBERED_POS + \
+                                        ECMA_OBJECT_GC_IS_REMEMBERED_WIDTH)
 #define ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH (1)
 
 /**
@@ -375,7 +641,8 @@ typedef struct ecma_object_t
  */
 #define ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS (ECMA_OBJECT_OBJ_TYPE_POS + \
                                                  ECMA_OBJECT_OBJ_TYPE_WIDTH)
-#define ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH (ECMA_POINTER_FIELD_WIDTH)
+#define ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH (ECMA_OBJECT_CP_FIELD_WIDTH)
+#define ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_FIELD prototype_or_outer_reference_cp
 
 /**
  * Flag indicating whether the object is a built-in object
@@ -396,8 +663,8 @@ typedef struct ecma_object_t
 /**
  * Type of lexical environment (ecma_lexical_environment_type_t).
  */
-#define ECMA_OBJECT_LEX_ENV_TYPE_POS (ECMA_OBJECT_GC_VISITED_POS + \
-                                        ECMA_OBJECT_GC_VISITED_WIDTH)
+#define ECMA_OBJECT_LEX_ENV_TYPE_POS (ECMA_OBJECT_GC_IS_REMEMBERED_POS + \
+                                      ECMA_OBJECT_GC_IS_REMEMBERED_WIDTH)
 #define ECMA_OBJECT_LEX_ENV_TYPE_WIDTH (1)
 
 /**
@@ -405,7 +672,8 @@ typedef struct ecma_object_t
  */
 #define ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS (ECMA_OBJECT_LEX_ENV_TYPE_POS + \
                                                     ECMA_OBJECT_LEX_ENV_TYPE_WIDTH)
-#define ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH (ECMA_POINTER_FIELD_WIDTH)
+#define ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH (ECMA_OBJECT_CP_FIELD_WIDTH)
+#define ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_FIELD prototype_or_outer_reference_cp
 
 /**
  * 'provideThis' property of object-bound lexical environments
@@ -420,9 +688,42 @@ typedef struct ecma_object_t
 #define ECMA_OBJECT_LEX_ENV_TYPE_SIZE (ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS + \
                                        ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH)
 
-  uint64_t container; /**< container for fields described above */
+  ecma_object_container_t container; /**< container for fields described above */
+
+#ifdef CONFIG_MEM_CPOINTER_32_BIT
+  mem_cpointer_t properties_or_bound_object_cp; /**< compressed pointer to property list or bound object */
+  mem_cpointer_t gc_next_cp; /**< compressed pointer to next object in the GC list */
+  mem_cpointer_t prototype_or_outer_reference_cp; /**< compressed pointer to prototype object
+                                                   *   or outer lexical environment */
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
 } ecma_object_t;
 
+/**
+ * Get compressed pointer field (see also: ECMA_OBJECT_*_CP_POS) of an object or lexical environment
+ */
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+# define ECMA_OBJECT_GET_CP_FIELD(object_p, field) \
+  ((mem_cpointer_t) JRT_EXTRACT_BIT_FIELD (ecma_object_container_t, (object_p)->container, \
+                                           ECMA_OBJECT_ ## field ## _CP_POS, \
+                                           ECMA_OBJECT_ ## field ## _CP_WIDTH))
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+# define ECMA_OBJECT_GET_CP_FIELD(object_p, field) ((object_p)->ECMA_OBJECT_ ## field ## _CP_FIELD)
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
+
+/**
+ * Set compressed pointer field (see also: ECMA_OBJECT_*_CP_POS) of an object or lexical environment
+ */
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+# define ECMA_OBJECT_SET_CP_FIELD(object_p, field, cp_value) \
+  (object_p)->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t, (object_p)->container, \
+                                                   (cp_value), \
+                                                   ECMA_OBJECT_ ## field ## _CP_POS, \
+                                                   ECMA_OBJECT_ ## field ## _CP_WIDTH)
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+# define ECMA_OBJECT_SET_CP_FIELD(object_p, field, cp_value) \
+  (object_p)->ECMA_OBJECT_ ## field ## _CP_FIELD = (cp_value)
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
+
 
 /**
  * Description of ECMA property descriptor
@@ -668,8 +969,13 @@ typedef struct
  */
 typedef struct
 {
+#ifndef CONFIG_ECMA_VALUE_NAN_BOXING
   /** Characters */
   lit_utf8_byte_t data[ sizeof (uint64_t) - sizeof (mem_cpointer_t) ];
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+  /** Characters (enough for one 64-bit ecma value) */
+  lit_utf8_byte_t data[ sizeof (ecma_value_t) ];
+#endif /* !CONFIG_ECMA_VALUE_NAN_BOXING */
 
   /** Compressed pointer to next chunk */
   mem_cpointer_t next_chunk_cp;
@@ -688,8 +994,13 @@ typedef enum
                                              stored locally in the string's descriptor */
   ECMA_STRING_CONTAINER_MAGIC_STRING, /**< the ecma-string is equal to one of ECMA magic strings */
   ECMA_STRING_CONTAINER_MAGIC_STRING_EX, /**< the ecma-string is equal to one of external magic strings */
+  ECMA_STRING_CONTAINER_ROPE, /**< the ecma-string is a not yet flattened concatenation of two ecma-strings,
+                               *   described by a rope node on the heap */
+  ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL, /**< actual data is on the heap, like with ECMA_STRING_CONTAINER_HEAP_CHUNKS,
+                                           *   but with 32-bit size and length (used for strings above 64 KB),
+                                           *   or is in an immutable buffer, owned by the embedder */
 
-  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_MAGIC_STRING_EX /**< maximum value */
+  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL /**< maximum value */
 } ecma_string_container_t;
 
 /**
@@ -727,7 +1038,7 @@ typedef struct ecma_string_t
   /** Reference counter for the string */
   uint16_t refs_and_container;
 
-  /** Hash of the string (calculated from two last characters of the string) */
+  /** Hash of the string (see also: lit_utf8_string_calc_hash) */
   lit_string_hash_t hash;
 
   /**
@@ -744,6 +1055,9 @@ typedef struct ecma_string_t
     /** Compressed pointer to an ecma_number_t */
     mem_cpointer_t number_cp;
 
+    /** Compressed pointer to a rope node */
+    mem_cpointer_t rope_cp;
+
     /** UInt32-represented number placed locally in the descriptor */
     uint32_t uint32_number;
 
@@ -758,11 +1072,82 @@ typedef struct ecma_string_t
   } u;
 } ecma_string_t;
 
+/**
+ * Builder of ecma-strings
+ *
+ * The characters are appended to a heap buffer, which grows geometrically, and is turned into
+ * the character storage of the resulting ecma-string, when the builder is finalized.
+ *
+ * Large ecma-strings are not copied to the buffer: the buffer is turned into a string,
+ * and the strings are concatenated to the prefix as ropes.
+ */
+typedef struct
+{
+  ecma_string_t *prefix_p; /**< characters, which precede the buffer (or NULL, if there are no such characters) */
+  lit_utf8_byte_t *buffer_p; /**< heap buffer: space for the string's header, followed by
+                              *   the characters (or NULL, if the buffer is not allocated yet) */
+  lit_utf8_size_t size; /**< size of the characters in the buffer, in bytes */
+  lit_utf8_size_t capacity; /**< number of bytes, available for the characters in the buffer */
+} ecma_stringbuilder_t;
+
 /**
  * Representation for native external pointer
  */
 typedef uintptr_t ecma_external_pointer_t;
 
+/**
+ * Backing store of an ArrayBuffer object
+ *
+ * The store is referenced by ECMA_INTERNAL_PROPERTY_ARRAYBUFFER property. Bytes of an engine-owned buffer
+ * are placed right after the header, while an external buffer is owned by the embedder, which is notified
+ * with the free callback, when the ArrayBuffer object is garbage collected.
+ */
+typedef struct
+{
+  uint8_t *buffer_p; /**< pointer to the bytes of the buffer */
+  ecma_external_pointer_t free_cb; /**< free callback of an external buffer (or 0, if the buffer is not external) */
+  uint32_t length; /**< length of the buffer, in bytes */
+} ecma_arraybuffer_t;
+
+/**
+ * Get size of the backing store of an engine-owned ArrayBuffer of the specified length
+ */
+#define ECMA_ARRAYBUFFER_GET_SIZE(length) (sizeof (ecma_arraybuffer_t) + (length))
+
+/**
+ * Types of views of an ArrayBuffer
+ */
+typedef enum
+{
+  ECMA_ARRAYBUFFER_VIEW_INT8, /**< Int8Array */
+  ECMA_ARRAYBUFFER_VIEW_UINT8, /**< Uint8Array */
+  ECMA_ARRAYBUFFER_VIEW_UINT8_CLAMPED, /**< Uint8ClampedArray */
+  ECMA_ARRAYBUFFER_VIEW_INT16, /**< Int16Array */
+  ECMA_ARRAYBUFFER_VIEW_UINT16, /**< Uint16Array */
+  ECMA_ARRAYBUFFER_VIEW_INT32, /**< Int32Array */
+  ECMA_ARRAYBUFFER_VIEW_UINT32, /**< Uint32Array */
+  ECMA_ARRAYBUFFER_VIEW_FLOAT32, /**< Float32Array */
+  ECMA_ARRAYBUFFER_VIEW_FLOAT64, /**< Float64Array */
+  ECMA_ARRAYBUFFER_VIEW_DATAVIEW /**< DataView (not a typed array) */
+} ecma_arraybuffer_view_type_t;
+
+/**
+ * Description of a typed array or DataView object
+ *
+ * The description is referenced by ECMA_INTERNAL_PROPERTY_ARRAYBUFFER_VIEW property, which is the first property
+ * of the object's property list (not counting the header of the object's slots and the property hashmap),
+ * so typed arrays are recognized without searching through their properties. Elements of typed arrays have
+ * no property records, and are read from and written to the ArrayBuffer directly.
+ */
+typedef struct
+{
+  mem_cpointer_t arraybuffer_cp; /**< compressed pointer to the viewed ArrayBuffer object */
+  mem_cpointer_t store_cp; /**< compressed pointer to the backing store of the ArrayBuffer */
+  uint8_t type; /**< type of the view (ecma_arraybuffer_view_type_t) */
+  uint32_t byte_offset; /**< offset of the view in the buffer, in bytes */
+  uint32_t length; /**< number of elements of a typed array, or number of bytes of a DataView */
+} ecma_arraybuffer_view_t;
+
 /**
  * Compiled byte code data.
   */
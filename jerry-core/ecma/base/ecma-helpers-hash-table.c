@@ -0,0 +1,98 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Helpers for open addressing hash tables of compressed pointers, keyed by string hashes
+ *
+ * The tables are linearly probed, and their number of entries is a power of 2
+ * (see also: ecma-property-hashmap.c, ecma-intern.c).
+ */
+
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmahelpers Helpers for operations with ECMA data types
+ * @{
+ */
+
+/**
+ * Get index of the entry, from which search of a key with the specified hash is started
+ *
+ * Hashes are narrower than indices of large tables, so the hashes are spread over the whole table.
+ *
+ * @return index of the entry
+ */
+uint32_t
+ecma_hash_table_get_start_index (uint32_t entries_count, /**< number of the table's entries */
+                                 lit_string_hash_t hash) /**< hash of the key */
+{
+  JERRY_ASSERT (entries_count > 0 && (entries_count & (entries_count - 1)) == 0);
+
+  if (entries_count <= (1u << LIT_STRING_HASH_BITS))
+  {
+    return hash & (entries_count - 1);
+  }
+
+  return (uint32_t) hash * (entries_count >> LIT_STRING_HASH_BITS);
+} /* ecma_hash_table_get_start_index */
+
+/**
+ * Free an entry of the table
+ *
+ * The entries, that follow the freed one in the same cluster, are shifted back, if the entry is between
+ * their start indices and their current positions, so that no gaps remain in probe paths. The entries
+ * are only shifted to the freed entry or further, so a scan of the table, which checks the freed entry
+ * again, doesn't skip any of them.
+ */
+void
+ecma_hash_table_free_entry (mem_cpointer_t *entries_p, /**< the table's entries */
+                            uint32_t entries_count, /**< number of the table's entries */
+                            uint32_t index, /**< index of the entry to free */
+                            ecma_hash_table_get_hash_t get_hash) /**< routine, returning hash
+                                                                  *   of an entry's key */
+{
+  JERRY_ASSERT (index < entries_count && entries_p[index] != ECMA_NULL_POINTER);
+
+  uint32_t mask = entries_count - 1;
+  uint32_t free_index = index;
+
+  while (true)
+  {
+    index = (index + 1) & mask;
+
+    if (entries_p[index] == ECMA_NULL_POINTER)
+    {
+      break;
+    }
+
+    uint32_t start_index = ecma_hash_table_get_start_index (entries_count, get_hash (entries_p[index]));
+
+    if (((index - start_index) & mask) >= ((index - free_index) & mask))
+    {
+      entries_p[free_index] = entries_p[index];
+      free_index = index;
+    }
+  }
+
+  entries_p[free_index] = ECMA_NULL_POINTER;
+} /* ecma_hash_table_free_entry */
+
+/**
+ * @}
+ * @}
+ */
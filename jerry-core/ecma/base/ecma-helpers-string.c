@@ -34,11 +34,35 @@
 #include "lit-literal-storage.h"
 #include "vm.h"
 
+#define JERRY_INTERNAL
+#include "jerry-internal.h"
+
 /**
  * Maximum length of strings' concatenation
  */
 #define ECMA_STRING_MAX_CONCATENATION_LENGTH (CONFIG_ECMA_STRING_MAX_CONCATENATION_LENGTH)
 
+/**
+ * Maximum depth of trees of ropes
+ */
+#define ECMA_STRING_MAX_ROPE_DEPTH (CONFIG_ECMA_STRING_MAX_ROPE_DEPTH)
+
+/**
+ * Minimum size of concatenations, which are represented by ropes
+ *
+ * Note:
+ *      shorter concatenations are copied, as the copy is cheaper than the rope node
+ */
+#define ECMA_STRING_ROPE_MIN_SIZE (32)
+
+/**
+ * Minimum size of concatenations of operands, merged upon rebalancing of ropes, which are represented by ropes
+ *
+ * Note:
+ *      shorter concatenations are copied, so that trees, built by repeated short appends, have no tiny leaves
+ */
+#define ECMA_STRING_ROPE_MERGE_COPY_SIZE (256)
+
 /**
  * The length should be representable with int32_t.
  */
@@ -64,6 +88,12 @@ JERRY_STATIC_ASSERT (ECMA_STRING_CONTAINER_MASK >= ECMA_STRING_CONTAINER__MAX,
 JERRY_STATIC_ASSERT ((ECMA_STRING_MAX_REF | ECMA_STRING_CONTAINER_MASK) == UINT16_MAX,
                      ecma_string_ref_and_container_fields_should_fill_the_16_bit_field);
 
+/**
+ * The rope depth should be representable with the depth field of rope nodes.
+ */
+JERRY_STATIC_ASSERT (ECMA_STRING_MAX_ROPE_DEPTH >= 1 && ECMA_STRING_MAX_ROPE_DEPTH <= UINT16_MAX,
+                     ecma_string_max_rope_depth_should_be_representable_with_uint16_t);
+
 /**
  * String header
  */
@@ -73,6 +103,59 @@ typedef struct
   uint16_t length; /* Number of characters in the string */
 } ecma_string_heap_header_t;
 
+/**
+ * Header of long and external strings (ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL)
+ *
+ * Characters of a long string are placed right after the header, while characters of an external string
+ * are owned by the embedder (see also: ecma_string_external_header_t).
+ */
+typedef struct
+{
+  const lit_utf8_byte_t *chars_p; /* Characters of the string */
+  lit_utf8_size_t size; /* Size of string in bytes */
+  ecma_length_t length; /* Number of characters in the string */
+} ecma_string_long_header_t;
+
+/**
+ * Header of external strings
+ */
+typedef struct
+{
+  ecma_string_long_header_t header; /* common part with long strings */
+  ecma_external_pointer_t free_cb; /* callback, notifying the embedder, that the characters are not used anymore
+                                    * (or 0, if the embedder should not be notified) */
+} ecma_string_external_header_t;
+
+/**
+ * Check whether the string with ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL container is an external string
+ */
+#define ECMA_STRING_LONG_HEADER_IS_EXTERNAL(header_p) \
+  ((header_p)->chars_p != (const lit_utf8_byte_t *) ((header_p) + 1))
+
+/**
+ * Maximum size of strings with ecma_string_heap_header_t, larger strings use ecma_string_long_header_t
+ */
+#define ECMA_STRING_HEAP_SHORT_MAX_SIZE (UINT16_MAX)
+
+/**
+ * Rope node: concatenation of two ecma-strings, which is flattened (copied to a heap buffer)
+ * only when the characters of the string are accessed
+ *
+ * Note:
+ *      both operands may be ropes, the depth of the tree is bounded by ECMA_STRING_MAX_ROPE_DEPTH,
+ *      so the tree can be processed recursively
+ */
+typedef struct
+{
+  lit_utf8_size_t size; /**< size of the concatenation in bytes */
+  ecma_length_t length; /**< number of characters in the concatenation */
+  mem_cpointer_t left_cp; /**< compressed pointer to the left operand (may be a rope) */
+  mem_cpointer_t right_cp; /**< compressed pointer to the right operand (may be a rope) */
+  uint16_t depth; /**< depth of the tree of ropes, i.e. one more than the maximum depth of the operands */
+  uint16_t is_hash_computed; /**< true - if hash field of the rope's ecma-string is already computed
+                              *   (see also: ecma_string_hash) */
+} ecma_string_rope_t;
+
 static void
 ecma_init_ecma_string_from_lit_cp (ecma_string_t *string_p,
                                    lit_cpointer_t lit_index);
@@ -149,6 +232,59 @@ ecma_init_ecma_string_from_magic_string_ex_id (ecma_string_t *string_p, /**< des
   string_p->u.magic_string_ex_id = magic_string_ex_id;
 } /* ecma_init_ecma_string_from_magic_string_ex_id */
 
+/**
+ * Allocate character buffer for a string on the heap, and set the string's container
+ * to ECMA_STRING_CONTAINER_HEAP_CHUNKS or ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL, depending on the size
+ *
+ * Note:
+ *      reference counter of the string descriptor is not changed
+ *
+ * @return pointer to the character buffer (of string_size bytes)
+ */
+static lit_utf8_byte_t *
+ecma_string_alloc_heap_chars (ecma_string_t *string_desc_p, /**< string descriptor */
+                              lit_utf8_size_t string_size, /**< string size */
+                              ecma_length_t string_length) /**< string length */
+{
+  JERRY_ASSERT (string_length <= string_size);
+
+  ecma_string_container_t container;
+  void *data_p;
+  lit_utf8_byte_t *chars_p;
+
+  if (likely (string_size <= ECMA_STRING_HEAP_SHORT_MAX_SIZE))
+  {
+    const size_t data_size = string_size + sizeof (ecma_string_heap_header_t);
+    ecma_string_heap_header_t *header_p = (ecma_string_heap_header_t *) mem_heap_alloc_block (data_size);
+    header_p->size = (uint16_t) string_size;
+    header_p->length = (uint16_t) string_length;
+
+    container = ECMA_STRING_CONTAINER_HEAP_CHUNKS;
+    data_p = header_p;
+    chars_p = (lit_utf8_byte_t *) (header_p + 1);
+  }
+  else
+  {
+    const size_t data_size = string_size + sizeof (ecma_string_long_header_t);
+    ecma_string_long_header_t *header_p = (ecma_string_long_header_t *) mem_heap_alloc_block (data_size);
+    chars_p = (lit_utf8_byte_t *) (header_p + 1);
+    header_p->chars_p = chars_p;
+    header_p->size = string_size;
+    header_p->length = string_length;
+
+    container = ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL;
+    data_p = header_p;
+  }
+
+  /* The reference counter is read after the allocation, as it can be changed by a garbage collection. */
+  string_desc_p->refs_and_container = (uint16_t) ((string_desc_p->refs_and_container & ~ECMA_STRING_CONTAINER_MASK)
+                                                  | container);
+  string_desc_p->u.common_field = 0;
+  ECMA_SET_NON_NULL_POINTER (string_desc_p->u.collection_cp, data_p);
+
+  return chars_p;
+} /* ecma_string_alloc_heap_chars */
+
 /**
  * Allocate new ecma-string and fill it with characters from the utf8 string
  *
@@ -176,21 +312,69 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
   JERRY_ASSERT (string_size > 0);
 
   ecma_string_t *string_desc_p = ecma_alloc_string ();
-  string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_HEAP_CHUNKS | ECMA_STRING_REF_ONE;
+  string_desc_p->refs_and_container = ECMA_STRING_REF_ONE;
   string_desc_p->hash = lit_utf8_string_calc_hash (string_p, string_size);
 
-  string_desc_p->u.common_field = 0;
-
-  const size_t data_size = string_size + sizeof (ecma_string_heap_header_t);
-  ecma_string_heap_header_t *data_p = (ecma_string_heap_header_t *) mem_heap_alloc_block (data_size);
-  data_p->size = (uint16_t) string_size;
-  data_p->length = (uint16_t) lit_utf8_string_length (string_p, string_size);
-  memcpy (data_p + 1, string_p, string_size);
-  ECMA_SET_NON_NULL_POINTER (string_desc_p->u.collection_cp, data_p);
+  lit_utf8_byte_t *chars_p = ecma_string_alloc_heap_chars (string_desc_p,
+                                                           string_size,
+                                                           lit_utf8_string_length (string_p, string_size));
+  memcpy (chars_p, string_p, string_size);
 
   return string_desc_p;
 } /* ecma_new_ecma_string_from_utf8 */
 
+/**
+ * Allocate new ecma-string, which refers to the characters of an immutable buffer, owned by the embedder
+ *
+ * Note:
+ *      the free callback (if not 0) is called with the buffer's pointer, when the engine does not use
+ *      the characters anymore; short strings and strings equal to magic strings are copied to the heap,
+ *      so the callback is called before this function returns
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_new_ecma_external_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 string */
+                                         lit_utf8_size_t string_size, /**< string size */
+                                         ecma_external_pointer_t free_cb) /**< free callback (or 0) */
+{
+  JERRY_ASSERT (string_p != NULL || string_size == 0);
+  JERRY_ASSERT (lit_is_cesu8_string_valid (string_p, string_size));
+
+  lit_magic_string_id_t magic_string_id;
+  lit_magic_string_ex_id_t magic_string_ex_id;
+
+  if (string_size <= sizeof (ecma_string_external_header_t)
+      || lit_is_utf8_string_magic (string_p, string_size, &magic_string_id)
+      || lit_is_ex_utf8_string_magic (string_p, string_size, &magic_string_ex_id))
+  {
+    ecma_string_t *string_desc_p = ecma_new_ecma_string_from_utf8 (string_p, string_size);
+
+    if (free_cb != 0)
+    {
+      jerry_dispatch_object_free_callback (free_cb, (ecma_external_pointer_t) string_p);
+    }
+
+    return string_desc_p;
+  }
+
+  ecma_string_t *string_desc_p = ecma_alloc_string ();
+  string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL | ECMA_STRING_REF_ONE;
+  string_desc_p->hash = lit_utf8_string_calc_hash (string_p, string_size);
+
+  ecma_string_external_header_t *external_p;
+  external_p = (ecma_string_external_header_t *) mem_heap_alloc_block (sizeof (ecma_string_external_header_t));
+  external_p->header.chars_p = string_p;
+  external_p->header.size = string_size;
+  external_p->header.length = lit_utf8_string_length (string_p, string_size);
+  external_p->free_cb = free_cb;
+
+  string_desc_p->u.common_field = 0;
+  ECMA_SET_NON_NULL_POINTER (string_desc_p->u.collection_cp, external_p);
+
+  return string_desc_p;
+} /* ecma_new_ecma_external_string_from_utf8 */
+
 /**
  * Allocate new ecma-string and fill it with cesu-8 character which represents specified code unit
  *
@@ -318,31 +502,161 @@ ecma_new_ecma_string_from_magic_string_ex_id (lit_magic_string_ex_id_t id) /**<
 } /* ecma_new_ecma_string_from_magic_string_ex_id */
 
 /**
- * Concatenate ecma-strings
+ * Copy characters of a rope to the buffer
  *
- * @return concatenation of two ecma-strings
+ * Note:
+ *      the buffer should be large enough to hold the whole concatenation (rope_p->size bytes)
  */
-ecma_string_t *
-ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
-                          ecma_string_t *string2_p) /**< second ecma-string */
+static void
+ecma_string_rope_to_utf8_string (const ecma_string_rope_t *rope_p, /**< rope node */
+                                 lit_utf8_byte_t *buffer_p) /**< destination buffer */
 {
-  JERRY_ASSERT (string1_p != NULL
-                && string2_p != NULL);
+  lit_utf8_byte_t *buffer_end_p = buffer_p + rope_p->size;
 
-  const lit_utf8_size_t str1_size = ecma_string_get_size (string1_p);
-  const lit_utf8_size_t str2_size = ecma_string_get_size (string2_p);
+  while (true)
+  {
+    const ecma_string_t *right_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->right_cp);
 
-  if (str1_size == 0)
+    const lit_utf8_size_t right_size = ecma_string_get_size (right_p);
+    buffer_end_p -= right_size;
+
+    /* Right operands are copied recursively, left operands iteratively. */
+    lit_utf8_size_t bytes_copied = ecma_string_to_utf8_string (right_p, buffer_end_p, right_size);
+    JERRY_ASSERT (bytes_copied == right_size);
+
+    const ecma_string_t *left_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp);
+
+    if (ECMA_STRING_GET_CONTAINER (left_p) != ECMA_STRING_CONTAINER_ROPE)
+    {
+      const lit_utf8_size_t left_size = (lit_utf8_size_t) (buffer_end_p - buffer_p);
+
+      bytes_copied = ecma_string_to_utf8_string (left_p, buffer_p, left_size);
+      JERRY_ASSERT (bytes_copied == left_size);
+      return;
+    }
+
+    rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t, left_p->u.rope_cp);
+  }
+} /* ecma_string_rope_to_utf8_string */
+
+/**
+ * Free rope node of an ecma-string and dereference its operands
+ */
+static void
+ecma_string_free_rope (ecma_string_t *string_p) /**< ecma-string with rope container */
+{
+  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE);
+
+  ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t, string_p->u.rope_cp);
+
+  ecma_string_t *left_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp);
+  ecma_string_t *right_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->right_cp);
+
+  mem_heap_free_block (rope_p, sizeof (ecma_string_rope_t));
+
+  ecma_deref_ecma_string (right_p);
+  ecma_deref_ecma_string (left_p);
+} /* ecma_string_free_rope */
+
+/**
+ * Flatten the rope of an ecma-string, i.e. copy the characters of the concatenation to a heap buffer,
+ * and change the string's container to ECMA_STRING_CONTAINER_HEAP_CHUNKS (or LONG_OR_EXTERNAL)
+ *
+ * Note:
+ *      the string's value, hash and reference counter are not changed, so the string is flattened in place,
+ *      even if it is referenced from several places
+ */
+static void __attr_noinline___
+ecma_string_flatten_rope (const ecma_string_t *const_string_p) /**< ecma-string with rope container */
+{
+  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (const_string_p) == ECMA_STRING_CONTAINER_ROPE);
+
+  /* Flattening changes only the representation of the string, not the value. */
+  ecma_string_t *string_p = (ecma_string_t *) const_string_p;
+
+  const ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t, string_p->u.rope_cp);
+
+  ecma_string_t rope_string = *string_p;
+
+  lit_utf8_byte_t *chars_p = ecma_string_alloc_heap_chars (string_p, rope_p->size, rope_p->length);
+  ecma_string_rope_to_utf8_string (rope_p, chars_p);
+
+  if (!rope_p->is_hash_computed)
   {
-    return ecma_copy_or_ref_ecma_string (string2_p);
+    string_p->hash = lit_utf8_string_calc_hash (chars_p, rope_p->size);
   }
-  else if (str2_size == 0)
+
+  ecma_string_free_rope (&rope_string);
+} /* ecma_string_flatten_rope */
+
+/**
+ * Get depth of the tree of ropes of an ecma-string
+ *
+ * @return depth of the tree of ropes, or 0 - if the string is not a rope
+ */
+static uint16_t
+ecma_string_get_rope_depth (const ecma_string_t *string_p) /**< ecma-string */
+{
+  if (ECMA_STRING_GET_CONTAINER (string_p) != ECMA_STRING_CONTAINER_ROPE)
   {
-    return ecma_copy_or_ref_ecma_string (string1_p);
+    return 0;
   }
 
+  return ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t, string_p->u.rope_cp)->depth;
+} /* ecma_string_get_rope_depth */
+
+/**
+ * Combine hash with the characters of an ecma-string, without flattening the string
+ *
+ * @return combined hash
+ */
+static lit_string_hash_t
+ecma_string_hash_combine (lit_string_hash_t hash, /**< hash to be combined with */
+                          const ecma_string_t *string_p) /**< ecma-string */
+{
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    const ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t, string_p->u.rope_cp);
+
+    hash = ecma_string_hash_combine (hash, ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp));
+    return ecma_string_hash_combine (hash, ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->right_cp));
+  }
+
+  lit_utf8_size_t size;
+  bool is_ascii;
+  const lit_utf8_byte_t *chars_p = ecma_string_raw_chars (string_p, &size, &is_ascii);
+
+  if (chars_p != NULL)
+  {
+    return lit_utf8_string_hash_combine (hash, chars_p, size);
+  }
+
+  lit_utf8_byte_t buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+
+  lit_utf8_size_t bytes_copied = ecma_string_to_utf8_string (string_p, buffer, sizeof (buffer));
+  JERRY_ASSERT (bytes_copied == size);
+
+  return lit_utf8_string_hash_combine (hash, buffer, size);
+} /* ecma_string_hash_combine */
+
+/**
+ * Concatenate ecma-strings, copying the characters of the concatenation to a heap buffer
+ *
+ * Note:
+ *      the concatenation should be shorter than ECMA_STRING_HEAP_SHORT_MAX_SIZE
+ *
+ * @return concatenation of two ecma-strings
+ */
+static ecma_string_t *
+ecma_concat_ecma_strings_to_heap_chunks (ecma_string_t *string1_p, /**< first ecma-string */
+                                         ecma_string_t *string2_p) /**< second ecma-string */
+{
+  const lit_utf8_size_t str1_size = ecma_string_get_size (string1_p);
+  const lit_utf8_size_t str2_size = ecma_string_get_size (string2_p);
   const lit_utf8_size_t new_size = str1_size + str2_size;
 
+  JERRY_ASSERT (new_size <= ECMA_STRING_HEAP_SHORT_MAX_SIZE);
+
   ecma_string_t *string_desc_p = ecma_alloc_string ();
   string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_HEAP_CHUNKS | ECMA_STRING_REF_ONE;
 
@@ -363,13 +677,189 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
 
   data_p->size = (uint16_t) new_size;
   data_p->length = (uint16_t) (ecma_string_get_length (string1_p) + ecma_string_get_length (string2_p));
-  string_desc_p->hash = lit_utf8_string_hash_combine (string1_p->hash,
+  string_desc_p->hash = lit_utf8_string_hash_combine (ecma_string_hash (string1_p),
                                                       (lit_utf8_byte_t *) (data_p + 1) + str1_size,
                                                       (lit_utf8_size_t) str2_size);
 
   ECMA_SET_NON_NULL_POINTER (string_desc_p->u.collection_cp, data_p);
 
   return string_desc_p;
+} /* ecma_concat_ecma_strings_to_heap_chunks */
+
+/**
+ * Create ecma-string, represented by a rope node, referencing the operands
+ *
+ * Note:
+ *      operands, which trees of ropes have reached ECMA_STRING_MAX_ROPE_DEPTH, are flattened
+ *
+ *      the hash of the concatenation is computed only when it is first used (see also: ecma_string_hash),
+ *      so creating the rope does not scan the characters of the operands
+ *
+ * @return pointer to ecma-string descriptor
+ */
+static ecma_string_t *
+ecma_new_ecma_string_rope (ecma_string_t *left_p, /**< left operand */
+                           ecma_string_t *right_p) /**< right operand */
+{
+  uint16_t left_depth = ecma_string_get_rope_depth (left_p);
+
+  if (left_depth >= ECMA_STRING_MAX_ROPE_DEPTH)
+  {
+    ecma_string_flatten_rope (left_p);
+    left_depth = 0;
+  }
+
+  uint16_t right_depth = ecma_string_get_rope_depth (right_p);
+
+  if (right_depth >= ECMA_STRING_MAX_ROPE_DEPTH)
+  {
+    ecma_string_flatten_rope (right_p);
+    right_depth = 0;
+  }
+
+  ecma_string_rope_t *rope_p = (ecma_string_rope_t *) mem_heap_alloc_block (sizeof (ecma_string_rope_t));
+  rope_p->size = ecma_string_get_size (left_p) + ecma_string_get_size (right_p);
+  rope_p->length = ecma_string_get_length (left_p) + ecma_string_get_length (right_p);
+  rope_p->depth = (uint16_t) (JERRY_MAX (left_depth, right_depth) + 1);
+  rope_p->is_hash_computed = false;
+
+  ECMA_SET_NON_NULL_POINTER (rope_p->left_cp, ecma_copy_or_ref_ecma_string (left_p));
+  ECMA_SET_NON_NULL_POINTER (rope_p->right_cp, ecma_copy_or_ref_ecma_string (right_p));
+
+  ecma_string_t *string_desc_p = ecma_alloc_string ();
+  string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_ROPE | ECMA_STRING_REF_ONE;
+  string_desc_p->hash = 0;
+
+  string_desc_p->u.common_field = 0;
+  ECMA_SET_NON_NULL_POINTER (string_desc_p->u.rope_cp, rope_p);
+
+  return string_desc_p;
+} /* ecma_new_ecma_string_rope */
+
+/**
+ * Merge adjacent operands of ropes upon rebalancing of a concatenation
+ *
+ * @return concatenation of the operands - copied to a heap buffer, if it is shorter than
+ *         ECMA_STRING_ROPE_MERGE_COPY_SIZE, or represented by a rope - otherwise
+ */
+static ecma_string_t *
+ecma_string_merge_rope_operands (ecma_string_t *left_p, /**< left operand */
+                                 ecma_string_t *right_p) /**< right operand */
+{
+  if (ecma_string_get_size (left_p) + ecma_string_get_size (right_p) < ECMA_STRING_ROPE_MERGE_COPY_SIZE)
+  {
+    return ecma_concat_ecma_strings_to_heap_chunks (left_p, right_p);
+  }
+
+  return ecma_new_ecma_string_rope (left_p, right_p);
+} /* ecma_string_merge_rope_operands */
+
+/**
+ * Concatenate ecma-strings, representing the concatenation with a rope
+ *
+ * The concatenation is rebalanced: an appended string is merged with right operands along the left spine
+ * of the first string's tree, that are not larger than the appended string, and a prepended string is merged
+ * with left operands along the right spine of the second string's tree in the same way. So, sizes of operands
+ * along the spines are decreasing towards the ends of the concatenation (like digits of a binary counter),
+ * and repeated appends or prepends build balanced trees of logarithmic depth, instead of chains of ropes,
+ * which would be flattened upon reaching ECMA_STRING_MAX_ROPE_DEPTH.
+ *
+ * See also:
+ *          ecma_concat_ecma_strings
+ *
+ * @return concatenation of two ecma-strings
+ */
+static ecma_string_t *
+ecma_concat_ecma_strings_to_rope (ecma_string_t *string1_p, /**< first ecma-string */
+                                  ecma_string_t *string2_p) /**< second ecma-string */
+{
+  ecma_string_t *left_p = ecma_copy_or_ref_ecma_string (string1_p);
+  ecma_string_t *right_p = ecma_copy_or_ref_ecma_string (string2_p);
+
+  if (ECMA_STRING_GET_CONTAINER (left_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    do
+    {
+      const ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t, left_p->u.rope_cp);
+      ecma_string_t *operand_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->right_cp);
+
+      if (ecma_string_get_size (operand_p) > ecma_string_get_size (right_p))
+      {
+        break;
+      }
+
+      ecma_string_t *merged_p = ecma_string_merge_rope_operands (operand_p, right_p);
+      ecma_deref_ecma_string (right_p);
+      right_p = merged_p;
+
+      ecma_string_t *rest_p = ecma_copy_or_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                                                      rope_p->left_cp));
+      ecma_deref_ecma_string (left_p);
+      left_p = rest_p;
+    }
+    while (ECMA_STRING_GET_CONTAINER (left_p) == ECMA_STRING_CONTAINER_ROPE);
+  }
+  else
+  {
+    while (ECMA_STRING_GET_CONTAINER (right_p) == ECMA_STRING_CONTAINER_ROPE)
+    {
+      const ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t, right_p->u.rope_cp);
+      ecma_string_t *operand_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp);
+
+      if (ecma_string_get_size (operand_p) > ecma_string_get_size (left_p))
+      {
+        break;
+      }
+
+      ecma_string_t *merged_p = ecma_string_merge_rope_operands (left_p, operand_p);
+      ecma_deref_ecma_string (left_p);
+      left_p = merged_p;
+
+      ecma_string_t *rest_p = ecma_copy_or_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                                                      rope_p->right_cp));
+      ecma_deref_ecma_string (right_p);
+      right_p = rest_p;
+    }
+  }
+
+  ecma_string_t *string_desc_p = ecma_new_ecma_string_rope (left_p, right_p);
+
+  ecma_deref_ecma_string (right_p);
+  ecma_deref_ecma_string (left_p);
+
+  return string_desc_p;
+} /* ecma_concat_ecma_strings_to_rope */
+
+/**
+ * Concatenate ecma-strings
+ *
+ * @return concatenation of two ecma-strings
+ */
+ecma_string_t *
+ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
+                          ecma_string_t *string2_p) /**< second ecma-string */
+{
+  JERRY_ASSERT (string1_p != NULL
+                && string2_p != NULL);
+
+  const lit_utf8_size_t str1_size = ecma_string_get_size (string1_p);
+  const lit_utf8_size_t str2_size = ecma_string_get_size (string2_p);
+
+  if (str1_size == 0)
+  {
+    return ecma_copy_or_ref_ecma_string (string2_p);
+  }
+  else if (str2_size == 0)
+  {
+    return ecma_copy_or_ref_ecma_string (string1_p);
+  }
+
+  if (str1_size + str2_size >= ECMA_STRING_ROPE_MIN_SIZE)
+  {
+    return ecma_concat_ecma_strings_to_rope (string1_p, string2_p);
+  }
+
+  return ecma_concat_ecma_strings_to_heap_chunks (string1_p, string2_p);
 } /* ecma_concat_ecma_strings */
 
 /**
@@ -410,10 +900,16 @@ ecma_copy_ecma_string (ecma_string_t *string_desc_p) /**< string descriptor */
       break;
     }
 
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      ecma_string_flatten_rope (string_desc_p);
+      /* FALLTHRU */
+    }
     case ECMA_STRING_CONTAINER_HEAP_CHUNKS:
     {
       new_str_p = ecma_alloc_string ();
       *new_str_p = *string_desc_p;
+      new_str_p->refs_and_container = ECMA_STRING_SET_REF_TO_ONE (new_str_p->refs_and_container);
 
       const ecma_string_heap_header_t *data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
                                                                            string_desc_p->u.collection_cp);
@@ -422,7 +918,22 @@ ecma_copy_ecma_string (ecma_string_t *string_desc_p) /**< string descriptor */
       ecma_string_heap_header_t *new_data_p = (ecma_string_heap_header_t *) mem_heap_alloc_block (data_size);
       memcpy (new_data_p, data_p, data_p->size + sizeof (ecma_string_heap_header_t));
 
-      ECMA_SET_NON_NULL_POINTER (new_str_p->u.collection_cp, data_p);
+      ECMA_SET_NON_NULL_POINTER (new_str_p->u.collection_cp, new_data_p);
+
+      break;
+    }
+
+    case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL:
+    {
+      new_str_p = ecma_alloc_string ();
+      *new_str_p = *string_desc_p;
+      new_str_p->refs_and_container = ECMA_STRING_SET_REF_TO_ONE (new_str_p->refs_and_container);
+
+      /* Characters of an external string are copied as well, as the buffer can be released only once */
+      const ecma_string_long_header_t *data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_long_header_t,
+                                                                           string_desc_p->u.collection_cp);
+      lit_utf8_byte_t *new_chars_p = ecma_string_alloc_heap_chars (new_str_p, data_p->size, data_p->length);
+      memcpy (new_chars_p, data_p->chars_p, data_p->size);
 
       break;
     }
@@ -468,6 +979,136 @@ ecma_copy_or_ref_ecma_string (ecma_string_t *string_p) /**< string descriptor */
   return string_p;
 } /* ecma_copy_or_ref_ecma_string */
 
+/**
+ * Entry of the cache of character index to byte offset mappings of non-ASCII strings
+ */
+typedef struct
+{
+  const lit_utf8_byte_t *chars_p; /**< characters of the string (NULL - if the entry is empty) */
+  ecma_length_t index; /**< index of the most recently accessed character */
+  lit_utf8_size_t offset; /**< byte offset of the character */
+} ecma_string_index_cache_entry_t;
+
+/**
+ * Cache of character index to byte offset mappings of non-ASCII strings
+ *
+ * Entries are ordered from the most recently used to the least recently used one.
+ *
+ * Note:
+ *      characters of an ASCII string are directly indexed, so such strings are not cached
+ */
+static ecma_string_index_cache_entry_t ecma_string_index_cache[CONFIG_ECMA_STRING_INDEX_CACHE_SIZE];
+
+/**
+ * Remove the entry of the characters buffer, which is going to be freed, from the character index cache
+ */
+static void
+ecma_string_index_cache_invalidate (const lit_utf8_byte_t *chars_p) /**< characters of the string */
+{
+  for (uint32_t i = 0; i < CONFIG_ECMA_STRING_INDEX_CACHE_SIZE; i++)
+  {
+    if (ecma_string_index_cache[i].chars_p == chars_p)
+    {
+      ecma_string_index_cache[i].chars_p = NULL;
+      return;
+    }
+  }
+} /* ecma_string_index_cache_invalidate */
+
+/**
+ * Invalidate all entries of the character index cache
+ */
+void
+ecma_string_index_cache_invalidate_all (void)
+{
+  for (uint32_t i = 0; i < CONFIG_ECMA_STRING_INDEX_CACHE_SIZE; i++)
+  {
+    ecma_string_index_cache[i].chars_p = NULL;
+  }
+} /* ecma_string_index_cache_invalidate_all */
+
+/**
+ * Get byte offset of the character at the specified index of a non-ASCII string
+ *
+ * The offset is searched starting from the nearest of the beginning and the end of the string,
+ * and of the character accessed most recently in the string, which makes sequential access
+ * amortised constant time.
+ *
+ * @return byte offset of the character
+ */
+static lit_utf8_size_t
+ecma_string_get_char_offset (const lit_utf8_byte_t *chars_p, /**< characters of the string */
+                             lit_utf8_size_t size, /**< size of the string in bytes */
+                             ecma_length_t length, /**< number of characters in the string */
+                             ecma_length_t index) /**< index of the character */
+{
+  JERRY_ASSERT (chars_p != NULL);
+  JERRY_ASSERT (size != length);
+  JERRY_ASSERT (index <= length);
+
+  ecma_length_t current_index = 0;
+  lit_utf8_size_t current_offset = 0;
+
+  if (index > length - index)
+  {
+    current_index = length;
+    current_offset = size;
+  }
+
+  uint32_t entry_index = CONFIG_ECMA_STRING_INDEX_CACHE_SIZE - 1;
+
+  for (uint32_t i = 0; i < CONFIG_ECMA_STRING_INDEX_CACHE_SIZE; i++)
+  {
+    if (ecma_string_index_cache[i].chars_p == chars_p)
+    {
+      const ecma_length_t cached_index = ecma_string_index_cache[i].index;
+      const ecma_length_t cached_distance = (cached_index > index) ? cached_index - index : index - cached_index;
+      const ecma_length_t distance = (current_index > index) ? current_index - index : index - current_index;
+
+      if (cached_distance < distance)
+      {
+        current_index = cached_index;
+        current_offset = ecma_string_index_cache[i].offset;
+      }
+
+      entry_index = i;
+      break;
+    }
+  }
+
+  while (current_index < index)
+  {
+    current_offset += lit_get_unicode_char_size_by_utf8_first_byte (chars_p[current_offset]);
+    current_index++;
+  }
+
+  while (current_index > index)
+  {
+    do
+    {
+      current_offset--;
+    }
+    while ((chars_p[current_offset] & LIT_UTF8_EXTRA_BYTE_MASK) == LIT_UTF8_EXTRA_BYTE_MARKER);
+
+    current_index--;
+  }
+
+  JERRY_ASSERT (current_offset <= size);
+
+  /* Move the entry to the front of the cache */
+  while (entry_index > 0)
+  {
+    ecma_string_index_cache[entry_index] = ecma_string_index_cache[entry_index - 1];
+    entry_index--;
+  }
+
+  ecma_string_index_cache[0].chars_p = chars_p;
+  ecma_string_index_cache[0].index = index;
+  ecma_string_index_cache[0].offset = current_offset;
+
+  return current_offset;
+} /* ecma_string_get_char_offset */
+
 /**
  * Decrease reference counter and deallocate ecma-string
  * if the counter becomes zero.
@@ -493,10 +1134,46 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       ecma_string_heap_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
                                                                            string_p->u.collection_cp);
 
+      if (data_p->size != data_p->length)
+      {
+        ecma_string_index_cache_invalidate ((const lit_utf8_byte_t *) (data_p + 1));
+      }
+
       mem_heap_free_block (data_p, data_p->size + sizeof (ecma_string_heap_header_t));
 
       break;
     }
+    case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL:
+    {
+      ecma_string_long_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_long_header_t,
+                                                                           string_p->u.collection_cp);
+
+      if (data_p->size != data_p->length)
+      {
+        ecma_string_index_cache_invalidate (data_p->chars_p);
+      }
+
+      if (ECMA_STRING_LONG_HEADER_IS_EXTERNAL (data_p))
+      {
+        ecma_string_external_header_t *external_p = (ecma_string_external_header_t *) data_p;
+        const ecma_external_pointer_t free_cb = external_p->free_cb;
+        const lit_utf8_byte_t *chars_p = data_p->chars_p;
+
+        mem_heap_free_block (external_p, sizeof (ecma_string_external_header_t));
+
+        if (free_cb != 0)
+        {
+          /* the external buffer is given back to the embedder */
+          jerry_dispatch_object_free_callback (free_cb, (ecma_external_pointer_t) chars_p);
+        }
+      }
+      else
+      {
+        mem_heap_free_block (data_p, data_p->size + sizeof (ecma_string_long_header_t));
+      }
+
+      break;
+    }
     case ECMA_STRING_CONTAINER_HEAP_NUMBER:
     {
       ecma_number_t *num_p = ECMA_GET_NON_NULL_POINTER (ecma_number_t,
@@ -506,6 +1183,12 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
 
       break;
     }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      ecma_string_free_rope (string_p);
+
+      break;
+    }
     case ECMA_STRING_CONTAINER_LIT_TABLE:
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
@@ -546,8 +1229,10 @@ ecma_string_to_number (const ecma_string_t *str_p) /**< ecma-string */
 
     case ECMA_STRING_CONTAINER_LIT_TABLE:
     case ECMA_STRING_CONTAINER_HEAP_CHUNKS:
+    case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
     case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
+    case ECMA_STRING_CONTAINER_ROPE:
     {
       const lit_utf8_size_t string_size = ecma_string_get_size (str_p);
 
@@ -579,6 +1264,9 @@ ecma_string_to_number (const ecma_string_t *str_p) /**< ecma-string */
 /**
  * Check if string is array index.
  *
+ * Note:
+ *      names of most non-index properties are rejected without converting them to numbers
+ *
  * @return true - if string is valid array index
  *         false - otherwise
  */
@@ -586,27 +1274,49 @@ bool
 ecma_string_get_array_index (const ecma_string_t *str_p, /**< ecma-string */
                              uint32_t *out_index_p) /**< [out] index */
 {
-  bool is_array_index = true;
-  if (ECMA_STRING_GET_CONTAINER (str_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC)
+  switch (ECMA_STRING_GET_CONTAINER (str_p))
   {
-    *out_index_p = str_p->u.uint32_number;
+    case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
+    {
+      *out_index_p = str_p->u.uint32_number;
+
+      return (*out_index_p != ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX);
+    }
+
+    case ECMA_STRING_CONTAINER_MAGIC_STRING:
+    case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
+    {
+      /* none of the magic strings is an array index */
+      return false;
+    }
+
+    default:
+    {
+      break;
+    }
   }
-  else
+
+  lit_utf8_size_t size;
+  bool is_ascii;
+  const lit_utf8_byte_t *chars_p = ecma_string_raw_chars (str_p, &size, &is_ascii);
+
+  if (chars_p != NULL
+      && (size == 0 || chars_p[0] < LIT_CHAR_0 || chars_p[0] > LIT_CHAR_9))
   {
-    ecma_number_t num = ecma_string_to_number (str_p);
-    *out_index_p = ecma_number_to_uint32 (num);
+    return false;
+  }
 
-    ecma_string_t *to_uint32_to_string_p = ecma_new_ecma_string_from_uint32 (*out_index_p);
+  ecma_number_t num = ecma_string_to_number (str_p);
+  *out_index_p = ecma_number_to_uint32 (num);
 
-    is_array_index = ecma_compare_ecma_strings (str_p,
-                                                to_uint32_to_string_p);
+  ecma_string_t *to_uint32_to_string_p = ecma_new_ecma_string_from_uint32 (*out_index_p);
 
-    ecma_deref_ecma_string (to_uint32_to_string_p);
-  }
+  bool is_array_index = ecma_compare_ecma_strings (str_p,
+                                                   to_uint32_to_string_p);
 
-  is_array_index = is_array_index && (*out_index_p != ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX);
+  ecma_deref_ecma_string (to_uint32_to_string_p);
 
-  return is_array_index;
+  return is_array_index && (*out_index_p != ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX);
 } /* ecma_string_get_array_index */
 
 /**
@@ -638,6 +1348,14 @@ ecma_string_to_utf8_string (const ecma_string_t *string_desc_p, /**< ecma-string
       memcpy (buffer_p, data_p + 1, size);
       break;
     }
+    case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL:
+    {
+      const ecma_string_long_header_t *data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_long_header_t,
+                                                                           string_desc_p->u.collection_cp);
+      size = data_p->size;
+      memcpy (buffer_p, data_p->chars_p, size);
+      break;
+    }
     case ECMA_STRING_CONTAINER_LIT_TABLE:
     {
       const lit_literal_t lit = lit_get_literal_by_cp (string_desc_p->u.lit_cp);
@@ -673,6 +1391,14 @@ ecma_string_to_utf8_string (const ecma_string_t *string_desc_p, /**< ecma-string
       memcpy (buffer_p, lit_get_magic_string_ex_utf8 (id), size);
       break;
     }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      const ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t,
+                                                                    string_desc_p->u.rope_cp);
+      size = rope_p->size;
+      ecma_string_rope_to_utf8_string (rope_p, buffer_p);
+      break;
+    }
     default:
     {
       JERRY_UNREACHABLE ();
@@ -762,6 +1488,11 @@ ecma_string_raw_chars (const ecma_string_t *string_p, /* ecma-string */
   lit_utf8_size_t size;
   const lit_utf8_byte_t *result_p;
 
+  if (unlikely (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE))
+  {
+    ecma_string_flatten_rope (string_p);
+  }
+
   switch (ECMA_STRING_GET_CONTAINER (string_p))
   {
     case ECMA_STRING_CONTAINER_LIT_TABLE:
@@ -783,6 +1514,15 @@ ecma_string_raw_chars (const ecma_string_t *string_p, /* ecma-string */
       result_p = (const lit_utf8_byte_t *) (data_p + 1);
       break;
     }
+    case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL:
+    {
+      const ecma_string_long_header_t *data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_long_header_t,
+                                                                           string_p->u.collection_cp);
+      size = data_p->size;
+      length = data_p->length;
+      result_p = data_p->chars_p;
+      break;
+    }
     case ECMA_STRING_CONTAINER_HEAP_NUMBER:
     {
       size = ecma_string_get_heap_number_size (string_p->u.number_cp);
@@ -848,6 +1588,16 @@ static bool __attr_noinline___
 ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-string */
                                     const ecma_string_t *string2_p) /* ecma-string */
 {
+  if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    ecma_string_flatten_rope (string1_p);
+  }
+
+  if (ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    ecma_string_flatten_rope (string2_p);
+  }
+
   if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_GET_CONTAINER (string2_p))
   {
     switch (ECMA_STRING_GET_CONTAINER (string1_p))
@@ -875,7 +1625,8 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
       default:
       {
         JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_NUMBER
-                      || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_CHUNKS);
+                      || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_CHUNKS
+                      || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL);
         break;
       }
     }
@@ -928,6 +1679,20 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
 
         return !strncmp ((char *) (data1_p + 1), (char *) (data2_p + 1), strings_size);
       }
+      case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL:
+      {
+        const ecma_string_long_header_t *data1_p = ECMA_GET_NON_NULL_POINTER (ecma_string_long_header_t,
+                                                                              string1_p->u.collection_cp);
+        const ecma_string_long_header_t *data2_p = ECMA_GET_NON_NULL_POINTER (ecma_string_long_header_t,
+                                                                              string2_p->u.collection_cp);
+
+        if (data1_p->length != data2_p->length)
+        {
+          return false;
+        }
+
+        return !memcmp (data1_p->chars_p, data2_p->chars_p, strings_size);
+      }
       default:
       {
         JERRY_UNREACHABLE ();
@@ -947,6 +1712,13 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
 
     utf8_string1_p = (lit_utf8_byte_t *) (data_p + 1);
   }
+  else if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL)
+  {
+    const ecma_string_long_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_long_header_t,
+                                                                               string1_p->u.collection_cp);
+
+    utf8_string1_p = (lit_utf8_byte_t *) data_p->chars_p;
+  }
   else if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_LIT_TABLE)
   {
     const lit_literal_t lit = lit_get_literal_by_cp (string1_p->u.lit_cp);
@@ -971,6 +1743,13 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
 
     utf8_string2_p = (lit_utf8_byte_t *) (data_p + 1);
   }
+  else if (ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL)
+  {
+    const ecma_string_long_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_long_header_t,
+                                                                               string2_p->u.collection_cp);
+
+    utf8_string2_p = (lit_utf8_byte_t *) data_p->chars_p;
+  }
   else if (ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_LIT_TABLE)
   {
     const lit_literal_t lit = lit_get_literal_by_cp (string2_p->u.lit_cp);
@@ -1002,6 +1781,36 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
   return is_equal;
 } /* ecma_compare_ecma_strings_longpath */
 
+/**
+ * Part of ecma-string to ecma-string comparison routine for strings, at least one of which is a rope
+ *
+ * Hashes of ropes are computed upon first use by scanning the characters, so sizes of the strings are
+ * compared first, which is enough to tell apart e.g. a string, and the string with a prepended prefix.
+ *
+ * See also:
+ *          ecma_compare_ecma_strings
+ *
+ * @return true - if strings are equal;
+ *         false - otherwise.
+ */
+static bool __attr_noinline___
+ecma_compare_ecma_strings_rope (const ecma_string_t *string1_p, /* ecma-string */
+                                const ecma_string_t *string2_p) /* ecma-string */
+{
+  if (string1_p == string2_p)
+  {
+    return true;
+  }
+
+  if (ecma_string_get_size (string1_p) != ecma_string_get_size (string2_p)
+      || ecma_string_hash (string1_p) != ecma_string_hash (string2_p))
+  {
+    return false;
+  }
+
+  return ecma_compare_ecma_strings_longpath (string1_p, string2_p);
+} /* ecma_compare_ecma_strings_rope */
+
 /**
  * Compare ecma-string to ecma-string
  *
@@ -1014,6 +1823,12 @@ ecma_compare_ecma_strings (const ecma_string_t *string1_p, /* ecma-string */
 {
   JERRY_ASSERT (string1_p != NULL && string2_p != NULL);
 
+  if (unlikely (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_ROPE
+                || ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_ROPE))
+  {
+    return ecma_compare_ecma_strings_rope (string1_p, string2_p);
+  }
+
   if (string1_p->hash != string2_p->hash)
   {
     return false;
@@ -1055,6 +1870,16 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
   lit_utf8_byte_t utf8_string2_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
   lit_utf8_size_t utf8_string2_size;
 
+  if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    ecma_string_flatten_rope (string1_p);
+  }
+
+  if (ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    ecma_string_flatten_rope (string2_p);
+  }
+
   if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_CHUNKS)
   {
     const ecma_string_heap_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
@@ -1063,6 +1888,14 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
     utf8_string1_p = (lit_utf8_byte_t *) (data_p + 1);
     utf8_string1_size = (lit_utf8_size_t) data_p->size;
   }
+  else if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL)
+  {
+    const ecma_string_long_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_long_header_t,
+                                                                               string1_p->u.collection_cp);
+
+    utf8_string1_p = (lit_utf8_byte_t *) data_p->chars_p;
+    utf8_string1_size = data_p->size;
+  }
   else if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_LIT_TABLE)
   {
     const lit_literal_t lit = lit_get_literal_by_cp (string1_p->u.lit_cp);
@@ -1097,6 +1930,14 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
     utf8_string2_p = (lit_utf8_byte_t *) (data_p + 1);
     utf8_string2_size = (lit_utf8_size_t) data_p->size;
   }
+  else if (ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL)
+  {
+    const ecma_string_long_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_long_header_t,
+                                                                               string2_p->u.collection_cp);
+
+    utf8_string2_p = (lit_utf8_byte_t *) data_p->chars_p;
+    utf8_string2_size = data_p->size;
+  }
   else if (ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_LIT_TABLE)
   {
     const lit_literal_t lit = lit_get_literal_by_cp (string2_p->u.lit_cp);
@@ -1177,6 +2018,14 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
     {
       return (ecma_length_t) ecma_string_get_heap_number_size (string_p->u.number_cp);
     }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      return ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t, string_p->u.rope_cp)->length;
+    }
+    case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL:
+    {
+      return ECMA_GET_NON_NULL_POINTER (ecma_string_long_header_t, string_p->u.collection_cp)->length;
+                                        }
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_CHUNKS);
@@ -1221,6 +2070,14 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
     {
       return ecma_string_get_heap_number_size (string_p->u.number_cp);
     }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      return ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t, string_p->u.rope_cp)->size;
+    }
+    case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL:
+    {
+      return ECMA_GET_NON_NULL_POINTER (ecma_string_long_header_t, string_p->u.collection_cp)->size;
+                                        }
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_CHUNKS);
@@ -1255,7 +2112,11 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
       return chars_p[index];
     }
 
-    return lit_utf8_string_code_unit_at (chars_p, buffer_size, index);
+    ecma_char_t code_unit;
+    lit_utf8_size_t offset = ecma_string_get_char_offset (chars_p, buffer_size, string_length, index);
+    lit_read_code_unit_from_utf8 (chars_p + offset, &code_unit);
+
+    return code_unit;
   }
 
   ecma_char_t ch;
@@ -1441,15 +2302,47 @@ ecma_is_ex_string_magic (const ecma_string_t *string_p, /**< ecma-string */
 } /* ecma_is_ex_string_magic */
 
 /**
- * Try to calculate hash of the ecma-string
+ * Compute hash of an ecma-string with rope container, and store it in the string's descriptor
+ *
+ * @return hash of the ecma-string
+ */
+static lit_string_hash_t __attr_noinline___
+ecma_string_compute_rope_hash (const ecma_string_t *const_string_p) /**< ecma-string with rope container */
+{
+  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (const_string_p) == ECMA_STRING_CONTAINER_ROPE);
+
+  /* Computing the hash changes only the descriptor's cached data, not the value. */
+  ecma_string_t *string_p = (ecma_string_t *) const_string_p;
+
+  ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t, string_p->u.rope_cp);
+
+  /* Hashes of left operands are cached as well, so only the right operands' characters are scanned. */
+  const ecma_string_t *left_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp);
+  const ecma_string_t *right_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->right_cp);
+
+  string_p->hash = ecma_string_hash_combine (ecma_string_hash (left_p), right_p);
+  rope_p->is_hash_computed = true;
+
+  return string_p->hash;
+} /* ecma_string_compute_rope_hash */
+
+/**
+ * Get hash of the ecma-string
+ *
+ * Hashes of concatenations, represented by ropes, are computed upon first use.
  *
- * @return calculated hash
+ * @return hash of the ecma-string
  */
 lit_string_hash_t
 ecma_string_hash (const ecma_string_t *string_p) /**< ecma-string to calculate hash for */
-
 {
-  return (string_p->hash);
+  if (unlikely (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+      && !ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t, string_p->u.rope_cp)->is_hash_computed)
+  {
+    return ecma_string_compute_rope_hash (string_p);
+  }
+
+  return string_p->hash;
 } /* ecma_string_hash */
 
 /**
@@ -1484,10 +2377,10 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
                                                (lit_utf8_size_t) end_pos);
       }
 
-      while (start_pos--)
-      {
-        start_p += lit_get_unicode_char_size_by_utf8_first_byte (*start_p);
-      }
+      start_p += ecma_string_get_char_offset (start_p,
+                                              buffer_size,
+                                              ecma_string_get_length (string_p),
+                                              start_pos);
 
       const lit_utf8_byte_t *end_p = start_p;
       while (end_pos--)
@@ -1623,6 +2516,461 @@ ecma_string_trim (const ecma_string_t *string_p) /**< pointer to an ecma string
 
 } /* ecma_string_trim */
 
+/**
+ * Initial number of bytes, available for the characters in the buffer of a string builder
+ */
+#define ECMA_STRINGBUILDER_INITIAL_CAPACITY (32)
+
+/**
+ * Minimum size of the ecma-strings, which are not copied to the buffer of a string builder
+ */
+#define ECMA_STRINGBUILDER_REF_MIN_SIZE (4096)
+
+/**
+ * Get size of the space, reserved for the string's header in the buffer of a string builder
+ *
+ * Note:
+ *      buffers, which can hold more than ECMA_STRING_HEAP_SHORT_MAX_SIZE bytes, reserve space
+ *      for the header of long strings
+ *
+ * @return size of the header space
+ */
+static size_t
+ecma_stringbuilder_get_header_size (lit_utf8_size_t capacity) /**< capacity of the buffer */
+{
+  return ((capacity <= ECMA_STRING_HEAP_SHORT_MAX_SIZE) ? sizeof (ecma_string_heap_header_t)
+                                                        : sizeof (ecma_string_long_header_t));
+} /* ecma_stringbuilder_get_header_size */
+
+/**
+ * Initialize an empty string builder
+ *
+ * Note:
+ *      the builder should be either finalized with ecma_stringbuilder_finalize,
+ *      or destroyed with ecma_stringbuilder_destroy
+ */
+void
+ecma_stringbuilder_init (ecma_stringbuilder_t *builder_p) /**< string builder */
+{
+  builder_p->prefix_p = NULL;
+  builder_p->buffer_p = NULL;
+  builder_p->size = 0;
+  builder_p->capacity = 0;
+} /* ecma_stringbuilder_init */
+
+/**
+ * Try to grow the buffer of the string builder in place, without copying the characters
+ *
+ * @return true - if the heap region following the buffer was free, and the buffer is grown,
+ *         false - otherwise
+ */
+static bool
+ecma_stringbuilder_try_grow (ecma_stringbuilder_t *builder_p, /**< string builder */
+                             lit_utf8_size_t new_capacity) /**< new capacity of the buffer */
+{
+  const size_t header_size = ecma_stringbuilder_get_header_size (builder_p->capacity);
+  const size_t new_header_size = ecma_stringbuilder_get_header_size (new_capacity);
+
+  if (!mem_heap_try_grow_block (builder_p->buffer_p,
+                                header_size + builder_p->capacity,
+                                new_header_size + new_capacity))
+  {
+    return false;
+  }
+
+  if (new_header_size != header_size)
+  {
+    memmove (builder_p->buffer_p + new_header_size, builder_p->buffer_p + header_size, builder_p->size);
+  }
+
+  builder_p->capacity = new_capacity;
+  return true;
+} /* ecma_stringbuilder_try_grow */
+
+/**
+ * Resize the buffer of the string builder
+ *
+ * If there is not enough memory for the preferred capacity, the buffer is resized to the required capacity.
+ */
+static void
+ecma_stringbuilder_resize (ecma_stringbuilder_t *builder_p, /**< string builder */
+                           lit_utf8_size_t required_capacity, /**< minimum capacity of the buffer */
+                           lit_utf8_size_t preferred_capacity) /**< preferred capacity of the buffer */
+{
+  JERRY_ASSERT (required_capacity > builder_p->capacity);
+  JERRY_ASSERT (preferred_capacity >= required_capacity);
+
+  lit_utf8_byte_t *buffer_p = builder_p->buffer_p;
+
+  if (buffer_p != NULL)
+  {
+    if (ecma_stringbuilder_try_grow (builder_p, preferred_capacity)
+        || (preferred_capacity != required_capacity && ecma_stringbuilder_try_grow (builder_p, required_capacity)))
+    {
+      return;
+    }
+  }
+
+  lit_utf8_size_t new_capacity = preferred_capacity;
+  size_t new_header_size = ecma_stringbuilder_get_header_size (new_capacity);
+  lit_utf8_byte_t *new_buffer_p;
+  new_buffer_p = (lit_utf8_byte_t *) mem_heap_alloc_block_null_on_error (new_header_size + new_capacity);
+
+  if (new_buffer_p == NULL)
+  {
+    new_capacity = required_capacity;
+    new_header_size = ecma_stringbuilder_get_header_size (new_capacity);
+    new_buffer_p = (lit_utf8_byte_t *) mem_heap_alloc_block (new_header_size + new_capacity);
+  }
+
+  if (buffer_p != NULL)
+  {
+    const size_t header_size = ecma_stringbuilder_get_header_size (builder_p->capacity);
+
+    memcpy (new_buffer_p + new_header_size, buffer_p + header_size, builder_p->size);
+    mem_heap_free_block (buffer_p, header_size + builder_p->capacity);
+  }
+
+  builder_p->buffer_p = new_buffer_p;
+  builder_p->capacity = new_capacity;
+} /* ecma_stringbuilder_resize */
+
+/**
+ * Grow the buffer of the string builder, so that it can hold at least the required number of bytes
+ *
+ * The buffer grows geometrically, so appending n bytes piece by piece takes amortized O (n) time.
+ * If a large piece is appended at once, some space is left for the following pieces.
+ */
+static void
+ecma_stringbuilder_grow (ecma_stringbuilder_t *builder_p, /**< string builder */
+                         lit_utf8_size_t required_capacity) /**< required capacity of the buffer */
+{
+  lit_utf8_size_t preferred_capacity = JERRY_MAX (builder_p->capacity * 2, ECMA_STRINGBUILDER_INITIAL_CAPACITY);
+  preferred_capacity = JERRY_MAX (preferred_capacity, required_capacity + required_capacity / 8);
+
+  ecma_stringbuilder_resize (builder_p, required_capacity, preferred_capacity);
+} /* ecma_stringbuilder_grow */
+
+/**
+ * Append the specified number of uninitialized bytes to the end of the string builder
+ *
+ * @return pointer to the appended bytes
+ */
+static lit_utf8_byte_t *
+ecma_stringbuilder_append_space (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                 lit_utf8_size_t size) /**< number of bytes to append */
+{
+  const lit_utf8_size_t required_capacity = builder_p->size + size;
+  JERRY_ASSERT (required_capacity >= builder_p->size);
+
+  if (required_capacity > builder_p->capacity)
+  {
+    ecma_stringbuilder_grow (builder_p, required_capacity);
+  }
+
+  lit_utf8_byte_t *dest_p = builder_p->buffer_p + ecma_stringbuilder_get_header_size (builder_p->capacity);
+  dest_p += builder_p->size;
+  builder_p->size = required_capacity;
+
+  return dest_p;
+} /* ecma_stringbuilder_append_space */
+
+/**
+ * Turn the buffer of the string builder into an ecma-string
+ *
+ * The buffer becomes the character storage of the string without copying the characters,
+ * and the unused tail of the buffer is returned to the heap. The builder is left with an empty buffer.
+ *
+ * @return pointer to ecma-string descriptor
+ */
+static ecma_string_t *
+ecma_stringbuilder_buffer_to_string (ecma_stringbuilder_t *builder_p) /**< string builder */
+{
+  lit_utf8_byte_t *buffer_p = builder_p->buffer_p;
+  const lit_utf8_size_t size = builder_p->size;
+  const lit_utf8_size_t capacity = builder_p->capacity;
+  const size_t header_size = ecma_stringbuilder_get_header_size (capacity);
+  lit_utf8_byte_t *chars_p = buffer_p + header_size;
+
+  builder_p->buffer_p = NULL;
+  builder_p->size = 0;
+  builder_p->capacity = 0;
+
+  if (size == 0)
+  {
+    if (buffer_p != NULL)
+    {
+      mem_heap_free_block (buffer_p, header_size + capacity);
+    }
+
+    return ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+  }
+
+  JERRY_ASSERT (lit_is_cesu8_string_valid (chars_p, size));
+
+  lit_magic_string_id_t magic_string_id;
+  if (lit_is_utf8_string_magic (chars_p, size, &magic_string_id))
+  {
+    mem_heap_free_block (buffer_p, header_size + capacity);
+    return ecma_get_magic_string (magic_string_id);
+  }
+
+  lit_magic_string_ex_id_t magic_string_ex_id;
+  if (lit_is_ex_utf8_string_magic (chars_p, size, &magic_string_ex_id))
+  {
+    mem_heap_free_block (buffer_p, header_size + capacity);
+    return ecma_get_magic_string_ex (magic_string_ex_id);
+  }
+
+  const ecma_length_t length = lit_utf8_string_length (chars_p, size);
+  const lit_string_hash_t hash = lit_utf8_string_calc_hash (chars_p, size);
+
+  ecma_string_container_t container;
+  size_t data_size;
+
+  if (likely (size <= ECMA_STRING_HEAP_SHORT_MAX_SIZE))
+  {
+    ecma_string_heap_header_t *header_p = (ecma_string_heap_header_t *) buffer_p;
+
+    if (header_size != sizeof (ecma_string_heap_header_t))
+    {
+      /* The buffer has grown over the limit of short strings, but the characters still fit in a short string. */
+      memmove (header_p + 1, chars_p, size);
+    }
+
+    header_p->size = (uint16_t) size;
+    header_p->length = (uint16_t) length;
+
+    container = ECMA_STRING_CONTAINER_HEAP_CHUNKS;
+    data_size = sizeof (ecma_string_heap_header_t) + size;
+  }
+  else
+  {
+    JERRY_ASSERT (header_size == sizeof (ecma_string_long_header_t));
+
+    ecma_string_long_header_t *header_p = (ecma_string_long_header_t *) buffer_p;
+    header_p->chars_p = chars_p;
+    header_p->size = size;
+    header_p->length = length;
+
+    container = ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL;
+    data_size = sizeof (ecma_string_long_header_t) + size;
+  }
+
+  mem_heap_shrink_block (buffer_p, header_size + capacity, data_size);
+
+  ecma_string_t *string_desc_p = ecma_alloc_string ();
+  string_desc_p->refs_and_container = (uint16_t) (container | ECMA_STRING_REF_ONE);
+  string_desc_p->hash = hash;
+
+  string_desc_p->u.common_field = 0;
+  ECMA_SET_NON_NULL_POINTER (string_desc_p->u.collection_cp, buffer_p);
+
+  return string_desc_p;
+} /* ecma_stringbuilder_buffer_to_string */
+
+/**
+ * Concatenate an ecma-string to the prefix of the string builder
+ */
+static void
+ecma_stringbuilder_append_to_prefix (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                     ecma_string_t *string_p) /**< ecma-string */
+{
+  if (builder_p->prefix_p == NULL)
+  {
+    builder_p->prefix_p = ecma_copy_or_ref_ecma_string (string_p);
+  }
+  else
+  {
+    ecma_string_t *concat_p = ecma_concat_ecma_strings (builder_p->prefix_p, string_p);
+    ecma_deref_ecma_string (builder_p->prefix_p);
+    builder_p->prefix_p = concat_p;
+  }
+} /* ecma_stringbuilder_append_to_prefix */
+
+/**
+ * Append characters of an ecma-string to the string builder
+ */
+void
+ecma_stringbuilder_append (ecma_stringbuilder_t *builder_p, /**< string builder */
+                           ecma_string_t *string_p) /**< ecma-string */
+{
+  const lit_utf8_size_t size = ecma_string_get_size (string_p);
+
+  if (size == 0)
+  {
+    return;
+  }
+
+  if (size >= ECMA_STRINGBUILDER_REF_MIN_SIZE)
+  {
+    /* The string is referenced by a rope instead of being copied. */
+    if (builder_p->size > 0)
+    {
+      ecma_string_t *buffer_string_p = ecma_stringbuilder_buffer_to_string (builder_p);
+      ecma_stringbuilder_append_to_prefix (builder_p, buffer_string_p);
+      ecma_deref_ecma_string (buffer_string_p);
+    }
+
+    ecma_stringbuilder_append_to_prefix (builder_p, string_p);
+    return;
+  }
+
+  lit_utf8_byte_t *dest_p = ecma_stringbuilder_append_space (builder_p, size);
+
+  lit_utf8_size_t bytes_copied = ecma_string_to_utf8_string (string_p, dest_p, size);
+  JERRY_ASSERT (bytes_copied == size);
+} /* ecma_stringbuilder_append */
+
+/**
+ * Append characters of a magic string to the string builder
+ */
+void
+ecma_stringbuilder_append_magic (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                 lit_magic_string_id_t id) /**< magic string id */
+{
+  ecma_stringbuilder_append_raw (builder_p, lit_get_magic_string_utf8 (id), lit_get_magic_string_size (id));
+} /* ecma_stringbuilder_append_magic */
+
+/**
+ * Append a cesu-8 encoded character sequence to the string builder
+ */
+void
+ecma_stringbuilder_append_raw (ecma_stringbuilder_t *builder_p, /**< string builder */
+                               const lit_utf8_byte_t *chars_p, /**< characters */
+                               lit_utf8_size_t size) /**< size of the characters, in bytes */
+{
+  JERRY_ASSERT (chars_p != NULL || size == 0);
+
+  if (size == 0)
+  {
+    return;
+  }
+
+  lit_utf8_byte_t *dest_p = ecma_stringbuilder_append_space (builder_p, size);
+  memcpy (dest_p, chars_p, size);
+} /* ecma_stringbuilder_append_raw */
+
+/**
+ * Append the characters of a substring of an ecma-string to the string builder
+ *
+ * Note:
+ *      unlike ecma_string_substr followed by ecma_stringbuilder_append, the substring is not created
+ */
+void
+ecma_stringbuilder_append_substr (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                  const ecma_string_t *string_p, /**< ecma-string */
+                                  ecma_length_t start_pos, /**< start position */
+                                  ecma_length_t end_pos) /**< end position, should be less or equal than
+                                                          *   string length */
+{
+  JERRY_ASSERT (start_pos <= end_pos);
+  JERRY_ASSERT (end_pos <= ecma_string_get_length (string_p));
+
+  if (start_pos == end_pos)
+  {
+    return;
+  }
+
+  lit_utf8_size_t size;
+  bool is_ascii;
+  const lit_utf8_byte_t *chars_p = ecma_string_raw_chars (string_p, &size, &is_ascii);
+
+  if (chars_p == NULL)
+  {
+    ecma_string_t *substring_p = ecma_string_substr (string_p, start_pos, end_pos);
+    ecma_stringbuilder_append (builder_p, substring_p);
+    ecma_deref_ecma_string (substring_p);
+  }
+  else if (is_ascii)
+  {
+    ecma_stringbuilder_append_raw (builder_p, chars_p + start_pos, (lit_utf8_size_t) (end_pos - start_pos));
+  }
+  else
+  {
+    const ecma_length_t length = ecma_string_get_length (string_p);
+    const lit_utf8_size_t start_offset = ecma_string_get_char_offset (chars_p, size, length, start_pos);
+    const lit_utf8_size_t end_offset = ecma_string_get_char_offset (chars_p, size, length, end_pos);
+
+    ecma_stringbuilder_append_raw (builder_p, chars_p + start_offset, end_offset - start_offset);
+  }
+} /* ecma_stringbuilder_append_substr */
+
+/**
+ * Append a code unit to the string builder
+ */
+void
+ecma_stringbuilder_append_char (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                ecma_char_t code_unit) /**< code unit */
+{
+  lit_utf8_byte_t utf8_bytes[LIT_UTF8_MAX_BYTES_IN_CODE_UNIT];
+  lit_utf8_size_t size = lit_code_unit_to_utf8 (code_unit, utf8_bytes);
+
+  ecma_stringbuilder_append_raw (builder_p, utf8_bytes, size);
+} /* ecma_stringbuilder_append_char */
+
+/**
+ * Append an ASCII character to the string builder
+ */
+void
+ecma_stringbuilder_append_byte (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                lit_utf8_byte_t byte) /**< ASCII character */
+{
+  JERRY_ASSERT (byte <= LIT_UTF8_1_BYTE_CODE_POINT_MAX);
+
+  *ecma_stringbuilder_append_space (builder_p, 1) = byte;
+} /* ecma_stringbuilder_append_byte */
+
+/**
+ * Turn the contents of the string builder into an ecma-string
+ *
+ * The buffer of the builder becomes the character storage of the string without copying
+ * the characters, and the unused tail of the buffer is returned to the heap.
+ *
+ * Note:
+ *      the builder should not be used after the call (unless it is initialized again)
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_stringbuilder_finalize (ecma_stringbuilder_t *builder_p) /**< string builder */
+{
+  ecma_string_t *string_p = ecma_stringbuilder_buffer_to_string (builder_p);
+
+  if (builder_p->prefix_p == NULL)
+  {
+    return string_p;
+  }
+
+  ecma_stringbuilder_append_to_prefix (builder_p, string_p);
+  ecma_deref_ecma_string (string_p);
+
+  string_p = builder_p->prefix_p;
+  builder_p->prefix_p = NULL;
+
+  return string_p;
+} /* ecma_stringbuilder_finalize */
+
+/**
+ * Free the buffer and the prefix of the string builder, dropping its contents
+ */
+void
+ecma_stringbuilder_destroy (ecma_stringbuilder_t *builder_p) /**< string builder */
+{
+  if (builder_p->prefix_p != NULL)
+  {
+    ecma_deref_ecma_string (builder_p->prefix_p);
+    builder_p->prefix_p = NULL;
+  }
+
+  if (builder_p->buffer_p != NULL)
+  {
+    mem_heap_free_block (builder_p->buffer_p,
+                         ecma_stringbuilder_get_header_size (builder_p->capacity) + builder_p->capacity);
+    builder_p->buffer_p = NULL;
+  }
+} /* ecma_stringbuilder_destroy */
+
 /**
  * @}
  * @}
@@ -32,14 +32,103 @@
 JERRY_STATIC_ASSERT (sizeof (ecma_value_t) * JERRY_BITSINBYTE >= ECMA_VALUE_SIZE,
                      bits_in_ecma_value_t_must_be_greater_than_or_equal_to_ECMA_VALUE_SIZE);
 
+#ifndef CONFIG_ECMA_VALUE_NAN_BOXING
+
+JERRY_STATIC_ASSERT (sizeof (ecma_integer_value_t) == sizeof (ecma_value_t),
+                     size_of_ecma_integer_value_t_must_be_equal_to_size_of_ecma_value_t);
+
+/**
+ * Number of unused bits above the integer numbers, stored in ecma values
+ */
+#define ECMA_INTEGER_NUMBER_UNUSED_BITS \
+  (sizeof (ecma_value_t) * JERRY_BITSINBYTE - ECMA_VALUE_VALUE_POS - ECMA_INTEGER_NUMBER_WIDTH)
+
+/**
+ * Shift, which moves the integer number of an ecma value (shifted to the upper bits) to the lowest bits
+ */
+#define ECMA_INTEGER_NUMBER_SHIFT (ECMA_INTEGER_NUMBER_UNUSED_BITS + ECMA_VALUE_VALUE_POS)
+
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+
+JERRY_STATIC_ASSERT (sizeof (ecma_number_t) == sizeof (ecma_value_t),
+                     size_of_ecma_number_t_must_be_equal_to_size_of_ecma_value_t);
+
+/**
+ * Check if the ecma value is boxed, i.e. it is not a float number, stored in the value itself
+ *
+ * @return true - if the value is boxed,
+ *         false - otherwise.
+ */
+static inline bool __attr_const___ __attr_always_inline___
+ecma_is_value_boxed (ecma_value_t value) /**< ecma value */
+{
+  /* The tag bits are the most significant ones */
+  return value >= ECMA_VALUE_NAN_BOXING_TAG;
+} /* ecma_is_value_boxed */
+
+/**
+ * Get float number, stored in an unboxed ecma value
+ *
+ * @return the number
+ */
+static inline ecma_number_t __attr_const___ __attr_always_inline___
+ecma_get_unboxed_number_from_value (ecma_value_t value) /**< ecma value */
+{
+  JERRY_ASSERT (!ecma_is_value_boxed (value));
+
+  union
+  {
+    ecma_value_t value;
+    ecma_number_t float_value;
+  } u;
+
+  u.value = value;
+
+  return u.float_value;
+} /* ecma_get_unboxed_number_from_value */
+
+/**
+ * Unboxed number value constructor
+ *
+ * @return ecma value, storing the number
+ */
+static inline ecma_value_t __attr_const___ __attr_always_inline___
+ecma_make_unboxed_number_value (ecma_number_t number) /**< number */
+{
+  union
+  {
+    ecma_value_t value;
+    ecma_number_t float_value;
+  } u;
+
+  u.float_value = number;
+
+  if (unlikely (ecma_is_value_boxed (u.value)))
+  {
+    /* The number is a NaN, which representation overlaps with the one of boxed values */
+    return ECMA_VALUE_NAN_BOXING_NAN;
+  }
+
+  return u.value;
+} /* ecma_make_unboxed_number_value */
+
+#endif /* !CONFIG_ECMA_VALUE_NAN_BOXING */
+
 /**
  * Get type field of ecma value
  *
  * @return type field
  */
-ecma_type_t __attr_pure___
+inline ecma_type_t __attr_pure___ __attr_always_inline___
 ecma_get_value_type_field (ecma_value_t value) /**< ecma value */
 {
+#ifdef CONFIG_ECMA_VALUE_NAN_BOXING
+  if (!ecma_is_value_boxed (value))
+  {
+    return ECMA_TYPE_NUMBER;
+  }
+#endif /* CONFIG_ECMA_VALUE_NAN_BOXING */
+
   return (ecma_type_t) JRT_EXTRACT_BIT_FIELD (ecma_value_t, value,
                                               ECMA_VALUE_TYPE_POS,
                                               ECMA_VALUE_TYPE_WIDTH);
@@ -61,12 +150,19 @@ ecma_get_value_value_field (ecma_value_t value) /**< ecma value */
 /**
  * Set type field of ecma value
  *
+ * Note:
+ *      with NaN-boxing, the value becomes boxed
+ *
  * @return ecma value with updated field
  */
 static ecma_value_t __attr_pure___
 ecma_set_value_type_field (ecma_value_t value, /**< ecma value to set field in */
                            ecma_type_t type_field) /**< new field value */
 {
+#ifdef CONFIG_ECMA_VALUE_NAN_BOXING
+  value |= ECMA_VALUE_NAN_BOXING_TAG;
+#endif /* CONFIG_ECMA_VALUE_NAN_BOXING */
+
   return JRT_SET_BIT_FIELD_VALUE (ecma_value_t, value,
                                   type_field,
                                   ECMA_VALUE_TYPE_POS,
@@ -88,6 +184,47 @@ ecma_set_value_value_field (ecma_value_t value, /**< ecma value to set field in
                                   ECMA_VALUE_VALUE_WIDTH);
 } /* ecma_set_value_value_field */
 
+/**
+ * Get pointer, stored in value field of ecma value
+ *
+ * @return the pointer
+ */
+static inline void *__attr_pure___ __attr_always_inline___
+ecma_get_value_pointer_field (ecma_value_t value) /**< ecma value */
+{
+#ifndef CONFIG_ECMA_VALUE_NAN_BOXING
+  return ECMA_GET_NON_NULL_POINTER (void, ecma_get_value_value_field (value));
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+  return (void *) ecma_get_value_value_field (value);
+#endif /* !CONFIG_ECMA_VALUE_NAN_BOXING */
+} /* ecma_get_value_pointer_field */
+
+/**
+ * Store pointer in value field of ecma value
+ *
+ * Note:
+ *      with NaN-boxing the pointer is stored uncompressed, otherwise - as a compressed pointer
+ *
+ * @return ecma value with updated field
+ */
+static inline ecma_value_t __attr_pure___ __attr_always_inline___
+ecma_set_value_pointer_field (ecma_value_t value, /**< ecma value to set field in */
+                              const void *pointer_p) /**< non-NULL pointer */
+{
+  JERRY_ASSERT (pointer_p != NULL);
+
+#ifndef CONFIG_ECMA_VALUE_NAN_BOXING
+  mem_cpointer_t pointer_cp;
+  ECMA_SET_NON_NULL_POINTER (pointer_cp, pointer_p);
+
+  return ecma_set_value_value_field (value, pointer_cp);
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+  JERRY_ASSERT ((((uint64_t) (uintptr_t) pointer_p) >> ECMA_VALUE_VALUE_WIDTH) == 0);
+
+  return ecma_set_value_value_field (value, (uintptr_t) pointer_p);
+#endif /* !CONFIG_ECMA_VALUE_NAN_BOXING */
+} /* ecma_set_value_pointer_field */
+
 /**
  * Check if the value is empty.
  *
@@ -192,6 +329,54 @@ ecma_is_value_number (ecma_value_t value) /**< ecma value */
   return (ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER);
 } /* ecma_is_value_number */
 
+/**
+ * Check if the value is an integer ecma-number, stored in the value itself.
+ *
+ * @return true - if the value contains an integer ecma-number,
+ *         false - otherwise.
+ */
+inline bool __attr_pure___ __attr_always_inline___
+ecma_is_value_integer_number (ecma_value_t value) /**< ecma value */
+{
+#ifndef CONFIG_ECMA_VALUE_NAN_BOXING
+  return (value & ((1u << ECMA_VALUE_TYPE_WIDTH) - 1u)) == ECMA_TYPE_NUMBER
+         && (value & (1u << ECMA_VALUE_INTEGER_POS)) != 0;
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+  (void) value;
+
+  return false;
+#endif /* !CONFIG_ECMA_VALUE_NAN_BOXING */
+} /* ecma_is_value_integer_number */
+
+/**
+ * Check if both values are integer ecma-numbers, stored in the values themselves.
+ *
+ * @return true - if both values contain integer ecma-numbers,
+ *         false - otherwise.
+ */
+inline bool __attr_pure___ __attr_always_inline___
+ecma_are_values_integer_numbers (ecma_value_t first_value, /**< first ecma value */
+                                 ecma_value_t second_value) /**< second ecma value */
+{
+  return ecma_is_value_integer_number (first_value) && ecma_is_value_integer_number (second_value);
+} /* ecma_are_values_integer_numbers */
+
+/**
+ * Check if the value is ecma-number, which is allocated on the heap.
+ *
+ * @return true - if the value contains pointer to a heap-allocated ecma-number,
+ *         false - otherwise.
+ */
+inline bool __attr_pure___ __attr_always_inline___
+ecma_is_value_heap_number (ecma_value_t value) /**< ecma value */
+{
+#ifndef CONFIG_ECMA_VALUE_NAN_BOXING
+  return ecma_is_value_number (value) && !ecma_is_value_integer_number (value);
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+  return ecma_is_value_boxed (value) && ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER;
+#endif /* !CONFIG_ECMA_VALUE_NAN_BOXING */
+} /* ecma_is_value_heap_number */
+
 /**
  * Check if the value is ecma-string.
  *
@@ -225,7 +410,13 @@ ecma_is_value_object (ecma_value_t value) /**< ecma value */
 inline bool __attr_pure___ __attr_always_inline___
 ecma_is_value_error (ecma_value_t value) /**< ecma value */
 {
+#ifndef CONFIG_ECMA_VALUE_NAN_BOXING
   return (value & (1u << ECMA_VALUE_ERROR_POS)) != 0;
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+  const ecma_value_t error_bits = ECMA_VALUE_NAN_BOXING_TAG | (((ecma_value_t) 1) << ECMA_VALUE_ERROR_POS);
+
+  return (value & error_bits) == error_bits;
+#endif /* !CONFIG_ECMA_VALUE_NAN_BOXING */
 } /* ecma_is_value_error */
 
 /**
@@ -257,40 +448,117 @@ ecma_make_simple_value (const ecma_simple_value_t value) /**< simple value */
   return ret_value;
 } /* ecma_make_simple_value */
 
+/**
+ * Integer number value constructor
+ *
+ * @return ecma value, storing the integer
+ */
+inline ecma_value_t __attr_const___ __attr_always_inline___
+ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number */
+{
+  JERRY_ASSERT (integer_value >= ECMA_INTEGER_NUMBER_MIN && integer_value <= ECMA_INTEGER_NUMBER_MAX);
+
+#ifndef CONFIG_ECMA_VALUE_NAN_BOXING
+  /* The bits above the integer are cleared */
+  ecma_value_t value = (((ecma_value_t) integer_value) << ECMA_INTEGER_NUMBER_SHIFT) >> ECMA_INTEGER_NUMBER_UNUSED_BITS;
+
+  return value | (1u << ECMA_VALUE_INTEGER_POS) | ECMA_TYPE_NUMBER;
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+  return ecma_make_unboxed_number_value ((ecma_number_t) integer_value);
+#endif /* !CONFIG_ECMA_VALUE_NAN_BOXING */
+} /* ecma_make_integer_value */
+
 /**
  * Number value constructor
+ *
+ * Integer numbers in the [ECMA_INTEGER_NUMBER_MIN, ECMA_INTEGER_NUMBER_MAX] range (except -0)
+ * are stored in the value, other numbers are allocated on the heap.
+ * With NaN-boxing, all numbers are stored in the value.
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
  */
-ecma_value_t __attr_const___
-ecma_make_number_value (const ecma_number_t *num_p) /**< number to reference in value */
+ecma_value_t
+ecma_make_number_value (ecma_number_t number) /**< number */
 {
-  JERRY_ASSERT (num_p != NULL);
+#ifdef CONFIG_ECMA_VALUE_NAN_BOXING
+  return ecma_make_unboxed_number_value (number);
+#else /* !CONFIG_ECMA_VALUE_NAN_BOXING */
+#ifndef CONFIG_ECMA_INTEGER_VALUES_DISABLE
+  /* The comparisons are false for NaN */
+  if (number >= (ecma_number_t) ECMA_INTEGER_NUMBER_MIN
+      && number <= (ecma_number_t) ECMA_INTEGER_NUMBER_MAX)
+  {
+    ecma_integer_value_t integer_value = (ecma_integer_value_t) number;
+
+    if ((ecma_number_t) integer_value == number
+        && (integer_value != 0 || !ecma_number_is_negative (number)))
+    {
+      return ecma_make_integer_value (integer_value);
+    }
+  }
+#endif /* !CONFIG_ECMA_INTEGER_VALUES_DISABLE */
 
-  mem_cpointer_t num_cp;
-  ECMA_SET_NON_NULL_POINTER (num_cp, num_p);
+  ecma_number_t *num_p = ecma_alloc_number ();
+  *num_p = number;
 
   ecma_value_t ret_value = 0;
 
   ret_value = ecma_set_value_type_field (ret_value, ECMA_TYPE_NUMBER);
-  ret_value = ecma_set_value_value_field (ret_value, num_cp);
+  ret_value = ecma_set_value_pointer_field (ret_value, num_p);
 
   return ret_value;
+#endif /* CONFIG_ECMA_VALUE_NAN_BOXING */
 } /* ecma_make_number_value */
 
+/**
+ * Number value constructor for int32_t numbers
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_make_int32_value (int32_t number) /**< number */
+{
+#ifndef CONFIG_ECMA_INTEGER_VALUES_DISABLE
+  if (number >= ECMA_INTEGER_NUMBER_MIN && number <= ECMA_INTEGER_NUMBER_MAX)
+  {
+    return ecma_make_integer_value ((ecma_integer_value_t) number);
+  }
+#endif /* !CONFIG_ECMA_INTEGER_VALUES_DISABLE */
+
+  return ecma_make_number_value ((ecma_number_t) number);
+} /* ecma_make_int32_value */
+
+/**
+ * Number value constructor for uint32_t numbers
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_make_uint32_value (uint32_t number) /**< number */
+{
+#ifndef CONFIG_ECMA_INTEGER_VALUES_DISABLE
+  if (number <= (uint32_t) ECMA_INTEGER_NUMBER_MAX)
+  {
+    return ecma_make_integer_value ((ecma_integer_value_t) number);
+  }
+#endif /* !CONFIG_ECMA_INTEGER_VALUES_DISABLE */
+
+  return ecma_make_number_value ((ecma_number_t) number);
+} /* ecma_make_uint32_value */
+
 /**
  * String value constructor
  */
 ecma_value_t __attr_const___
 ecma_make_string_value (const ecma_string_t *ecma_string_p) /**< string to reference in value */
 {
-  JERRY_ASSERT (ecma_string_p != NULL);
-
-  mem_cpointer_t string_cp;
-  ECMA_SET_NON_NULL_POINTER (string_cp, ecma_string_p);
-
   ecma_value_t ret_value = 0;
 
   ret_value = ecma_set_value_type_field (ret_value, ECMA_TYPE_STRING);
-  ret_value = ecma_set_value_value_field (ret_value, string_cp);
+  ret_value = ecma_set_value_pointer_field (ret_value, ecma_string_p);
 
   return ret_value;
 } /* ecma_make_string_value */
@@ -301,29 +569,38 @@ ecma_make_string_value (const ecma_string_t *ecma_string_p) /**< string to refer
 ecma_value_t __attr_const___
 ecma_make_object_value (const ecma_object_t *object_p) /**< object to reference in value */
 {
-  JERRY_ASSERT (object_p != NULL);
-
-  mem_cpointer_t object_cp;
-  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
-
   ecma_value_t ret_value = 0;
 
   ret_value = ecma_set_value_type_field (ret_value, ECMA_TYPE_OBJECT);
-  ret_value = ecma_set_value_value_field (ret_value, object_cp);
+  ret_value = ecma_set_value_pointer_field (ret_value, object_p);
 
   return ret_value;
 } /* ecma_make_object_value */
 
 /**
  * Error value constructor
+ *
+ * Note:
+ *      with NaN-boxing, numbers are moved to the heap, as only boxed values can be error values
  */
-ecma_value_t __attr_const___
+ecma_value_t
 ecma_make_error_value (ecma_value_t value) /**< original ecma value */
 {
   /* Error values cannot be converted. */
   JERRY_ASSERT (!ecma_is_value_error (value));
 
-  return value | (1u << ECMA_VALUE_ERROR_POS);
+#ifdef CONFIG_ECMA_VALUE_NAN_BOXING
+  if (!ecma_is_value_boxed (value))
+  {
+    ecma_number_t *num_p = ecma_alloc_number ();
+    *num_p = ecma_get_unboxed_number_from_value (value);
+
+    value = ecma_set_value_type_field (0, ECMA_TYPE_NUMBER);
+    value = ecma_set_value_pointer_field (value, num_p);
+  }
+#endif /* CONFIG_ECMA_VALUE_NAN_BOXING */
+
+  return value | (((ecma_value_t) 1) << ECMA_VALUE_ERROR_POS);
 } /* ecma_make_error_value */
 
 
@@ -337,19 +614,60 @@ ecma_make_error_obj_value (const ecma_object_t *object_p) /**< object to referen
 } /* ecma_make_error_obj_value */
 
 /**
- * Get pointer to ecma-number from ecma value
+ * Get integer number from ecma value
  *
- * @return the pointer
+ * @return the integer
  */
-ecma_number_t *__attr_pure___
+inline ecma_integer_value_t __attr_const___ __attr_always_inline___
+ecma_get_integer_from_value (ecma_value_t value) /**< ecma value */
+{
+  JERRY_ASSERT (ecma_is_value_integer_number (value));
+
+#ifndef CONFIG_ECMA_VALUE_NAN_BOXING
+  /* Arithmetic shift restores the sign of the integer */
+  return ((ecma_integer_value_t) (value << ECMA_INTEGER_NUMBER_UNUSED_BITS)) >> ECMA_INTEGER_NUMBER_SHIFT;
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+  return (ecma_integer_value_t) ecma_get_unboxed_number_from_value (value);
+#endif /* !CONFIG_ECMA_VALUE_NAN_BOXING */
+} /* ecma_get_integer_from_value */
+
+/**
+ * Get ecma-number from ecma value
+ *
+ * @return the number
+ */
+ecma_number_t __attr_pure___
 ecma_get_number_from_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER);
 
-  return ECMA_GET_NON_NULL_POINTER (ecma_number_t,
-                                    ecma_get_value_value_field (value));
+#ifndef CONFIG_ECMA_VALUE_NAN_BOXING
+  if (ecma_is_value_integer_number (value))
+  {
+    return (ecma_number_t) ecma_get_integer_from_value (value);
+  }
+#else /* CONFIG_ECMA_VALUE_NAN_BOXING */
+  if (likely (!ecma_is_value_boxed (value)))
+  {
+    return ecma_get_unboxed_number_from_value (value);
+  }
+#endif /* !CONFIG_ECMA_VALUE_NAN_BOXING */
+
+  return *(ecma_number_t *) ecma_get_value_pointer_field (value);
 } /* ecma_get_number_from_value */
 
+/**
+ * Overwrite the ecma-number referenced by an ecma value, which stores the number on the heap
+ */
+void
+ecma_update_heap_number_value (ecma_value_t value, /**< ecma value */
+                               ecma_number_t number) /**< new number */
+{
+  JERRY_ASSERT (ecma_is_value_heap_number (value));
+
+  *(ecma_number_t *) ecma_get_value_pointer_field (value) = number;
+} /* ecma_update_heap_number_value */
+
 /**
  * Get pointer to ecma-string from ecma value
  *
@@ -360,8 +678,7 @@ ecma_get_string_from_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_STRING);
 
-  return ECMA_GET_NON_NULL_POINTER (ecma_string_t,
-                                    ecma_get_value_value_field (value));
+  return (ecma_string_t *) ecma_get_value_pointer_field (value);
 } /* ecma_get_string_from_value */
 
 /**
@@ -374,8 +691,7 @@ ecma_get_object_from_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_OBJECT);
 
-  return ECMA_GET_NON_NULL_POINTER (ecma_object_t,
-                                    ecma_get_value_value_field (value));
+  return (ecma_object_t *) ecma_get_value_pointer_field (value);
 } /* ecma_get_object_from_value */
 
 /**
@@ -388,7 +704,7 @@ ecma_get_value_from_error_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ecma_is_value_error (value));
 
-  value = (ecma_value_t) (value & ~(1u << ECMA_VALUE_ERROR_POS));
+  value = (ecma_value_t) (value & ~(((ecma_value_t) 1) << ECMA_VALUE_ERROR_POS));
 
   JERRY_ASSERT (!ecma_is_value_error (value));
 
@@ -411,12 +727,20 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
     }
     case ECMA_TYPE_NUMBER:
     {
-      ecma_number_t *num_p = ecma_get_number_from_value (value);
-
+      if (!ecma_is_value_heap_number (value))
+      {
+        return value;
+      }
+
+#ifdef CONFIG_ECMA_VALUE_NAN_BOXING
+      /* The copy is not boxed */
+      return ecma_make_number_value (ecma_get_number_from_value (value));
+#else /* !CONFIG_ECMA_VALUE_NAN_BOXING */
       ecma_number_t *number_copy_p = ecma_alloc_number ();
-      *number_copy_p = *num_p;
+      *number_copy_p = ecma_get_number_from_value (value);
 
-      return ecma_make_number_value (number_copy_p);
+      return ecma_set_value_pointer_field (value, number_copy_p);
+#endif /* CONFIG_ECMA_VALUE_NAN_BOXING */
     }
     case ECMA_TYPE_STRING:
     {
@@ -464,8 +788,10 @@ ecma_free_value (ecma_value_t value) /**< value description */
 
     case ECMA_TYPE_NUMBER:
     {
-      ecma_number_t *number_p = ecma_get_number_from_value (value);
-      ecma_dealloc_number (number_p);
+      if (ecma_is_value_heap_number (value))
+      {
+        ecma_dealloc_number ((ecma_number_t *) ecma_get_value_pointer_field (value));
+      }
       break;
     }
 
@@ -25,10 +25,17 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "ecma-intern.h"
 #include "ecma-lcache.h"
+#include "ecma-property-hashmap.h"
+#include "ecma-shapes.h"
 #include "jrt-bit-fields.h"
 #include "byte-code.h"
 #include "re-compiler.h"
+#include "vm-inline-cache.h"
+
+#define JERRY_INTERNAL
+#include "jerry-internal.h"
 
 /**
  * Create an object with specified prototype object
@@ -48,30 +55,23 @@ ecma_create_object (ecma_object_t *prototype_object_p, /**< pointer to prototybe
 
   ecma_init_gc_info (object_p);
 
-  object_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, object_p->container,
-                                                 ECMA_NULL_POINTER,
-                                                 ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                 ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  object_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, object_p->container,
+  ECMA_OBJECT_SET_CP_FIELD (object_p, PROPERTIES_OR_BOUND_OBJECT, ECMA_NULL_POINTER);
+  object_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t, object_p->container,
                                                  false,
                                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
                                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
-  object_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, object_p->container,
+  object_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t, object_p->container,
                                                  is_extensible,
                                                  ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
                                                  ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
-  object_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, object_p->container,
+  object_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t, object_p->container,
                                                  type,
                                                  ECMA_OBJECT_OBJ_TYPE_POS,
                                                  ECMA_OBJECT_OBJ_TYPE_WIDTH);
 
-  uint64_t prototype_object_cp;
+  mem_cpointer_t prototype_object_cp;
   ECMA_SET_POINTER (prototype_object_cp, prototype_object_p);
-
-  object_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, object_p->container,
-                                                 prototype_object_cp,
-                                                 ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS,
-                                                 ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
+  ECMA_OBJECT_SET_CP_FIELD (object_p, OBJ_PROTOTYPE_OBJECT, prototype_object_cp);
 
   ecma_set_object_is_builtin (object_p, false);
 
@@ -95,32 +95,29 @@ ecma_create_decl_lex_env (ecma_object_t *outer_lexical_environment_p) /**< outer
 
   ecma_init_gc_info (new_lexical_environment_p);
 
-  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, new_lexical_environment_p->container,
-                                                                  ECMA_NULL_POINTER,
-                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, new_lexical_environment_p->container,
+  ECMA_OBJECT_SET_CP_FIELD (new_lexical_environment_p, PROPERTIES_OR_BOUND_OBJECT, ECMA_NULL_POINTER);
+  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t,
+                                                                  new_lexical_environment_p->container,
                                                                   true,
                                                                   ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
                                                                   ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
 
-  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, new_lexical_environment_p->container,
+  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t,
+                                                                  new_lexical_environment_p->container,
                                                                   ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE,
                                                                   ECMA_OBJECT_LEX_ENV_TYPE_POS,
                                                                   ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
 
-  uint64_t outer_reference_cp;
+  mem_cpointer_t outer_reference_cp;
   ECMA_SET_POINTER (outer_reference_cp, outer_lexical_environment_p);
-  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, new_lexical_environment_p->container,
-                                                                  outer_reference_cp,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
+  ECMA_OBJECT_SET_CP_FIELD (new_lexical_environment_p, LEX_ENV_OUTER_REFERENCE, outer_reference_cp);
 
   /*
    * Declarative lexical environments do not really have the flag,
    * but to not leave the value initialized, setting the flag to false.
    */
-  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, new_lexical_environment_p->container,
+  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t,
+                                                                  new_lexical_environment_p->container,
                                                                   false,
                                                                   ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
                                                                   ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
@@ -150,34 +147,31 @@ ecma_create_object_lex_env (ecma_object_t *outer_lexical_environment_p, /**< out
 
   ecma_init_gc_info (new_lexical_environment_p);
 
-  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, new_lexical_environment_p->container,
+  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t,
+                                                                  new_lexical_environment_p->container,
                                                                   true,
                                                                   ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
                                                                   ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
 
-  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, new_lexical_environment_p->container,
+  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t,
+                                                                  new_lexical_environment_p->container,
                                                                   ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND,
                                                                   ECMA_OBJECT_LEX_ENV_TYPE_POS,
                                                                   ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
 
-  uint64_t outer_reference_cp;
+  mem_cpointer_t outer_reference_cp;
   ECMA_SET_POINTER (outer_reference_cp, outer_lexical_environment_p);
-  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, new_lexical_environment_p->container,
-                                                                  outer_reference_cp,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
+  ECMA_OBJECT_SET_CP_FIELD (new_lexical_environment_p, LEX_ENV_OUTER_REFERENCE, outer_reference_cp);
 
-  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, new_lexical_environment_p->container,
+  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t,
+                                                                  new_lexical_environment_p->container,
                                                                   provide_this,
                                                                   ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
                                                                   ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
 
-  uint64_t bound_object_cp;
+  mem_cpointer_t bound_object_cp;
   ECMA_SET_NON_NULL_POINTER (bound_object_cp, binding_obj_p);
-  new_lexical_environment_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, new_lexical_environment_p->container,
-                                                                  bound_object_cp,
-                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  ECMA_OBJECT_SET_CP_FIELD (new_lexical_environment_p, PROPERTIES_OR_BOUND_OBJECT, bound_object_cp);
 
   return new_lexical_environment_p;
 } /* ecma_create_object_lex_env */
@@ -190,7 +184,7 @@ ecma_is_lexical_environment (const ecma_object_t *object_p) /**< object or lexic
 {
   JERRY_ASSERT (object_p != NULL);
 
-  return (bool) JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
+  return (bool) JRT_EXTRACT_BIT_FIELD (ecma_object_container_t, object_p->container,
                                        ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
                                        ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
 } /* ecma_is_lexical_environment */
@@ -204,7 +198,7 @@ ecma_get_object_extensible (const ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  return (bool) JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
+  return (bool) JRT_EXTRACT_BIT_FIELD (ecma_object_container_t, object_p->container,
                                        ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
                                        ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
 } /* ecma_get_object_extensible */
@@ -219,7 +213,7 @@ ecma_set_object_extensible (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  object_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, object_p->container,
+  object_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t, object_p->container,
                                                  is_extensible,
                                                  ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
                                                  ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
@@ -234,7 +228,7 @@ ecma_get_object_type (const ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  return (ecma_object_type_t) JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
+  return (ecma_object_type_t) JRT_EXTRACT_BIT_FIELD (ecma_object_container_t, object_p->container,
                                                      ECMA_OBJECT_OBJ_TYPE_POS,
                                                      ECMA_OBJECT_OBJ_TYPE_WIDTH);
 } /* ecma_get_object_type */
@@ -249,7 +243,7 @@ ecma_set_object_type (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  object_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, object_p->container,
+  object_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t, object_p->container,
                                                  type,
                                                  ECMA_OBJECT_OBJ_TYPE_POS,
                                                  ECMA_OBJECT_OBJ_TYPE_WIDTH);
@@ -264,10 +258,7 @@ ecma_get_object_prototype (const ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
-  uintptr_t prototype_object_cp = (uintptr_t) JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
-                                                                     ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS,
-                                                                     ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
+  mem_cpointer_t prototype_object_cp = ECMA_OBJECT_GET_CP_FIELD (object_p, OBJ_PROTOTYPE_OBJECT);
   return ECMA_GET_POINTER (ecma_object_t,
                            prototype_object_cp);
 } /* ecma_get_object_prototype */
@@ -288,7 +279,7 @@ ecma_get_object_is_builtin (const ecma_object_t *object_p) /**< object */
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= width);
 
-  uintptr_t flag_value = (uintptr_t) JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
+  uintptr_t flag_value = (uintptr_t) JRT_EXTRACT_BIT_FIELD (ecma_object_container_t, object_p->container,
                                                             offset,
                                                             width);
 
@@ -308,7 +299,7 @@ ecma_set_object_is_builtin (ecma_object_t *object_p, /**< object */
   const uint32_t offset = ECMA_OBJECT_OBJ_IS_BUILTIN_POS;
   const uint32_t width = ECMA_OBJECT_OBJ_IS_BUILTIN_WIDTH;
 
-  object_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, object_p->container,
+  object_p->container = JRT_SET_BIT_FIELD_VALUE (ecma_object_container_t, object_p->container,
                                                  is_builtin,
                                                  offset,
                                                  width);
@@ -323,7 +314,7 @@ ecma_get_lex_env_type (const ecma_object_t *object_p) /**< lexical environment *
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (ecma_is_lexical_environment (object_p));
 
-  return (ecma_lexical_environment_type_t) JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
+  return (ecma_lexical_environment_type_t) JRT_EXTRACT_BIT_FIELD (ecma_object_container_t, object_p->container,
                                                                   ECMA_OBJECT_LEX_ENV_TYPE_POS,
                                                                   ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
 } /* ecma_get_lex_env_type */
@@ -337,10 +328,7 @@ ecma_get_lex_env_outer_reference (const ecma_object_t *object_p) /**< lexical en
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (ecma_is_lexical_environment (object_p));
 
-  JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
-  uintptr_t outer_reference_cp = (uintptr_t) JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
-                                                                    ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
-                                                                    ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
+  mem_cpointer_t outer_reference_cp = ECMA_OBJECT_GET_CP_FIELD (object_p, LEX_ENV_OUTER_REFERENCE);
   return ECMA_GET_POINTER (ecma_object_t,
                            outer_reference_cp);
 } /* ecma_get_lex_env_outer_reference */
@@ -358,10 +346,7 @@ ecma_get_property_list (const ecma_object_t *object_p) /**< object or lexical en
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p) ||
                 ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
 
-  JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  uintptr_t properties_cp = (uintptr_t) JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
-                                                               ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                               ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  mem_cpointer_t properties_cp = ECMA_OBJECT_GET_CP_FIELD (object_p, PROPERTIES_OR_BOUND_OBJECT);
   return ECMA_GET_POINTER (ecma_property_t,
                            properties_cp);
 } /* ecma_get_property_list */
@@ -380,15 +365,341 @@ ecma_set_property_list (ecma_object_t *object_p, /**< object or lexical environm
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p) ||
                 ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
 
-  uint64_t properties_cp;
+  mem_cpointer_t properties_cp;
   ECMA_SET_POINTER (properties_cp, property_list_p);
-
-  object_p->container = JRT_SET_BIT_FIELD_VALUE (uint64_t, object_p->container,
-                                                 properties_cp,
-                                                 ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                 ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  ECMA_OBJECT_SET_CP_FIELD (object_p, PROPERTIES_OR_BOUND_OBJECT, properties_cp);
 } /* ecma_set_property_list */
 
+JERRY_STATIC_ASSERT (offsetof (ecma_property_slots_header_t, flags) == offsetof (ecma_property_t, flags)
+                     && offsetof (ecma_property_slot_t, flags) == offsetof (ecma_property_t, flags),
+                     flags_of_property_slots_must_be_placed_at_the_same_offset_as_in_ecma_property_t);
+
+JERRY_STATIC_ASSERT (offsetof (ecma_property_slots_header_t, next_property_p)
+                     == offsetof (ecma_property_t, next_property_p),
+                     next_property_p_of_property_slots_header_must_be_placed_at_the_same_offset_as_in_ecma_property_t);
+
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+JERRY_STATIC_ASSERT (offsetof (ecma_property_slot_t, value_high)
+                     == offsetof (ecma_property_t, h.named_data_property_value_high),
+                     value_high_of_property_slot_must_be_placed_at_the_same_offset_as_in_ecma_property_t);
+#endif /* !CONFIG_MEM_CPOINTER_32_BIT */
+
+JERRY_STATIC_ASSERT (sizeof (ecma_property_slots_header_t) % sizeof (ecma_property_slot_t) == 0,
+                     size_of_property_slots_header_must_be_multiple_of_size_of_property_slot);
+
+/**
+ * Number of slots, by which the array of a shaped object's slots is grown
+ *
+ * The heap allocates blocks, which sizes are multiples of MEM_ALIGNMENT, so the slots fill the whole block.
+ */
+#define ECMA_PROPERTY_SLOTS_GROWTH ((uint32_t) (MEM_ALIGNMENT / sizeof (ecma_property_slot_t)))
+
+/**
+ * Get header of the object's slots
+ *
+ * @return pointer to the header,
+ *         or NULL - if the object's properties are not shaped
+ */
+ecma_property_slots_header_t *
+ecma_get_property_slots (const ecma_object_t *object_p) /**< object */
+{
+  if (ecma_is_lexical_environment (object_p))
+  {
+    return NULL;
+  }
+
+  ecma_property_t *list_head_p = ecma_get_property_list (object_p);
+
+  if (list_head_p != NULL
+      && list_head_p->flags == ECMA_PROPERTY_FLAG_SHAPED)
+  {
+    return (ecma_property_slots_header_t *) list_head_p;
+  }
+
+  return NULL;
+} /* ecma_get_property_slots */
+
+/**
+ * Get a slot of shaped object
+ *
+ * @return pointer to the slot, that is used as the property's descriptor
+ */
+ecma_property_t *
+ecma_get_property_slot (ecma_property_slots_header_t *slots_header_p, /**< header of the object's slots */
+                        uint32_t index) /**< index of the slot */
+{
+  JERRY_ASSERT (index < slots_header_p->slots_number);
+
+  ecma_property_slot_t *slots_p = (ecma_property_slot_t *) (slots_header_p + 1);
+
+  return (ecma_property_t *) (slots_p + index);
+} /* ecma_get_property_slot */
+
+/**
+ * Get index of a slot of shaped object
+ *
+ * @return the index
+ */
+uint32_t
+ecma_get_property_slot_index (ecma_property_slots_header_t *slots_header_p, /**< header of the object's slots */
+                              const ecma_property_t *prop_p) /**< slot */
+{
+  JERRY_ASSERT (prop_p->flags & ECMA_PROPERTY_FLAG_SHAPED);
+
+  ecma_property_slot_t *slots_p = (ecma_property_slot_t *) (slots_header_p + 1);
+  uint32_t index = (uint32_t) ((const ecma_property_slot_t *) prop_p - slots_p);
+
+  JERRY_ASSERT (index < slots_header_p->slots_number);
+
+  return index;
+} /* ecma_get_property_slot_index */
+
+/**
+ * Get name of a named data property, stored in a slot of shaped object
+ *
+ * @return pointer to the name (the reference counter is not increased)
+ */
+ecma_string_t *
+ecma_get_property_slot_name (ecma_property_slots_header_t *slots_header_p, /**< header of the object's slots */
+                             uint32_t index) /**< index of the slot */
+{
+  return ecma_shape_get_property_name (ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_header_p->shape_cp), index);
+} /* ecma_get_property_slot_name */
+
+/**
+ * Link the property record into the object's property list
+ *
+ * The header of the object's slots is always put to start of the list. Other records are put to start of the list,
+ * or right after the header of the slots, the property hashmap and the dense storage of array's elements
+ * or the description of a typed array, which are always the list's first records.
+ */
+static void
+ecma_link_property (ecma_object_t *object_p, /**< object or lexical environment */
+                    ecma_property_t *prop_p) /**< property record */
+{
+  ecma_property_t *prev_prop_p = NULL;
+  ecma_property_t *list_head_p = ecma_get_property_list (object_p);
+
+  if (prop_p->flags == ECMA_PROPERTY_FLAG_SHAPED)
+  {
+    /* The header of the slots precedes any internal properties, that are kept at start of the list */
+    JERRY_ASSERT (ecma_get_property_slots (object_p) == NULL);
+
+    ECMA_SET_POINTER (prop_p->next_property_p, list_head_p);
+    ecma_set_property_list (object_p, prop_p);
+
+    return;
+  }
+
+  if (list_head_p != NULL
+      && list_head_p->flags == ECMA_PROPERTY_FLAG_SHAPED)
+  {
+    JERRY_ASSERT (ecma_get_property_slots (object_p) != NULL);
+
+    prev_prop_p = list_head_p;
+    list_head_p = ECMA_GET_POINTER (ecma_property_t, list_head_p->next_property_p);
+  }
+
+  if (list_head_p != NULL
+      && (list_head_p->flags & ECMA_PROPERTY_FLAG_INTERNAL)
+      && list_head_p->h.internal_property_type == ECMA_INTERNAL_PROPERTY_PROPERTY_HASHMAP)
+  {
+    prev_prop_p = list_head_p;
+    list_head_p = ECMA_GET_POINTER (ecma_property_t, list_head_p->next_property_p);
+  }
+
+  /* The hashmap is put before the dense storage of array's elements (see also: ecma_array_elements_t)
+   * and the description of a typed array (see also: ecma_arraybuffer_view_t) */
+  if (list_head_p != NULL
+      && (list_head_p->flags & ECMA_PROPERTY_FLAG_INTERNAL)
+      && (list_head_p->h.internal_property_type == ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES
+          || list_head_p->h.internal_property_type == ECMA_INTERNAL_PROPERTY_ARRAYBUFFER_VIEW)
+      && !((prop_p->flags & ECMA_PROPERTY_FLAG_INTERNAL)
+           && prop_p->h.internal_property_type == ECMA_INTERNAL_PROPERTY_PROPERTY_HASHMAP))
+  {
+    prev_prop_p = list_head_p;
+  }
+
+  if (prev_prop_p != NULL)
+  {
+    prop_p->next_property_p = prev_prop_p->next_property_p;
+    ECMA_SET_NON_NULL_POINTER (prev_prop_p->next_property_p, prop_p);
+  }
+  else
+  {
+    ECMA_SET_POINTER (prop_p->next_property_p, list_head_p);
+    ecma_set_property_list (object_p, prop_p);
+  }
+} /* ecma_link_property */
+
+#ifndef CONFIG_ECMA_SHAPES_DISABLE
+/**
+ * Reallocate array of the object's slots, so that one more slot could be used
+ *
+ * Note:
+ *      LCache entries of the slots are invalidated, as the slots are moved
+ *
+ * @return pointer to header of the slots
+ */
+static ecma_property_slots_header_t *
+ecma_grow_property_slots (ecma_object_t *object_p, /**< object */
+                          ecma_property_slots_header_t *slots_header_p) /**< header of the object's slots,
+                                                                         *   or NULL - if the object is not
+                                                                         *   shaped yet */
+{
+  uint32_t slots_number = 0;
+  uint32_t slots_capacity = 0;
+
+  if (slots_header_p != NULL)
+  {
+    slots_number = slots_header_p->slots_number;
+    slots_capacity = slots_header_p->slots_capacity;
+
+    if (slots_number < slots_capacity)
+    {
+      return slots_header_p;
+    }
+
+    for (uint32_t index = 0; index < slots_number; index++)
+    {
+      ecma_property_t *slot_p = ecma_get_property_slot (slots_header_p, index);
+
+      if ((slot_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
+          && ecma_is_property_lcached (slot_p))
+      {
+        ecma_lcache_invalidate (object_p, NULL, slot_p);
+      }
+    }
+  }
+
+  uint32_t new_slots_capacity = JERRY_MIN (slots_capacity + ECMA_PROPERTY_SLOTS_GROWTH,
+                                           CONFIG_ECMA_SHAPE_MAX_PROPERTIES);
+  size_t new_size = sizeof (ecma_property_slots_header_t) + new_slots_capacity * sizeof (ecma_property_slot_t);
+
+  ecma_property_slots_header_t *new_slots_header_p;
+  new_slots_header_p = (ecma_property_slots_header_t *) mem_heap_alloc_block (new_size);
+
+  if (slots_header_p != NULL)
+  {
+    memcpy (new_slots_header_p,
+            slots_header_p,
+            sizeof (ecma_property_slots_header_t) + slots_number * sizeof (ecma_property_slot_t));
+
+    mem_heap_free_block (slots_header_p,
+                         sizeof (ecma_property_slots_header_t) + slots_capacity * sizeof (ecma_property_slot_t));
+
+    ecma_set_property_list (object_p, (ecma_property_t *) new_slots_header_p);
+  }
+  else
+  {
+    new_slots_header_p->flags = ECMA_PROPERTY_FLAG_SHAPED;
+    new_slots_header_p->slots_number = 0;
+    new_slots_header_p->shape_cp = ECMA_NULL_POINTER;
+    new_slots_header_p->is_closed = false;
+
+    ecma_link_property (object_p, (ecma_property_t *) new_slots_header_p);
+  }
+
+  new_slots_header_p->slots_capacity = (uint8_t) new_slots_capacity;
+
+  return new_slots_header_p;
+} /* ecma_grow_property_slots */
+
+/**
+ * Check whether there are named properties in the object's property list
+ *
+ * @return true / false
+ */
+static bool
+ecma_has_named_property_records (const ecma_object_t *object_p) /**< object */
+{
+  for (ecma_property_t *property_p = ecma_get_property_list (object_p);
+       property_p != NULL;
+       property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
+  {
+    if (property_p->flags & (ECMA_PROPERTY_FLAG_NAMEDDATA | ECMA_PROPERTY_FLAG_NAMEDACCESSOR))
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* ecma_has_named_property_records */
+
+/**
+ * Try to allocate a slot for a new named data property of the object, transitioning the object to the next shape
+ *
+ * @return pointer to the slot (flags and value of the slot are not initialized),
+ *         or NULL - if the property should be stored in the object's property list
+ */
+static ecma_property_slot_t *
+ecma_create_property_slot (ecma_object_t *object_p, /**< object */
+                           ecma_string_t *name_p) /**< property's name */
+{
+  ecma_property_slots_header_t *slots_header_p = ecma_get_property_slots (object_p);
+
+  if (slots_header_p == NULL)
+  {
+    /*
+     * Only ordinary objects are shaped: properties of other objects are often instantiated lazily,
+     * or have special semantics. The header is created upon the first named data property,
+     * and if there are named accessor properties already, the shape is closed right away,
+     * so that the slots would not precede the accessors upon enumeration.
+     */
+    if (ecma_is_lexical_environment (object_p)
+        || ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_GENERAL
+        || ecma_get_object_is_builtin (object_p))
+    {
+      return NULL;
+    }
+  }
+  else if (slots_header_p->is_closed)
+  {
+    return NULL;
+  }
+
+  ecma_shape_t *shape_p = NULL;
+
+  if (slots_header_p != NULL)
+  {
+    shape_p = ECMA_GET_POINTER (ecma_shape_t, slots_header_p->shape_cp);
+  }
+
+  ecma_shape_t *new_shape_p = NULL;
+
+  if (slots_header_p != NULL || !ecma_has_named_property_records (object_p))
+  {
+    new_shape_p = ecma_shape_transition (shape_p, name_p);
+  }
+
+  if (new_shape_p == NULL)
+  {
+    if (slots_header_p == NULL)
+    {
+      slots_header_p = ecma_grow_property_slots (object_p, NULL);
+    }
+
+    slots_header_p->is_closed = true;
+
+    return NULL;
+  }
+
+  slots_header_p = ecma_grow_property_slots (object_p, slots_header_p);
+
+  if (shape_p != NULL)
+  {
+    ecma_shape_deref (shape_p);
+  }
+
+  ECMA_SET_NON_NULL_POINTER (slots_header_p->shape_cp, new_shape_p);
+
+  uint32_t index = slots_header_p->slots_number++;
+  JERRY_ASSERT (index == new_shape_p->index);
+
+  return (ecma_property_slot_t *) ecma_get_property_slot (slots_header_p, index);
+} /* ecma_create_property_slot */
+#endif /* !CONFIG_ECMA_SHAPES_DISABLE */
+
 /**
  * Get lexical environment's 'provideThis' property
  */
@@ -399,8 +710,7 @@ ecma_get_lex_env_provide_this (const ecma_object_t *object_p) /**< object-bound
   JERRY_ASSERT (ecma_is_lexical_environment (object_p) &&
                 ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND);
 
-  JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  bool provide_this = (JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
+  bool provide_this = (JRT_EXTRACT_BIT_FIELD (ecma_object_container_t, object_p->container,
                                               ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
                                               ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH) != 0);
 
@@ -417,10 +727,7 @@ ecma_get_lex_env_binding_object (const ecma_object_t *object_p) /**< object-boun
   JERRY_ASSERT (ecma_is_lexical_environment (object_p) &&
                 ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND);
 
-  JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  uintptr_t object_cp = (uintptr_t) JRT_EXTRACT_BIT_FIELD (uint64_t, object_p->container,
-                                                           ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                           ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  mem_cpointer_t object_cp = ECMA_OBJECT_GET_CP_FIELD (object_p, PROPERTIES_OR_BOUND_OBJECT);
   return ECMA_GET_NON_NULL_POINTER (ecma_object_t, object_cp);
 } /* ecma_get_lex_env_binding_object */
 
@@ -440,15 +747,13 @@ ecma_create_internal_property (ecma_object_t *object_p, /**< the object */
 
   new_property_p->flags = ECMA_PROPERTY_FLAG_INTERNAL;
 
-  ecma_property_t *list_head_p = ecma_get_property_list (object_p);
-  ECMA_SET_POINTER (new_property_p->next_property_p, list_head_p);
-  ecma_set_property_list (object_p, new_property_p);
-
   JERRY_ASSERT (property_id < ECMA_INTERNAL_PROPERTY__COUNT);
 
   new_property_p->h.internal_property_type = (uint8_t) property_id;
   new_property_p->v.internal_property.value = ECMA_NULL_POINTER;
 
+  ecma_link_property (object_p, new_property_p);
+
   return new_property_p;
 } /* ecma_create_internal_property */
 
@@ -516,38 +821,59 @@ ecma_create_named_data_property (ecma_object_t *obj_p, /**< object */
   JERRY_ASSERT (obj_p != NULL && name_p != NULL);
   JERRY_ASSERT (ecma_find_named_property (obj_p, name_p) == NULL);
 
-  ecma_property_t *prop_p = ecma_alloc_property ();
-  name_p = ecma_copy_or_ref_ecma_string (name_p);
-
-  prop_p->flags = ECMA_PROPERTY_FLAG_NAMEDDATA;
-
-  ECMA_SET_NON_NULL_POINTER (prop_p->v.named_data_property.name_p, name_p);
+  uint8_t flags = ECMA_PROPERTY_FLAG_NAMEDDATA;
 
   if (is_configurable)
   {
-    prop_p->flags = (uint8_t) (prop_p->flags | ECMA_PROPERTY_FLAG_CONFIGURABLE);
+    flags = (uint8_t) (flags | ECMA_PROPERTY_FLAG_CONFIGURABLE);
   }
   if (is_enumerable)
   {
-    prop_p->flags = (uint8_t) (prop_p->flags | ECMA_PROPERTY_FLAG_ENUMERABLE);
+    flags = (uint8_t) (flags | ECMA_PROPERTY_FLAG_ENUMERABLE);
   }
   if (is_writable)
   {
-    prop_p->flags = (uint8_t) (prop_p->flags | ECMA_PROPERTY_FLAG_WRITABLE);
+    flags = (uint8_t) (flags | ECMA_PROPERTY_FLAG_WRITABLE);
   }
 
-  ecma_set_named_data_property_value (prop_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+  ecma_property_t *prop_p;
 
-  /*
-   * See also:
-   *          ecma_op_object_get_property_names
-   */
-  ecma_property_t *list_head_p = ecma_get_property_list (obj_p);
-  ECMA_SET_POINTER (prop_p->next_property_p, list_head_p);
-  ecma_set_property_list (obj_p, prop_p);
+  /* Properties are named by interned strings, so that they are matched by the descriptors upon lookups */
+  name_p = ecma_intern_property_name (name_p);
+
+#ifndef CONFIG_ECMA_SHAPES_DISABLE
+  ecma_property_slot_t *slot_p = ecma_create_property_slot (obj_p, name_p);
+
+  if (slot_p != NULL)
+  {
+    slot_p->flags = (uint8_t) (flags | ECMA_PROPERTY_FLAG_SHAPED);
+    prop_p = (ecma_property_t *) slot_p;
+
+    ecma_set_named_data_property_value (prop_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+  }
+  else
+#endif /* !CONFIG_ECMA_SHAPES_DISABLE */
+  {
+    prop_p = ecma_alloc_property ();
+    prop_p->flags = flags;
+
+    ECMA_SET_NON_NULL_POINTER (prop_p->v.named_data_property.name_p, ecma_copy_or_ref_ecma_string (name_p));
+
+    /* The value is initialized before linking, as inserting into the hashmap can trigger garbage collection */
+    ecma_set_named_data_property_value (prop_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+
+    /*
+     * See also:
+     *          ecma_op_object_get_property_names
+     */
+    ecma_link_property (obj_p, prop_p);
+    ecma_property_hashmap_insert (obj_p, prop_p);
+  }
 
   ecma_lcache_invalidate (obj_p, name_p, NULL);
 
+  ecma_deref_ecma_string (name_p);
+
   return prop_p;
 } /* ecma_create_named_data_property */
 
@@ -569,7 +895,7 @@ ecma_create_named_accessor_property (ecma_object_t *obj_p, /**< object */
 
   ecma_property_t *prop_p = ecma_alloc_property ();
   ecma_getter_setter_pointers_t *getter_setter_pointers_p = ecma_alloc_getter_setter_pointers ();
-  name_p = ecma_copy_or_ref_ecma_string (name_p);
+  name_p = ecma_intern_property_name (name_p);
 
   prop_p->flags = ECMA_PROPERTY_FLAG_NAMEDACCESSOR;
 
@@ -584,15 +910,25 @@ ecma_create_named_accessor_property (ecma_object_t *obj_p, /**< object */
     prop_p->flags = (uint8_t) (prop_p->flags | ECMA_PROPERTY_FLAG_ENUMERABLE);
   }
 
+  /* The pointers are initialized before linking, as inserting into the hashmap can trigger garbage collection */
+  getter_setter_pointers_p->getter_p = ECMA_NULL_POINTER;
+  getter_setter_pointers_p->setter_p = ECMA_NULL_POINTER;
   ECMA_SET_NON_NULL_POINTER (prop_p->v.named_accessor_property.getter_setter_pair_cp, getter_setter_pointers_p);
 
+  ecma_property_slots_header_t *slots_header_p = ecma_get_property_slots (obj_p);
+
+  if (slots_header_p != NULL)
+  {
+    /* Properties, created after the accessor, are not added to the shape, so that enumeration order is kept */
+    slots_header_p->is_closed = true;
+  }
+
   /*
    * See also:
    *          ecma_op_object_get_property_names
    */
-  ecma_property_t *list_head_p = ecma_get_property_list (obj_p);
-  ECMA_SET_POINTER (prop_p->next_property_p, list_head_p);
-  ecma_set_property_list (obj_p, prop_p);
+  ecma_link_property (obj_p, prop_p);
+  ecma_property_hashmap_insert (obj_p, prop_p);
 
   /*
    * Should be performed after linking the property into object's property list, because the setters assert that.
@@ -606,18 +942,18 @@ ecma_create_named_accessor_property (ecma_object_t *obj_p, /**< object */
 } /* ecma_create_named_accessor_property */
 
 /**
- * Find named data property or named access property in specified object.
+ * Find named data property or named access property with the specified name in the object
+ *
+ * See also:
+ *          ecma_find_named_property
  *
  * @return pointer to the property, if it is found,
  *         NULL - otherwise.
  */
-ecma_property_t *
-ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in */
-                          ecma_string_t *name_p) /**< property's name */
+static ecma_property_t *
+ecma_find_named_property_by_name (ecma_object_t *obj_p, /**< object to find property in */
+                                  ecma_string_t *name_p) /**< property's name */
 {
-  JERRY_ASSERT (obj_p != NULL);
-  JERRY_ASSERT (name_p != NULL);
-
   ecma_property_t *property_p;
 
   if (ecma_lcache_lookup (obj_p, name_p, &property_p))
@@ -625,6 +961,44 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
     return property_p;
   }
 
+  ecma_property_slots_header_t *slots_header_p = ecma_get_property_slots (obj_p);
+
+  if (slots_header_p != NULL
+      && slots_header_p->shape_cp != ECMA_NULL_POINTER)
+  {
+    uint32_t index;
+
+    if (ecma_shape_find_property (ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_header_p->shape_cp),
+                                  name_p,
+                                  &index))
+    {
+      property_p = ecma_get_property_slot (slots_header_p, index);
+
+      /* Deleted properties remain described by the shape, and could be re-created in the property list */
+      if (property_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
+      {
+        ecma_lcache_insert (obj_p, name_p, property_p);
+
+        return property_p;
+      }
+    }
+  }
+
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  ecma_property_hashmap_t *hashmap_p = ecma_property_hashmap_get (obj_p);
+
+  if (hashmap_p != NULL)
+  {
+    property_p = ecma_property_hashmap_find (hashmap_p, name_p);
+
+    ecma_lcache_insert (obj_p, name_p, property_p);
+
+    return property_p;
+  }
+
+  uint32_t steps = 0;
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+
   for (property_p = ecma_get_property_list (obj_p);
        property_p != NULL;
        property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
@@ -648,14 +1022,54 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
 
     JERRY_ASSERT (property_name_p != NULL);
 
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+    steps++;
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+
     if (ecma_compare_ecma_strings (name_p, property_name_p))
     {
       break;
     }
   }
 
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  if (steps >= CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTIES)
+  {
+    ecma_property_hashmap_create (obj_p);
+  }
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+
   ecma_lcache_insert (obj_p, name_p, property_p);
 
+  return property_p;
+} /* ecma_find_named_property_by_name */
+
+/**
+ * Find named data property or named access property in specified object.
+ *
+ * @return pointer to the property, if it is found,
+ *         NULL - otherwise.
+ */
+ecma_property_t *
+ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in */
+                          ecma_string_t *name_p) /**< property's name */
+{
+  JERRY_ASSERT (obj_p != NULL);
+  JERRY_ASSERT (name_p != NULL);
+
+  ecma_string_t *interned_name_p = ecma_find_interned_property_name (name_p);
+
+  if (interned_name_p == NULL)
+  {
+    return ecma_find_named_property_by_name (obj_p, name_p);
+  }
+
+  /* The interned string is equal to the names of the properties, that were created from heap strings
+   * of the same value, by the descriptor, so it is looked up instead of the heap string */
+  ecma_property_t *property_p = ecma_find_named_property_by_name (obj_p, interned_name_p);
+
+  ecma_deref_ecma_string (interned_name_p);
+
   return property_p;
 } /* ecma_find_named_property */
 
@@ -748,6 +1162,57 @@ ecma_free_named_accessor_property (ecma_object_t *object_p, /**< object the prop
   ecma_dealloc_property (property_p);
 } /* ecma_free_named_accessor_property */
 
+/**
+ * Free the named data property, stored in a slot of shaped object, and values it references.
+ *
+ * The slot is marked as unused.
+ */
+static void
+ecma_free_property_slot (ecma_object_t *object_p, /**< object the property belongs to */
+                         ecma_property_t *property_p) /**< the slot */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (property_p != NULL
+                && (property_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
+                && (property_p->flags & ECMA_PROPERTY_FLAG_SHAPED));
+
+  ecma_lcache_invalidate (object_p, NULL, property_p);
+
+  ecma_value_t v = ecma_get_named_data_property_value (property_p);
+  ecma_free_value_if_not_object (v);
+
+  property_p->flags = 0;
+} /* ecma_free_property_slot */
+
+/**
+ * Free the shaped object's slots, values they reference, and the reference to the object's shape
+ */
+static void
+ecma_free_property_slots (ecma_object_t *object_p, /**< object the slots belong to */
+                          ecma_property_slots_header_t *slots_header_p) /**< header of the slots */
+{
+  JERRY_ASSERT (ecma_get_property_slots (object_p) == slots_header_p);
+
+  for (uint32_t index = 0; index < slots_header_p->slots_number; index++)
+  {
+    ecma_property_t *slot_p = ecma_get_property_slot (slots_header_p, index);
+
+    if (slot_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
+    {
+      ecma_free_property_slot (object_p, slot_p);
+    }
+  }
+
+  if (slots_header_p->shape_cp != ECMA_NULL_POINTER)
+  {
+    ecma_shape_deref (ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_header_p->shape_cp));
+  }
+
+  mem_heap_free_block (slots_header_p,
+                       sizeof (ecma_property_slots_header_t)
+                       + slots_header_p->slots_capacity * sizeof (ecma_property_slot_t));
+} /* ecma_free_property_slots */
+
 /**
  * Free the internal property and values it references.
  */
@@ -757,11 +1222,25 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
   JERRY_ASSERT (property_p != NULL && (property_p->flags & ECMA_PROPERTY_FLAG_INTERNAL));
 
   ecma_internal_property_id_t property_id = (ecma_internal_property_id_t) property_p->h.internal_property_type;
-  uint32_t property_value = property_p->v.internal_property.value;
+  ecma_value_t property_value = property_p->v.internal_property.value;
 
   switch (property_id)
   {
-    case ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES: /* a collection */
+    case ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES: /* compressed pointer to a ecma_array_elements_t */
+    {
+      ecma_array_elements_t *elements_p = ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t, property_value);
+      ecma_value_t *values_p = ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p);
+
+      for (uint32_t index = 0; index < elements_p->length; index++)
+      {
+        ecma_free_value_if_not_object (values_p[index]);
+      }
+
+      mem_heap_free_block (elements_p, ECMA_ARRAY_ELEMENTS_GET_SIZE (elements_p->capacity));
+
+      break;
+    }
+
     case ECMA_INTERNAL_PROPERTY_STRING_INDEXED_ARRAY_VALUES: /* a collection */
     {
       ecma_free_values_collection (ECMA_GET_NON_NULL_POINTER (ecma_collection_header_t,
@@ -844,6 +1323,12 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
       break;
     }
 
+    case ECMA_INTERNAL_PROPERTY_PROPERTY_HASHMAP: /* compressed pointer to a property hashmap */
+    {
+      ecma_property_hashmap_free_table (ECMA_GET_NON_NULL_POINTER (ecma_property_hashmap_t, property_value));
+      break;
+    }
+
     case ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE: /* compressed pointer to a regexp bytecode array */
     {
       ecma_compiled_code_t *bytecode_p = ECMA_GET_POINTER (ecma_compiled_code_t, property_value);
@@ -854,6 +1339,32 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
       }
       break;
     }
+
+    case ECMA_INTERNAL_PROPERTY_ARRAYBUFFER: /* compressed pointer to a ecma_arraybuffer_t */
+    {
+      ecma_arraybuffer_t *arraybuffer_p = ECMA_GET_NON_NULL_POINTER (ecma_arraybuffer_t, property_value);
+
+      if (arraybuffer_p->free_cb != 0)
+      {
+        /* the external buffer is given back to the embedder */
+        jerry_dispatch_object_free_callback (arraybuffer_p->free_cb,
+                                             (ecma_external_pointer_t) arraybuffer_p->buffer_p);
+
+        mem_heap_free_block (arraybuffer_p, sizeof (ecma_arraybuffer_t));
+      }
+      else
+      {
+        mem_heap_free_block (arraybuffer_p, ECMA_ARRAYBUFFER_GET_SIZE (arraybuffer_p->length));
+      }
+      break;
+    }
+
+    case ECMA_INTERNAL_PROPERTY_ARRAYBUFFER_VIEW: /* compressed pointer to a ecma_arraybuffer_view_t */
+    {
+      mem_heap_free_block (ECMA_GET_NON_NULL_POINTER (ecma_arraybuffer_view_t, property_value),
+                           sizeof (ecma_arraybuffer_view_t));
+      break;
+    }
   }
 
   ecma_dealloc_property (property_p);
@@ -867,11 +1378,16 @@ ecma_free_property (ecma_object_t *object_p, /**< object the property belongs to
                     ecma_property_t *prop_p) /**< property */
 {
   JERRY_ASSERT (object_p != NULL && prop_p != NULL);
+  JERRY_ASSERT (!(prop_p->flags & ECMA_PROPERTY_FLAG_SHAPED) || prop_p->flags == ECMA_PROPERTY_FLAG_SHAPED);
 
   if (prop_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
   {
     ecma_free_named_data_property (object_p, prop_p);
   }
+  else if (prop_p->flags & ECMA_PROPERTY_FLAG_SHAPED)
+  {
+    ecma_free_property_slots (object_p, (ecma_property_slots_header_t *) prop_p);
+  }
   else if (prop_p->flags & ECMA_PROPERTY_FLAG_NAMEDACCESSOR)
   {
     ecma_free_named_accessor_property (object_p, prop_p);
@@ -891,6 +1407,19 @@ void
 ecma_delete_property (ecma_object_t *obj_p, /**< object */
                       ecma_property_t *prop_p) /**< property */
 {
+  if (prop_p->flags & ECMA_PROPERTY_FLAG_SHAPED)
+  {
+    ecma_property_slots_header_t *slots_header_p = ecma_get_property_slots (obj_p);
+    JERRY_ASSERT (slots_header_p != NULL);
+
+    ecma_free_property_slot (obj_p, prop_p);
+
+    /* Properties, created after the deletion, are not added to the shape, so that enumeration order is kept */
+    slots_header_p->is_closed = true;
+
+    return;
+  }
+
   for (ecma_property_t *cur_prop_p = ecma_get_property_list (obj_p), *prev_prop_p = NULL, *next_prop_p;
        cur_prop_p != NULL;
        prev_prop_p = cur_prop_p, cur_prop_p = next_prop_p)
@@ -900,6 +1429,14 @@ ecma_delete_property (ecma_object_t *obj_p, /**< object */
 
     if (cur_prop_p == prop_p)
     {
+      if (prop_p->flags & (ECMA_PROPERTY_FLAG_NAMEDDATA | ECMA_PROPERTY_FLAG_NAMEDACCESSOR))
+      {
+        ecma_property_hashmap_delete (obj_p, prop_p);
+      }
+
+      /* Inline caches could refer to the property record (slots are checked upon each cache hit) */
+      vm_inline_cache_invalidate_all ();
+
       ecma_free_property (obj_p, prop_p);
 
       if (prev_prop_p == NULL)
@@ -926,6 +1463,18 @@ ecma_assert_object_contains_the_property (const ecma_object_t *object_p, /**< ec
                                           const ecma_property_t *prop_p) /**< ecma-property */
 {
 #ifndef JERRY_NDEBUG
+  if (prop_p->flags & ECMA_PROPERTY_FLAG_SHAPED)
+  {
+    ecma_property_slots_header_t *slots_header_p = ecma_get_property_slots (object_p);
+
+    JERRY_ASSERT (slots_header_p != NULL);
+    JERRY_ASSERT ((const ecma_property_slot_t *) prop_p >= (const ecma_property_slot_t *) (slots_header_p + 1)
+                  && ((const ecma_property_slot_t *) prop_p
+                      < (const ecma_property_slot_t *) (slots_header_p + 1) + slots_header_p->slots_number));
+
+    return;
+  }
+
   ecma_property_t *prop_iter_p;
   for (prop_iter_p = ecma_get_property_list (object_p);
        prop_iter_p != NULL;
@@ -944,8 +1493,10 @@ ecma_assert_object_contains_the_property (const ecma_object_t *object_p, /**< ec
 #endif /* JERRY_NDEBUG */
 } /* ecma_assert_object_contains_the_property */
 
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
 JERRY_STATIC_ASSERT (ECMA_VALUE_SIZE <= 24,
                      maximum_ECMA_VALUE_SIZE_must_be_less_than_or_equal_to_24);
+#endif /* !CONFIG_MEM_CPOINTER_32_BIT */
 
 /**
  * Get value field of named data property
@@ -957,8 +1508,24 @@ ecma_get_named_data_property_value (const ecma_property_t *prop_p) /**< property
 {
   JERRY_ASSERT (prop_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA);
 
+  if (prop_p->flags & ECMA_PROPERTY_FLAG_SHAPED)
+  {
+    const ecma_property_slot_t *slot_p = (const ecma_property_slot_t *) prop_p;
+
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+    ecma_value_t upper_bits = slot_p->value_high;
+    return (upper_bits << 16) | (slot_p->value_low);
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+    return slot_p->value;
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
+  }
+
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
   ecma_value_t upper_bits = prop_p->h.named_data_property_value_high;
   return (upper_bits << 16) | (prop_p->v.named_data_property.value_low);
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+  return prop_p->v.named_data_property.value;
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
 } /* ecma_get_named_data_property_value */
 
 /**
@@ -970,8 +1537,26 @@ ecma_set_named_data_property_value (ecma_property_t *prop_p, /**< property */
 {
   JERRY_ASSERT (prop_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA);
 
+  if (prop_p->flags & ECMA_PROPERTY_FLAG_SHAPED)
+  {
+    ecma_property_slot_t *slot_p = (ecma_property_slot_t *) prop_p;
+
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+    slot_p->value_high = (uint8_t) (value >> 16);
+    slot_p->value_low = (uint16_t) value;
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+    slot_p->value = value;
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
+
+    return;
+  }
+
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
   prop_p->h.named_data_property_value_high = (uint8_t) (value >> 16);
   prop_p->v.named_data_property.value_low = (uint16_t) value;
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+  prop_p->v.named_data_property.value = value;
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
 } /* ecma_set_named_data_property_value */
 
 /**
@@ -988,20 +1573,24 @@ ecma_named_data_property_assign_value (ecma_object_t *obj_p, /**< object */
   JERRY_ASSERT (prop_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA);
   ecma_assert_object_contains_the_property (obj_p, prop_p);
 
-  if (ecma_is_value_number (value)
-      && ecma_is_value_number (ecma_get_named_data_property_value (prop_p)))
-  {
-    const ecma_number_t *num_src_p = ecma_get_number_from_value (value);
-    ecma_number_t *num_dst_p = ecma_get_number_from_value (ecma_get_named_data_property_value (prop_p));
+  ecma_value_t old_value = ecma_get_named_data_property_value (prop_p);
 
-    *num_dst_p = *num_src_p;
+  if (ecma_is_value_heap_number (value)
+      && ecma_is_value_heap_number (old_value))
+  {
+    /* Both numbers are stored on the heap, so the storage of the old one can be reused */
+    ecma_update_heap_number_value (old_value, ecma_get_number_from_value (value));
   }
   else
   {
-    ecma_value_t v = ecma_get_named_data_property_value (prop_p);
-    ecma_free_value_if_not_object (v);
+    ecma_free_value_if_not_object (old_value);
 
     ecma_set_named_data_property_value (prop_p, ecma_copy_value_if_not_object (value));
+
+    if (ecma_is_value_object (value))
+    {
+      ecma_gc_write_barrier (obj_p);
+    }
   }
 } /* ecma_named_data_property_assign_value */
 
@@ -1055,6 +1644,11 @@ ecma_set_named_accessor_property_getter (ecma_object_t *object_p, /**< the prope
                                                prop_p->v.named_accessor_property.getter_setter_pair_cp);
 
   ECMA_SET_POINTER (getter_setter_pointers_p->getter_p, getter_p);
+
+  if (getter_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p);
+  }
 } /* ecma_set_named_accessor_property_getter */
 
 /**
@@ -1073,6 +1667,11 @@ ecma_set_named_accessor_property_setter (ecma_object_t *object_p, /**< the prope
                                                prop_p->v.named_accessor_property.getter_setter_pair_cp);
 
   ECMA_SET_POINTER (getter_setter_pointers_p->setter_p, setter_p);
+
+  if (setter_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p);
+  }
 } /* ecma_set_named_accessor_property_setter */
 
 /**
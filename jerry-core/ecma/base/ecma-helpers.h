@@ -64,6 +64,9 @@ extern bool ecma_is_value_false (ecma_value_t);
 extern bool ecma_is_value_array_hole (ecma_value_t);
 
 extern bool ecma_is_value_number (ecma_value_t);
+extern bool ecma_is_value_integer_number (ecma_value_t);
+extern bool ecma_are_values_integer_numbers (ecma_value_t, ecma_value_t);
+extern bool ecma_is_value_heap_number (ecma_value_t);
 extern bool ecma_is_value_string (ecma_value_t);
 extern bool ecma_is_value_object (ecma_value_t);
 extern bool ecma_is_value_error (ecma_value_t);
@@ -71,12 +74,17 @@ extern bool ecma_is_value_error (ecma_value_t);
 extern void ecma_check_value_type_is_spec_defined (ecma_value_t);
 
 extern ecma_value_t ecma_make_simple_value (const ecma_simple_value_t value);
-extern ecma_value_t ecma_make_number_value (const ecma_number_t *);
+extern ecma_value_t ecma_make_integer_value (ecma_integer_value_t);
+extern ecma_value_t ecma_make_number_value (ecma_number_t);
+extern ecma_value_t ecma_make_int32_value (int32_t);
+extern ecma_value_t ecma_make_uint32_value (uint32_t);
 extern ecma_value_t ecma_make_string_value (const ecma_string_t *);
 extern ecma_value_t ecma_make_object_value (const ecma_object_t *);
 extern ecma_value_t ecma_make_error_value (ecma_value_t);
 extern ecma_value_t ecma_make_error_obj_value (const ecma_object_t *);
-extern ecma_number_t *ecma_get_number_from_value (ecma_value_t) __attr_pure___;
+extern ecma_integer_value_t ecma_get_integer_from_value (ecma_value_t) __attr_const___;
+extern ecma_number_t ecma_get_number_from_value (ecma_value_t) __attr_pure___;
+extern void ecma_update_heap_number_value (ecma_value_t, ecma_number_t);
 extern ecma_string_t *ecma_get_string_from_value (ecma_value_t) __attr_pure___;
 extern ecma_object_t *ecma_get_object_from_value (ecma_value_t) __attr_pure___;
 extern ecma_value_t ecma_get_value_from_error_value (ecma_value_t) __attr_pure___;
@@ -87,6 +95,8 @@ extern void ecma_free_value_if_not_object (ecma_value_t);
 
 /* ecma-helpers-string.c */
 extern ecma_string_t *ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t);
+extern ecma_string_t *ecma_new_ecma_external_string_from_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t,
+                                                              ecma_external_pointer_t);
 extern ecma_string_t *ecma_new_ecma_string_from_code_unit (ecma_char_t);
 extern ecma_string_t *ecma_new_ecma_string_from_uint32 (uint32_t);
 extern ecma_string_t *ecma_new_ecma_string_from_number (ecma_number_t);
@@ -119,6 +129,18 @@ extern bool ecma_is_ex_string_magic (const ecma_string_t *, lit_magic_string_ex_
 extern lit_string_hash_t ecma_string_hash (const ecma_string_t *);
 extern ecma_string_t *ecma_string_substr (const ecma_string_t *, ecma_length_t, ecma_length_t);
 extern ecma_string_t *ecma_string_trim (const ecma_string_t *);
+extern void ecma_string_index_cache_invalidate_all (void);
+
+extern void ecma_stringbuilder_init (ecma_stringbuilder_t *);
+extern void ecma_stringbuilder_append (ecma_stringbuilder_t *, ecma_string_t *);
+extern void ecma_stringbuilder_append_magic (ecma_stringbuilder_t *, lit_magic_string_id_t);
+extern void ecma_stringbuilder_append_raw (ecma_stringbuilder_t *, const lit_utf8_byte_t *, lit_utf8_size_t);
+extern void ecma_stringbuilder_append_substr (ecma_stringbuilder_t *, const ecma_string_t *, ecma_length_t,
+                                              ecma_length_t);
+extern void ecma_stringbuilder_append_char (ecma_stringbuilder_t *, ecma_char_t);
+extern void ecma_stringbuilder_append_byte (ecma_stringbuilder_t *, lit_utf8_byte_t);
+extern ecma_string_t *ecma_stringbuilder_finalize (ecma_stringbuilder_t *);
+extern void ecma_stringbuilder_destroy (ecma_stringbuilder_t *);
 
 /* ecma-helpers-number.c */
 extern ecma_number_t ecma_number_make_nan (void);
@@ -184,6 +206,10 @@ extern void ecma_set_object_is_builtin (ecma_object_t *, bool);
 extern ecma_lexical_environment_type_t ecma_get_lex_env_type (const ecma_object_t *) __attr_pure___;
 extern ecma_object_t *ecma_get_lex_env_outer_reference (const ecma_object_t *) __attr_pure___;
 extern ecma_property_t *ecma_get_property_list (const ecma_object_t *) __attr_pure___;
+extern ecma_property_slots_header_t *ecma_get_property_slots (const ecma_object_t *);
+extern ecma_property_t *ecma_get_property_slot (ecma_property_slots_header_t *, uint32_t);
+extern uint32_t ecma_get_property_slot_index (ecma_property_slots_header_t *, const ecma_property_t *);
+extern ecma_string_t *ecma_get_property_slot_name (ecma_property_slots_header_t *, uint32_t);
 extern ecma_object_t *ecma_get_lex_env_binding_object (const ecma_object_t *) __attr_pure___;
 extern bool ecma_get_lex_env_provide_this (const ecma_object_t *) __attr_pure___;
 
@@ -239,6 +265,16 @@ ecma_get_external_pointer_value (ecma_object_t *, ecma_internal_property_id_t, e
 extern void
 ecma_free_external_pointer_in_property (ecma_property_t *);
 
+/* ecma-helpers-hash-table.c */
+
+/**
+ * Routine, returning hash of the key of a hash table's entry
+ */
+typedef lit_string_hash_t (*ecma_hash_table_get_hash_t) (mem_cpointer_t);
+
+extern uint32_t ecma_hash_table_get_start_index (uint32_t, lit_string_hash_t);
+extern void ecma_hash_table_free_entry (mem_cpointer_t *, uint32_t, uint32_t, ecma_hash_table_get_hash_t);
+
 /* ecma-helpers-conversion.c */
 extern ecma_number_t ecma_utf8_string_to_number (const lit_utf8_byte_t *, lit_utf8_size_t);
 extern lit_utf8_size_t ecma_uint32_to_utf8_string (uint32_t, lit_utf8_byte_t *, lit_utf8_size_t);
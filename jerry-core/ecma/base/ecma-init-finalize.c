@@ -17,8 +17,10 @@
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
+#include "ecma-intern.h"
 #include "ecma-lcache.h"
 #include "ecma-lex-env.h"
+#include "ecma-shapes.h"
 #include "mem-allocator.h"
 
 /** \addtogroup ecma ECMA
@@ -37,6 +39,8 @@ ecma_init (void)
   ecma_gc_init ();
   ecma_init_builtins ();
   ecma_lcache_init ();
+  ecma_intern_init ();
+  ecma_shapes_init ();
   ecma_init_environment ();
 
   mem_register_a_try_give_memory_back_callback (ecma_try_to_give_back_some_memory);
@@ -54,6 +58,7 @@ ecma_finalize (void)
   ecma_lcache_invalidate_all ();
   ecma_finalize_builtins ();
   ecma_gc_run ();
+  ecma_string_index_cache_invalidate_all ();
 } /* ecma_finalize */
 
 /**
@@ -0,0 +1,376 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Implementation of interning of property names
+ *
+ * Property names, that are built at runtime (for example, by concatenation), are heap strings, which are compared
+ * with names of properties by characters. Upon creation of a property, such a name is replaced with the interned
+ * string of the same value: the magic string or the literal, if one exists, or otherwise the first heap string
+ * of the value, that was registered in the intern table. Upon lookup, the name is replaced with the interned string
+ * in the same way, so names of properties are matched by their descriptors (see also: ecma_find_named_property),
+ * and the lookups are cached by LCache.
+ *
+ * The table holds a reference to each interned string, and the strings, that are referenced only by the table,
+ * are removed from it after garbage collection, so the table's entries are weak.
+ */
+
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-intern.h"
+#include "jrt-libc-includes.h"
+#include "lit-literal.h"
+#include "lit-magic-strings.h"
+#include "mem-heap.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaintern Interning of property names
+ * @{
+ */
+
+#ifndef CONFIG_ECMA_INTERN_DISABLE
+/**
+ * Header of the intern table
+ *
+ * The table is an open addressing hash table of compressed pointers to the interned strings,
+ * which is placed right after the header.
+ */
+typedef struct
+{
+  uint32_t max_string_count; /**< number of entries of the table (a power of 2) */
+  uint32_t string_count; /**< number of strings in the table */
+} ecma_intern_table_t;
+
+/**
+ * Minimum number of the table's entries
+ */
+#define ECMA_INTERN_TABLE_MIN_ENTRIES (32u)
+
+/**
+ * Get the table's entries
+ */
+#define ECMA_INTERN_TABLE_GET_ENTRIES(table_p) ((mem_cpointer_t *) ((table_p) + 1))
+
+/**
+ * Get size of the table's memory block
+ */
+#define ECMA_INTERN_TABLE_GET_SIZE(max_string_count) \
+  (sizeof (ecma_intern_table_t) + (max_string_count) * sizeof (mem_cpointer_t))
+
+/**
+ * The intern table, or NULL - if there are no interned strings
+ */
+static ecma_intern_table_t *ecma_intern_table_p;
+#endif /* !CONFIG_ECMA_INTERN_DISABLE */
+
+/**
+ * Initialize the intern table
+ */
+void
+ecma_intern_init (void)
+{
+#ifndef CONFIG_ECMA_INTERN_DISABLE
+  ecma_intern_table_p = NULL;
+#endif /* !CONFIG_ECMA_INTERN_DISABLE */
+} /* ecma_intern_init */
+
+#ifndef CONFIG_ECMA_INTERN_DISABLE
+/**
+ * Check whether the name is a heap string, that can be replaced with an interned string
+ *
+ * Names of other containers are either unique for their value (literals and magic strings),
+ * or are rarely used as property names.
+ *
+ * @return true / false
+ */
+static inline bool __attr_always_inline___
+ecma_intern_is_name_internable (const ecma_string_t *name_p) /**< property name */
+{
+  ecma_string_container_t container = ECMA_STRING_GET_CONTAINER (name_p);
+
+  return (container == ECMA_STRING_CONTAINER_HEAP_CHUNKS
+          || container == ECMA_STRING_CONTAINER_ROPE);
+} /* ecma_intern_is_name_internable */
+
+/**
+ * Get hash of the string, referenced by an entry of the intern table
+ *
+ * @return hash of the string
+ */
+static lit_string_hash_t
+ecma_intern_get_entry_hash (mem_cpointer_t entry) /**< non-empty entry */
+{
+  return ecma_string_hash (ECMA_GET_NON_NULL_POINTER (ecma_string_t, entry));
+} /* ecma_intern_get_entry_hash */
+
+/**
+ * Find the interned string, that is equal to the name
+ *
+ * @return pointer to the string (the reference counter is not increased),
+ *         or NULL - if the table doesn't contain such a string
+ */
+static ecma_string_t *
+ecma_intern_find (const ecma_string_t *name_p) /**< property name */
+{
+  if (ecma_intern_table_p == NULL)
+  {
+    return NULL;
+  }
+
+  mem_cpointer_t *entries_p = ECMA_INTERN_TABLE_GET_ENTRIES (ecma_intern_table_p);
+  uint32_t mask = ecma_intern_table_p->max_string_count - 1;
+  uint32_t index = ecma_hash_table_get_start_index (ecma_intern_table_p->max_string_count, ecma_string_hash (name_p));
+
+  while (entries_p[index] != ECMA_NULL_POINTER)
+  {
+    ecma_string_t *string_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, entries_p[index]);
+
+    if (ecma_compare_ecma_strings (string_p, name_p))
+    {
+      return string_p;
+    }
+
+    index = (index + 1) & mask;
+  }
+
+  return NULL;
+} /* ecma_intern_find */
+
+/**
+ * Put the string to a free entry of the table
+ */
+static void
+ecma_intern_put (ecma_intern_table_t *table_p, /**< intern table */
+                 ecma_string_t *string_p) /**< string to put */
+{
+  JERRY_ASSERT (table_p->string_count < table_p->max_string_count);
+
+  mem_cpointer_t *entries_p = ECMA_INTERN_TABLE_GET_ENTRIES (table_p);
+  uint32_t mask = table_p->max_string_count - 1;
+  uint32_t index = ecma_hash_table_get_start_index (table_p->max_string_count, ecma_string_hash (string_p));
+
+  while (entries_p[index] != ECMA_NULL_POINTER)
+  {
+    index = (index + 1) & mask;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (entries_p[index], string_p);
+  table_p->string_count++;
+} /* ecma_intern_put */
+
+/**
+ * Register the string in the table, growing the table, if required
+ *
+ * Note:
+ *      the table takes over the caller's reference to the string
+ */
+static void
+ecma_intern_insert (ecma_string_t *string_p) /**< string to register */
+{
+  uint32_t string_count = (ecma_intern_table_p != NULL) ? ecma_intern_table_p->string_count : 0;
+  uint32_t max_string_count = (ecma_intern_table_p != NULL) ? ecma_intern_table_p->max_string_count : 0;
+
+  if ((string_count + 1) * 2 > max_string_count)
+  {
+    uint32_t new_max_string_count = ECMA_INTERN_TABLE_MIN_ENTRIES;
+
+    while (new_max_string_count < (string_count + 1) * 2)
+    {
+      new_max_string_count *= 2;
+    }
+
+    size_t size = ECMA_INTERN_TABLE_GET_SIZE (new_max_string_count);
+    ecma_intern_table_t *new_table_p = (ecma_intern_table_t *) mem_heap_alloc_block (size);
+
+    new_table_p->max_string_count = new_max_string_count;
+    new_table_p->string_count = 0;
+    memset (ECMA_INTERN_TABLE_GET_ENTRIES (new_table_p), 0, new_max_string_count * sizeof (mem_cpointer_t));
+
+    /* The old table is accessed after the allocation, as garbage collection can remove strings from it */
+    ecma_intern_table_t *table_p = ecma_intern_table_p;
+
+    if (table_p != NULL)
+    {
+      mem_cpointer_t *entries_p = ECMA_INTERN_TABLE_GET_ENTRIES (table_p);
+
+      for (uint32_t index = 0; index < table_p->max_string_count; index++)
+      {
+        if (entries_p[index] != ECMA_NULL_POINTER)
+        {
+          ecma_intern_put (new_table_p, ECMA_GET_NON_NULL_POINTER (ecma_string_t, entries_p[index]));
+        }
+      }
+
+      JERRY_ASSERT (new_table_p->string_count == table_p->string_count);
+
+      mem_heap_free_block (table_p, ECMA_INTERN_TABLE_GET_SIZE (table_p->max_string_count));
+    }
+
+    ecma_intern_table_p = new_table_p;
+  }
+
+  ecma_intern_put (ecma_intern_table_p, string_p);
+} /* ecma_intern_insert */
+#endif /* !CONFIG_ECMA_INTERN_DISABLE */
+
+/**
+ * Get the interned string, that is equal to the name of a property being created,
+ * interning the name, if there is no such string yet
+ *
+ * @return pointer to the interned string, or to the name itself - if the name should not be interned
+ *         (the reference counter of the returned string is increased)
+ */
+ecma_string_t *
+ecma_intern_property_name (ecma_string_t *name_p) /**< property name */
+{
+#ifndef CONFIG_ECMA_INTERN_DISABLE
+  if (!ecma_intern_is_name_internable (name_p))
+  {
+    return ecma_copy_or_ref_ecma_string (name_p);
+  }
+
+  ecma_string_t *interned_p = ecma_intern_find (name_p);
+
+  if (interned_p != NULL)
+  {
+    return ecma_copy_or_ref_ecma_string (interned_p);
+  }
+
+  lit_utf8_size_t size;
+  bool is_ascii;
+  const lit_utf8_byte_t *chars_p = ecma_string_raw_chars (name_p, &size, &is_ascii);
+  JERRY_ASSERT (chars_p != NULL);
+
+  lit_magic_string_id_t magic_string_id;
+  lit_magic_string_ex_id_t magic_string_ex_id;
+
+  if (lit_is_utf8_string_magic (chars_p, size, &magic_string_id))
+  {
+    interned_p = ecma_get_magic_string (magic_string_id);
+  }
+  else if (lit_is_ex_utf8_string_magic (chars_p, size, &magic_string_ex_id))
+  {
+    interned_p = ecma_get_magic_string_ex (magic_string_ex_id);
+  }
+  else
+  {
+    /* Names, used as identifiers in the source code, are interned as the literals,
+     * so that the properties are matched by the literals, which are used to access them */
+    lit_literal_t lit = lit_find_literal_by_utf8_string (chars_p, size);
+
+    if (lit != NULL)
+    {
+      interned_p = ecma_new_ecma_string_from_lit_cp (lit_cpointer_compress (lit));
+    }
+    else
+    {
+      interned_p = ecma_copy_or_ref_ecma_string (name_p);
+    }
+  }
+
+  ecma_intern_insert (ecma_copy_or_ref_ecma_string (interned_p));
+
+  return interned_p;
+#else /* CONFIG_ECMA_INTERN_DISABLE */
+  return ecma_copy_or_ref_ecma_string (name_p);
+#endif /* CONFIG_ECMA_INTERN_DISABLE */
+} /* ecma_intern_property_name */
+
+/**
+ * Find the interned string, that is equal to the name of a property being looked up
+ *
+ * @return pointer to the interned string (the reference counter is increased),
+ *         or NULL - if the name should not be interned, or there is no such string
+ *         (so there is no property with a name, created from a heap string of the same value)
+ */
+ecma_string_t *
+ecma_find_interned_property_name (ecma_string_t *name_p) /**< property name */
+{
+#ifndef CONFIG_ECMA_INTERN_DISABLE
+  if (!ecma_intern_is_name_internable (name_p))
+  {
+    return NULL;
+  }
+
+  ecma_string_t *interned_p = ecma_intern_find (name_p);
+
+  if (interned_p != NULL)
+  {
+    return ecma_copy_or_ref_ecma_string (interned_p);
+  }
+#else /* CONFIG_ECMA_INTERN_DISABLE */
+  (void) name_p;
+#endif /* CONFIG_ECMA_INTERN_DISABLE */
+
+  return NULL;
+} /* ecma_find_interned_property_name */
+
+/**
+ * Remove the strings, that are referenced only by the intern table, from the table, and free them
+ *
+ * Note:
+ *      called by garbage collector, after unreachable objects are freed
+ */
+void
+ecma_intern_free_unused_names (void)
+{
+#ifndef CONFIG_ECMA_INTERN_DISABLE
+  ecma_intern_table_t *table_p = ecma_intern_table_p;
+
+  if (table_p == NULL)
+  {
+    return;
+  }
+
+  mem_cpointer_t *entries_p = ECMA_INTERN_TABLE_GET_ENTRIES (table_p);
+  uint32_t index = 0;
+
+  while (index < table_p->max_string_count)
+  {
+    if (entries_p[index] == ECMA_NULL_POINTER)
+    {
+      index++;
+      continue;
+    }
+
+    ecma_string_t *string_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, entries_p[index]);
+
+    if (string_p->refs_and_container >= 2 * ECMA_STRING_REF_ONE)
+    {
+      index++;
+      continue;
+    }
+
+    ecma_deref_ecma_string (string_p);
+    table_p->string_count--;
+
+    /* The following entries can be shifted to the freed one, so the entry is checked again */
+    ecma_hash_table_free_entry (entries_p, table_p->max_string_count, index, ecma_intern_get_entry_hash);
+  }
+
+  if (table_p->string_count == 0)
+  {
+    mem_heap_free_block (table_p, ECMA_INTERN_TABLE_GET_SIZE (table_p->max_string_count));
+    ecma_intern_table_p = NULL;
+  }
+#endif /* !CONFIG_ECMA_INTERN_DISABLE */
+} /* ecma_intern_free_unused_names */
+
+/**
+ * @}
+ * @}
+ */
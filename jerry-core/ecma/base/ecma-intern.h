@@ -0,0 +1,38 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_INTERN_H
+#define ECMA_INTERN_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaintern Interning of property names
+ * @{
+ */
+
+extern void ecma_intern_init (void);
+extern ecma_string_t *ecma_intern_property_name (ecma_string_t *);
+extern ecma_string_t *ecma_find_interned_property_name (ecma_string_t *);
+extern void ecma_intern_free_unused_names (void);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_INTERN_H */
@@ -39,35 +39,88 @@ typedef struct
   /** Compressed pointer to property's name */
   mem_cpointer_t prop_name_cp;
 
-  /** Compressed pointer to a property of the object */
+  /**
+   * Compressed pointer to a property of the object
+   * (or to header of the object's slots, if the property is stored in a slot)
+   */
   mem_cpointer_t prop_cp;
 
-  /** Padding structure to 8 bytes size */
-  uint16_t padding;
+  /** Index of the property's slot plus one, or zero - if the property is not stored in a slot */
+  uint16_t slot_index;
 } ecma_lcache_hash_entry_t;
 
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
 JERRY_STATIC_ASSERT (sizeof (ecma_lcache_hash_entry_t) == sizeof (uint64_t),
                      size_of_ecma_lcache_hash_entry_t_must_be_equal_to_8_bytes);
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+JERRY_STATIC_ASSERT (sizeof (ecma_lcache_hash_entry_t) == 4 * sizeof (mem_cpointer_t),
+                     size_of_ecma_lcache_hash_entry_t_must_be_equal_to_16_bytes);
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
 
-/**
- * LCache hash value length, in bits
- */
-#define ECMA_LCACHE_HASH_BITS (sizeof (lit_string_hash_t) * JERRY_BITSINBYTE)
+JERRY_STATIC_ASSERT ((CONFIG_ECMA_LCACHE_ROWS & (CONFIG_ECMA_LCACHE_ROWS - 1)) == 0,
+                     CONFIG_ECMA_LCACHE_ROWS_must_be_power_of_2);
+
+JERRY_STATIC_ASSERT (CONFIG_ECMA_LCACHE_WAYS > 0,
+                     CONFIG_ECMA_LCACHE_WAYS_must_be_positive);
 
 /**
  * Number of rows in LCache's hash table
  */
-#define ECMA_LCACHE_HASH_ROWS_COUNT (1ull << ECMA_LCACHE_HASH_BITS)
+#define ECMA_LCACHE_HASH_ROWS_COUNT (CONFIG_ECMA_LCACHE_ROWS)
 
 /**
  * Number of entries in a row of LCache's hash table
  */
-#define ECMA_LCACHE_HASH_ROW_LENGTH (2)
+#define ECMA_LCACHE_HASH_ROW_LENGTH (CONFIG_ECMA_LCACHE_WAYS)
 
 /**
  * LCache's hash table
+ *
+ * Entries of a row are ordered from the most recently inserted to the least recently inserted one.
  */
 static ecma_lcache_hash_entry_t ecma_lcache_hash_table[ ECMA_LCACHE_HASH_ROWS_COUNT ][ ECMA_LCACHE_HASH_ROW_LENGTH ];
+
+#ifdef MEM_STATS
+/**
+ * LCache's statistics
+ */
+typedef struct
+{
+  size_t hits; /**< number of lookups, that found an entry */
+  size_t misses; /**< number of lookups, that found no entry */
+  size_t evictions; /**< number of valid entries, replaced because their rows were full */
+  size_t invalidations; /**< number of entries, invalidated because of changes of the cached properties */
+} ecma_lcache_stats_t;
+
+/**
+ * LCache's statistics
+ */
+static ecma_lcache_stats_t ecma_lcache_stats;
+
+/**
+ * Increase the specified LCache statistics counter
+ */
+# define ECMA_LCACHE_STAT(counter) (ecma_lcache_stats.counter++)
+#else /* MEM_STATS */
+# define ECMA_LCACHE_STAT(counter)
+#endif /* !MEM_STATS */
+
+/**
+ * Get the row of LCache's hash table for the (object, property name) pair
+ *
+ * Both the object and the name take part in selecting the row, so that frequently used names
+ * (like 'length' or 'prototype') of different objects are spread across the table.
+ *
+ * @return index of the row
+ */
+static inline uint32_t __attr_always_inline___
+ecma_lcache_row_index (unsigned int object_cp, /**< compressed pointer to the object */
+                       lit_string_hash_t name_hash) /**< hash of the property's name */
+{
+  uint32_t hash = (uint32_t) object_cp * 0x9e3779b1u;
+
+  return ((hash >> 16) ^ name_hash) & (ECMA_LCACHE_HASH_ROWS_COUNT - 1);
+} /* ecma_lcache_row_index */
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 
 /**
@@ -78,10 +131,60 @@ ecma_lcache_init (void)
 {
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
   memset (ecma_lcache_hash_table, 0, sizeof (ecma_lcache_hash_table));
+
+#ifdef MEM_STATS
+  memset (&ecma_lcache_stats, 0, sizeof (ecma_lcache_stats));
+#endif /* MEM_STATS */
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 } /* ecma_lcache_init */
 
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
+/**
+ * Get key of the property, identifying it in LCache entries
+ *
+ * Slots of shaped objects are not aligned as heap blocks, so they are identified by the slots' header and index.
+ */
+static void
+ecma_lcache_get_property_key (ecma_object_t *object_p, /**< object */
+                              ecma_property_t *prop_p, /**< property or NULL */
+                              unsigned int *out_prop_cp_p, /**< [out] compressed pointer */
+                              uint16_t *out_slot_index_p) /**< [out] index of the slot plus one, or zero */
+{
+  if (prop_p != NULL
+      && (prop_p->flags & ECMA_PROPERTY_FLAG_SHAPED))
+  {
+    ecma_property_slots_header_t *slots_header_p = ecma_get_property_slots (object_p);
+    JERRY_ASSERT (slots_header_p != NULL);
+
+    ECMA_SET_NON_NULL_POINTER (*out_prop_cp_p, slots_header_p);
+    *out_slot_index_p = (uint16_t) (ecma_get_property_slot_index (slots_header_p, prop_p) + 1u);
+  }
+  else
+  {
+    ECMA_SET_POINTER (*out_prop_cp_p, prop_p);
+    *out_slot_index_p = 0;
+  }
+} /* ecma_lcache_get_property_key */
+
+/**
+ * Get property, registered in the LCache entry
+ *
+ * @return pointer to the property, or NULL
+ */
+static inline ecma_property_t * __attr_always_inline___
+ecma_lcache_get_entry_property (ecma_lcache_hash_entry_t *entry_p) /**< entry */
+{
+  if (entry_p->slot_index != 0)
+  {
+    ecma_property_slots_header_t *slots_header_p;
+    slots_header_p = ECMA_GET_NON_NULL_POINTER (ecma_property_slots_header_t, entry_p->prop_cp);
+
+    return ecma_get_property_slot (slots_header_p, entry_p->slot_index - 1u);
+  }
+
+  return ECMA_GET_POINTER (ecma_property_t, entry_p->prop_cp);
+} /* ecma_lcache_get_entry_property */
+
 /**
  * Invalidate specified LCache entry
  */
@@ -100,9 +203,7 @@ ecma_lcache_invalidate_entry (ecma_lcache_hash_entry_t *entry_p) /**< entry to i
 
   if (entry_p->prop_cp != ECMA_NULL_POINTER)
   {
-    ecma_set_property_lcached (ECMA_GET_NON_NULL_POINTER (ecma_property_t,
-                                                          entry_p->prop_cp),
-                               false);
+    ecma_set_property_lcached (ecma_lcache_get_entry_property (entry_p), false);
   }
 } /* ecma_lcache_invalidate_entry */
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
@@ -135,15 +236,19 @@ static void
 ecma_lcache_invalidate_row_for_object_property_pair (uint32_t row_index, /**< index of the row */
                                                      unsigned int object_cp, /**< compressed pointer
                                                                               *   to an object */
-                                                     unsigned property_cp) /**< compressed pointer
+                                                     unsigned property_cp, /**< compressed pointer
                                                                             *   to the object's
                                                                             *   property */
+                                                     uint16_t slot_index) /**< index of the property's
+                                                                           *   slot plus one, or zero */
 {
   for (uint32_t entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
   {
     if (ecma_lcache_hash_table[ row_index ][ entry_index ].object_cp == object_cp
-        && ecma_lcache_hash_table[ row_index ][ entry_index ].prop_cp == property_cp)
+        && ecma_lcache_hash_table[ row_index ][ entry_index ].prop_cp == property_cp
+        && ecma_lcache_hash_table[ row_index ][ entry_index ].slot_index == slot_index)
     {
+      ECMA_LCACHE_STAT (invalidations);
       ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[ row_index ][ entry_index ]);
     }
   }
@@ -166,33 +271,31 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
   prop_name_p = ecma_copy_or_ref_ecma_string (prop_name_p);
 
-  lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
+  unsigned int object_cp, prop_cp;
+  uint16_t slot_index;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+  ecma_lcache_get_property_key (object_p, prop_p, &prop_cp, &slot_index);
+
+  ecma_lcache_hash_entry_t *row_p = ecma_lcache_hash_table[ecma_lcache_row_index (object_cp,
+                                                                                  ecma_string_hash (prop_name_p))];
 
   if (prop_p != NULL)
   {
     if (unlikely (ecma_is_property_lcached (prop_p)))
     {
-      mem_cpointer_t prop_cp;
-      ECMA_SET_NON_NULL_POINTER (prop_cp, prop_p);
-
       int32_t entry_index;
       for (entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
       {
-        if (ecma_lcache_hash_table[hash_key][entry_index].object_cp != ECMA_NULL_POINTER
-            && ecma_lcache_hash_table[hash_key][entry_index].prop_cp == prop_cp)
+        if (row_p[entry_index].object_cp == object_cp
+            && row_p[entry_index].prop_cp == prop_cp
+            && row_p[entry_index].slot_index == slot_index)
         {
-#ifndef JERRY_NDEBUG
-          ecma_object_t *obj_in_entry_p;
-          obj_in_entry_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
-                                                      ecma_lcache_hash_table[hash_key][entry_index].object_cp);
-          JERRY_ASSERT (obj_in_entry_p == object_p);
-#endif /* !JERRY_NDEBUG */
           break;
         }
       }
 
       JERRY_ASSERT (entry_index != ECMA_LCACHE_HASH_ROW_LENGTH);
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[hash_key][entry_index]);
+      ecma_lcache_invalidate_entry (row_p + entry_index);
     }
 
     JERRY_ASSERT (!ecma_is_property_lcached (prop_p));
@@ -200,29 +303,35 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
   }
 
   int32_t entry_index;
-  for (entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
+  for (entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH - 1; entry_index++)
   {
-    if (ecma_lcache_hash_table[hash_key][entry_index].object_cp == ECMA_NULL_POINTER)
+    if (row_p[entry_index].object_cp == ECMA_NULL_POINTER)
     {
       break;
     }
   }
 
-  if (entry_index == ECMA_LCACHE_HASH_ROW_LENGTH)
+  if (row_p[entry_index].object_cp != ECMA_NULL_POINTER)
   {
-    /* No empty entry was found, invalidating the whole row */
-    for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
-    {
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[hash_key][i]);
-    }
+    /* No empty entry was found, evicting the least recently inserted one */
+    JERRY_ASSERT (entry_index == ECMA_LCACHE_HASH_ROW_LENGTH - 1);
 
-    entry_index = 0;
+    ECMA_LCACHE_STAT (evictions);
+    ecma_lcache_invalidate_entry (row_p + entry_index);
+  }
+
+  /* The new entry is placed to the beginning of the row, so that it is checked first upon lookups */
+  while (entry_index > 0)
+  {
+    row_p[entry_index] = row_p[entry_index - 1];
+    entry_index--;
   }
 
   ecma_ref_object (object_p);
-  ECMA_SET_NON_NULL_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].object_cp, object_p);
-  ECMA_SET_NON_NULL_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].prop_name_cp, prop_name_p);
-  ECMA_SET_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].prop_cp, prop_p);
+  row_p[0].object_cp = (mem_cpointer_t) object_cp;
+  ECMA_SET_NON_NULL_POINTER (row_p[0].prop_name_cp, prop_name_p);
+  row_p[0].prop_cp = (mem_cpointer_t) prop_cp;
+  row_p[0].slot_index = slot_index;
 #else /* CONFIG_ECMA_LCACHE_DISABLE */
   (void) prop_p;
 #endif /* CONFIG_ECMA_LCACHE_DISABLE */
@@ -245,26 +354,26 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
                                                  *         then the output parameter is not set */
 {
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
-  lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
-
   unsigned int object_cp;
   ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
 
+  ecma_lcache_hash_entry_t *row_p = ecma_lcache_hash_table[ecma_lcache_row_index (object_cp,
+                                                                                  ecma_string_hash (prop_name_p))];
+
   for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
   {
-    if (ecma_lcache_hash_table[hash_key][i].object_cp == object_cp)
+    if (row_p[i].object_cp == object_cp)
     {
-      ecma_string_t *entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
-                                                                    ecma_lcache_hash_table[hash_key][i].prop_name_cp);
-
-      JERRY_ASSERT (prop_name_p->hash == entry_prop_name_p->hash);
+      ecma_string_t *entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, row_p[i].prop_name_cp);
 
       if (ECMA_STRING_GET_CONTAINER (prop_name_p) == ECMA_STRING_GET_CONTAINER (entry_prop_name_p)
           && prop_name_p->u.common_field == entry_prop_name_p->u.common_field)
       {
-        ecma_property_t *prop_p = ECMA_GET_POINTER (ecma_property_t, ecma_lcache_hash_table[hash_key][i].prop_cp);
+        ecma_property_t *prop_p = ecma_lcache_get_entry_property (row_p + i);
         JERRY_ASSERT (prop_p == NULL || ecma_is_property_lcached (prop_p));
 
+        ECMA_LCACHE_STAT (hits);
+
         *prop_p_p = prop_p;
 
         return true;
@@ -275,6 +384,8 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
       }
     }
   }
+
+  ECMA_LCACHE_STAT (misses);
 #else /* CONFIG_ECMA_LCACHE_DISABLE */
   (void) object_p;
   (void) prop_name_p;
@@ -317,7 +428,14 @@ ecma_lcache_invalidate (ecma_object_t *object_p, /**< object */
 
     ecma_set_property_lcached (prop_p, false);
 
-    if (prop_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
+    if (prop_p->flags & ECMA_PROPERTY_FLAG_SHAPED)
+    {
+      ecma_property_slots_header_t *slots_header_p = ecma_get_property_slots (object_p);
+
+      prop_name_p = ecma_get_property_slot_name (slots_header_p,
+                                                 ecma_get_property_slot_index (slots_header_p, prop_p));
+    }
+    else if (prop_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
     {
       prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
                                                prop_p->v.named_data_property.name_p);
@@ -334,18 +452,43 @@ ecma_lcache_invalidate (ecma_object_t *object_p, /**< object */
   }
 
   unsigned int object_cp, prop_cp;
+  uint16_t slot_index;
   ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
-  ECMA_SET_POINTER (prop_cp, prop_p);
+  ecma_lcache_get_property_key (object_p, prop_p, &prop_cp, &slot_index);
 
-  lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
+  /* Given (object, property name) pair should be in the row corresponding to the object and the name's hash */
+  uint32_t row_index = ecma_lcache_row_index (object_cp, ecma_string_hash (prop_name_p));
 
-  /* Property's name has was computed.
-   * Given (object, property name) pair should be in the row corresponding to computed hash.
-   */
-  ecma_lcache_invalidate_row_for_object_property_pair (hash_key, object_cp, prop_cp);
+  ecma_lcache_invalidate_row_for_object_property_pair (row_index,
+                                                       object_cp,
+                                                       prop_cp,
+                                                       slot_index);
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 } /* ecma_lcache_invalidate */
 
+#ifdef MEM_STATS
+/**
+ * Print LCache's statistics
+ */
+void
+ecma_lcache_stats_print (void)
+{
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+  printf ("LCache stats:\n"
+          "  Rows = %u, ways = %u\n"
+          "  Lookups: hits = %zu, misses = %zu\n"
+          "  Evictions = %zu\n"
+          "  Invalidations = %zu\n\n",
+          (unsigned int) ECMA_LCACHE_HASH_ROWS_COUNT,
+          (unsigned int) ECMA_LCACHE_HASH_ROW_LENGTH,
+          ecma_lcache_stats.hits,
+          ecma_lcache_stats.misses,
+          ecma_lcache_stats.evictions,
+          ecma_lcache_stats.invalidations);
+#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
+} /* ecma_lcache_stats_print */
+#endif /* MEM_STATS */
+
 /**
  * @}
  * @}
@@ -29,6 +29,10 @@ extern void ecma_lcache_insert (ecma_object_t *, ecma_string_t *, ecma_property_
 extern bool ecma_lcache_lookup (ecma_object_t *, const ecma_string_t *, ecma_property_t **);
 extern void ecma_lcache_invalidate (ecma_object_t *, ecma_string_t *, ecma_property_t *);
 
+#ifdef MEM_STATS
+extern void ecma_lcache_stats_print (void);
+#endif /* MEM_STATS */
+
 /**
  * @}
  * @}
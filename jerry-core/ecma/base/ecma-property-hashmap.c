@@ -0,0 +1,312 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Implementation of property hashmaps
+ *
+ * The hashmap is created on demand for objects and lexical environments, which property lists
+ * contain many named properties, and is kept consistent upon creation and deletion of the properties.
+ * The hashmap is linked to the property list as an internal property, which is placed at the list's start
+ * (right after header of the object's slots, if the object is shaped). Properties, stored in slots,
+ * are located through the object's shape, and so are not put to the hashmap.
+ */
+
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-property-hashmap.h"
+#include "jrt-libc-includes.h"
+#include "mem-heap.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmapropertyhashmap Property hashmap
+ * @{
+ */
+
+/**
+ * Minimum number of the hashmap's entries
+ */
+#define ECMA_PROPERTY_HASHMAP_MIN_ENTRIES (32u)
+
+/**
+ * Get the hashmap's table of entries
+ */
+#define ECMA_PROPERTY_HASHMAP_GET_TABLE(hashmap_p) ((mem_cpointer_t *) ((hashmap_p) + 1))
+
+/**
+ * Get size of the hashmap's memory block
+ */
+#define ECMA_PROPERTY_HASHMAP_GET_SIZE(max_property_count) \
+  (sizeof (ecma_property_hashmap_t) + (max_property_count) * sizeof (mem_cpointer_t))
+
+/**
+ * Get the object's property hashmap
+ *
+ * @return pointer to the hashmap,
+ *         or NULL - if the object doesn't have a hashmap
+ */
+ecma_property_hashmap_t *
+ecma_property_hashmap_get (const ecma_object_t *object_p) /**< object or lexical environment */
+{
+  if (ecma_is_lexical_environment (object_p)
+      && ecma_get_lex_env_type (object_p) != ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  {
+    return NULL;
+  }
+
+  ecma_property_t *property_p = ecma_get_property_list (object_p);
+
+  if (property_p != NULL
+      && property_p->flags == ECMA_PROPERTY_FLAG_SHAPED)
+  {
+    property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p);
+  }
+
+  if (property_p != NULL
+      && (property_p->flags & ECMA_PROPERTY_FLAG_INTERNAL)
+      && property_p->h.internal_property_type == ECMA_INTERNAL_PROPERTY_PROPERTY_HASHMAP)
+  {
+    return ECMA_GET_NON_NULL_POINTER (ecma_property_hashmap_t, property_p->v.internal_property.value);
+  }
+
+  return NULL;
+} /* ecma_property_hashmap_get */
+
+/**
+ * Get name of a named property of the property list
+ *
+ * @return pointer to the name (the reference counter is not increased)
+ */
+static ecma_string_t *
+ecma_property_hashmap_get_name (const ecma_property_t *property_p) /**< named property */
+{
+  JERRY_ASSERT (!(property_p->flags & ECMA_PROPERTY_FLAG_SHAPED));
+
+  if (property_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
+  {
+    return ECMA_GET_NON_NULL_POINTER (ecma_string_t, property_p->v.named_data_property.name_p);
+  }
+
+  JERRY_ASSERT (property_p->flags & ECMA_PROPERTY_FLAG_NAMEDACCESSOR);
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_string_t, property_p->v.named_accessor_property.name_p);
+} /* ecma_property_hashmap_get_name */
+
+/**
+ * Get hash of the name of the property, referenced by an entry of the hashmap
+ *
+ * @return hash of the name
+ */
+static lit_string_hash_t
+ecma_property_hashmap_get_entry_hash (mem_cpointer_t entry) /**< non-empty entry */
+{
+  ecma_property_t *property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_t, entry);
+
+  return ecma_string_hash (ecma_property_hashmap_get_name (property_p));
+} /* ecma_property_hashmap_get_entry_hash */
+
+/**
+ * Put the property to a free entry of the hashmap
+ */
+static void
+ecma_property_hashmap_put (ecma_property_hashmap_t *hashmap_p, /**< hashmap */
+                           ecma_property_t *property_p) /**< named property */
+{
+  JERRY_ASSERT (hashmap_p->property_count < hashmap_p->max_property_count);
+
+  mem_cpointer_t *table_p = ECMA_PROPERTY_HASHMAP_GET_TABLE (hashmap_p);
+  uint32_t mask = hashmap_p->max_property_count - 1;
+  lit_string_hash_t hash = ecma_string_hash (ecma_property_hashmap_get_name (property_p));
+  uint32_t index = ecma_hash_table_get_start_index (hashmap_p->max_property_count, hash);
+
+  while (table_p[index] != ECMA_NULL_POINTER)
+  {
+    index = (index + 1) & mask;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (table_p[index], property_p);
+  hashmap_p->property_count++;
+} /* ecma_property_hashmap_put */
+
+/**
+ * Create the object's property hashmap, containing the named properties of the object's property list
+ *
+ * Note:
+ *      the object should not have a hashmap
+ */
+void
+ecma_property_hashmap_create (ecma_object_t *object_p) /**< object or lexical environment */
+{
+  JERRY_ASSERT (ecma_property_hashmap_get (object_p) == NULL);
+
+  uint32_t property_count = 0;
+
+  for (ecma_property_t *property_p = ecma_get_property_list (object_p);
+       property_p != NULL;
+       property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
+  {
+    if (property_p->flags & (ECMA_PROPERTY_FLAG_NAMEDDATA | ECMA_PROPERTY_FLAG_NAMEDACCESSOR))
+    {
+      property_count++;
+    }
+  }
+
+  uint32_t max_property_count = ECMA_PROPERTY_HASHMAP_MIN_ENTRIES;
+
+  while (max_property_count < property_count * 2)
+  {
+    max_property_count *= 2;
+  }
+
+  size_t size = ECMA_PROPERTY_HASHMAP_GET_SIZE (max_property_count);
+  ecma_property_hashmap_t *hashmap_p = (ecma_property_hashmap_t *) mem_heap_alloc_block (size);
+
+  hashmap_p->max_property_count = max_property_count;
+  hashmap_p->property_count = 0;
+  memset (ECMA_PROPERTY_HASHMAP_GET_TABLE (hashmap_p), 0, max_property_count * sizeof (mem_cpointer_t));
+
+  for (ecma_property_t *property_p = ecma_get_property_list (object_p);
+       property_p != NULL;
+       property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
+  {
+    if (property_p->flags & (ECMA_PROPERTY_FLAG_NAMEDDATA | ECMA_PROPERTY_FLAG_NAMEDACCESSOR))
+    {
+      ecma_property_hashmap_put (hashmap_p, property_p);
+    }
+  }
+
+  JERRY_ASSERT (hashmap_p->property_count == property_count);
+
+  /* The hashmap is linked after it is filled, as allocation of the internal property could run GC */
+  ecma_property_t *hashmap_property_p = ecma_create_internal_property (object_p,
+                                                                      ECMA_INTERNAL_PROPERTY_PROPERTY_HASHMAP);
+  ECMA_SET_NON_NULL_POINTER (hashmap_property_p->v.internal_property.value, hashmap_p);
+
+  JERRY_ASSERT (ecma_property_hashmap_get (object_p) == hashmap_p);
+} /* ecma_property_hashmap_create */
+
+/**
+ * Free the object's property hashmap
+ *
+ * Note:
+ *      the object should have a hashmap
+ */
+void
+ecma_property_hashmap_free (ecma_object_t *object_p) /**< object or lexical environment */
+{
+  JERRY_ASSERT (ecma_property_hashmap_get (object_p) != NULL);
+
+  ecma_delete_property (object_p,
+                        ecma_find_internal_property (object_p, ECMA_INTERNAL_PROPERTY_PROPERTY_HASHMAP));
+} /* ecma_property_hashmap_free */
+
+/**
+ * Free memory block of the hashmap
+ */
+void
+ecma_property_hashmap_free_table (ecma_property_hashmap_t *hashmap_p) /**< hashmap */
+{
+  mem_heap_free_block (hashmap_p, ECMA_PROPERTY_HASHMAP_GET_SIZE (hashmap_p->max_property_count));
+} /* ecma_property_hashmap_free_table */
+
+/**
+ * Insert a named property, that was linked to the object's property list, into the object's hashmap, if it exists
+ */
+void
+ecma_property_hashmap_insert (ecma_object_t *object_p, /**< object or lexical environment */
+                              ecma_property_t *property_p) /**< named property */
+{
+  ecma_property_hashmap_t *hashmap_p = ecma_property_hashmap_get (object_p);
+
+  if (hashmap_p == NULL)
+  {
+    return;
+  }
+
+  if ((hashmap_p->property_count + 1) * 2 > hashmap_p->max_property_count)
+  {
+    /* The hashmap is re-created, as a larger one, from the property list, that already contains the property */
+    ecma_property_hashmap_free (object_p);
+    ecma_property_hashmap_create (object_p);
+    return;
+  }
+
+  ecma_property_hashmap_put (hashmap_p, property_p);
+} /* ecma_property_hashmap_insert */
+
+/**
+ * Delete a named property of the object's property list from the object's hashmap, if it exists
+ */
+void
+ecma_property_hashmap_delete (ecma_object_t *object_p, /**< object or lexical environment */
+                              ecma_property_t *property_p) /**< named property */
+{
+  ecma_property_hashmap_t *hashmap_p = ecma_property_hashmap_get (object_p);
+
+  if (hashmap_p == NULL)
+  {
+    return;
+  }
+
+  mem_cpointer_t *table_p = ECMA_PROPERTY_HASHMAP_GET_TABLE (hashmap_p);
+  uint32_t mask = hashmap_p->max_property_count - 1;
+  lit_string_hash_t hash = ecma_string_hash (ecma_property_hashmap_get_name (property_p));
+  uint32_t index = ecma_hash_table_get_start_index (hashmap_p->max_property_count, hash);
+
+  while (ECMA_GET_NON_NULL_POINTER (ecma_property_t, table_p[index]) != property_p)
+  {
+    index = (index + 1) & mask;
+  }
+
+  ecma_hash_table_free_entry (table_p, hashmap_p->max_property_count, index, ecma_property_hashmap_get_entry_hash);
+  hashmap_p->property_count--;
+} /* ecma_property_hashmap_delete */
+
+/**
+ * Find a named property in the hashmap
+ *
+ * @return pointer to the property,
+ *         or NULL - if the object's property list doesn't contain a property with the specified name
+ */
+ecma_property_t *
+ecma_property_hashmap_find (ecma_property_hashmap_t *hashmap_p, /**< hashmap */
+                            const ecma_string_t *name_p) /**< property's name */
+{
+  mem_cpointer_t *table_p = ECMA_PROPERTY_HASHMAP_GET_TABLE (hashmap_p);
+  uint32_t mask = hashmap_p->max_property_count - 1;
+  uint32_t index = ecma_hash_table_get_start_index (hashmap_p->max_property_count, ecma_string_hash (name_p));
+
+  while (table_p[index] != ECMA_NULL_POINTER)
+  {
+    ecma_property_t *property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_t, table_p[index]);
+    ecma_string_t *property_name_p = ecma_property_hashmap_get_name (property_p);
+
+    if (ecma_string_hash (property_name_p) == ecma_string_hash (name_p)
+        && ecma_compare_ecma_strings (property_name_p, name_p))
+    {
+      return property_p;
+    }
+
+    index = (index + 1) & mask;
+  }
+
+  return NULL;
+} /* ecma_property_hashmap_find */
+
+/**
+ * @}
+ * @}
+ */
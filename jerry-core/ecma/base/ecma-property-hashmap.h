@@ -0,0 +1,53 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_PROPERTY_HASHMAP_H
+#define ECMA_PROPERTY_HASHMAP_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmapropertyhashmap Property hashmap
+ * @{
+ */
+
+/**
+ * Header of an object's property hashmap
+ *
+ * The hashmap is an open addressing hash table of compressed pointers to named properties
+ * of the object's property list. The table is placed right after the header.
+ */
+typedef struct
+{
+  uint32_t max_property_count; /**< number of entries of the table (a power of 2) */
+  uint32_t property_count; /**< number of properties in the table */
+} ecma_property_hashmap_t;
+
+extern ecma_property_hashmap_t *ecma_property_hashmap_get (const ecma_object_t *);
+extern void ecma_property_hashmap_create (ecma_object_t *);
+extern void ecma_property_hashmap_free (ecma_object_t *);
+extern void ecma_property_hashmap_free_table (ecma_property_hashmap_t *);
+extern void ecma_property_hashmap_insert (ecma_object_t *, ecma_property_t *);
+extern void ecma_property_hashmap_delete (ecma_object_t *, ecma_property_t *);
+extern ecma_property_t *ecma_property_hashmap_find (ecma_property_hashmap_t *, const ecma_string_t *);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_PROPERTY_HASHMAP_H */
@@ -0,0 +1,250 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Implementation of shapes (hidden classes)
+ *
+ * Objects, that get the same named data properties in the same order, share the chain of shapes,
+ * describing the properties' names, while values and attributes of the properties are stored in the objects'
+ * arrays of slots (see also: ecma_property_slots_header_t). So names are not repeated in each object,
+ * and a property is located by an index in the array.
+ */
+
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-shapes.h"
+#include "mem-heap.h"
+#include "vm-inline-cache.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashapes Shapes (hidden classes)
+ * @{
+ */
+
+JERRY_STATIC_ASSERT (CONFIG_ECMA_SHAPE_MAX_PROPERTIES <= UINT8_MAX,
+                     CONFIG_ECMA_SHAPE_MAX_PROPERTIES_must_be_less_than_or_equal_to_UINT8_MAX);
+
+JERRY_STATIC_ASSERT (CONFIG_ECMA_SHAPE_MAX_TRANSITIONS <= UINT8_MAX,
+                     CONFIG_ECMA_SHAPE_MAX_TRANSITIONS_must_be_less_than_or_equal_to_UINT8_MAX);
+
+/**
+ * First of the shapes, describing one property, i.e. transitioned from an object without shaped properties
+ */
+static mem_cpointer_t ecma_shape_roots_cp;
+
+/**
+ * Number of the shapes, describing one property
+ */
+static uint32_t ecma_shape_roots_number;
+
+/**
+ * Initialize the shapes' transition tree
+ */
+void
+ecma_shapes_init (void)
+{
+  ecma_shape_roots_cp = ECMA_NULL_POINTER;
+  ecma_shape_roots_number = 0;
+} /* ecma_shapes_init */
+
+/**
+ * Get shape, that describes the properties of the specified shape, and a new property with the specified name,
+ * creating it, if the transition doesn't exist yet
+ *
+ * Note:
+ *      the property should not be described by the shape
+ *
+ * @return pointer to the shape, which reference counter is increased,
+ *         or NULL - if the number of properties or transitions exceeds the configured limit
+ */
+ecma_shape_t *
+ecma_shape_transition (ecma_shape_t *shape_p, /**< shape, describing current properties,
+                                               *   or NULL - if there are no such properties */
+                       ecma_string_t *name_p) /**< name of the new property */
+{
+  mem_cpointer_t *children_cp_p;
+  uint32_t children_number;
+  uint32_t index;
+
+  if (shape_p == NULL)
+  {
+    children_cp_p = &ecma_shape_roots_cp;
+    children_number = ecma_shape_roots_number;
+    index = 0;
+  }
+  else
+  {
+    children_cp_p = &shape_p->children_cp;
+    children_number = shape_p->children_number;
+    index = shape_p->index + 1u;
+  }
+
+  for (ecma_shape_t *child_p = ECMA_GET_POINTER (ecma_shape_t, *children_cp_p);
+       child_p != NULL;
+       child_p = ECMA_GET_POINTER (ecma_shape_t, child_p->next_sibling_cp))
+  {
+    if (ecma_compare_ecma_strings (ECMA_GET_NON_NULL_POINTER (ecma_string_t, child_p->name_cp), name_p))
+    {
+      ecma_shape_ref (child_p);
+      return child_p;
+    }
+  }
+
+  if (index >= CONFIG_ECMA_SHAPE_MAX_PROPERTIES
+      || children_number >= CONFIG_ECMA_SHAPE_MAX_TRANSITIONS)
+  {
+    return NULL;
+  }
+
+  ecma_shape_t *child_p = (ecma_shape_t *) mem_heap_alloc_block (sizeof (ecma_shape_t));
+
+  ECMA_SET_POINTER (child_p->parent_cp, shape_p);
+  ECMA_SET_NON_NULL_POINTER (child_p->name_cp, ecma_copy_or_ref_ecma_string (name_p));
+  child_p->children_cp = ECMA_NULL_POINTER;
+  child_p->next_sibling_cp = *children_cp_p;
+  child_p->refs = 1;
+  child_p->index = (uint8_t) index;
+  child_p->children_number = 0;
+
+  ECMA_SET_NON_NULL_POINTER (*children_cp_p, child_p);
+
+  if (shape_p == NULL)
+  {
+    ecma_shape_roots_number++;
+  }
+  else
+  {
+    shape_p->children_number++;
+
+    /* the parent is referenced by the child */
+    ecma_shape_ref (shape_p);
+  }
+
+  return child_p;
+} /* ecma_shape_transition */
+
+/**
+ * Increase reference counter of the shape
+ */
+void
+ecma_shape_ref (ecma_shape_t *shape_p) /**< shape */
+{
+  if (unlikely (shape_p->refs == UINT32_MAX))
+  {
+    jerry_fatal (ERR_REF_COUNT_LIMIT);
+  }
+
+  shape_p->refs++;
+} /* ecma_shape_ref */
+
+/**
+ * Decrease reference counter of the shape, and free it and the ancestors, that are not referenced anymore
+ */
+void
+ecma_shape_deref (ecma_shape_t *shape_p) /**< shape */
+{
+  while (shape_p != NULL)
+  {
+    JERRY_ASSERT (shape_p->refs > 0);
+
+    if (--shape_p->refs > 0)
+    {
+      return;
+    }
+
+    JERRY_ASSERT (shape_p->children_cp == ECMA_NULL_POINTER && shape_p->children_number == 0);
+
+    ecma_shape_t *parent_p = ECMA_GET_POINTER (ecma_shape_t, shape_p->parent_cp);
+
+    mem_cpointer_t *sibling_cp_p;
+
+    if (parent_p == NULL)
+    {
+      sibling_cp_p = &ecma_shape_roots_cp;
+      ecma_shape_roots_number--;
+    }
+    else
+    {
+      sibling_cp_p = &parent_p->children_cp;
+      parent_p->children_number--;
+    }
+
+    while (ECMA_GET_NON_NULL_POINTER (ecma_shape_t, *sibling_cp_p) != shape_p)
+    {
+      sibling_cp_p = &ECMA_GET_NON_NULL_POINTER (ecma_shape_t, *sibling_cp_p)->next_sibling_cp;
+    }
+
+    *sibling_cp_p = shape_p->next_sibling_cp;
+
+    ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp));
+    mem_heap_free_block (shape_p, sizeof (ecma_shape_t));
+
+    /* Inline caches could refer to the shape */
+    vm_inline_cache_invalidate_all ();
+
+    shape_p = parent_p;
+  }
+} /* ecma_shape_deref */
+
+/**
+ * Find index of the slot of a property, described by the shape
+ *
+ * @return true - if the shape describes a property with the specified name,
+ *         false - otherwise
+ */
+bool
+ecma_shape_find_property (const ecma_shape_t *shape_p, /**< shape */
+                          const ecma_string_t *name_p, /**< property's name */
+                          uint32_t *out_index_p) /**< [out] index of the property's slot */
+{
+  while (shape_p != NULL)
+  {
+    if (ecma_compare_ecma_strings (ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp), name_p))
+    {
+      *out_index_p = shape_p->index;
+      return true;
+    }
+
+    shape_p = ECMA_GET_POINTER (ecma_shape_t, shape_p->parent_cp);
+  }
+
+  return false;
+} /* ecma_shape_find_property */
+
+/**
+ * Get name of a property, described by the shape
+ *
+ * @return pointer to the name (the reference counter is not increased)
+ */
+ecma_string_t *
+ecma_shape_get_property_name (const ecma_shape_t *shape_p, /**< shape */
+                              uint32_t index) /**< index of the property's slot */
+{
+  JERRY_ASSERT (shape_p != NULL && index <= shape_p->index);
+
+  while (shape_p->index != index)
+  {
+    shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+  }
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp);
+} /* ecma_shape_get_property_name */
+
+/**
+ * @}
+ * @}
+ */
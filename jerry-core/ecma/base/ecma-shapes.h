@@ -0,0 +1,40 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_SHAPES_H
+#define ECMA_SHAPES_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashapes Shapes (hidden classes)
+ * @{
+ */
+
+extern void ecma_shapes_init (void);
+extern ecma_shape_t *ecma_shape_transition (ecma_shape_t *, ecma_string_t *);
+extern void ecma_shape_ref (ecma_shape_t *);
+extern void ecma_shape_deref (ecma_shape_t *);
+extern bool ecma_shape_find_property (const ecma_shape_t *, const ecma_string_t *, uint32_t *);
+extern ecma_string_t *ecma_shape_get_property_name (const ecma_shape_t *, uint32_t);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_SHAPES_H */
@@ -62,14 +62,14 @@ ecma_builtin_array_prototype_helper_set_length (ecma_object_t *object, /**< obje
   ecma_value_t ret_value;
   ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
 
-  ecma_number_t *len_p = ecma_alloc_number ();
-  *len_p = length;
+  ecma_value_t length_value = ecma_make_number_value (length);
 
   ret_value = ecma_op_object_put (object,
                                   magic_string_length_p,
-                                  ecma_make_number_value (len_p),
-                                  true),
-  ecma_dealloc_number (len_p);
+                                  length_value,
+                                  true);
+
+  ecma_free_value (length_value);
   ecma_deref_ecma_string (magic_string_length_p);
 
   return ret_value;
@@ -171,43 +171,34 @@ ecma_builtin_array_prototype_object_to_locale_string (const ecma_value_t this_ar
   }
   else
   {
-    /* 7-8. */
-    ECMA_TRY_CATCH (first_value,
-                    ecma_builtin_helper_get_to_locale_string_at_index (obj_p, 0),
-                    ret_value);
-
-    ecma_string_t *return_string_p = ecma_copy_or_ref_ecma_string (ecma_get_string_from_value (first_value));
+    ecma_stringbuilder_t builder;
+    ecma_stringbuilder_init (&builder);
 
-    /* 9-10. */
-    for (uint32_t k = 1; ecma_is_value_empty (ret_value) && (k < length); k++)
+    /* 7-10. */
+    for (uint32_t k = 0; ecma_is_value_empty (ret_value) && (k < length); k++)
     {
-      ecma_string_t *part_string_p = ecma_concat_ecma_strings (return_string_p, separator_string_p);
+      if (k > 0)
+      {
+        ecma_stringbuilder_append (&builder, separator_string_p);
+      }
 
       ECMA_TRY_CATCH (next_string_value,
                       ecma_builtin_helper_get_to_locale_string_at_index (obj_p, k),
                       ret_value);
 
-      ecma_string_t *next_string_p = ecma_get_string_from_value (next_string_value);
-
-      ecma_deref_ecma_string (return_string_p);
-
-      return_string_p = ecma_concat_ecma_strings (part_string_p, next_string_p);
+      ecma_stringbuilder_append (&builder, ecma_get_string_from_value (next_string_value));
 
       ECMA_FINALIZE (next_string_value);
-
-      ecma_deref_ecma_string (part_string_p);
     }
 
     if (ecma_is_value_empty (ret_value))
     {
-      ret_value = ecma_make_string_value (return_string_p);
+      ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
     }
     else
     {
-      ecma_deref_ecma_string (return_string_p);
+      ecma_stringbuilder_destroy (&builder);
     }
-
-    ECMA_FINALIZE (first_value);
   }
 
   ecma_deref_ecma_string (separator_string_p);
@@ -398,46 +389,37 @@ ecma_builtin_array_prototype_join (const ecma_value_t this_arg, /**< this argume
   {
     ecma_string_t *separator_string_p = ecma_get_string_from_value (separator_value);
 
-    /* 7-8. */
-    ECMA_TRY_CATCH (first_value,
-                    ecma_op_array_get_to_string_at_index (obj_p, 0),
-                    ret_value);
-
-    ecma_string_t *return_string_p = ecma_copy_or_ref_ecma_string (ecma_get_string_from_value (first_value));
+    /* The parts are collected in a string builder, instead of concatenating the partial results. */
+    ecma_stringbuilder_t builder;
+    ecma_stringbuilder_init (&builder);
 
-    /* 9-10. */
-    for (uint32_t k = 1; ecma_is_value_empty (ret_value) && (k < length); k++)
+    /* 7-10. */
+    for (uint32_t k = 0; ecma_is_value_empty (ret_value) && (k < length); k++)
     {
-      /* 10.a */
-      ecma_string_t *part_string_p = ecma_concat_ecma_strings (return_string_p, separator_string_p);
+      if (k > 0)
+      {
+        /* 10.a */
+        ecma_stringbuilder_append (&builder, separator_string_p);
+      }
 
-      /* 10.b, 10.c */
+      /* 7-8, 10.b-10.d */
       ECMA_TRY_CATCH (next_string_value,
                       ecma_op_array_get_to_string_at_index (obj_p, k),
                       ret_value);
 
-      ecma_string_t *next_string_p = ecma_get_string_from_value (next_string_value);
-
-      ecma_deref_ecma_string (return_string_p);
-
-      /* 10.d */
-      return_string_p = ecma_concat_ecma_strings (part_string_p, next_string_p);
+      ecma_stringbuilder_append (&builder, ecma_get_string_from_value (next_string_value));
 
       ECMA_FINALIZE (next_string_value);
-
-      ecma_deref_ecma_string (part_string_p);
     }
 
     if (ecma_is_value_empty (ret_value))
     {
-      ret_value = ecma_make_string_value (return_string_p);
+      ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
     }
     else
     {
-      ecma_deref_ecma_string (return_string_p);
+      ecma_stringbuilder_destroy (&builder);
     }
-
-    ECMA_FINALIZE (first_value);
   }
 
   ECMA_FINALIZE (separator_value);
@@ -587,10 +569,7 @@ ecma_builtin_array_prototype_object_push (ecma_value_t this_arg, /**< this argum
                     ecma_builtin_array_prototype_helper_set_length (obj_p, n),
                     ret_value);
 
-    ecma_number_t *ret_num_p = ecma_alloc_number ();
-    *ret_num_p = n;
-
-    ret_value = ecma_make_number_value (ret_num_p);
+    ret_value = ecma_make_number_value (n);
 
     ECMA_FINALIZE (set_length_value)
   }
@@ -654,8 +633,8 @@ ecma_builtin_array_prototype_object_reverse (ecma_value_t this_arg) /**< this ar
     ECMA_TRY_CATCH (upper_value, ecma_op_object_get (obj_p, upper_str_p), ret_value);
 
     /* 6.f and 6.g */
-    bool lower_exist = (ecma_op_object_get_property (obj_p, lower_str_p) != NULL);
-    bool upper_exist = (ecma_op_object_get_property (obj_p, upper_str_p) != NULL);
+    bool lower_exist = ecma_op_object_has_property (obj_p, lower_str_p);
+    bool upper_exist = ecma_op_object_has_property (obj_p, upper_str_p);
 
     /* 6.h */
     if (lower_exist && upper_exist)
@@ -761,7 +740,7 @@ ecma_builtin_array_prototype_object_shift (ecma_value_t this_arg) /**< this argu
       ecma_string_t *to_str_p = ecma_new_ecma_string_from_uint32 (k - 1);
 
       /* 7.c */
-      if (ecma_op_object_get_property (obj_p, from_str_p) != NULL)
+      if (ecma_op_object_has_property (obj_p, from_str_p))
       {
         /* 7.d.i */
         ECMA_TRY_CATCH (curr_value, ecma_op_object_get (obj_p, from_str_p), ret_value);
@@ -888,7 +867,7 @@ ecma_builtin_array_prototype_object_slice (ecma_value_t this_arg, /**< 'this' ar
     ecma_string_t *curr_idx_str_p = ecma_new_ecma_string_from_uint32 (k);
 
     /* 10.c */
-    if (ecma_op_object_get_property (obj_p, curr_idx_str_p) != NULL)
+    if (ecma_op_object_has_property (obj_p, curr_idx_str_p))
     {
       /* 10.c.i */
       ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, curr_idx_str_p), ret_value);
@@ -952,7 +931,7 @@ ecma_builtin_array_prototype_object_sort_compare_helper (ecma_value_t j, /**< le
    * sort to the end of the result, followed by non-existent property values.
    */
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
-  ecma_number_t *result_p = ecma_alloc_number ();
+  ecma_number_t result = ECMA_NUMBER_ZERO;
 
   bool j_is_undef = ecma_is_value_undefined (j);
   bool k_is_undef = ecma_is_value_undefined (k);
@@ -961,18 +940,18 @@ ecma_builtin_array_prototype_object_sort_compare_helper (ecma_value_t j, /**< le
   {
     if (k_is_undef)
     {
-      *result_p = ECMA_NUMBER_ZERO;
+      result = ECMA_NUMBER_ZERO;
     }
     else
     {
-      *result_p = ECMA_NUMBER_ONE;
+      result = ECMA_NUMBER_ONE;
     }
   }
   else
   {
     if (k_is_undef)
     {
-      *result_p = ECMA_NUMBER_MINUS_ONE;
+      result = ECMA_NUMBER_MINUS_ONE;
     }
     else
     {
@@ -986,15 +965,15 @@ ecma_builtin_array_prototype_object_sort_compare_helper (ecma_value_t j, /**< le
 
         if (ecma_compare_ecma_strings_relational (j_str_p, k_str_p))
         {
-          *result_p = ECMA_NUMBER_MINUS_ONE;
+          result = ECMA_NUMBER_MINUS_ONE;
         }
         else if (!ecma_compare_ecma_strings (j_str_p, k_str_p))
         {
-          *result_p = ECMA_NUMBER_ONE;
+          result = ECMA_NUMBER_ONE;
         }
         else
         {
-          *result_p = ECMA_NUMBER_ZERO;
+          result = ECMA_NUMBER_ZERO;
         }
 
         ECMA_FINALIZE (k_value);
@@ -1021,12 +1000,12 @@ ecma_builtin_array_prototype_object_sort_compare_helper (ecma_value_t j, /**< le
         if (!ecma_is_value_number (call_value))
         {
           ECMA_OP_TO_NUMBER_TRY_CATCH (ret_num, call_value, ret_value);
-          *result_p = ret_num;
+          result = ret_num;
           ECMA_OP_TO_NUMBER_FINALIZE (ret_num);
         }
         else
         {
-          *result_p = *ecma_get_number_from_value (call_value);
+          result = ecma_get_number_from_value (call_value);
         }
 
         ECMA_FINALIZE (call_value);
@@ -1036,11 +1015,7 @@ ecma_builtin_array_prototype_object_sort_compare_helper (ecma_value_t j, /**< le
 
   if (ecma_is_value_empty (ret_value))
   {
-    ret_value = ecma_make_number_value (result_p);
-  }
-  else
-  {
-    ecma_dealloc_number (result_p);
+    ret_value = ecma_make_number_value (result);
   }
 
   return ret_value;
@@ -1080,7 +1055,7 @@ ecma_builtin_array_prototype_object_array_to_heap_helper (ecma_value_t array[],
       JERRY_ASSERT (ecma_is_value_number (child_compare_value));
 
       /* Use the child that is greater. */
-      if (*ecma_get_number_from_value (child_compare_value) < ECMA_NUMBER_ZERO)
+      if (ecma_get_number_from_value (child_compare_value) < ECMA_NUMBER_ZERO)
       {
         child++;
       }
@@ -1100,7 +1075,7 @@ ecma_builtin_array_prototype_object_array_to_heap_helper (ecma_value_t array[],
                       ret_value);
       JERRY_ASSERT (ecma_is_value_number (swap_compare_value));
 
-      if (*ecma_get_number_from_value (swap_compare_value) <= ECMA_NUMBER_ZERO)
+      if (ecma_get_number_from_value (swap_compare_value) <= ECMA_NUMBER_ZERO)
       {
         /* Break from loop if current child is less than swap (tree top) */
         should_break = true;
@@ -1447,7 +1422,7 @@ ecma_builtin_array_prototype_object_splice (ecma_value_t this_arg, /**< this arg
     ecma_string_t *idx_str_p = ecma_new_ecma_string_from_uint32 (del_item_idx);
 
     /* 9.b */
-    if (ecma_op_object_get_property (obj_p, idx_str_p) != NULL)
+    if (ecma_op_object_has_property (obj_p, idx_str_p))
     {
       /* 9.c.i */
       ECMA_TRY_CATCH (get_value,
@@ -1505,7 +1480,7 @@ ecma_builtin_array_prototype_object_splice (ecma_value_t this_arg, /**< this arg
         ecma_string_t *to_str_p = ecma_new_ecma_string_from_uint32 (to);
 
         /* 12.b.iii */
-        if (ecma_op_object_get_property (obj_p, from_str_p) != NULL)
+        if (ecma_op_object_has_property (obj_p, from_str_p))
         {
           /* 12.b.iv */
           ECMA_TRY_CATCH (get_value,
@@ -1558,7 +1533,7 @@ ecma_builtin_array_prototype_object_splice (ecma_value_t this_arg, /**< this arg
         ecma_string_t *to_str_p = ecma_new_ecma_string_from_uint32 (to);
 
         /* 13.b.iii */
-        if (ecma_op_object_get_property (obj_p, from_str_p) != NULL)
+        if (ecma_op_object_has_property (obj_p, from_str_p))
         {
           /* 13.b.iv */
           ECMA_TRY_CATCH (get_value,
@@ -1674,7 +1649,7 @@ ecma_builtin_array_prototype_object_unshift (ecma_value_t this_arg, /**< this ar
     ecma_string_t *to_str_p = ecma_new_ecma_string_from_number (new_idx);
 
     /* 6.c */
-    if (ecma_op_object_get_property (obj_p, from_str_p) != NULL)
+    if (ecma_op_object_has_property (obj_p, from_str_p))
     {
       /* 6.d.i */
       ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, from_str_p), ret_value);
@@ -1713,9 +1688,7 @@ ecma_builtin_array_prototype_object_unshift (ecma_value_t this_arg, /**< this ar
     ECMA_TRY_CATCH (set_length_value,
                     ecma_builtin_array_prototype_helper_set_length (obj_p, new_len),
                     ret_value);
-    ecma_number_t *num_p = ecma_alloc_number ();
-    *num_p = new_len;
-    ret_value = ecma_make_number_value (num_p);
+    ret_value = ecma_make_number_value (new_len);
 
     ECMA_FINALIZE (set_length_value);
   }
@@ -1765,9 +1738,7 @@ ecma_builtin_array_prototype_object_index_of (ecma_value_t this_arg, /**< this a
   /* 4. */
   if (len == 0)
   {
-    ecma_number_t *num_p = ecma_alloc_number ();
-    *num_p = ECMA_NUMBER_MINUS_ONE;
-    ret_value = ecma_make_number_value (num_p);
+    ret_value = ecma_make_number_value (ECMA_NUMBER_MINUS_ONE);
   }
   else
   {
@@ -1788,7 +1759,7 @@ ecma_builtin_array_prototype_object_index_of (ecma_value_t this_arg, /**< this a
         ecma_string_t *idx_str_p = ecma_new_ecma_string_from_uint32 (from_idx);
 
         /* 9.a */
-        if (ecma_op_object_get_property (obj_p, idx_str_p) != NULL)
+        if (ecma_op_object_has_property (obj_p, idx_str_p))
         {
           /* 9.b.i */
           ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, idx_str_p), ret_value);
@@ -1808,9 +1779,7 @@ ecma_builtin_array_prototype_object_index_of (ecma_value_t this_arg, /**< this a
 
     if (ecma_is_value_empty (ret_value))
     {
-      ecma_number_t *num_p = ecma_alloc_number ();
-      *num_p = found_index;
-      ret_value = ecma_make_number_value (num_p);
+      ret_value = ecma_make_number_value (found_index);
     }
 
     ECMA_OP_TO_NUMBER_FINALIZE (arg_from_idx);
@@ -1862,13 +1831,12 @@ ecma_builtin_array_prototype_object_last_index_of (ecma_value_t this_arg, /**< t
   /* 3. */
   uint32_t len = ecma_number_to_uint32 (len_number);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-  *num_p = ECMA_NUMBER_MINUS_ONE;
+  ecma_number_t num = ECMA_NUMBER_MINUS_ONE;
 
   /* 4. */
   if (len == 0)
   {
-    ret_value = ecma_make_number_value (num_p);
+    ret_value = ecma_make_number_value (num);
   }
   else
   {
@@ -1937,13 +1905,13 @@ ecma_builtin_array_prototype_object_last_index_of (ecma_value_t this_arg, /**< t
      * for an underflow instead. This is safe, because from_idx will always start in [0, len - 1],
      * and len is in [0, UINT_MAX], so from_idx >= len means we've had an underflow, and should stop.
      */
-    for (; from_idx < len && *num_p < 0 && ecma_is_value_empty (ret_value); from_idx--)
+    for (; from_idx < len && num < 0 && ecma_is_value_empty (ret_value); from_idx--)
     {
       /* 8.a */
       ecma_string_t *idx_str_p = ecma_new_ecma_string_from_uint32 (from_idx);
 
       /* 8.a */
-      if (ecma_op_object_get_property (obj_p, idx_str_p) != NULL)
+      if (ecma_op_object_has_property (obj_p, idx_str_p))
       {
         /* 8.b.i */
         ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, idx_str_p), ret_value);
@@ -1951,7 +1919,7 @@ ecma_builtin_array_prototype_object_last_index_of (ecma_value_t this_arg, /**< t
         /* 8.b.ii */
         if (ecma_op_strict_equality_compare (search_element, get_value))
         {
-          *num_p = ((ecma_number_t) from_idx);
+          num = ((ecma_number_t) from_idx);
         }
 
         ECMA_FINALIZE (get_value);
@@ -1962,11 +1930,7 @@ ecma_builtin_array_prototype_object_last_index_of (ecma_value_t this_arg, /**< t
 
     if (ecma_is_value_empty (ret_value))
     {
-      ret_value = ecma_make_number_value (num_p);
-    }
-    else
-    {
-      ecma_dealloc_number (num_p);
+      ret_value = ecma_make_number_value (num);
     }
   }
 
@@ -2020,7 +1984,6 @@ ecma_builtin_array_prototype_object_every (ecma_value_t this_arg, /**< this argu
   else
   {
     ecma_value_t current_index;
-    ecma_number_t *num_p = ecma_alloc_number ();
     ecma_object_t *func_object_p;
 
     /* We already checked that arg1 is callable, so it will always coerce to an object. */
@@ -2036,13 +1999,12 @@ ecma_builtin_array_prototype_object_every (ecma_value_t this_arg, /**< this argu
       ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
 
       /* 7.c */
-      if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
+      if (ecma_op_object_has_property (obj_p, index_str_p))
       {
         /* 7.c.i */
         ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
 
-        *num_p = ((ecma_number_t) index);
-        current_index = ecma_make_number_value (num_p);
+        current_index = ecma_make_uint32_value (index);
 
         ecma_value_t call_args[] = { get_value, current_index, obj_this };
         /* 7.c.ii */
@@ -2055,6 +2017,7 @@ ecma_builtin_array_prototype_object_every (ecma_value_t this_arg, /**< this argu
         }
 
         ECMA_FINALIZE (call_value);
+        ecma_free_value (current_index);
         ECMA_FINALIZE (get_value);
       }
 
@@ -2062,7 +2025,6 @@ ecma_builtin_array_prototype_object_every (ecma_value_t this_arg, /**< this argu
     }
 
     ecma_free_value (to_object_comp);
-    ecma_dealloc_number (num_p);
 
     if (ecma_is_value_empty (ret_value))
     {
@@ -2121,7 +2083,6 @@ ecma_builtin_array_prototype_object_some (ecma_value_t this_arg, /**< this argum
   else
   {
     ecma_value_t current_index;
-    ecma_number_t *num_p = ecma_alloc_number ();
     ecma_object_t *func_object_p;
 
     /* We already checked that arg1 is callable, so it will always coerce to an object. */
@@ -2137,13 +2098,12 @@ ecma_builtin_array_prototype_object_some (ecma_value_t this_arg, /**< this argum
       ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
 
       /* 7.c */
-      if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
+      if (ecma_op_object_has_property (obj_p, index_str_p))
       {
         /* 7.c.i */
         ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
 
-        *num_p = ((ecma_number_t) index);
-        current_index = ecma_make_number_value (num_p);
+        current_index = ecma_make_uint32_value (index);
 
         ecma_value_t call_args[] = { get_value, current_index, obj_this };
         /* 7.c.ii */
@@ -2156,6 +2116,7 @@ ecma_builtin_array_prototype_object_some (ecma_value_t this_arg, /**< this argum
         }
 
         ECMA_FINALIZE (call_value);
+        ecma_free_value (current_index);
         ECMA_FINALIZE (get_value);
       }
 
@@ -2163,7 +2124,6 @@ ecma_builtin_array_prototype_object_some (ecma_value_t this_arg, /**< this argum
     }
 
     ecma_free_value (to_object_comp);
-    ecma_dealloc_number (num_p);
 
     if (ecma_is_value_empty (ret_value))
     {
@@ -2221,7 +2181,6 @@ ecma_builtin_array_prototype_object_for_each (ecma_value_t this_arg, /**< this a
   else
   {
     ecma_value_t current_index;
-    ecma_number_t *num_p = ecma_alloc_number ();
     ecma_object_t *func_object_p;
 
     /* We already checked that arg1 is callable, so it will always coerce to an object. */
@@ -2237,19 +2196,19 @@ ecma_builtin_array_prototype_object_for_each (ecma_value_t this_arg, /**< this a
       ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
 
       /* 7.b */
-      if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
+      if (ecma_op_object_has_property (obj_p, index_str_p))
       {
         /* 7.c.i */
         ECMA_TRY_CATCH (current_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
 
-        *num_p = ((ecma_number_t) index);
-        current_index = ecma_make_number_value (num_p);
+        current_index = ecma_make_uint32_value (index);
 
         /* 7.c.ii */
         ecma_value_t call_args[] = {current_value, current_index, obj_this};
         ECMA_TRY_CATCH (call_value, ecma_op_function_call (func_object_p, arg2, call_args, 3), ret_value);
 
         ECMA_FINALIZE (call_value);
+        ecma_free_value (current_index);
         ECMA_FINALIZE (current_value);
       }
 
@@ -2263,7 +2222,6 @@ ecma_builtin_array_prototype_object_for_each (ecma_value_t this_arg, /**< this a
     }
 
     ecma_free_value (to_object_comp);
-    ecma_dealloc_number (num_p);
   }
 
   ECMA_OP_TO_NUMBER_FINALIZE (len_number);
@@ -2315,7 +2273,6 @@ ecma_builtin_array_prototype_object_map (ecma_value_t this_arg, /**< this argume
   }
   else
   {
-    ecma_number_t *num_p = ecma_alloc_number ();
     ecma_object_t *func_object_p;
     JERRY_ASSERT (ecma_is_value_object (arg1));
     func_object_p = ecma_get_object_from_value (arg1);
@@ -2335,13 +2292,12 @@ ecma_builtin_array_prototype_object_map (ecma_value_t this_arg, /**< this argume
       /* 8.a */
       ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
       /* 8.b */
-      if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
+      if (ecma_op_object_has_property (obj_p, index_str_p))
       {
         /* 8.c.i */
         ECMA_TRY_CATCH (current_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
         /* 8.c.ii */
-        *num_p = ((ecma_number_t) index);
-        current_index = ecma_make_number_value (num_p);
+        current_index = ecma_make_uint32_value (index);
         ecma_value_t call_args[] = {current_value, current_index, obj_this};
 
         ECMA_TRY_CATCH (mapped_value, ecma_op_function_call (func_object_p, arg2, call_args, 3), ret_value);
@@ -2358,6 +2314,7 @@ ecma_builtin_array_prototype_object_map (ecma_value_t this_arg, /**< this argume
         JERRY_ASSERT (ecma_is_value_true (put_comp));
 
         ECMA_FINALIZE (mapped_value);
+        ecma_free_value (current_index);
         ECMA_FINALIZE (current_value);
       }
 
@@ -2377,7 +2334,6 @@ ecma_builtin_array_prototype_object_map (ecma_value_t this_arg, /**< this argume
       ecma_free_value (new_array);
     }
 
-    ecma_dealloc_number (num_p);
   }
 
   ECMA_OP_TO_NUMBER_FINALIZE (len_number);
@@ -2430,7 +2386,6 @@ ecma_builtin_array_prototype_object_filter (ecma_value_t this_arg, /**< this arg
   else
   {
     ecma_value_t current_index;
-    ecma_number_t *num_p = ecma_alloc_number ();
     ecma_object_t *func_object_p;
 
     /* 6. */
@@ -2452,13 +2407,12 @@ ecma_builtin_array_prototype_object_filter (ecma_value_t this_arg, /**< this arg
       ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
 
       /* 9.c */
-      if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
+      if (ecma_op_object_has_property (obj_p, index_str_p))
       {
         /* 9.c.i */
         ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
 
-        *num_p = ((ecma_number_t) index);
-        current_index = ecma_make_number_value (num_p);
+        current_index = ecma_make_uint32_value (index);
 
         ecma_value_t call_args[] = { get_value, current_index, obj_this };
         /* 9.c.ii */
@@ -2484,13 +2438,13 @@ ecma_builtin_array_prototype_object_filter (ecma_value_t this_arg, /**< this arg
         }
 
         ECMA_FINALIZE (call_value);
+        ecma_free_value (current_index);
         ECMA_FINALIZE (get_value);
       }
 
       ecma_deref_ecma_string (index_str_p);
     }
 
-    ecma_dealloc_number (num_p);
 
     if (ecma_is_value_empty (ret_value))
     {
@@ -2554,7 +2508,6 @@ ecma_builtin_array_prototype_object_reduce (ecma_value_t this_arg, /**< this arg
   }
   else
   {
-    ecma_number_t *num_p = ecma_alloc_number ();
     ecma_object_t *func_object_p;
 
     JERRY_ASSERT (ecma_is_value_object (callbackfn));
@@ -2587,7 +2540,7 @@ ecma_builtin_array_prototype_object_reduce (ecma_value_t this_arg, /**< this arg
           ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
 
           /* 8.b.ii-iii */
-          if ((k_present = (ecma_op_object_get_property (obj_p, index_str_p) != NULL)))
+          if ((k_present = ecma_op_object_has_property (obj_p, index_str_p)))
           {
             ECMA_TRY_CATCH (current_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
             accumulator = ecma_copy_value (current_value);
@@ -2612,13 +2565,12 @@ ecma_builtin_array_prototype_object_reduce (ecma_value_t this_arg, /**< this arg
         /* 9.a */
         ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
         /* 9.b */
-        if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
+        if (ecma_op_object_has_property (obj_p, index_str_p))
         {
           /* 9.c.i */
           ECMA_TRY_CATCH (current_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
           /* 9.c.ii */
-          *num_p = ((ecma_number_t) index);
-          current_index = ecma_make_number_value (num_p);
+          current_index = ecma_make_uint32_value (index);
           ecma_value_t call_args[] = {accumulator, current_value, current_index, obj_this};
 
           ECMA_TRY_CATCH (call_value,
@@ -2632,6 +2584,7 @@ ecma_builtin_array_prototype_object_reduce (ecma_value_t this_arg, /**< this arg
           accumulator = ecma_copy_value (call_value);
 
           ECMA_FINALIZE (call_value);
+          ecma_free_value (current_index);
           ECMA_FINALIZE (current_value);
         }
         ecma_deref_ecma_string (index_str_p);
@@ -2645,7 +2598,6 @@ ecma_builtin_array_prototype_object_reduce (ecma_value_t this_arg, /**< this arg
     }
 
     ecma_free_value (accumulator);
-    ecma_dealloc_number (num_p);
   }
 
   ECMA_OP_TO_NUMBER_FINALIZE (len_number);
@@ -2711,7 +2663,6 @@ ecma_builtin_array_prototype_object_reduce_right (ecma_value_t this_arg, /**< th
     }
     else
     {
-      ecma_number_t *num_p = ecma_alloc_number ();
       ecma_value_t accumulator = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
 
       /* 6. */
@@ -2733,7 +2684,7 @@ ecma_builtin_array_prototype_object_reduce_right (ecma_value_t this_arg, /**< th
           ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 ((uint32_t) index);
 
           /* 8.b.ii-iii */
-          if ((k_present = (ecma_op_object_get_property (obj_p, index_str_p) != NULL)))
+          if ((k_present = ecma_op_object_has_property (obj_p, index_str_p)))
           {
             ECMA_TRY_CATCH (current_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
             accumulator = ecma_copy_value (current_value);
@@ -2758,13 +2709,12 @@ ecma_builtin_array_prototype_object_reduce_right (ecma_value_t this_arg, /**< th
         /* 9.a */
         ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 ((uint32_t) index);
         /* 9.b */
-        if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
+        if (ecma_op_object_has_property (obj_p, index_str_p))
         {
           /* 9.c.i */
           ECMA_TRY_CATCH (current_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
           /* 9.c.ii */
-          *num_p = ((ecma_number_t) (uint32_t) index);
-          current_index = ecma_make_number_value (num_p);
+          current_index = ecma_make_uint32_value ((uint32_t) index);
           ecma_value_t call_args[] = {accumulator, current_value, current_index, obj_this};
 
           ECMA_TRY_CATCH (call_value,
@@ -2778,6 +2728,7 @@ ecma_builtin_array_prototype_object_reduce_right (ecma_value_t this_arg, /**< th
           accumulator = ecma_copy_value (call_value);
 
           ECMA_FINALIZE (call_value);
+          ecma_free_value (current_index);
           ECMA_FINALIZE (current_value);
         }
         ecma_deref_ecma_string (index_str_p);
@@ -2790,7 +2741,6 @@ ecma_builtin_array_prototype_object_reduce_right (ecma_value_t this_arg, /**< th
       }
 
       ecma_free_value (accumulator);
-      ecma_dealloc_number (num_p);
     }
   }
 
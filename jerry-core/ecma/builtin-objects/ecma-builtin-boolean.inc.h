@@ -63,3 +63,4 @@ NUMBER_VALUE (LIT_MAGIC_STRING_LENGTH,
 #undef OBJECT_VALUE
 #undef CP_UNIMPLEMENTED_VALUE
 #undef ROUTINE
+#undef ACCESSOR_READ_ONLY
@@ -0,0 +1,574 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-arraybuffer-object.h"
+#include "ecma-builtins.h"
+#include "ecma-conversion.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jrt.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-dataview-prototype.inc.h"
+#define BUILTIN_UNDERSCORED_ID dataview_prototype
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup dataviewprototype ECMA DataView.prototype object built-in
+ * @{
+ */
+
+/**
+ * Get description of the DataView object, passed as 'this' argument
+ *
+ * @return pointer to the description - if the value is a DataView object,
+ *         NULL - otherwise
+ */
+static ecma_arraybuffer_view_t *
+ecma_builtin_dataview_prototype_get_this_view (ecma_value_t this_arg) /**< this argument */
+{
+  if (!ecma_is_value_object (this_arg))
+  {
+    return NULL;
+  }
+
+  ecma_arraybuffer_view_t *view_p = ecma_op_arraybuffer_view_get (ecma_get_object_from_value (this_arg));
+
+  if (view_p == NULL || view_p->type != ECMA_ARRAYBUFFER_VIEW_DATAVIEW)
+  {
+    return NULL;
+  }
+
+  return view_p;
+} /* ecma_builtin_dataview_prototype_get_this_view */
+
+/**
+ * The DataView.prototype object's 'buffer' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_buffer_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_builtin_dataview_prototype_get_this_view (this_arg);
+
+  if (view_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Argument 'this' is not a DataView object."));
+  }
+
+  ecma_object_t *arraybuffer_obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, view_p->arraybuffer_cp);
+  ecma_ref_object (arraybuffer_obj_p);
+
+  return ecma_make_object_value (arraybuffer_obj_p);
+} /* ecma_builtin_dataview_prototype_buffer_getter */
+
+/**
+ * The DataView.prototype object's 'byteLength' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.2
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_byte_length_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_builtin_dataview_prototype_get_this_view (this_arg);
+
+  if (view_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Argument 'this' is not a DataView object."));
+  }
+
+  return ecma_make_number_value ((ecma_number_t) view_p->length);
+} /* ecma_builtin_dataview_prototype_byte_length_getter */
+
+/**
+ * The DataView.prototype object's 'byteOffset' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.3
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_byte_offset_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_builtin_dataview_prototype_get_this_view (this_arg);
+
+  if (view_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Argument 'this' is not a DataView object."));
+  }
+
+  return ecma_make_number_value ((ecma_number_t) view_p->byte_offset);
+} /* ecma_builtin_dataview_prototype_byte_offset_getter */
+
+/**
+ * Check whether the host stores multi-byte values in little endian order
+ *
+ * @return true - if the host is little endian,
+ *         false - otherwise.
+ */
+static bool
+ecma_builtin_dataview_prototype_is_host_little_endian (void)
+{
+  const uint16_t probe = 1;
+
+  return *(const uint8_t *) &probe == 1;
+} /* ecma_builtin_dataview_prototype_is_host_little_endian */
+
+/**
+ * Copy bytes of an element between the buffer and the host order representation
+ */
+static void
+ecma_builtin_dataview_prototype_copy_element (uint8_t *dst_p, /**< destination */
+                                              const uint8_t *src_p, /**< source */
+                                              uint32_t element_size, /**< size of the element */
+                                              bool is_little_endian) /**< byte order of the element in the buffer */
+{
+  if (is_little_endian == ecma_builtin_dataview_prototype_is_host_little_endian ())
+  {
+    memcpy (dst_p, src_p, element_size);
+    return;
+  }
+
+  for (uint32_t i = 0; i < element_size; i++)
+  {
+    dst_p[i] = src_p[element_size - 1 - i];
+  }
+} /* ecma_builtin_dataview_prototype_copy_element */
+
+/**
+ * Get an element of the specified type from the DataView
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.1.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_get_view_value (ecma_value_t this_arg, /**< this argument */
+                                                ecma_value_t request_index, /**< byte offset of the element */
+                                                ecma_value_t little_endian, /**< byte order of the element */
+                                                ecma_arraybuffer_view_type_t type) /**< type of the element */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_builtin_dataview_prototype_get_this_view (this_arg);
+
+  if (view_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Argument 'this' is not a DataView object."));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t index = 0;
+
+  ECMA_TRY_CATCH (index_empty_value,
+                  ecma_op_to_byte_length (request_index, &index),
+                  ret_value);
+
+  uint32_t element_size = ecma_op_typedarray_element_size (type);
+
+  if (index > view_p->length || element_size > view_p->length - index)
+  {
+    ret_value = ecma_raise_range_error (ECMA_ERR_MSG ("Offset is outside the bounds of the DataView."));
+  }
+  else
+  {
+    ecma_arraybuffer_t *arraybuffer_p = ecma_op_arraybuffer_view_get_arraybuffer (view_p);
+    uint8_t element[sizeof (double)];
+
+    ecma_builtin_dataview_prototype_copy_element (element,
+                                                  arraybuffer_p->buffer_p + view_p->byte_offset + index,
+                                                  element_size,
+                                                  ecma_is_value_true (ecma_op_to_boolean (little_endian)));
+
+    ret_value = ecma_make_number_value (ecma_op_typedarray_read (type, element));
+  }
+
+  ECMA_FINALIZE (index_empty_value);
+
+  return ret_value;
+} /* ecma_builtin_dataview_prototype_get_view_value */
+
+/**
+ * Store an element of the specified type to the DataView
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.1.2
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_set_view_value (ecma_value_t this_arg, /**< this argument */
+                                                ecma_value_t request_index, /**< byte offset of the element */
+                                                ecma_value_t little_endian, /**< byte order of the element */
+                                                ecma_arraybuffer_view_type_t type, /**< type of the element */
+                                                ecma_value_t value) /**< value to store */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_builtin_dataview_prototype_get_this_view (this_arg);
+
+  if (view_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Argument 'this' is not a DataView object."));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t index = 0;
+
+  ECMA_TRY_CATCH (index_empty_value,
+                  ecma_op_to_byte_length (request_index, &index),
+                  ret_value);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (num, value, ret_value);
+
+  uint32_t element_size = ecma_op_typedarray_element_size (type);
+
+  if (index > view_p->length || element_size > view_p->length - index)
+  {
+    ret_value = ecma_raise_range_error (ECMA_ERR_MSG ("Offset is outside the bounds of the DataView."));
+  }
+  else
+  {
+    ecma_arraybuffer_t *arraybuffer_p = ecma_op_arraybuffer_view_get_arraybuffer (view_p);
+    uint8_t element[sizeof (double)];
+
+    ecma_op_typedarray_write (type, element, num);
+
+    ecma_builtin_dataview_prototype_copy_element (arraybuffer_p->buffer_p + view_p->byte_offset + index,
+                                                  element,
+                                                  element_size,
+                                                  ecma_is_value_true (ecma_op_to_boolean (little_endian)));
+
+    ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (num);
+  ECMA_FINALIZE (index_empty_value);
+
+  return ret_value;
+} /* ecma_builtin_dataview_prototype_set_view_value */
+
+/**
+ * The DataView.prototype object's 'getInt8' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.7
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_int8 (ecma_value_t this_arg, /**< this argument */
+                                                ecma_value_t arg1, /**< byte offset */
+                                                ecma_value_t arg2) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_ARRAYBUFFER_VIEW_INT8);
+} /* ecma_builtin_dataview_prototype_object_get_int8 */
+
+/**
+ * The DataView.prototype object's 'getUint8' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.10
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_uint8 (ecma_value_t this_arg, /**< this argument */
+                                                 ecma_value_t arg1, /**< byte offset */
+                                                 ecma_value_t arg2) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_ARRAYBUFFER_VIEW_UINT8);
+} /* ecma_builtin_dataview_prototype_object_get_uint8 */
+
+/**
+ * The DataView.prototype object's 'getInt16' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.8
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_int16 (ecma_value_t this_arg, /**< this argument */
+                                                 ecma_value_t arg1, /**< byte offset */
+                                                 ecma_value_t arg2) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_ARRAYBUFFER_VIEW_INT16);
+} /* ecma_builtin_dataview_prototype_object_get_int16 */
+
+/**
+ * The DataView.prototype object's 'getUint16' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.11
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_uint16 (ecma_value_t this_arg, /**< this argument */
+                                                  ecma_value_t arg1, /**< byte offset */
+                                                  ecma_value_t arg2) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_ARRAYBUFFER_VIEW_UINT16);
+} /* ecma_builtin_dataview_prototype_object_get_uint16 */
+
+/**
+ * The DataView.prototype object's 'getInt32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.9
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_int32 (ecma_value_t this_arg, /**< this argument */
+                                                 ecma_value_t arg1, /**< byte offset */
+                                                 ecma_value_t arg2) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_ARRAYBUFFER_VIEW_INT32);
+} /* ecma_builtin_dataview_prototype_object_get_int32 */
+
+/**
+ * The DataView.prototype object's 'getUint32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.12
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_uint32 (ecma_value_t this_arg, /**< this argument */
+                                                  ecma_value_t arg1, /**< byte offset */
+                                                  ecma_value_t arg2) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_ARRAYBUFFER_VIEW_UINT32);
+} /* ecma_builtin_dataview_prototype_object_get_uint32 */
+
+/**
+ * The DataView.prototype object's 'getFloat32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.5
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_float32 (ecma_value_t this_arg, /**< this argument */
+                                                   ecma_value_t arg1, /**< byte offset */
+                                                   ecma_value_t arg2) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_ARRAYBUFFER_VIEW_FLOAT32);
+} /* ecma_builtin_dataview_prototype_object_get_float32 */
+
+/**
+ * The DataView.prototype object's 'getFloat64' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.6
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_float64 (ecma_value_t this_arg, /**< this argument */
+                                                   ecma_value_t arg1, /**< byte offset */
+                                                   ecma_value_t arg2) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_ARRAYBUFFER_VIEW_FLOAT64);
+} /* ecma_builtin_dataview_prototype_object_get_float64 */
+
+/**
+ * The DataView.prototype object's 'setInt8' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.15
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_int8 (ecma_value_t this_arg, /**< this argument */
+                                                ecma_value_t arg1, /**< byte offset */
+                                                ecma_value_t arg2, /**< value */
+                                                ecma_value_t arg3) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg3, ECMA_ARRAYBUFFER_VIEW_INT8, arg2);
+} /* ecma_builtin_dataview_prototype_object_set_int8 */
+
+/**
+ * The DataView.prototype object's 'setUint8' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.18
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_uint8 (ecma_value_t this_arg, /**< this argument */
+                                                 ecma_value_t arg1, /**< byte offset */
+                                                 ecma_value_t arg2, /**< value */
+                                                 ecma_value_t arg3) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg3, ECMA_ARRAYBUFFER_VIEW_UINT8, arg2);
+} /* ecma_builtin_dataview_prototype_object_set_uint8 */
+
+/**
+ * The DataView.prototype object's 'setInt16' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.16
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_int16 (ecma_value_t this_arg, /**< this argument */
+                                                 ecma_value_t arg1, /**< byte offset */
+                                                 ecma_value_t arg2, /**< value */
+                                                 ecma_value_t arg3) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg3, ECMA_ARRAYBUFFER_VIEW_INT16, arg2);
+} /* ecma_builtin_dataview_prototype_object_set_int16 */
+
+/**
+ * The DataView.prototype object's 'setUint16' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.19
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_uint16 (ecma_value_t this_arg, /**< this argument */
+                                                  ecma_value_t arg1, /**< byte offset */
+                                                  ecma_value_t arg2, /**< value */
+                                                  ecma_value_t arg3) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg3, ECMA_ARRAYBUFFER_VIEW_UINT16, arg2);
+} /* ecma_builtin_dataview_prototype_object_set_uint16 */
+
+/**
+ * The DataView.prototype object's 'setInt32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.17
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_int32 (ecma_value_t this_arg, /**< this argument */
+                                                 ecma_value_t arg1, /**< byte offset */
+                                                 ecma_value_t arg2, /**< value */
+                                                 ecma_value_t arg3) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg3, ECMA_ARRAYBUFFER_VIEW_INT32, arg2);
+} /* ecma_builtin_dataview_prototype_object_set_int32 */
+
+/**
+ * The DataView.prototype object's 'setUint32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.20
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_uint32 (ecma_value_t this_arg, /**< this argument */
+                                                  ecma_value_t arg1, /**< byte offset */
+                                                  ecma_value_t arg2, /**< value */
+                                                  ecma_value_t arg3) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg3, ECMA_ARRAYBUFFER_VIEW_UINT32, arg2);
+} /* ecma_builtin_dataview_prototype_object_set_uint32 */
+
+/**
+ * The DataView.prototype object's 'setFloat32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.13
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_float32 (ecma_value_t this_arg, /**< this argument */
+                                                   ecma_value_t arg1, /**< byte offset */
+                                                   ecma_value_t arg2, /**< value */
+                                                   ecma_value_t arg3) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg3, ECMA_ARRAYBUFFER_VIEW_FLOAT32, arg2);
+} /* ecma_builtin_dataview_prototype_object_set_float32 */
+
+/**
+ * The DataView.prototype object's 'setFloat64' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.14
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_float64 (ecma_value_t this_arg, /**< this argument */
+                                                   ecma_value_t arg1, /**< byte offset */
+                                                   ecma_value_t arg2, /**< value */
+                                                   ecma_value_t arg3) /**< little endian flag */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg3, ECMA_ARRAYBUFFER_VIEW_FLOAT64, arg2);
+} /* ecma_builtin_dataview_prototype_object_set_float64 */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
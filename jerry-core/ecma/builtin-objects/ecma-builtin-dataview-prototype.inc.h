@@ -0,0 +1,96 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * DataView.prototype built-in description
+ */
+
+#ifndef OBJECT_ID
+# define OBJECT_ID(builtin_object_id)
+#endif /* !OBJECT_ID */
+
+#ifndef OBJECT_VALUE
+# define OBJECT_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable)
+#endif /* !OBJECT_VALUE */
+
+#ifndef ROUTINE
+# define ROUTINE(name, c_function_name, args_number, length_prop_value)
+#endif /* !ROUTINE */
+
+#ifndef ACCESSOR_READ_ONLY
+# define ACCESSOR_READ_ONLY(name, c_getter_func_name, prop_enumerable, prop_configurable)
+#endif /* !ACCESSOR_READ_ONLY */
+
+/* Object identifier */
+OBJECT_ID (ECMA_BUILTIN_ID_DATAVIEW_PROTOTYPE)
+
+/* Object properties:
+ *  (property name, object pointer getter) */
+
+// ECMA-262 v6, 24.2.4.4
+OBJECT_VALUE (LIT_MAGIC_STRING_CONSTRUCTOR,
+              ecma_builtin_get (ECMA_BUILTIN_ID_DATAVIEW),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+/* Accessor properties:
+ *  (property name, C getter routine name, enumerable, configurable) */
+
+// ECMA-262 v6, 24.2.4.1
+ACCESSOR_READ_ONLY (LIT_MAGIC_STRING_BUFFER,
+                    ecma_builtin_dataview_prototype_buffer_getter,
+                    ECMA_PROPERTY_NOT_ENUMERABLE,
+                    ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 24.2.4.2
+ACCESSOR_READ_ONLY (LIT_MAGIC_STRING_BYTE_LENGTH_UL,
+                    ecma_builtin_dataview_prototype_byte_length_getter,
+                    ECMA_PROPERTY_NOT_ENUMERABLE,
+                    ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 24.2.4.3
+ACCESSOR_READ_ONLY (LIT_MAGIC_STRING_BYTE_OFFSET_UL,
+                    ecma_builtin_dataview_prototype_byte_offset_getter,
+                    ECMA_PROPERTY_NOT_ENUMERABLE,
+                    ECMA_PROPERTY_CONFIGURABLE)
+
+/* Routine properties:
+ *  (property name, C routine name, arguments number or NON_FIXED, value of the routine's length property) */
+ROUTINE (LIT_MAGIC_STRING_GET_INT8_UL,    ecma_builtin_dataview_prototype_object_get_int8,    2, 1)
+ROUTINE (LIT_MAGIC_STRING_GET_UINT8_UL,   ecma_builtin_dataview_prototype_object_get_uint8,   2, 1)
+ROUTINE (LIT_MAGIC_STRING_GET_INT16_UL,   ecma_builtin_dataview_prototype_object_get_int16,   2, 1)
+ROUTINE (LIT_MAGIC_STRING_GET_UINT16_UL,  ecma_builtin_dataview_prototype_object_get_uint16,  2, 1)
+ROUTINE (LIT_MAGIC_STRING_GET_INT32_UL,   ecma_builtin_dataview_prototype_object_get_int32,   2, 1)
+ROUTINE (LIT_MAGIC_STRING_GET_UINT32_UL,  ecma_builtin_dataview_prototype_object_get_uint32,  2, 1)
+ROUTINE (LIT_MAGIC_STRING_GET_FLOAT32_UL, ecma_builtin_dataview_prototype_object_get_float32, 2, 1)
+ROUTINE (LIT_MAGIC_STRING_GET_FLOAT64_UL, ecma_builtin_dataview_prototype_object_get_float64, 2, 1)
+ROUTINE (LIT_MAGIC_STRING_SET_INT8_UL,    ecma_builtin_dataview_prototype_object_set_int8,    3, 2)
+ROUTINE (LIT_MAGIC_STRING_SET_UINT8_UL,   ecma_builtin_dataview_prototype_object_set_uint8,   3, 2)
+ROUTINE (LIT_MAGIC_STRING_SET_INT16_UL,   ecma_builtin_dataview_prototype_object_set_int16,   3, 2)
+ROUTINE (LIT_MAGIC_STRING_SET_UINT16_UL,  ecma_builtin_dataview_prototype_object_set_uint16,  3, 2)
+ROUTINE (LIT_MAGIC_STRING_SET_INT32_UL,   ecma_builtin_dataview_prototype_object_set_int32,   3, 2)
+ROUTINE (LIT_MAGIC_STRING_SET_UINT32_UL,  ecma_builtin_dataview_prototype_object_set_uint32,  3, 2)
+ROUTINE (LIT_MAGIC_STRING_SET_FLOAT32_UL, ecma_builtin_dataview_prototype_object_set_float32, 3, 2)
+ROUTINE (LIT_MAGIC_STRING_SET_FLOAT64_UL, ecma_builtin_dataview_prototype_object_set_float64, 3, 2)
+
+#undef OBJECT_ID
+#undef SIMPLE_VALUE
+#undef NUMBER_VALUE
+#undef STRING_VALUE
+#undef OBJECT_VALUE
+#undef CP_UNIMPLEMENTED_VALUE
+#undef ROUTINE
+#undef ACCESSOR_READ_ONLY
@@ -0,0 +1,140 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-arraybuffer-object.h"
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jrt.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-dataview.inc.h"
+#define BUILTIN_UNDERSCORED_ID dataview
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup dataview ECMA DataView object built-in
+ * @{
+ */
+
+/**
+ * Handle calling [[Call]] of built-in DataView object
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_builtin_dataview_dispatch_call (const ecma_value_t *arguments_list_p, /**< arguments list */
+                                     ecma_length_t arguments_list_len) /**< number of arguments */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  return ecma_raise_type_error (ECMA_ERR_MSG ("Constructor DataView requires 'new'."));
+} /* ecma_builtin_dataview_dispatch_call */
+
+/**
+ * Handle calling [[Construct]] of built-in DataView object
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.2.1
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_builtin_dataview_dispatch_construct (const ecma_value_t *arguments_list_p, /**< arguments list */
+                                          ecma_length_t arguments_list_len) /**< number of arguments */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  ecma_arraybuffer_t *arraybuffer_p = NULL;
+
+  if (arguments_list_len > 0 && ecma_is_value_object (arguments_list_p[0]))
+  {
+    arraybuffer_p = ecma_op_arraybuffer_get (ecma_get_object_from_value (arguments_list_p[0]));
+  }
+
+  if (arraybuffer_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Argument of DataView is not an ArrayBuffer object."));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  ecma_value_t undefined_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  ecma_value_t byte_offset_value = (arguments_list_len > 1) ? arguments_list_p[1] : undefined_value;
+  ecma_value_t byte_length_value = (arguments_list_len > 2) ? arguments_list_p[2] : undefined_value;
+  uint32_t byte_offset = 0;
+  uint32_t byte_length = 0;
+
+  ECMA_TRY_CATCH (byte_offset_empty_value,
+                  ecma_op_to_byte_length (byte_offset_value, &byte_offset),
+                  ret_value);
+
+  if (byte_offset > arraybuffer_p->length)
+  {
+    ret_value = ecma_raise_range_error (ECMA_ERR_MSG ("Invalid DataView offset."));
+  }
+  else if (ecma_is_value_undefined (byte_length_value))
+  {
+    byte_length = arraybuffer_p->length - byte_offset;
+  }
+  else
+  {
+    ECMA_TRY_CATCH (byte_length_empty_value,
+                    ecma_op_to_byte_length (byte_length_value, &byte_length),
+                    ret_value);
+
+    if (byte_length > arraybuffer_p->length - byte_offset)
+    {
+      ret_value = ecma_raise_range_error (ECMA_ERR_MSG ("Invalid DataView length."));
+    }
+
+    ECMA_FINALIZE (byte_length_empty_value);
+  }
+
+  if (ecma_is_value_empty (ret_value))
+  {
+    ecma_object_t *view_obj_p = ecma_op_create_arraybuffer_view (ecma_get_object_from_value (arguments_list_p[0]),
+                                                                 ECMA_ARRAYBUFFER_VIEW_DATAVIEW,
+                                                                 byte_offset,
+                                                                 byte_length);
+    ret_value = ecma_make_object_value (view_obj_p);
+  }
+
+  ECMA_FINALIZE (byte_offset_empty_value);
+
+  return ret_value;
+} /* ecma_builtin_dataview_dispatch_construct */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
@@ -273,13 +273,15 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
       ECMA_SET_NON_NULL_POINTER (bound_args_prop_p->v.internal_property.value, bound_args_collection_p);
     }
 
+    ecma_gc_write_barrier (function_p);
+
     /*
      * [[Class]] property is not stored explicitly for objects of ECMA_OBJECT_TYPE_FUNCTION type.
      *
      * See also: ecma_object_get_class_name
      */
 
-    ecma_number_t *length_p = ecma_alloc_number ();
+    ecma_number_t length = ECMA_NUMBER_ZERO;
     ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
 
     /* 15. */
@@ -292,25 +294,22 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
       const ecma_length_t bound_arg_count = arg_count > 1 ? arg_count - 1 : 0;
 
       /* 15.a */
-      *length_p = *ecma_get_number_from_value (get_len_value) - ((ecma_number_t) bound_arg_count);
+      length = ecma_get_number_from_value (get_len_value) - ((ecma_number_t) bound_arg_count);
       ecma_free_value (get_len_value);
 
       /* 15.b */
-      if (ecma_number_is_negative (*length_p))
+      if (ecma_number_is_negative (length))
       {
-        *length_p = ECMA_NUMBER_ZERO;
+        length = ECMA_NUMBER_ZERO;
       }
     }
-    else
-    {
-      /* 16. */
-      *length_p = ECMA_NUMBER_ZERO;
-    }
+    /* 16. length remains zero otherwise */
 
     /* 17. */
+    ecma_value_t length_value = ecma_make_number_value (length);
     ecma_value_t completion = ecma_builtin_helper_def_prop (function_p,
                                                             magic_string_length_p,
-                                                            ecma_make_number_value (length_p),
+                                                            length_value,
                                                             false, /* Writable */
                                                             false, /* Enumerable */
                                                             false, /* Configurable */
@@ -319,7 +318,7 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
     JERRY_ASSERT (ecma_is_value_boolean (completion));
 
     ecma_deref_ecma_string (magic_string_length_p);
-    ecma_dealloc_number (length_p);
+    ecma_free_value (length_value);
 
     /* 19-21. */
     ecma_object_t *thrower_p = ecma_builtin_get (ECMA_BUILTIN_ID_TYPE_ERROR_THROWER);
@@ -142,6 +142,85 @@ OBJECT_VALUE (LIT_MAGIC_STRING_REGEXP_UL,
               ECMA_PROPERTY_CONFIGURABLE)
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
 
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+// ECMA-262 v6, 24.1.2
+OBJECT_VALUE (LIT_MAGIC_STRING_ARRAY_BUFFER_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_ARRAYBUFFER),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 24.2.2
+OBJECT_VALUE (LIT_MAGIC_STRING_DATA_VIEW_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_DATAVIEW),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_INT8_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_INT8ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_UINT8_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_UINT8ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_UINT8_CLAMPED_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_UINT8CLAMPEDARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_INT16_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_INT16ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_UINT16_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_UINT16ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_INT32_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_INT32ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_UINT32_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_UINT32ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_FLOAT32_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_FLOAT32ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_FLOAT64_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_FLOAT64ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ERROR_BUILTINS
 // ECMA-262 v5, 15.1.4.9
 OBJECT_VALUE (LIT_MAGIC_STRING_ERROR_UL,
@@ -247,3 +326,4 @@ ROUTINE (LIT_MAGIC_STRING_UNESCAPE, ecma_builtin_global_object_unescape, 1, 1)
 #undef OBJECT_VALUE
 #undef CP_UNIMPLEMENTED_VALUE
 #undef ROUTINE
+#undef ACCESSOR_READ_ONLY
@@ -907,13 +907,12 @@ ecma_date_set_internal_property (ecma_value_t this_arg, /**< this argument */
 {
   JERRY_ASSERT (ecma_is_value_object (this_arg));
 
-  ecma_number_t *value_p = ecma_alloc_number ();
   ecma_number_t date = ecma_date_make_date (day, time);
   if (is_utc != ECMA_DATE_UTC)
   {
     date = ecma_date_utc (date);
   }
-  *value_p = ecma_date_time_clip (date);
+  ecma_number_t value = ecma_date_time_clip (date);
 
   ecma_object_t *obj_p = ecma_get_object_from_value (this_arg);
 
@@ -922,9 +921,9 @@ ecma_date_set_internal_property (ecma_value_t this_arg, /**< this argument */
 
   ecma_number_t *prim_value_num_p = ECMA_GET_NON_NULL_POINTER (ecma_number_t,
                                                                prim_value_prop_p->v.internal_property.value);
-  *prim_value_num_p = *value_p;
+  *prim_value_num_p = value;
 
-  return ecma_make_number_value (value_p);
+  return ecma_make_number_value (value);
 } /* ecma_date_set_internal_property */
 
 /**
@@ -1346,10 +1345,9 @@ ecma_date_get_primitive_value (ecma_value_t this_arg) /**< this argument */
                                                                      ECMA_INTERNAL_PROPERTY_PRIMITIVE_NUMBER_VALUE);
     JERRY_ASSERT (prim_value_prop_p != NULL);
 
-    ecma_number_t *prim_value_num_p = ecma_alloc_number ();
-    *prim_value_num_p = *ECMA_GET_NON_NULL_POINTER (ecma_number_t,
-                                                    prim_value_prop_p->v.internal_property.value);
-    ret_value = ecma_make_number_value (prim_value_num_p);
+    ecma_number_t *prim_value_num_p = ECMA_GET_NON_NULL_POINTER (ecma_number_t,
+                                                                 prim_value_prop_p->v.internal_property.value);
+    ret_value = ecma_make_number_value (*prim_value_num_p);
   }
 
   return ret_value;
@@ -93,167 +93,6 @@ ecma_has_string_value_in_collection (ecma_collection_header_t *collection_p, /**
   return false;
 } /* ecma_has_string_value_in_collection*/
 
-/**
- * Common function to concatenate key-value pairs into an ecma-string.
- *
- * See also:
- *          ECMA-262 v5, 15.12.3
- *
- * Used by:
- *         - ecma_builtin_helper_json_create_formatted_json step 10.b.ii
- *         - ecma_builtin_helper_json_create_non_formatted_json step 10.a.i
- *
- * @return pointer to ecma-string
- *         Returned value must be freed with ecma_deref_ecma_string.
- */
-ecma_string_t *
-ecma_builtin_helper_json_create_separated_properties (ecma_collection_header_t *partial_p, /**< key-value pairs*/
-                                                      ecma_string_t *separator_p) /**< separator*/
-{
-  ecma_string_t *properties_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
-  ecma_string_t *tmp_str_p;
-
-  ecma_collection_iterator_t iterator;
-  ecma_collection_iterator_init (&iterator, partial_p);
-
-  uint32_t index = 0;
-
-  while (ecma_collection_iterator_next (&iterator))
-  {
-    ecma_value_t name_value = *iterator.current_value_p;
-    ecma_string_t *current_p = ecma_get_string_from_value (name_value);
-
-    if (index == 0)
-    {
-      index++;
-
-      tmp_str_p = ecma_concat_ecma_strings (properties_str_p, current_p);
-      ecma_deref_ecma_string (properties_str_p);
-      properties_str_p = tmp_str_p;
-      continue;
-    }
-
-    tmp_str_p = ecma_concat_ecma_strings (properties_str_p, separator_p);
-    ecma_deref_ecma_string (properties_str_p);
-    properties_str_p = tmp_str_p;
-
-    tmp_str_p = ecma_concat_ecma_strings (properties_str_p, current_p);
-    ecma_deref_ecma_string (properties_str_p);
-    properties_str_p = tmp_str_p;
-  }
-
-  return properties_str_p;
-} /* ecma_builtin_helper_json_create_separated_properties */
-
-/**
- * Common function to create a formatted JSON string.
- *
- * See also:
- *          ECMA-262 v5, 15.12.3
- *
- * Used by:
- *         - ecma_builtin_json_object step 10.b
- *         - ecma_builtin_json_array step 10.b
- *
- * @return ecma value
- *         Returned value must be freed with ecma_free_value.
- */
-ecma_value_t
-ecma_builtin_helper_json_create_formatted_json (ecma_string_t *left_bracket_p, /**< left bracket*/
-                                                ecma_string_t *right_bracket_p, /**< right bracket*/
-                                                ecma_string_t *stepback_p, /**< stepback*/
-                                                ecma_collection_header_t *partial_p, /**< key-value pairs*/
-                                                ecma_json_stringify_context_t *context_p) /**< context*/
-{
-  /* 10.b */
-  ecma_string_t *comma_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_COMMA_CHAR);
-  ecma_string_t *line_feed_p = ecma_get_magic_string (LIT_MAGIC_STRING_NEW_LINE_CHAR);
-  ecma_string_t *properties_str_p;
-  ecma_string_t *separator_p;
-
-  /* 10.b.i */
-  ecma_string_t *tmp_str_p = ecma_concat_ecma_strings (comma_str_p, line_feed_p);
-  ecma_deref_ecma_string (comma_str_p);
-  separator_p = tmp_str_p;
-
-  tmp_str_p = ecma_concat_ecma_strings (separator_p, context_p->indent_str_p);
-  ecma_deref_ecma_string (separator_p);
-  separator_p = tmp_str_p;
-
-  /* 10.b.ii */
-  properties_str_p = ecma_builtin_helper_json_create_separated_properties (partial_p, separator_p);
-  ecma_deref_ecma_string (separator_p);
-
-  /* 10.b.iii */
-  ecma_string_t *final_str_p;
-
-  tmp_str_p = ecma_concat_ecma_strings (left_bracket_p, line_feed_p);
-  final_str_p = tmp_str_p;
-
-  tmp_str_p = ecma_concat_ecma_strings (final_str_p, context_p->indent_str_p);
-  ecma_deref_ecma_string (final_str_p);
-  final_str_p = tmp_str_p;
-
-  tmp_str_p = ecma_concat_ecma_strings (final_str_p, properties_str_p);
-  ecma_deref_ecma_string (final_str_p);
-  ecma_deref_ecma_string (properties_str_p);
-  final_str_p = tmp_str_p;
-
-  tmp_str_p = ecma_concat_ecma_strings (final_str_p, line_feed_p);
-  ecma_deref_ecma_string (line_feed_p);
-  ecma_deref_ecma_string (final_str_p);
-  final_str_p = tmp_str_p;
-
-  tmp_str_p = ecma_concat_ecma_strings (final_str_p, stepback_p);
-  ecma_deref_ecma_string (final_str_p);
-  final_str_p = tmp_str_p;
-
-  tmp_str_p = ecma_concat_ecma_strings (final_str_p, right_bracket_p);
-  ecma_deref_ecma_string (final_str_p);
-  final_str_p = tmp_str_p;
-
-  return ecma_make_string_value (final_str_p);
-} /* ecma_builtin_helper_json_create_formatted_json */
-
-/**
- * Common function to create a non-formatted JSON string.
- *
- * See also:
- *          ECMA-262 v5, 15.12.3
- *
- * Used by:
- *         - ecma_builtin_json_object step 10.a
- *         - ecma_builtin_json_array step 10.a
- *
- * @return ecma value
- *         Returned value must be freed with ecma_free_value.
- */
-ecma_value_t
-ecma_builtin_helper_json_create_non_formatted_json (ecma_string_t *left_bracket_p, /**< left bracket*/
-                                                    ecma_string_t *right_bracket_p, /**< right bracket*/
-                                                    ecma_collection_header_t *partial_p) /**< key-value pairs*/
-{
-  /* 10.a */
-  ecma_string_t *comma_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_COMMA_CHAR);
-  ecma_string_t *properties_str_p;
-  ecma_string_t *tmp_str_p;
-
-  /* 10.a.i */
-  properties_str_p = ecma_builtin_helper_json_create_separated_properties (partial_p, comma_str_p);
-  ecma_deref_ecma_string (comma_str_p);
-
-  /* 10.a.ii */
-  tmp_str_p = ecma_concat_ecma_strings (left_bracket_p, properties_str_p);
-  ecma_deref_ecma_string (properties_str_p);
-  properties_str_p = tmp_str_p;
-
-  tmp_str_p = ecma_concat_ecma_strings (properties_str_p, right_bracket_p);
-  ecma_deref_ecma_string (properties_str_p);
-  properties_str_p = tmp_str_p;
-
-  return ecma_make_string_value (properties_str_p);
-} /* ecma_builtin_helper_json_create_non_formatted_json */
-
 /**
  * Convert decimal value to 4 digit hexadecimal string value.
  *
@@ -83,8 +83,8 @@ ecma_builtin_helper_object_to_string (const ecma_value_t this_arg) /**< this arg
 
   /* Building string "[object #type#]" where type is 'Undefined',
      'Null' or one of possible object's classes.
-     The string with null character is maximum 19 characters long. */
-  const lit_utf8_size_t buffer_size = 19;
+     The string is maximum 26 characters long ("[object Uint8ClampedArray]"). */
+  const lit_utf8_size_t buffer_size = 26;
   MEM_DEFINE_LOCAL_ARRAY (str_buffer, buffer_size, lit_utf8_byte_t);
 
   lit_utf8_byte_t *buffer_ptr = str_buffer;
@@ -353,8 +353,8 @@ ecma_builtin_helper_array_concat_value (ecma_object_t *obj_p, /**< array */
       ecma_string_t *array_index_string_p = ecma_new_ecma_string_from_uint32 (array_index);
 
       /* 5.b.iii.2 */
-      if (ecma_op_object_get_property (ecma_get_object_from_value (value),
-                                       array_index_string_p) != NULL)
+      if (ecma_op_object_has_property (ecma_get_object_from_value (value),
+                                       array_index_string_p))
       {
         ecma_string_t *new_array_index_string_p = ecma_new_ecma_string_from_uint32 (*length_p + array_index);
 
@@ -520,17 +520,16 @@ ecma_builtin_helper_string_prototype_object_index_of (ecma_value_t this_arg, /**
   /* 7 (indexOf) -- 8 (lastIndexOf) */
   ecma_string_t *search_str_p = ecma_get_string_from_value (search_str_val);
 
-  ecma_number_t *ret_num_p = ecma_alloc_number ();
-  *ret_num_p = ECMA_NUMBER_MINUS_ONE;
+  ecma_number_t ret_num = ECMA_NUMBER_MINUS_ONE;
 
   /* 8 (indexOf) -- 9 (lastIndexOf) */
   ecma_length_t index_of = 0;
   if (ecma_builtin_helper_string_find_index (original_str_p, search_str_p, first_index, start, &index_of))
   {
-    *ret_num_p = ((ecma_number_t) index_of);
+    ret_num = ((ecma_number_t) index_of);
   }
 
-  ret_value = ecma_make_number_value (ret_num_p);
+  ret_value = ecma_make_number_value (ret_num);
 
   ECMA_OP_TO_NUMBER_FINALIZE (pos_num);
   ECMA_FINALIZE (search_str_val);
@@ -158,13 +158,6 @@ extern bool ecma_has_string_value_in_collection (ecma_collection_header_t *, ecm
 
 extern ecma_string_t *
 ecma_builtin_helper_json_create_hex_digit_ecma_string (uint8_t);
-extern ecma_string_t *
-ecma_builtin_helper_json_create_separated_properties (ecma_collection_header_t *, ecma_string_t *);
-extern ecma_value_t
-ecma_builtin_helper_json_create_formatted_json (ecma_string_t *, ecma_string_t *, ecma_string_t *,
-                                                ecma_collection_header_t *, ecma_json_stringify_context_t *);
-extern ecma_value_t
-ecma_builtin_helper_json_create_non_formatted_json (ecma_string_t *, ecma_string_t *, ecma_collection_header_t *);
 
 /**
  * @}
@@ -46,6 +46,8 @@
   const ecma_value_t *arguments_list_p, ecma_length_t arguments_list_len
 #define ROUTINE(name, c_function_name, args_number, length_prop_value) \
   static ecma_value_t c_function_name (ROUTINE_ARG_LIST_ ## args_number);
+#define ACCESSOR_READ_ONLY(name, c_getter_func_name, prop_enumerable, prop_configurable) \
+  static ecma_value_t c_getter_func_name (ROUTINE_ARG_LIST_0);
 #include BUILTIN_INC_HEADER_NAME
 #undef ROUTINE_ARG_LIST_NON_FIXED
 #undef ROUTINE_ARG_LIST_3
@@ -65,6 +67,7 @@ static const lit_magic_string_id_t ECMA_BUILTIN_PROPERTY_NAMES[] =
 #define CP_UNIMPLEMENTED_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) name,
 #define OBJECT_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) name,
 #define ROUTINE(name, c_function_name, args_number, length_prop_value) name,
+#define ACCESSOR_READ_ONLY(name, c_getter_func_name, prop_enumerable, prop_configurable) name,
 #include BUILTIN_INC_HEADER_NAME
 };
 
@@ -85,6 +88,8 @@ enum
   ECMA_BUILTIN_PROPERTY_NAME_INDEX(name),
 #define ROUTINE(name, c_function_name, args_number, length_prop_value) \
   ECMA_BUILTIN_PROPERTY_NAME_INDEX(name),
+#define ACCESSOR_READ_ONLY(name, c_getter_func_name, prop_enumerable, prop_configurable) \
+  ECMA_BUILTIN_PROPERTY_NAME_INDEX(name),
 #include BUILTIN_INC_HEADER_NAME
 };
 
@@ -134,6 +139,11 @@ FIND_PROPERTY_INDEX_ROUTINE_NAME (lit_magic_string_id_t id) /**< magic string id
     { \
       return ECMA_BUILTIN_PROPERTY_NAME_INDEX(name); \
     }
+#define ACCESSOR_READ_ONLY(name, c_getter_func_name, prop_enumerable, prop_configurable) \
+    case name: \
+    { \
+      return ECMA_BUILTIN_PROPERTY_NAME_INDEX(name); \
+    }
 #include BUILTIN_INC_HEADER_NAME
     default:
     {
@@ -197,7 +207,7 @@ TRY_TO_INSTANTIATE_PROPERTY_ROUTINE_NAME (ecma_object_t *obj_p, /**< object */
     mask_prop_p->v.internal_property.value = 0;
   }
 
-  uint32_t bit_mask = mask_prop_p->v.internal_property.value;
+  uint32_t bit_mask = (uint32_t) mask_prop_p->v.internal_property.value;
 
   if (bit_mask & bit)
   {
@@ -251,10 +261,7 @@ TRY_TO_INSTANTIATE_PROPERTY_ROUTINE_NAME (ecma_object_t *obj_p, /**< object */
    }
 #define NUMBER_VALUE(name, number_value, prop_writable, prop_enumerable, prop_configurable) case name: \
     { \
-      ecma_number_t *num_p = ecma_alloc_number (); \
-      *num_p = number_value; \
-      \
-      value = ecma_make_number_value (num_p); \
+      value = ecma_make_number_value (number_value); \
       \
       writable = prop_writable; \
       enumerable = prop_enumerable; \
@@ -274,6 +281,20 @@ TRY_TO_INSTANTIATE_PROPERTY_ROUTINE_NAME (ecma_object_t *obj_p, /**< object */
       \
       break; \
     }
+#define ACCESSOR_READ_ONLY(name, c_getter_func_name, prop_enumerable, prop_configurable) case name: \
+    { \
+      /* The getter is a built-in routine, dispatched by the property's name */ \
+      ecma_object_t *getter_p = ecma_builtin_make_function_object_for_routine (builtin_object_id, id, 0); \
+      ecma_property_t *accessor_prop_p = ecma_create_named_accessor_property (obj_p, \
+                                                                              prop_name_p, \
+                                                                              getter_p, \
+                                                                              NULL, \
+                                                                              prop_enumerable, \
+                                                                              prop_configurable); \
+      ecma_deref_object (getter_p); \
+      \
+      return accessor_prop_p; \
+    }
 #ifdef CONFIG_ECMA_COMPACT_PROFILE
 #define CP_UNIMPLEMENTED_VALUE(name, value, prop_writable, prop_enumerable, prop_configurable) case name: \
     { \
@@ -379,7 +400,7 @@ LIST_LAZY_PROPERTY_NAMES_ROUTINE_NAME (ecma_object_t *object_p, /**< a built-in
     }
     else
     {
-      uint32_t bit_mask = mask_prop_p->v.internal_property.value;
+      uint32_t bit_mask = (uint32_t) mask_prop_p->v.internal_property.value;
 
       if (bit_mask & bit)
       {
@@ -459,6 +480,11 @@ DISPATCH_ROUTINE_ROUTINE_NAME (uint16_t builtin_routine_id, /**< built-in wide r
        { \
          return c_function_name (this_arg_value ROUTINE_ARG_LIST_ ## args_number); \
        }
+#define ACCESSOR_READ_ONLY(name, c_getter_func_name, prop_enumerable, prop_configurable) \
+       case name: \
+       { \
+         return c_getter_func_name (this_arg_value); \
+       }
 #include BUILTIN_INC_HEADER_NAME
 #undef ROUTINE_ARG
 #undef ROUTINE_ARG_LIST_0
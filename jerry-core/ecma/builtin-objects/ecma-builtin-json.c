@@ -75,14 +75,16 @@ typedef enum
 typedef struct
 {
   ecma_json_token_type_t type; /**< type of the current token */
-  lit_utf8_byte_t *current_p; /**< current position of the string processed by the parser */
-  lit_utf8_byte_t *end_p; /**< end of the string processed by the parser */
+  const lit_utf8_byte_t *current_p; /**< current position of the string processed by the parser */
+  const lit_utf8_byte_t *end_p; /**< end of the string processed by the parser */
   union
   {
     struct
     {
-      lit_utf8_byte_t *start_p; /**< when type is string_token, it contains the start of the string */
-      lit_utf8_size_t size; /**< when type is string_token, it contains the size of the string */
+      const lit_utf8_byte_t *start_p; /**< when type is string_token, it contains the start of the string */
+      lit_utf8_size_t size; /**< when type is string_token, it contains the size of the string,
+                             *   including the escape sequences */
+      bool has_escapes; /**< when type is string_token, it is true if the string contains escape sequences */
     } string;
     ecma_number_t number; /**< when type is number_token, it contains the value of the number */
   } u;
@@ -94,7 +96,8 @@ typedef struct
  * @return true if the match is successful
  */
 static bool
-ecma_builtin_json_check_id (lit_utf8_byte_t *string_p, /**< start position */
+ecma_builtin_json_check_id (const lit_utf8_byte_t *string_p, /**< start position */
+                            const lit_utf8_byte_t *end_p, /**< end of the string */
                             const char *id_p) /**< string identifier */
 {
   /*
@@ -118,126 +121,220 @@ ecma_builtin_json_check_id (lit_utf8_byte_t *string_p, /**< start position */
       return true;
     }
   }
-  while (*string_p == *id_p);
+  while (string_p < end_p && *string_p == *id_p);
 
   return false;
 } /* ecma_builtin_json_check_id */
 
+/**
+ * Decode the escape sequence, which follows a backslash in a JSON string.
+ *
+ * @return true - if the escape sequence is valid (the position is advanced after the sequence),
+ *         false - otherwise
+ */
+static bool
+ecma_builtin_json_parse_escape (const lit_utf8_byte_t **current_p_p, /**< [in, out] position after the backslash */
+                                const lit_utf8_byte_t *end_p, /**< end of the string */
+                                ecma_char_t *code_unit_p) /**< [out] decoded character */
+{
+  const lit_utf8_byte_t *current_p = *current_p_p;
+
+  if (current_p >= end_p)
+  {
+    return false;
+  }
+
+  switch (*current_p)
+  {
+    case LIT_CHAR_DOUBLE_QUOTE:
+    case LIT_CHAR_SLASH:
+    case LIT_CHAR_BACKSLASH:
+    {
+      *code_unit_p = *current_p;
+      break;
+    }
+    case LIT_CHAR_LOWERCASE_B:
+    {
+      *code_unit_p = LIT_CHAR_BS;
+      break;
+    }
+    case LIT_CHAR_LOWERCASE_F:
+    {
+      *code_unit_p = LIT_CHAR_FF;
+      break;
+    }
+    case LIT_CHAR_LOWERCASE_N:
+    {
+      *code_unit_p = LIT_CHAR_LF;
+      break;
+    }
+    case LIT_CHAR_LOWERCASE_R:
+    {
+      *code_unit_p = LIT_CHAR_CR;
+      break;
+    }
+    case LIT_CHAR_LOWERCASE_T:
+    {
+      *code_unit_p = LIT_CHAR_TAB;
+      break;
+    }
+    case LIT_CHAR_LOWERCASE_U:
+    {
+      if (end_p - current_p < 5
+          || !lit_read_code_unit_from_hex (current_p + 1, 4, code_unit_p))
+      {
+        return false;
+      }
+
+      *current_p_p = current_p + 5;
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  *current_p_p = current_p + 1;
+  return true;
+} /* ecma_builtin_json_parse_escape */
+
 /**
  * Parse and extract string token.
+ *
+ * Note:
+ *      the characters of the string are only checked here, the escape sequences
+ *      are decoded when the string is created by ecma_builtin_json_get_string
  */
 static void
 ecma_builtin_json_parse_string (ecma_json_token_t *token_p) /**< token argument */
 {
-  lit_utf8_byte_t *current_p = token_p->current_p;
-  lit_utf8_byte_t *write_p = current_p;
+  const lit_utf8_byte_t *current_p = token_p->current_p;
+  const lit_utf8_byte_t *end_p = token_p->end_p;
+  bool has_escapes = false;
 
   token_p->u.string.start_p = current_p;
 
-  while (*current_p != LIT_CHAR_DOUBLE_QUOTE)
+  while (true)
   {
-    if (*current_p <= 0x1f)
+    if (current_p >= end_p || *current_p <= 0x1f)
     {
       return;
     }
+
+    if (*current_p == LIT_CHAR_DOUBLE_QUOTE)
+    {
+      break;
+    }
+
     if (*current_p == LIT_CHAR_BACKSLASH)
     {
+      ecma_char_t code_unit;
+
       current_p++;
-      switch (*current_p)
+      if (!ecma_builtin_json_parse_escape (&current_p, end_p, &code_unit))
       {
-        case LIT_CHAR_DOUBLE_QUOTE:
-        case LIT_CHAR_SLASH:
-        case LIT_CHAR_BACKSLASH:
-        {
-          break;
-        }
-        case LIT_CHAR_LOWERCASE_B:
-        {
-          *current_p = LIT_CHAR_BS;
-          break;
-        }
-        case LIT_CHAR_LOWERCASE_F:
-        {
-          *current_p = LIT_CHAR_FF;
-          break;
-        }
-        case LIT_CHAR_LOWERCASE_N:
-        {
-          *current_p = LIT_CHAR_LF;
-          break;
-        }
-        case LIT_CHAR_LOWERCASE_R:
-        {
-          *current_p = LIT_CHAR_CR;
-          break;
-        }
-        case LIT_CHAR_LOWERCASE_T:
-        {
-          *current_p = LIT_CHAR_TAB;
-          break;
-        }
-        case LIT_CHAR_LOWERCASE_U:
-        {
-          ecma_char_t code_unit;
-
-          if (!(lit_read_code_unit_from_hex (current_p + 1, 4, &code_unit)))
-          {
-            return;
-          }
-
-          current_p += 5;
-          write_p += lit_code_unit_to_utf8 (code_unit, write_p);
-          continue;
-        }
-        default:
-        {
-          return;
-        }
+        return;
       }
+
+      has_escapes = true;
+      continue;
     }
-    *write_p++ = *current_p++;
+
+    current_p++;
   }
 
-  token_p->u.string.size = (lit_utf8_size_t) (write_p - token_p->u.string.start_p);
+  token_p->u.string.size = (lit_utf8_size_t) (current_p - token_p->u.string.start_p);
+  token_p->u.string.has_escapes = has_escapes;
   token_p->current_p = current_p + 1;
   token_p->type = string_token;
 } /* ecma_builtin_json_parse_string */
 
+/**
+ * Create the string of a string token.
+ *
+ * @return pointer to ecma-string
+ *         Returned value must be freed with ecma_deref_ecma_string.
+ */
+static ecma_string_t *
+ecma_builtin_json_get_string (ecma_json_token_t *token_p) /**< token argument */
+{
+  JERRY_ASSERT (token_p->type == string_token);
+
+  const lit_utf8_byte_t *current_p = token_p->u.string.start_p;
+  const lit_utf8_byte_t *end_p = current_p + token_p->u.string.size;
+
+  if (!token_p->u.string.has_escapes)
+  {
+    return ecma_new_ecma_string_from_utf8 (current_p, token_p->u.string.size);
+  }
+
+  ecma_stringbuilder_t builder;
+  ecma_stringbuilder_init (&builder);
+
+  const lit_utf8_byte_t *unescaped_start_p = current_p;
+
+  while (current_p < end_p)
+  {
+    if (*current_p != LIT_CHAR_BACKSLASH)
+    {
+      current_p++;
+      continue;
+    }
+
+    ecma_stringbuilder_append_raw (&builder, unescaped_start_p, (lit_utf8_size_t) (current_p - unescaped_start_p));
+
+    ecma_char_t code_unit;
+
+    current_p++;
+    bool is_valid = ecma_builtin_json_parse_escape (&current_p, end_p, &code_unit);
+    JERRY_ASSERT (is_valid);
+
+    ecma_stringbuilder_append_char (&builder, code_unit);
+    unescaped_start_p = current_p;
+  }
+
+  ecma_stringbuilder_append_raw (&builder, unescaped_start_p, (lit_utf8_size_t) (end_p - unescaped_start_p));
+
+  return ecma_stringbuilder_finalize (&builder);
+} /* ecma_builtin_json_get_string */
+
 /**
  * Parse and extract string token.
  */
 static void
 ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument */
 {
-  lit_utf8_byte_t *current_p = token_p->current_p;
-  lit_utf8_byte_t *start_p = current_p;
+  const lit_utf8_byte_t *current_p = token_p->current_p;
+  const lit_utf8_byte_t *end_p = token_p->end_p;
+  const lit_utf8_byte_t *start_p = current_p;
 
   if (*current_p == LIT_CHAR_MINUS)
   {
     current_p++;
   }
 
-  if (*current_p == LIT_CHAR_0)
+  if (current_p < end_p && *current_p == LIT_CHAR_0)
   {
     current_p++;
-    if (lit_char_is_decimal_digit (*current_p))
+    if (current_p < end_p && lit_char_is_decimal_digit (*current_p))
     {
       return;
     }
   }
-  else if (lit_char_is_decimal_digit (*current_p))
+  else if (current_p < end_p && lit_char_is_decimal_digit (*current_p))
   {
     do
     {
       current_p++;
     }
-    while (lit_char_is_decimal_digit (*current_p));
+    while (current_p < end_p && lit_char_is_decimal_digit (*current_p));
   }
 
-  if (*current_p == LIT_CHAR_DOT)
+  if (current_p < end_p && *current_p == LIT_CHAR_DOT)
   {
     current_p++;
-    if (!lit_char_is_decimal_digit (*current_p))
+    if (current_p >= end_p || !lit_char_is_decimal_digit (*current_p))
     {
       return;
     }
@@ -246,18 +343,18 @@ ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument
     {
       current_p++;
     }
-    while (lit_char_is_decimal_digit (*current_p));
+    while (current_p < end_p && lit_char_is_decimal_digit (*current_p));
   }
 
-  if (*current_p == LIT_CHAR_LOWERCASE_E || *current_p == LIT_CHAR_UPPERCASE_E)
+  if (current_p < end_p && (*current_p == LIT_CHAR_LOWERCASE_E || *current_p == LIT_CHAR_UPPERCASE_E))
   {
     current_p++;
-    if (*current_p == LIT_CHAR_PLUS || *current_p == LIT_CHAR_MINUS)
+    if (current_p < end_p && (*current_p == LIT_CHAR_PLUS || *current_p == LIT_CHAR_MINUS))
     {
       current_p++;
     }
 
-    if (!lit_char_is_decimal_digit (*current_p))
+    if (current_p >= end_p || !lit_char_is_decimal_digit (*current_p))
     {
       return;
     }
@@ -266,7 +363,7 @@ ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument
     {
       current_p++;
     }
-    while (lit_char_is_decimal_digit (*current_p));
+    while (current_p < end_p && lit_char_is_decimal_digit (*current_p));
   }
   token_p->type = number_token;
   token_p->u.number = ecma_utf8_string_to_number (start_p, (lit_utf8_size_t) (current_p - start_p));
@@ -283,14 +380,13 @@ ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument
 static void
 ecma_builtin_json_parse_next_token (ecma_json_token_t *token_p) /**< token argument */
 {
-  lit_utf8_byte_t *current_p = token_p->current_p;
+  const lit_utf8_byte_t *current_p = token_p->current_p;
+  const lit_utf8_byte_t *end_p = token_p->end_p;
   token_p->type = invalid_token;
 
-  /*
-   * No need for end check since the string is zero terminated.
-   */
-  while (*current_p == LIT_CHAR_SP || *current_p == LIT_CHAR_CR
-         || *current_p == LIT_CHAR_LF || *current_p == LIT_CHAR_TAB)
+  while (current_p < end_p
+         && (*current_p == LIT_CHAR_SP || *current_p == LIT_CHAR_CR
+             || *current_p == LIT_CHAR_LF || *current_p == LIT_CHAR_TAB))
   {
     current_p++;
   }
@@ -341,7 +437,7 @@ ecma_builtin_json_parse_next_token (ecma_json_token_t *token_p) /**< token argum
     }
     case LIT_CHAR_LOWERCASE_N:
     {
-      if (ecma_builtin_json_check_id (current_p, "null"))
+      if (ecma_builtin_json_check_id (current_p, end_p, "null"))
       {
         token_p->type = null_token;
         token_p->current_p = current_p + 4;
@@ -351,7 +447,7 @@ ecma_builtin_json_parse_next_token (ecma_json_token_t *token_p) /**< token argum
     }
     case LIT_CHAR_LOWERCASE_T:
     {
-      if (ecma_builtin_json_check_id (current_p, "true"))
+      if (ecma_builtin_json_check_id (current_p, end_p, "true"))
       {
         token_p->type = true_token;
         token_p->current_p = current_p + 4;
@@ -361,7 +457,7 @@ ecma_builtin_json_parse_next_token (ecma_json_token_t *token_p) /**< token argum
     }
     case LIT_CHAR_LOWERCASE_F:
     {
-      if (ecma_builtin_json_check_id (current_p, "false"))
+      if (ecma_builtin_json_check_id (current_p, end_p, "false"))
       {
         token_p->type = false_token;
         token_p->current_p = current_p + 5;
@@ -392,20 +488,19 @@ ecma_builtin_json_parse_next_token (ecma_json_token_t *token_p) /**< token argum
 static bool
 ecma_builtin_json_check_right_square_token (ecma_json_token_t *token_p) /**< token argument */
 {
-  lit_utf8_byte_t *current_p = token_p->current_p;
+  const lit_utf8_byte_t *current_p = token_p->current_p;
+  const lit_utf8_byte_t *end_p = token_p->end_p;
 
-  /*
-   * No need for end check since the string is zero terminated.
-   */
-  while (*current_p == LIT_CHAR_SP || *current_p == LIT_CHAR_CR
-         || *current_p == LIT_CHAR_LF || *current_p == LIT_CHAR_TAB)
+  while (current_p < end_p
+         && (*current_p == LIT_CHAR_SP || *current_p == LIT_CHAR_CR
+             || *current_p == LIT_CHAR_LF || *current_p == LIT_CHAR_TAB))
   {
     current_p++;
   }
 
   token_p->current_p = current_p;
 
-  if (*current_p == LIT_CHAR_RIGHT_SQUARE)
+  if (current_p < end_p && *current_p == LIT_CHAR_RIGHT_SQUARE)
   {
     token_p->current_p = current_p + 1;
     return true;
@@ -451,14 +546,11 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
   {
     case number_token:
     {
-      ecma_number_t *number_p = ecma_alloc_number ();
-      *number_p = token_p->u.number;
-      return ecma_make_number_value (number_p);
+      return ecma_make_number_value (token_p->u.number);
     }
     case string_token:
     {
-      ecma_string_t *string_p = ecma_new_ecma_string_from_utf8 (token_p->u.string.start_p, token_p->u.string.size);
-      return ecma_make_string_value (string_p);
+      return ecma_make_string_value (ecma_builtin_json_get_string (token_p));
     }
     case null_token:
     {
@@ -500,12 +592,12 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
           break;
         }
 
-        lit_utf8_byte_t *string_start_p = token_p->u.string.start_p;
-        lit_utf8_size_t string_size = token_p->u.string.size;
+        ecma_string_t *name_p = ecma_builtin_json_get_string (token_p);
         ecma_builtin_json_parse_next_token (token_p);
 
         if (token_p->type != colon_token)
         {
+          ecma_deref_ecma_string (name_p);
           break;
         }
 
@@ -513,10 +605,10 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
 
         if (ecma_is_value_undefined (value))
         {
+          ecma_deref_ecma_string (name_p);
           break;
         }
 
-        ecma_string_t *name_p = ecma_new_ecma_string_from_utf8 (string_start_p, string_size);
         ecma_builtin_json_define_value_property (object_p, name_p, value);
         ecma_deref_ecma_string (name_p);
         ecma_free_value (value);
@@ -709,19 +801,27 @@ ecma_builtin_json_parse (ecma_value_t this_arg __attr_unused___, /**< 'this' arg
                   ret_value);
 
   ecma_string_t *string_p = ecma_get_string_from_value (string);
-  ecma_length_t string_size = (uint32_t) ecma_string_get_size (string_p);
-  lit_utf8_size_t buffer_size = sizeof (lit_utf8_byte_t) * (string_size + 1);
+
+  /* The characters of the string are parsed in place, only the strings without
+   * character storage (e.g. the stringified numbers) are copied to a buffer. */
+  lit_utf8_size_t string_size;
+  bool is_ascii;
+  const lit_utf8_byte_t *chars_p = ecma_string_raw_chars (string_p, &string_size, &is_ascii);
+  lit_utf8_size_t buffer_size = (chars_p == NULL) ? string_size : 0;
 
   MEM_DEFINE_LOCAL_ARRAY (str_start_p, buffer_size, lit_utf8_byte_t);
 
-  lit_utf8_size_t sz = ecma_string_to_utf8_string (string_p, str_start_p, buffer_size);
-  JERRY_ASSERT (sz == string_size);
+  if (chars_p == NULL)
+  {
+    lit_utf8_size_t sz = ecma_string_to_utf8_string (string_p, str_start_p, buffer_size);
+    JERRY_ASSERT (sz == string_size);
 
-  str_start_p[string_size] = LIT_BYTE_NULL;
+    chars_p = str_start_p;
+  }
 
   ecma_json_token_t token;
-  token.current_p = str_start_p;
-  token.end_p = str_start_p + string_size;
+  token.current_p = chars_p;
+  token.end_p = chars_p + string_size;
 
   ecma_value_t final_result = ecma_builtin_json_parse_value (&token);
 
@@ -774,13 +874,21 @@ ecma_builtin_json_parse (ecma_value_t this_arg __attr_unused___, /**< 'this' arg
 } /* ecma_builtin_json_parse */
 
 static ecma_value_t
-ecma_builtin_json_str (ecma_string_t *key_p, ecma_object_t *holder_p, ecma_json_stringify_context_t *context_p);
+ecma_builtin_json_str_value (ecma_string_t *key_p, ecma_object_t *holder_p, ecma_json_stringify_context_t *context_p);
+
+static bool
+ecma_builtin_json_is_serializable (ecma_value_t value);
+
+static ecma_value_t
+ecma_builtin_json_str (ecma_value_t value, ecma_json_stringify_context_t *context_p, ecma_stringbuilder_t *builder_p);
 
 static ecma_value_t
-ecma_builtin_json_object (ecma_object_t *obj_p, ecma_json_stringify_context_t *context_p);
+ecma_builtin_json_object (ecma_object_t *obj_p, ecma_json_stringify_context_t *context_p,
+                          ecma_stringbuilder_t *builder_p);
 
 static ecma_value_t
-ecma_builtin_json_array (ecma_object_t *obj_p, ecma_json_stringify_context_t *context_p);
+ecma_builtin_json_array (ecma_object_t *obj_p, ecma_json_stringify_context_t *context_p,
+                         ecma_stringbuilder_t *builder_p);
 
 /**
  * The JSON object's 'stringify' routine
@@ -1025,10 +1133,29 @@ ecma_builtin_json_stringify (ecma_value_t this_arg __attr_unused___, /**< 'this'
 
       /* 11. */
       ECMA_TRY_CATCH (str_val,
-                      ecma_builtin_json_str (empty_str_p, obj_wrapper_p, &context),
+                      ecma_builtin_json_str_value (empty_str_p, obj_wrapper_p, &context),
                       ret_value);
 
-      ret_value = ecma_copy_value (str_val);
+      if (ecma_builtin_json_is_serializable (str_val))
+      {
+        ecma_stringbuilder_t builder;
+        ecma_stringbuilder_init (&builder);
+
+        ret_value = ecma_builtin_json_str (str_val, &context, &builder);
+
+        if (ecma_is_value_empty (ret_value))
+        {
+          ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
+        }
+        else
+        {
+          ecma_stringbuilder_destroy (&builder);
+        }
+      }
+      else
+      {
+        ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+      }
 
       ECMA_FINALIZE (str_val);
 
@@ -1050,177 +1177,152 @@ ecma_builtin_json_stringify (ecma_value_t this_arg __attr_unused___, /**< 'this'
 /**
  * Abstract operation 'Quote' defined in 15.12.3
  *
+ * The quoted string is appended to the string builder.
+ *
  * See also:
  *          ECMA-262 v5, 15.12.3
- *
- * @return ecma value
- *         Returned value must be freed with ecma_free_value.
  */
-static ecma_value_t
-ecma_builtin_json_quote (ecma_string_t *string_p) /**< string that should be quoted*/
+static void
+ecma_builtin_json_quote (ecma_stringbuilder_t *builder_p, /**< string builder */
+                         ecma_string_t *string_p) /**< string that should be quoted*/
 {
-  /* 1. */
-  ecma_string_t *quote_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_DOUBLE_QUOTE_CHAR);
-  ecma_string_t *product_str_p = ecma_copy_or_ref_ecma_string (quote_str_p);
-  ecma_string_t *tmp_str_p;
-
-  ecma_length_t string_size = ecma_string_get_size (string_p);
-
-  MEM_DEFINE_LOCAL_ARRAY (string_buff, string_size, lit_utf8_byte_t);
-
-  lit_utf8_size_t bytes_copied = ecma_string_to_utf8_string (string_p,
-                                                             string_buff,
-                                                             string_size);
-
-  JERRY_ASSERT (bytes_copied == string_size);
+  lit_utf8_size_t string_size;
+  bool is_ascii;
+  const lit_utf8_byte_t *string_buff_p = ecma_string_raw_chars (string_p, &string_size, &is_ascii);
 
-  lit_utf8_byte_t *str_p = string_buff;
-  const lit_utf8_byte_t *str_end_p = str_p + string_size;
+  /* 1. */
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_DOUBLE_QUOTE);
 
-  while (str_p < str_end_p)
+  if (string_buff_p == NULL)
   {
-    ecma_char_t current_char = lit_utf8_read_next (&str_p);
+    /* Stringified numbers have no characters to be escaped. */
+    ecma_stringbuilder_append (builder_p, string_p);
+  }
+  else
+  {
+    /* Characters to be escaped are all single byte characters, so the string is scanned bytewise,
+     * and each sequence of characters, which are not escaped, is appended at once. */
+    const lit_utf8_byte_t *str_p = string_buff_p;
+    const lit_utf8_byte_t *str_end_p = str_p + string_size;
+    const lit_utf8_byte_t *unescaped_start_p = str_p;
 
-    /* 2.a */
-    if (current_char == LIT_CHAR_BACKSLASH || current_char == LIT_CHAR_DOUBLE_QUOTE)
+    while (str_p < str_end_p)
     {
-      ecma_string_t *backslash_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_BACKSLASH_CHAR);
+      const lit_utf8_byte_t current_char = *str_p;
 
-      /* 2.a.i */
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, backslash_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (backslash_str_p);
-      product_str_p = tmp_str_p;
-
-      /* 2.a.ii */
-      ecma_string_t *current_char_str_p = ecma_new_ecma_string_from_code_unit (current_char);
+      /* 2.d */
+      if (current_char >= LIT_CHAR_SP
+          && current_char != LIT_CHAR_BACKSLASH
+          && current_char != LIT_CHAR_DOUBLE_QUOTE)
+      {
+        str_p++;
+        continue;
+      }
 
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, current_char_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (current_char_str_p);
-      product_str_p = tmp_str_p;
-    }
-    /* 2.b */
-    else if (current_char == LIT_CHAR_BS
-             || current_char == LIT_CHAR_FF
-             || current_char == LIT_CHAR_LF
-             || current_char == LIT_CHAR_CR
-             || current_char == LIT_CHAR_TAB)
-    {
-      ecma_string_t *backslash_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_BACKSLASH_CHAR);
+      ecma_stringbuilder_append_raw (builder_p, unescaped_start_p, (lit_utf8_size_t) (str_p - unescaped_start_p));
 
-      /* 2.b.i */
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, backslash_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (backslash_str_p);
-      product_str_p = tmp_str_p;
+      str_p++;
+      unescaped_start_p = str_p;
 
-      /* 2.b.ii */
-      lit_utf8_byte_t abbrev = LIT_CHAR_SP;
+      /* 2.a.i, 2.b.i, 2.c.i */
+      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_BACKSLASH);
 
-      switch (current_char)
+      /* 2.a */
+      if (current_char == LIT_CHAR_BACKSLASH || current_char == LIT_CHAR_DOUBLE_QUOTE)
       {
-        case LIT_CHAR_BS:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_B;
-          break;
-        }
-        case LIT_CHAR_FF:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_F;
-          break;
-        }
-        case LIT_CHAR_LF:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_N;
-          break;
-        }
-        case LIT_CHAR_CR:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_R;
-          break;
-        }
-        case LIT_CHAR_TAB:
+        /* 2.a.ii */
+        ecma_stringbuilder_append_byte (builder_p, current_char);
+      }
+      /* 2.b */
+      else if (current_char == LIT_CHAR_BS
+               || current_char == LIT_CHAR_FF
+               || current_char == LIT_CHAR_LF
+               || current_char == LIT_CHAR_CR
+               || current_char == LIT_CHAR_TAB)
+      {
+        /* 2.b.ii */
+        lit_utf8_byte_t abbrev = LIT_CHAR_SP;
+
+        switch (current_char)
         {
-          abbrev = LIT_CHAR_LOWERCASE_T;
-          break;
+          case LIT_CHAR_BS:
+          {
+            abbrev = LIT_CHAR_LOWERCASE_B;
+            break;
+          }
+          case LIT_CHAR_FF:
+          {
+            abbrev = LIT_CHAR_LOWERCASE_F;
+            break;
+          }
+          case LIT_CHAR_LF:
+          {
+            abbrev = LIT_CHAR_LOWERCASE_N;
+            break;
+          }
+          case LIT_CHAR_CR:
+          {
+            abbrev = LIT_CHAR_LOWERCASE_R;
+            break;
+          }
+          case LIT_CHAR_TAB:
+          {
+            abbrev = LIT_CHAR_LOWERCASE_T;
+            break;
+          }
         }
+
+        /* 2.b.iii */
+        ecma_stringbuilder_append_byte (builder_p, abbrev);
       }
+      /* 2.c */
+      else
+      {
+        /* 2.c.ii */
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_U);
 
-      /* 2.b.iii */
-      ecma_string_t *abbrev_str_p = ecma_new_ecma_string_from_utf8 (&abbrev, 1);
+        /* 2.c.iii */
+        ecma_string_t *hex_str_p = ecma_builtin_helper_json_create_hex_digit_ecma_string (current_char);
 
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, abbrev_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (abbrev_str_p);
-      product_str_p = tmp_str_p;
+        /* 2.c.iv */
+        ecma_stringbuilder_append (builder_p, hex_str_p);
+        ecma_deref_ecma_string (hex_str_p);
+      }
     }
-    /* 2.c */
-    else if (current_char < LIT_CHAR_SP)
-    {
-      ecma_string_t *backslash_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_BACKSLASH_CHAR);
-
-      /* 2.c.i */
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, backslash_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (backslash_str_p);
-      product_str_p = tmp_str_p;
-
-      /* 2.c.ii */
-      lit_utf8_byte_t u_ch = LIT_CHAR_LOWERCASE_U;
-      ecma_string_t *u_ch_str_p = ecma_new_ecma_string_from_utf8 (&u_ch, 1);
 
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, u_ch_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (u_ch_str_p);
-      product_str_p = tmp_str_p;
-
-      /* 2.c.iii */
-      ecma_string_t *hex_str_p = ecma_builtin_helper_json_create_hex_digit_ecma_string ((uint8_t) current_char);
-
-      /* 2.c.iv */
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, hex_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (hex_str_p);
-      product_str_p = tmp_str_p;
+    if (unescaped_start_p == string_buff_p)
+    {
+      /* The string has nothing to escape, so it is appended as a whole, which avoids copying large strings. */
+      ecma_stringbuilder_append (builder_p, string_p);
     }
-    /* 2.d */
     else
     {
-      ecma_string_t *current_char_str_p = ecma_new_ecma_string_from_code_unit (current_char);
-
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, current_char_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (current_char_str_p);
-      product_str_p = tmp_str_p;
+      ecma_stringbuilder_append_raw (builder_p, unescaped_start_p, (lit_utf8_size_t) (str_end_p - unescaped_start_p));
     }
   }
 
-  MEM_FINALIZE_LOCAL_ARRAY (string_buff);
-
   /* 3. */
-  tmp_str_p = ecma_concat_ecma_strings (product_str_p, quote_str_p);
-  ecma_deref_ecma_string (product_str_p);
-  ecma_deref_ecma_string (quote_str_p);
-  product_str_p = tmp_str_p;
-
-  /* 4. */
-  return ecma_make_string_value (product_str_p);
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_DOUBLE_QUOTE);
 } /* ecma_builtin_json_quote */
 
 /**
- * Abstract operation 'Str' defined in 15.12.3
+ * Steps 1. - 4. of abstract operation 'Str' defined in 15.12.3
+ *
+ * Note:
+ *      the value is serialized by ecma_builtin_json_str, so the members, which are not serialized,
+ *      are known before anything is appended to the string builder
  *
  * See also:
  *          ECMA-262 v5, 15.12.3
  *
- * @return ecma value
+ * @return the value to be serialized - if the operation is successful,
+ *         error - otherwise
  *         Returned value must be freed with ecma_free_value.
  */
 static ecma_value_t
-ecma_builtin_json_str (ecma_string_t *key_p, /**< property key*/
-                       ecma_object_t *holder_p, /**< the object*/
-                       ecma_json_stringify_context_t *context_p) /**< context*/
+ecma_builtin_json_str_value (ecma_string_t *key_p, /**< property key*/
+                             ecma_object_t *holder_p, /**< the object*/
+                             ecma_json_stringify_context_t *context_p) /**< context*/
 {
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
@@ -1327,90 +1429,130 @@ ecma_builtin_json_str (ecma_string_t *key_p, /**< property key*/
 
   if (ecma_is_value_empty (ret_value))
   {
-    /* 5. - 7. */
-    if (ecma_is_value_null (my_val) || ecma_is_value_boolean (my_val))
-    {
-      ret_value = ecma_op_to_string (my_val);
-      JERRY_ASSERT (!ecma_is_value_error (ret_value));
-    }
-    /* 8. */
-    else if (ecma_is_value_string (my_val))
-    {
-      ecma_string_t *value_str_p = ecma_get_string_from_value (my_val);
-      ret_value = ecma_builtin_json_quote (value_str_p);
-    }
-    /* 9. */
-    else if (ecma_is_value_number (my_val))
-    {
-      ecma_number_t num_value_p = *ecma_get_number_from_value (my_val);
+    ret_value = my_val;
+  }
+  else
+  {
+    ecma_free_value (my_val);
+  }
 
-      /* 9.a */
-      if (!ecma_number_is_nan (num_value_p) && !ecma_number_is_infinity (num_value_p))
-      {
-        ret_value = ecma_op_to_string (my_val);
-        JERRY_ASSERT (!ecma_is_value_error (ret_value));
-      }
-      else
-      {
-        /* 9.b */
-        ecma_string_t *null_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_NULL);
-        ret_value = ecma_make_string_value (null_str_p);
-      }
-    }
-    /* 10. */
-    else if (ecma_is_value_object (my_val) && !ecma_op_is_callable (my_val))
-    {
-      ecma_object_t *obj_p = ecma_get_object_from_value (my_val);
-      lit_magic_string_id_t class_name = ecma_object_get_class_name (obj_p);
+  ECMA_FINALIZE (value);
 
-      /* 10.a */
-      if (class_name == LIT_MAGIC_STRING_ARRAY_UL)
-      {
-        ECMA_TRY_CATCH (val,
-                        ecma_builtin_json_array (obj_p, context_p),
-                        ret_value);
+  return ret_value;
+} /* ecma_builtin_json_str_value */
 
-        ret_value = ecma_copy_value (val);
+/**
+ * Check whether a value, returned by ecma_builtin_json_str_value, produces any output
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3 (step 11 of abstract operation 'Str')
+ *
+ * @return true - if the value is serialized,
+ *         false - if the value is undefined
+ */
+static bool
+ecma_builtin_json_is_serializable (ecma_value_t value) /**< value */
+{
+  return (ecma_is_value_null (value)
+          || ecma_is_value_boolean (value)
+          || ecma_is_value_string (value)
+          || ecma_is_value_number (value)
+          || (ecma_is_value_object (value) && !ecma_op_is_callable (value)));
+} /* ecma_builtin_json_is_serializable */
 
-        ECMA_FINALIZE (val);
-      }
-      /* 10.b */
-      else
-      {
-        ECMA_TRY_CATCH (val,
-                        ecma_builtin_json_object (obj_p, context_p),
-                        ret_value);
+/**
+ * Steps 5. - 10. of abstract operation 'Str' defined in 15.12.3
+ *
+ * The serialized value is appended to the string builder.
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3
+ *
+ * @return empty ecma value - if the value is serialized,
+ *         error - otherwise
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_json_str (ecma_value_t my_val, /**< value returned by ecma_builtin_json_str_value */
+                       ecma_json_stringify_context_t *context_p, /**< context*/
+                       ecma_stringbuilder_t *builder_p) /**< string builder */
+{
+  JERRY_ASSERT (ecma_builtin_json_is_serializable (my_val));
 
-        ret_value = ecma_copy_value (val);
+  /* 5. - 7. */
+  if (ecma_is_value_null (my_val) || ecma_is_value_boolean (my_val))
+  {
+    ecma_value_t str_value = ecma_op_to_string (my_val);
+    JERRY_ASSERT (!ecma_is_value_error (str_value));
 
-        ECMA_FINALIZE (val);
-      }
+    ecma_stringbuilder_append (builder_p, ecma_get_string_from_value (str_value));
+    ecma_free_value (str_value);
+  }
+  /* 8. */
+  else if (ecma_is_value_string (my_val))
+  {
+    ecma_string_t *value_str_p = ecma_get_string_from_value (my_val);
+    ecma_builtin_json_quote (builder_p, value_str_p);
+  }
+  /* 9. */
+  else if (ecma_is_value_number (my_val))
+  {
+    ecma_number_t num_value_p = ecma_get_number_from_value (my_val);
+
+    /* 9.a */
+    if (!ecma_number_is_nan (num_value_p) && !ecma_number_is_infinity (num_value_p))
+    {
+      ecma_value_t str_value = ecma_op_to_string (my_val);
+      JERRY_ASSERT (!ecma_is_value_error (str_value));
+
+      ecma_stringbuilder_append (builder_p, ecma_get_string_from_value (str_value));
+      ecma_free_value (str_value);
     }
     else
     {
-      /* 11. */
-      ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+      /* 9.b */
+      ecma_stringbuilder_append_magic (builder_p, LIT_MAGIC_STRING_NULL);
     }
   }
+  /* 10. */
+  else
+  {
+    ecma_object_t *obj_p = ecma_get_object_from_value (my_val);
+    lit_magic_string_id_t class_name = ecma_object_get_class_name (obj_p);
 
-  ecma_free_value (my_val);
-  ECMA_FINALIZE (value);
+    /* 10.a */
+    if (class_name == LIT_MAGIC_STRING_ARRAY_UL)
+    {
+      return ecma_builtin_json_array (obj_p, context_p, builder_p);
+    }
 
-  return ret_value;
+    /* 10.b */
+    return ecma_builtin_json_object (obj_p, context_p, builder_p);
+  }
+
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 } /* ecma_builtin_json_str */
 
 /**
  * Abstract operation 'JO' defined in 15.12.3
  *
+ * The serialized object is appended to the string builder.
+ *
+ * Note:
+ *      instead of collecting the serialized members in the 'partial' list, the members
+ *      are appended to the string builder one by one, with the separators of step 10
+ *
  * See also:
  *          ECMA-262 v5, 15.12.3
  *
- * @return ecma value
+ * @return empty ecma value - if the object is serialized,
+ *         error - otherwise
  *         Returned value must be freed with ecma_free_value.
  */
 static ecma_value_t
 ecma_builtin_json_object (ecma_object_t *obj_p, /**< the object*/
-                          ecma_json_stringify_context_t *context_p) /**< context*/
+                          ecma_json_stringify_context_t *context_p, /**< context*/
+                          ecma_stringbuilder_t *builder_p) /**< string builder */
 {
   ecma_value_t obj_value = ecma_make_object_value (obj_p);
 
@@ -1451,11 +1593,14 @@ ecma_builtin_json_object (ecma_object_t *obj_p, /**< the object*/
     while (ecma_collection_iterator_next (&iter))
     {
       ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
-      ecma_property_t *property_p = ecma_op_object_get_own_property (obj_p, property_name_p);
+      ecma_property_descriptor_t prop_desc;
+      bool is_found = ecma_op_object_get_own_property_descriptor (obj_p, property_name_p, &prop_desc);
+      JERRY_ASSERT (is_found && prop_desc.is_enumerable);
 
-      JERRY_ASSERT (ecma_is_property_enumerable (property_p));
+      bool is_data_property = prop_desc.is_value_defined;
+      ecma_free_property_descriptor (&prop_desc);
 
-      if (property_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
+      if (is_data_property)
       {
         ecma_append_to_values_collection (property_keys_p, *iter.current_value_p, true);
       }
@@ -1464,8 +1609,10 @@ ecma_builtin_json_object (ecma_object_t *obj_p, /**< the object*/
     ecma_free_values_collection (props_p, true);
   }
 
-  /* 7. */
-  ecma_collection_header_t *partial_p = ecma_new_values_collection (NULL, 0, true);
+  bool is_gap_empty = (ecma_string_get_length (context_p->gap_str_p) == 0);
+  uint32_t member_count = 0;
+
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LEFT_BRACE);
 
   /* 8. */
   ecma_collection_iterator_t iterator;
@@ -1478,50 +1625,41 @@ ecma_builtin_json_object (ecma_object_t *obj_p, /**< the object*/
 
     /* 8.a */
     ECMA_TRY_CATCH (str_val,
-                    ecma_builtin_json_str (key_p, obj_p, context_p),
+                    ecma_builtin_json_str_value (key_p, obj_p, context_p),
                     ret_value);
 
     /* 8.b */
-    if (!ecma_is_value_undefined (str_val))
+    if (ecma_builtin_json_is_serializable (str_val))
     {
-      ecma_string_t *colon_p = ecma_get_magic_string (LIT_MAGIC_STRING_COLON_CHAR);
-      ecma_string_t *value_str_p = ecma_get_string_from_value (str_val);
-      ecma_string_t *tmp_str_p;
+      /* 10.a.i, 10.b.i - 10.b.ii */
+      if (member_count > 0)
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_COMMA);
+      }
 
-      /* 8.b.i */
-      ecma_value_t str_comp_val = ecma_builtin_json_quote (key_p);
-      JERRY_ASSERT (!ecma_is_value_error (str_comp_val));
+      if (!is_gap_empty)
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LF);
+        ecma_stringbuilder_append (builder_p, context_p->indent_str_p);
+      }
 
-      ecma_string_t *member_str_p = ecma_get_string_from_value (str_comp_val);
+      /* 8.b.i */
+      ecma_builtin_json_quote (builder_p, key_p);
 
       /* 8.b.ii */
-      tmp_str_p = ecma_concat_ecma_strings (member_str_p, colon_p);
-      ecma_free_value (str_comp_val);
-      ecma_deref_ecma_string (colon_p);
-      member_str_p = tmp_str_p;
+      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_COLON);
 
       /* 8.b.iii */
-      bool is_gap_empty = (ecma_string_get_length (context_p->gap_str_p) == 0);
-
       if (!is_gap_empty)
       {
-        ecma_string_t *space_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_SPACE_CHAR);
-
-        tmp_str_p = ecma_concat_ecma_strings (member_str_p, space_str_p);
-        ecma_deref_ecma_string (member_str_p);
-        ecma_deref_ecma_string (space_str_p);
-        member_str_p = tmp_str_p;
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_SP);
       }
 
       /* 8.b.iv */
-      tmp_str_p = ecma_concat_ecma_strings (member_str_p, value_str_p);
-      ecma_deref_ecma_string (member_str_p);
-      member_str_p = tmp_str_p;
+      ret_value = ecma_builtin_json_str (str_val, context_p, builder_p);
 
       /* 8.b.v */
-      ecma_value_t member_value = ecma_make_string_value (member_str_p);
-      ecma_append_to_values_collection (partial_p, member_value, true);
-      ecma_deref_ecma_string (member_str_p);
+      member_count++;
     }
 
     ECMA_FINALIZE (str_val);
@@ -1532,62 +1670,19 @@ ecma_builtin_json_object (ecma_object_t *obj_p, /**< the object*/
     ecma_free_values_collection (property_keys_p, true);
   }
 
-  if (!ecma_is_value_empty (ret_value))
-  {
-    ecma_free_values_collection (partial_p, true);
-    ecma_deref_ecma_string (stepback_p);
-    return ret_value;
-  }
-
-  /* 9. */
-  if (partial_p->unit_number == 0)
-  {
-    ecma_string_t *left_brace_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LEFT_BRACE_CHAR);
-    ecma_string_t *right_brace_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_RIGHT_BRACE_CHAR);
-
-    ecma_string_t *final_str_p = ecma_concat_ecma_strings (left_brace_str_p, right_brace_str_p);
-    ret_value = ecma_make_string_value (final_str_p);
-
-    ecma_deref_ecma_string (left_brace_str_p);
-    ecma_deref_ecma_string (right_brace_str_p);
-  }
-  /* 10. */
-  else
+  if (ecma_is_value_empty (ret_value))
   {
-    bool is_gap_empty = (ecma_string_get_length (context_p->gap_str_p) == 0);
-
-    /* 10.a */
-    if (is_gap_empty)
+    /* 10.b.iii */
+    if (member_count > 0 && !is_gap_empty)
     {
-      ecma_string_t *left_brace_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LEFT_BRACE_CHAR);
-      ecma_string_t *right_brace_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_RIGHT_BRACE_CHAR);
-
-      ret_value = ecma_builtin_helper_json_create_non_formatted_json (left_brace_str_p,
-                                                                      right_brace_str_p,
-                                                                      partial_p);
-
-      ecma_deref_ecma_string (left_brace_str_p);
-      ecma_deref_ecma_string (right_brace_str_p);
+      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LF);
+      ecma_stringbuilder_append (builder_p, stepback_p);
     }
-    /* 10.b */
-    else
-    {
-      ecma_string_t *left_brace_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LEFT_BRACE_CHAR);
-      ecma_string_t *right_brace_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_RIGHT_BRACE_CHAR);
-
-      ret_value = ecma_builtin_helper_json_create_formatted_json (left_brace_str_p,
-                                                                  right_brace_str_p,
-                                                                  stepback_p,
-                                                                  partial_p,
-                                                                  context_p);
 
-      ecma_deref_ecma_string (left_brace_str_p);
-      ecma_deref_ecma_string (right_brace_str_p);
-    }
+    /* 9., 10.a.ii, 10.b.iii */
+    ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_RIGHT_BRACE);
   }
 
-  ecma_free_values_collection (partial_p, true);
-
   /* 11. */
   ecma_remove_last_value_from_values_collection (context_p->occurence_stack_p);
 
@@ -1602,15 +1697,23 @@ ecma_builtin_json_object (ecma_object_t *obj_p, /**< the object*/
 /**
  * Abstract operation 'JA' defined in 15.12.3
  *
+ * The serialized array is appended to the string builder.
+ *
+ * Note:
+ *      instead of collecting the serialized elements in the 'partial' list, the elements
+ *      are appended to the string builder one by one, with the separators of step 10
+ *
  * See also:
  *          ECMA-262 v5, 15.12.3
  *
- * @return ecma value
+ * @return empty ecma value - if the array is serialized,
+ *         error - otherwise
  *         Returned value must be freed with ecma_free_value.
  */
 static ecma_value_t
 ecma_builtin_json_array (ecma_object_t *obj_p, /**< the array object*/
-                         ecma_json_stringify_context_t *context_p) /**< context*/
+                         ecma_json_stringify_context_t *context_p, /**< context*/
+                         ecma_stringbuilder_t *builder_p) /**< string builder */
 {
   ecma_value_t obj_value = ecma_make_object_value (obj_p);
 
@@ -1631,9 +1734,6 @@ ecma_builtin_json_array (ecma_object_t *obj_p, /**< the array object*/
   /* 4. */
   context_p->indent_str_p = ecma_concat_ecma_strings (context_p->indent_str_p, context_p->gap_str_p);
 
-  /* 5. */
-  ecma_collection_header_t *partial_p = ecma_new_values_collection (NULL, 0, true);
-
   ecma_string_t *length_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
 
   /* 6. */
@@ -1646,91 +1746,66 @@ ecma_builtin_json_array (ecma_object_t *obj_p, /**< the array object*/
                                ret_value);
 
   uint32_t array_length = ecma_number_to_uint32 (array_length_num);
+  bool is_gap_empty = (ecma_string_get_length (context_p->gap_str_p) == 0);
+
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LEFT_SQUARE);
 
   /* 7. - 8. */
   for (uint32_t index = 0;
        index < array_length && ecma_is_value_empty (ret_value);
        index++)
   {
+    /* 10.a.i, 10.b.i - 10.b.ii */
+    if (index > 0)
+    {
+      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_COMMA);
+    }
+
+    if (!is_gap_empty)
+    {
+      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LF);
+      ecma_stringbuilder_append (builder_p, context_p->indent_str_p);
+    }
 
     /* 8.a */
     ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
 
     ECMA_TRY_CATCH (str_val,
-                    ecma_builtin_json_str (index_str_p, obj_p, context_p),
+                    ecma_builtin_json_str_value (index_str_p, obj_p, context_p),
                     ret_value);
 
-    /* 8.b */
-    if (ecma_is_value_undefined (str_val))
+    if (ecma_builtin_json_is_serializable (str_val))
     {
-      ecma_string_t *null_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_NULL);
-      ecma_append_to_values_collection (partial_p, ecma_make_string_value (null_str_p), true);
-      ecma_deref_ecma_string (null_str_p);
+      ret_value = ecma_builtin_json_str (str_val, context_p, builder_p);
     }
-    /* 8.c */
     else
     {
-      ecma_append_to_values_collection (partial_p, str_val, true);
+      /* 8.b */
+      ecma_stringbuilder_append_magic (builder_p, LIT_MAGIC_STRING_NULL);
     }
 
     ECMA_FINALIZE (str_val);
+
     ecma_deref_ecma_string (index_str_p);
   }
 
   if (ecma_is_value_empty (ret_value))
   {
-    /* 9. */
-    if (partial_p->unit_number == 0)
+    /* 10.b.iii */
+    if (array_length > 0 && !is_gap_empty)
     {
-      ecma_string_t *left_square_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LEFT_SQUARE_CHAR);
-      ecma_string_t *right_square_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_RIGHT_SQUARE_CHAR);
-
-      ecma_string_t *final_str_p = ecma_concat_ecma_strings (left_square_str_p, right_square_str_p);
-      ret_value = ecma_make_string_value (final_str_p);
-
-      ecma_deref_ecma_string (left_square_str_p);
-      ecma_deref_ecma_string (right_square_str_p);
+      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LF);
+      ecma_stringbuilder_append (builder_p, stepback_p);
     }
-    /* 10. */
-    else
-    {
-      bool is_gap_empty = (ecma_string_get_length (context_p->gap_str_p) == 0);
-      /* 10.a */
-      if (is_gap_empty)
-      {
-        ecma_string_t *left_square_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LEFT_SQUARE_CHAR);
-        ecma_string_t *right_square_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_RIGHT_SQUARE_CHAR);
-
-        ret_value = ecma_builtin_helper_json_create_non_formatted_json (left_square_str_p,
-                                                                        right_square_str_p,
-                                                                        partial_p);
-
-        ecma_deref_ecma_string (left_square_str_p);
-        ecma_deref_ecma_string (right_square_str_p);
-      }
-      /* 10.b */
-      else
-      {
-        ecma_string_t *left_square_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LEFT_SQUARE_CHAR);
-        ecma_string_t *right_square_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_RIGHT_SQUARE_CHAR);
-
-        ret_value = ecma_builtin_helper_json_create_formatted_json (left_square_str_p,
-                                                                    right_square_str_p,
-                                                                    stepback_p,
-                                                                    partial_p,
-                                                                    context_p);
 
-        ecma_deref_ecma_string (left_square_str_p);
-        ecma_deref_ecma_string (right_square_str_p);
-      }
-    }
+    /* 9., 10.a.ii, 10.b.iii */
+    ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_RIGHT_SQUARE);
   }
 
   ECMA_OP_TO_NUMBER_FINALIZE (array_length_num);
   ECMA_FINALIZE (array_length);
 
   ecma_deref_ecma_string (length_str_p);
-  ecma_free_values_collection (partial_p, true);
 
   /* 11. */
   ecma_remove_last_value_from_values_collection (context_p->occurence_stack_p);
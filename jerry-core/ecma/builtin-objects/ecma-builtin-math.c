@@ -65,11 +65,7 @@ ecma_builtin_math_object_abs (ecma_value_t this_arg __attr_unused___, /**< 'this
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (fabs (arg_num));
-
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (fabs (arg_num)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
 
@@ -93,10 +89,7 @@ ecma_builtin_math_object_acos (ecma_value_t this_arg __attr_unused___, /**< 'thi
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (acos (arg_num));
-
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (acos (arg_num)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
   return ret_value;
@@ -119,10 +112,7 @@ ecma_builtin_math_object_asin (ecma_value_t this_arg __attr_unused___, /**< 'thi
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (asin (arg_num));
-
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (asin (arg_num)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
   return ret_value;
@@ -145,10 +135,7 @@ ecma_builtin_math_object_atan (ecma_value_t this_arg __attr_unused___, /**< 'thi
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (atan (arg_num));
-
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (atan (arg_num)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
   return ret_value;
@@ -173,10 +160,7 @@ ecma_builtin_math_object_atan2 (ecma_value_t this_arg __attr_unused___, /**< 'th
   ECMA_OP_TO_NUMBER_TRY_CATCH (x, arg1, ret_value);
   ECMA_OP_TO_NUMBER_TRY_CATCH (y, arg2, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (atan2 (x, y));
-
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (atan2 (x, y)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (y);
   ECMA_OP_TO_NUMBER_FINALIZE (x);
@@ -200,9 +184,7 @@ ecma_builtin_math_object_ceil (ecma_value_t this_arg __attr_unused___, /**< 'thi
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (ceil (arg_num));
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (ceil (arg_num)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
   return ret_value;
@@ -225,9 +207,7 @@ ecma_builtin_math_object_cos (ecma_value_t this_arg __attr_unused___, /**< 'this
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (cos (arg_num));
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (cos (arg_num)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
   return ret_value;
@@ -250,11 +230,7 @@ ecma_builtin_math_object_exp (ecma_value_t this_arg __attr_unused___, /**< 'this
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (exp (arg_num));
-
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (exp (arg_num)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
 
@@ -278,9 +254,7 @@ ecma_builtin_math_object_floor (ecma_value_t this_arg __attr_unused___, /**< 'th
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (floor (arg_num));
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (floor (arg_num)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
   return ret_value;
@@ -303,11 +277,7 @@ ecma_builtin_math_object_log (ecma_value_t this_arg __attr_unused___, /**< 'this
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (log (arg_num));
-
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (log (arg_num)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
 
@@ -388,9 +358,7 @@ ecma_builtin_math_object_max (ecma_value_t this_arg __attr_unused___, /**< 'this
 
   if (ecma_is_value_empty (ret_value))
   {
-    ecma_number_t *num_p = ecma_alloc_number ();
-    *num_p = ret_num;
-    ret_value = ecma_make_number_value (num_p);
+    ret_value = ecma_make_number_value (ret_num);
   }
 
   return ret_value;
@@ -470,9 +438,7 @@ ecma_builtin_math_object_min (ecma_value_t this_arg __attr_unused___, /**< 'this
 
   if (ecma_is_value_empty (ret_value))
   {
-    ecma_number_t *num_p = ecma_alloc_number ();
-    *num_p = ret_num;
-    ret_value = ecma_make_number_value (num_p);
+    ret_value = ecma_make_number_value (ret_num);
   }
 
   return ret_value;
@@ -497,9 +463,7 @@ ecma_builtin_math_object_pow (ecma_value_t this_arg __attr_unused___, /**< 'this
   ECMA_OP_TO_NUMBER_TRY_CATCH (x, arg1, ret_value);
   ECMA_OP_TO_NUMBER_TRY_CATCH (y, arg2, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (pow (x, y));
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (pow (x, y)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (y);
   ECMA_OP_TO_NUMBER_FINALIZE (x);
@@ -540,10 +504,7 @@ ecma_builtin_math_object_random (ecma_value_t this_arg __attr_unused___) /**< 't
   rand /= (ecma_number_t) max_uint32;
   rand *= (ecma_number_t) (max_uint32 - 1) / (ecma_number_t) max_uint32;
 
-  ecma_number_t *rand_p = ecma_alloc_number ();
-  *rand_p = rand;
-
-  return ecma_make_number_value (rand_p);
+  return ecma_make_number_value (rand);
 } /* ecma_builtin_math_object_random */
 
 /**
@@ -563,18 +524,18 @@ ecma_builtin_math_object_round (ecma_value_t this_arg __attr_unused___, /**< 'th
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
+  ecma_number_t num;
 
   if (ecma_number_is_nan (arg_num)
       || ecma_number_is_zero (arg_num)
       || ecma_number_is_infinity (arg_num))
   {
-    *num_p = arg_num;
+    num = arg_num;
   }
   else if (ecma_number_is_negative (arg_num)
            && arg_num >= -ECMA_NUMBER_HALF)
   {
-    *num_p = ecma_number_negate (ECMA_NUMBER_ZERO);
+    num = ecma_number_negate (ECMA_NUMBER_ZERO);
   }
   else
   {
@@ -585,15 +546,15 @@ ecma_builtin_math_object_round (ecma_value_t this_arg __attr_unused___, /**< 'th
 
     if (up_rounded - arg_num <= arg_num - down_rounded)
     {
-      *num_p = up_rounded;
+      num = up_rounded;
     }
     else
     {
-      *num_p = down_rounded;
+      num = down_rounded;
     }
   }
 
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (num);
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
 
@@ -617,9 +578,7 @@ ecma_builtin_math_object_sin (ecma_value_t this_arg __attr_unused___, /**< 'this
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (sin (arg_num));
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (sin (arg_num)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
   return ret_value;
@@ -642,9 +601,7 @@ ecma_builtin_math_object_sqrt (ecma_value_t this_arg __attr_unused___, /**< 'thi
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (sqrt (arg_num));
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (sqrt (arg_num)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
   return ret_value;
@@ -667,10 +624,7 @@ ecma_builtin_math_object_tan (ecma_value_t this_arg __attr_unused___, /**< 'this
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg, ret_value);
 
-  ecma_number_t *num_p = ecma_alloc_number ();
-  *num_p = DOUBLE_TO_ECMA_NUMBER_T (tan (arg_num));
-
-  ret_value = ecma_make_number_value (num_p);
+  ret_value = ecma_make_number_value (DOUBLE_TO_ECMA_NUMBER_T (tan (arg_num)));
 
   ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
   return ret_value;
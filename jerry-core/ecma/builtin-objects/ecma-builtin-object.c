@@ -199,16 +199,14 @@ ecma_builtin_object_object_seal (ecma_value_t this_arg __attr_unused___, /**< 't
            && ecma_is_value_empty (ret_value))
     {
       ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
-      ecma_property_t *property_p = ecma_op_object_get_own_property (obj_p, property_name_p);
 
       // 2.a
-      ecma_property_descriptor_t prop_desc = ecma_get_property_descriptor_from_property (property_p);
+      ecma_property_descriptor_t prop_desc;
+      bool is_found = ecma_op_object_get_own_property_descriptor (obj_p, property_name_p, &prop_desc);
+      JERRY_ASSERT (is_found);
 
       // 2.b
-      if (ecma_is_property_configurable (property_p))
-      {
-        prop_desc.is_configurable = false;
-      }
+      prop_desc.is_configurable = false;
 
       // 2.c
       ECMA_TRY_CATCH (define_own_prop_ret,
@@ -272,22 +270,20 @@ ecma_builtin_object_object_freeze (ecma_value_t this_arg __attr_unused___, /**<
            && ecma_is_value_empty (ret_value))
     {
       ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
-      ecma_property_t *property_p = ecma_op_object_get_own_property (obj_p, property_name_p);
 
       // 2.a
-      ecma_property_descriptor_t prop_desc = ecma_get_property_descriptor_from_property (property_p);
+      ecma_property_descriptor_t prop_desc;
+      bool is_found = ecma_op_object_get_own_property_descriptor (obj_p, property_name_p, &prop_desc);
+      JERRY_ASSERT (is_found);
 
       // 2.b
-      if ((property_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA) && ecma_is_property_writable (property_p))
+      if (prop_desc.is_writable_defined)
       {
         prop_desc.is_writable = false;
       }
 
       // 2.c
-      if (ecma_is_property_configurable (property_p))
-      {
-        prop_desc.is_configurable = false;
-      }
+      prop_desc.is_configurable = false;
 
       // 2.d
       ECMA_TRY_CATCH (define_own_prop_ret,
@@ -393,10 +389,15 @@ ecma_builtin_object_object_is_sealed (ecma_value_t this_arg __attr_unused___, /*
         ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
 
         // 2.a
-        ecma_property_t *property_p = ecma_op_object_get_own_property (obj_p, property_name_p);
+        ecma_property_descriptor_t prop_desc;
+        bool is_found = ecma_op_object_get_own_property_descriptor (obj_p, property_name_p, &prop_desc);
+        JERRY_ASSERT (is_found);
+
+        bool is_configurable = prop_desc.is_configurable;
+        ecma_free_property_descriptor (&prop_desc);
 
         // 2.b
-        if (ecma_is_property_configurable (property_p))
+        if (is_configurable)
         {
           is_sealed = false;
           break;
@@ -460,19 +461,23 @@ ecma_builtin_object_object_is_frozen (ecma_value_t this_arg __attr_unused___, /*
         ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
 
         // 2.a
-        ecma_property_t *property_p = ecma_op_object_get_own_property (obj_p, property_name_p);
+        ecma_property_descriptor_t prop_desc;
+        bool is_found = ecma_op_object_get_own_property_descriptor (obj_p, property_name_p, &prop_desc);
+        JERRY_ASSERT (is_found);
 
-        JERRY_ASSERT (property_p->flags & (ECMA_PROPERTY_FLAG_NAMEDDATA | ECMA_PROPERTY_FLAG_NAMEDACCESSOR));
+        bool is_writable = prop_desc.is_writable_defined && prop_desc.is_writable;
+        bool is_configurable = prop_desc.is_configurable;
+        ecma_free_property_descriptor (&prop_desc);
 
         // 2.b
-        if ((property_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA) && ecma_is_property_writable (property_p))
+        if (is_writable)
         {
           is_frozen = false;
           break;
         }
 
         // 2.c
-        if (ecma_is_property_configurable (property_p))
+        if (is_configurable)
         {
           is_frozen = false;
           break;
@@ -585,12 +590,10 @@ ecma_builtin_object_object_get_own_property_descriptor (ecma_value_t this_arg __
   ecma_string_t *name_str_p = ecma_get_string_from_value (name_str_value);
 
   // 3.
-  ecma_property_t *prop_p = ecma_op_object_get_own_property (obj_p, name_str_p);
+  ecma_property_descriptor_t prop_desc;
 
-  if (prop_p != NULL)
+  if (ecma_op_object_get_own_property_descriptor (obj_p, name_str_p, &prop_desc))
   {
-    ecma_property_descriptor_t prop_desc = ecma_get_property_descriptor_from_property (prop_p);
-
     // 4.
     ecma_object_t *desc_obj_p = ecma_op_from_property_descriptor (&prop_desc);
 
@@ -194,13 +194,13 @@ ecma_builtin_string_prototype_object_char_code_at (ecma_value_t this_arg, /**< t
   ecma_string_t *original_string_p = ecma_get_string_from_value (to_string_val);
   const ecma_length_t len = ecma_string_get_length (original_string_p);
 
-  ecma_number_t *ret_num_p = ecma_alloc_number ();
+  ecma_number_t ret_num;
 
   /* 5 */
   // When index_num is NaN, then the first two comparisons are false
   if (index_num < 0 || index_num >= len || (ecma_number_is_nan (index_num) && !len))
   {
-    *ret_num_p = ecma_number_make_nan ();
+    ret_num = ecma_number_make_nan ();
   }
   else
   {
@@ -214,11 +214,10 @@ ecma_builtin_string_prototype_object_char_code_at (ecma_value_t this_arg, /**< t
     JERRY_ASSERT (ecma_number_is_nan (index_num) || ecma_number_to_uint32 (index_num) == ecma_number_trunc (index_num));
 
     ecma_char_t new_ecma_char = ecma_string_get_char_at_pos (original_string_p, ecma_number_to_uint32 (index_num));
-    *ret_num_p = ((ecma_number_t) new_ecma_char);
+    ret_num = ((ecma_number_t) new_ecma_char);
   }
 
-  ecma_value_t new_value = ecma_make_number_value (ret_num_p);
-  ret_value = new_value;
+  ret_value = ecma_make_number_value (ret_num);
 
   ECMA_OP_TO_NUMBER_FINALIZE (index_num);
 
@@ -258,7 +257,9 @@ ecma_builtin_string_prototype_object_concat (ecma_value_t this_arg, /**< this ar
   // No copy performed
 
   /* 4 */
-  ecma_string_t *string_to_return = ecma_copy_or_ref_ecma_string (ecma_get_string_from_value (to_string_val));
+  ecma_stringbuilder_t builder;
+  ecma_stringbuilder_init (&builder);
+  ecma_stringbuilder_append (&builder, ecma_get_string_from_value (to_string_val));
 
   /* 5 */
   for (uint32_t arg_index = 0;
@@ -267,15 +268,11 @@ ecma_builtin_string_prototype_object_concat (ecma_value_t this_arg, /**< this ar
   {
     /* 5a */
     /* 5b */
-    ecma_string_t *string_temp = string_to_return;
-
     ECMA_TRY_CATCH (get_arg_string,
                     ecma_op_to_string (argument_list_p[arg_index]),
                     ret_value);
 
-    string_to_return = ecma_concat_ecma_strings (string_to_return, ecma_get_string_from_value (get_arg_string));
-
-    ecma_deref_ecma_string (string_temp);
+    ecma_stringbuilder_append (&builder, ecma_get_string_from_value (get_arg_string));
 
     ECMA_FINALIZE (get_arg_string);
   }
@@ -283,11 +280,11 @@ ecma_builtin_string_prototype_object_concat (ecma_value_t this_arg, /**< this ar
   /* 6 */
   if (ecma_is_value_empty (ret_value))
   {
-    ret_value = ecma_make_string_value (string_to_return);
+    ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
   }
   else
   {
-    ecma_deref_ecma_string (string_to_return);
+    ecma_stringbuilder_destroy (&builder);
   }
 
   ECMA_FINALIZE (to_string_val);
@@ -363,22 +360,22 @@ ecma_builtin_string_prototype_object_locale_compare (ecma_value_t this_arg, /**<
   ecma_string_t *this_string_p = ecma_get_string_from_value (this_to_string_val);
   ecma_string_t *arg_string_p = ecma_get_string_from_value (arg_to_string_val);
 
-  ecma_number_t *result_p = ecma_alloc_number ();
+  ecma_number_t result;
 
   if (ecma_compare_ecma_strings_relational (this_string_p, arg_string_p))
   {
-    *result_p = ECMA_NUMBER_MINUS_ONE;
+    result = ECMA_NUMBER_MINUS_ONE;
   }
   else if (!ecma_compare_ecma_strings (this_string_p, arg_string_p))
   {
-    *result_p = ECMA_NUMBER_ONE;
+    result = ECMA_NUMBER_ONE;
   }
   else
   {
-    *result_p = ECMA_NUMBER_ZERO;
+    result = ECMA_NUMBER_ZERO;
   }
 
-  ret_value = ecma_make_number_value (result_p);
+  ret_value = ecma_make_number_value (result);
 
   ECMA_FINALIZE (arg_to_string_val);
   ECMA_FINALIZE (this_to_string_val);
@@ -455,8 +452,7 @@ ecma_builtin_string_prototype_object_match (ecma_value_t this_arg, /**< this arg
     else
     {
       /* 8.a. */
-      ecma_number_t *zero_number_p = ecma_alloc_number ();
-      *zero_number_p = 0;
+      ecma_value_t zero_value = ecma_make_number_value (0);
 
       ecma_string_t *index_zero_string_p = ecma_new_ecma_string_from_uint32 (0);
 
@@ -465,7 +461,7 @@ ecma_builtin_string_prototype_object_match (ecma_value_t this_arg, /**< this arg
       ECMA_TRY_CATCH (put_value,
                       ecma_op_object_put (regexp_obj_p,
                                           last_index_string_p,
-                                          ecma_make_number_value (zero_number_p),
+                                          zero_value,
                                           true),
                       ret_value);
 
@@ -507,18 +503,17 @@ ecma_builtin_string_prototype_object_match (ecma_value_t this_arg, /**< this arg
                           ecma_op_to_number (this_index_value),
                           ret_value);
 
-          ecma_number_t this_index = *ecma_get_number_from_value (this_index_number);
+          ecma_number_t this_index = ecma_get_number_from_value (this_index_number);
 
           /* 8.f.iii.2. */
           if (this_index == previous_last_index)
           {
-            ecma_number_t *new_last_index_p = ecma_alloc_number ();
-            *new_last_index_p = this_index + 1;
+            ecma_value_t new_last_index_value = ecma_make_number_value (this_index + 1);
             /* 8.f.iii.2.a. */
             ECMA_TRY_CATCH (index_put_value,
                             ecma_op_object_put (regexp_obj_p,
                                                 last_index_string_p,
-                                                ecma_make_number_value (new_last_index_p),
+                                                new_last_index_value,
                                                 true),
                             ret_value);
 
@@ -527,7 +522,7 @@ ecma_builtin_string_prototype_object_match (ecma_value_t this_arg, /**< this arg
 
             ECMA_FINALIZE (index_put_value);
 
-            ecma_dealloc_number (new_last_index_p);
+            ecma_free_value (new_last_index_value);
           }
           else
           {
@@ -594,7 +589,7 @@ ecma_builtin_string_prototype_object_match (ecma_value_t this_arg, /**< this arg
 
       ecma_deref_ecma_string (last_index_string_p);
       ecma_deref_ecma_string (index_zero_string_p);
-      ecma_dealloc_number (zero_number_p);
+      ecma_free_value (zero_value);
     }
 
     ECMA_FINALIZE (global_value);
@@ -627,6 +622,7 @@ typedef struct
                                          * depending on the value of is_regexp */
   ecma_length_t match_start; /**< starting position of the match */
   ecma_length_t match_end; /**< end position of the match */
+  ecma_stringbuilder_t result_builder; /**< builder of the result string */
 
   /* Replace value callable part. */
   ecma_object_t *replace_function_p;
@@ -636,48 +632,6 @@ typedef struct
   lit_utf8_byte_t *replace_str_curr_p; /**< replace string iterator */
 } ecma_builtin_replace_search_ctx_t;
 
-/**
- * Generic helper function to append a substring at the end of a base string
- *
- * The base string can be kept or freed
- *
- * @return the constructed string
- */
-static ecma_string_t *
-ecma_builtin_string_prototype_object_replace_append_substr (ecma_string_t *base_string_p, /**< base string */
-                                                            ecma_string_t *appended_string_p, /**< appended string */
-                                                            ecma_length_t start, /**< start position */
-                                                            ecma_length_t end, /**< end position */
-                                                            bool free_base_string) /**< free base string or not */
-{
-  ecma_string_t *ret_string_p;
-
-  JERRY_ASSERT (start <= end);
-  JERRY_ASSERT (end <= ecma_string_get_length (appended_string_p));
-
-  if (start < end)
-  {
-    ecma_string_t *substring_p = ecma_string_substr (appended_string_p, start, end);
-    ret_string_p = ecma_concat_ecma_strings (base_string_p, substring_p);
-
-    ecma_deref_ecma_string (substring_p);
-    if (free_base_string)
-    {
-      ecma_deref_ecma_string (base_string_p);
-    }
-  }
-  else if (free_base_string)
-  {
-    ret_string_p = base_string_p;
-  }
-  else
-  {
-    ret_string_p = ecma_copy_or_ref_ecma_string (base_string_p);
-  }
-
-  return ret_string_p;
-} /* ecma_builtin_string_prototype_object_replace_append_substr */
-
 /**
  * Generic helper function to perform the find the next match
  *
@@ -726,12 +680,12 @@ ecma_builtin_string_prototype_object_replace_match (ecma_builtin_replace_search_
       /* We use the length of the result string to determine the
        * match end. This works regardless the global flag is set. */
       ecma_string_t *result_string_p = ecma_get_string_from_value (result_string_value);
-      ecma_number_t *index_number_p = ecma_get_number_from_value (index_value);
+      ecma_number_t index_number = ecma_get_number_from_value (index_value);
 
-      context_p->match_start = (ecma_length_t) (*index_number_p);
+      context_p->match_start = (ecma_length_t) (index_number);
       context_p->match_end = context_p->match_start + (ecma_length_t) ecma_string_get_length (result_string_p);
 
-      JERRY_ASSERT ((ecma_length_t) ecma_number_to_uint32 (*index_number_p) == context_p->match_start);
+      JERRY_ASSERT ((ecma_length_t) ecma_number_to_uint32 (index_number) == context_p->match_start);
 
       ret_value = ecma_copy_value (match_value);
 
@@ -779,9 +733,11 @@ ecma_builtin_string_prototype_object_replace_match (ecma_builtin_replace_search_
 } /* ecma_builtin_string_prototype_object_replace_match */
 
 /**
- * Generic helper function to construct the string which replaces the matched part
+ * Generic helper function to construct the string which replaces the matched part,
+ * and append it to the result string builder of the context
  *
- * @return ecma value
+ * @return empty ecma value - if the string is appended successfully
+ *         error - otherwise
  *         Returned value must be freed with ecma_free_value.
  */
 static ecma_value_t
@@ -799,10 +755,10 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
 
   JERRY_ASSERT (ecma_is_value_number (match_length_value));
 
-  ecma_number_t *match_length_number_p = ecma_get_number_from_value (match_length_value);
-  ecma_length_t match_length = (ecma_length_t) (*match_length_number_p);
+  ecma_number_t match_length_number = ecma_get_number_from_value (match_length_value);
+  ecma_length_t match_length = (ecma_length_t) (match_length_number);
 
-  JERRY_ASSERT ((ecma_length_t) ecma_number_to_uint32 (*match_length_number_p) == match_length);
+  JERRY_ASSERT ((ecma_length_t) ecma_number_to_uint32 (match_length_number) == match_length);
   JERRY_ASSERT (match_length >= 1);
 
   if (context_p->is_replace_callable)
@@ -833,10 +789,7 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
 
     if (ecma_is_value_empty (ret_value))
     {
-      ecma_number_t *index_number_p = ecma_alloc_number ();
-
-      *index_number_p = context_p->match_start;
-      arguments_list[match_length] = ecma_make_number_value (index_number_p);
+      arguments_list[match_length] = ecma_make_number_value (context_p->match_start);
       arguments_list[match_length + 1] = ecma_copy_value (context_p->input_string);
 
       ECMA_TRY_CATCH (result_value,
@@ -850,13 +803,13 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
                       ecma_op_to_string (result_value),
                       ret_value);
 
-      ret_value = ecma_copy_value (to_string_value);
+      ecma_stringbuilder_append (&context_p->result_builder, ecma_get_string_from_value (to_string_value));
 
       ECMA_FINALIZE (to_string_value);
       ECMA_FINALIZE (result_value);
 
       ecma_free_value (arguments_list[match_length + 1]);
-      ecma_dealloc_number (index_number_p);
+      ecma_free_value (arguments_list[match_length]);
     }
 
     for (ecma_length_t i = 0; i < values_copied; i++)
@@ -882,7 +835,7 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
      * example: "<xy>".replace(/(x)y/, "$1,$2,$01,$12") === "<x,$2,x,x2>"
      */
 
-    ecma_string_t *result_string_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+    ecma_stringbuilder_t *result_builder_p = &context_p->result_builder;
 
     ecma_length_t previous_start = 0;
     ecma_length_t current_position = 0;
@@ -948,11 +901,10 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
 
       if (action != LIT_CHAR_NULL)
       {
-        result_string_p = ecma_builtin_string_prototype_object_replace_append_substr (result_string_p,
-                                                                                      context_p->replace_string_p,
-                                                                                      previous_start,
-                                                                                      current_position,
-                                                                                      true);
+        ecma_stringbuilder_append_substr (result_builder_p,
+                                          context_p->replace_string_p,
+                                          previous_start,
+                                          current_position);
         replace_str_curr_p++;
 
         if (action == LIT_CHAR_DOLLAR_SIGN)
@@ -962,20 +914,15 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
         else if (action == LIT_CHAR_GRAVE_ACCENT)
         {
           ecma_string_t *input_string_p = ecma_get_string_from_value (context_p->input_string);
-          result_string_p = ecma_builtin_string_prototype_object_replace_append_substr (result_string_p,
-                                                                                        input_string_p,
-                                                                                        0,
-                                                                                        context_p->match_start,
-                                                                                        true);
+          ecma_stringbuilder_append_substr (result_builder_p, input_string_p, 0, context_p->match_start);
         }
         else if (action == LIT_CHAR_SINGLE_QUOTE)
         {
           ecma_string_t *input_string_p = ecma_get_string_from_value (context_p->input_string);
-          result_string_p = ecma_builtin_string_prototype_object_replace_append_substr (result_string_p,
-                                                                                        input_string_p,
-                                                                                        context_p->match_end,
-                                                                                        context_p->input_length,
-                                                                                        true);
+          ecma_stringbuilder_append_substr (result_builder_p,
+                                            input_string_p,
+                                            context_p->match_end,
+                                            context_p->input_length);
         }
         else
         {
@@ -1017,11 +964,7 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
           if (!ecma_is_value_undefined (submatch_value))
           {
             JERRY_ASSERT (ecma_is_value_string (submatch_value));
-            ecma_string_t *submatch_string_p = ecma_get_string_from_value (submatch_value);
-
-            ecma_string_t *appended_string_p = ecma_concat_ecma_strings (result_string_p, submatch_string_p);
-            ecma_deref_ecma_string (result_string_p);
-            result_string_p = appended_string_p;
+            ecma_stringbuilder_append (result_builder_p, ecma_get_string_from_value (submatch_value));
           }
 
           ECMA_FINALIZE (submatch_value);
@@ -1042,13 +985,10 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
 
     if (ecma_is_value_empty (ret_value))
     {
-      result_string_p = ecma_builtin_string_prototype_object_replace_append_substr (result_string_p,
-                                                                                    context_p->replace_string_p,
-                                                                                    previous_start,
-                                                                                    current_position,
-                                                                                    true);
-
-      ret_value = ecma_make_string_value (result_string_p);
+      ecma_stringbuilder_append_substr (result_builder_p,
+                                        context_p->replace_string_p,
+                                        previous_start,
+                                        current_position);
     }
   }
 
@@ -1072,9 +1012,10 @@ ecma_builtin_string_prototype_object_replace_loop (ecma_builtin_replace_search_c
   ecma_length_t previous_start = 0;
   bool continue_match = true;
 
-  ecma_string_t *result_string_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
   ecma_string_t *input_string_p = ecma_get_string_from_value (context_p->input_string);
 
+  ecma_stringbuilder_init (&context_p->result_builder);
+
   while (continue_match)
   {
     continue_match = false;
@@ -1084,25 +1025,12 @@ ecma_builtin_string_prototype_object_replace_loop (ecma_builtin_replace_search_c
 
     if (!ecma_is_value_null (match_value))
     {
-      result_string_p = ecma_builtin_string_prototype_object_replace_append_substr (result_string_p,
-                                                                                    input_string_p,
-                                                                                    previous_start,
-                                                                                    context_p->match_start,
-                                                                                    true);
-
-      ECMA_TRY_CATCH (string_value,
-                      ecma_builtin_string_prototype_object_replace_get_string (context_p, match_value),
-                      ret_value);
-
-      JERRY_ASSERT (ecma_is_value_string (string_value));
-
-      ecma_string_t *appended_string_p = ecma_concat_ecma_strings (result_string_p,
-                                                                   ecma_get_string_from_value (string_value));
+      ecma_stringbuilder_append_substr (&context_p->result_builder,
+                                        input_string_p,
+                                        previous_start,
+                                        context_p->match_start);
 
-      ecma_deref_ecma_string (result_string_p);
-      result_string_p = appended_string_p;
-
-      ECMA_FINALIZE (string_value);
+      ret_value = ecma_builtin_string_prototype_object_replace_get_string (context_p, match_value);
 
       previous_start = context_p->match_end;
 
@@ -1121,19 +1049,17 @@ ecma_builtin_string_prototype_object_replace_loop (ecma_builtin_replace_search_c
         {
           ecma_string_t *last_index_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LASTINDEX_UL);
           ecma_object_t *regexp_obj_p = ecma_get_object_from_value (context_p->regexp_or_search_string);
-          ecma_number_t *zero_number_p = ecma_alloc_number ();
-
-          *zero_number_p = context_p->match_end + 1;
+          ecma_value_t last_index_value = ecma_make_number_value (context_p->match_end + 1);
 
           ECMA_TRY_CATCH (put_value,
                           ecma_op_object_put (regexp_obj_p,
                                               last_index_string_p,
-                                              ecma_make_number_value (zero_number_p),
+                                              last_index_value,
                                               true),
                           ret_value);
 
           ECMA_FINALIZE (put_value);
-          ecma_dealloc_number (zero_number_p);
+          ecma_free_value (last_index_value);
           ecma_deref_ecma_string (last_index_string_p);
         }
       }
@@ -1144,14 +1070,12 @@ ecma_builtin_string_prototype_object_replace_loop (ecma_builtin_replace_search_c
       if (!context_p->is_global || ecma_is_value_null (match_value))
       {
         /* No more matches */
-        ecma_string_t *appended_string_p;
-        appended_string_p = ecma_builtin_string_prototype_object_replace_append_substr (result_string_p,
-                                                                                        input_string_p,
-                                                                                        previous_start,
-                                                                                        context_p->input_length,
-                                                                                        false);
-
-        ret_value = ecma_make_string_value (appended_string_p);
+        ecma_stringbuilder_append_substr (&context_p->result_builder,
+                                          input_string_p,
+                                          previous_start,
+                                          context_p->input_length);
+
+        ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&context_p->result_builder));
       }
       else
       {
@@ -1162,7 +1086,11 @@ ecma_builtin_string_prototype_object_replace_loop (ecma_builtin_replace_search_c
     ECMA_FINALIZE (match_value);
   }
 
-  ecma_deref_ecma_string (result_string_p);
+  if (ecma_is_value_error (ret_value))
+  {
+    ecma_stringbuilder_destroy (&context_p->result_builder);
+  }
+
   return ret_value;
 } /* ecma_builtin_string_prototype_object_replace_loop */
 
@@ -1245,7 +1173,7 @@ ecma_builtin_string_prototype_object_replace_main (ecma_builtin_replace_search_c
  *          which computes the replacement string
  *
  *  The final string is created from several string fragments appended
- *  together by ecma_builtin_string_prototype_object_replace_append_substr.
+ *  to the result string builder of the context.
  *
  * See also:
  *          ECMA-262 v5, 15.5.4.11
@@ -1293,18 +1221,17 @@ ecma_builtin_string_prototype_object_replace (ecma_value_t this_arg, /**< this a
     if (context.is_global)
     {
       ecma_string_t *last_index_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LASTINDEX_UL);
-      ecma_number_t *zero_number_p = ecma_alloc_number ();
-      *zero_number_p = 0;
+      ecma_value_t zero_value = ecma_make_number_value (0);
 
       ECMA_TRY_CATCH (put_value,
                       ecma_op_object_put (regexp_obj_p,
                                           last_index_string_p,
-                                          ecma_make_number_value (zero_number_p),
+                                          zero_value,
                                           true),
                       ret_value);
 
       ECMA_FINALIZE (put_value);
-      ecma_dealloc_number (zero_number_p);
+      ecma_free_value (zero_value);
       ecma_deref_ecma_string (last_index_string_p);
     }
 
@@ -1408,7 +1335,7 @@ ecma_builtin_string_prototype_object_search (ecma_value_t this_arg, /**< this ar
 
       JERRY_ASSERT (ecma_is_value_number (index_value));
 
-      offset = *ecma_get_number_from_value (index_value);
+      offset = ecma_get_number_from_value (index_value);
 
       ECMA_FINALIZE (index_value);
       ecma_deref_ecma_string (index_string_p);
@@ -1416,10 +1343,7 @@ ecma_builtin_string_prototype_object_search (ecma_value_t this_arg, /**< this ar
 
     if (ecma_is_value_empty (ret_value))
     {
-      ecma_number_t *offset_number_p = ecma_alloc_number ();
-      *offset_number_p = offset;
-
-      ret_value = ecma_make_number_value (offset_number_p);
+      ret_value = ecma_make_number_value (offset);
     }
 
     ECMA_FINALIZE (match_result);
@@ -1553,8 +1477,11 @@ ecma_builtin_helper_split_match (ecma_value_t input_string, /**< first argument
       ecma_string_t *magic_index_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_INDEX);
       ecma_property_t *index_prop_p = ecma_get_named_property (obj_p, magic_index_str_p);
 
-      ecma_number_t *index_num_p = ecma_get_number_from_value (ecma_get_named_data_property_value (index_prop_p));
-      *index_num_p += start_idx;
+      ecma_number_t index_num = ecma_get_number_from_value (ecma_get_named_data_property_value (index_prop_p));
+      ecma_value_t index_value = ecma_make_number_value (index_num + start_idx);
+
+      ecma_named_data_property_assign_value (obj_p, index_prop_p, index_value);
+      ecma_free_value (index_value);
 
       ecma_deref_ecma_string (magic_index_str_p);
     }
@@ -1610,14 +1537,12 @@ ecma_builtin_helper_split_match (ecma_value_t input_string, /**< first argument
                                                                          true, false, false);
         ecma_deref_ecma_string (magic_index_str_p);
 
-        ecma_number_t *index_num_p = ecma_alloc_number ();
-        *index_num_p = ((ecma_number_t) start_idx);
-
-        ecma_named_data_property_assign_value (match_array_p, index_prop_p, ecma_make_number_value (index_num_p));
+        ecma_value_t index_value = ecma_make_uint32_value (start_idx);
+        ecma_named_data_property_assign_value (match_array_p, index_prop_p, index_value);
+        ecma_free_value (index_value);
 
         ret_value = match_array;
 
-        ecma_dealloc_number (index_num_p);
         ecma_deref_ecma_string (zero_str_p);
       }
       else
@@ -1816,10 +1741,10 @@ ecma_builtin_string_prototype_object_split (ecma_value_t this_arg, /**< this arg
               ecma_property_t *index_prop_p = ecma_get_named_property (match_array_obj_p, magic_index_str_p);
 
               ecma_value_t index_value = ecma_get_named_data_property_value (index_prop_p);
-              ecma_number_t *index_num_p = ecma_get_number_from_value (index_value);
-              JERRY_ASSERT (*index_num_p >= 0);
+              ecma_number_t index_num = ecma_get_number_from_value (index_value);
+              JERRY_ASSERT (index_num >= 0);
 
-              uint32_t end_pos = ecma_number_to_uint32 (*index_num_p);
+              uint32_t end_pos = ecma_number_to_uint32 (index_num);
 
               if (separator_is_empty)
               {
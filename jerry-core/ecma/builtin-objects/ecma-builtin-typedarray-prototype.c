@@ -0,0 +1,395 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-arraybuffer-object.h"
+#include "ecma-builtin-helpers.h"
+#include "ecma-builtins.h"
+#include "ecma-conversion.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jrt.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-typedarray-prototype.inc.h"
+#define BUILTIN_UNDERSCORED_ID typedarray_prototype
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup typedarrayprototype ECMA %TypedArrayPrototype% object built-in
+ * @{
+ */
+
+/**
+ * Get description of the typed array, passed as 'this' argument
+ *
+ * @return pointer to the description - if the value is a typed array,
+ *         NULL - otherwise
+ */
+static ecma_arraybuffer_view_t *
+ecma_builtin_typedarray_prototype_get_this_view (ecma_value_t this_arg) /**< this argument */
+{
+  if (!ecma_is_value_object (this_arg))
+  {
+    return NULL;
+  }
+
+  return ecma_op_typedarray_get (ecma_get_object_from_value (this_arg));
+} /* ecma_builtin_typedarray_prototype_get_this_view */
+
+/**
+ * The %TypedArrayPrototype% object's 'buffer' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_buffer_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_builtin_typedarray_prototype_get_this_view (this_arg);
+
+  if (view_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Argument 'this' is not a typed array."));
+  }
+
+  ecma_object_t *arraybuffer_obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, view_p->arraybuffer_cp);
+  ecma_ref_object (arraybuffer_obj_p);
+
+  return ecma_make_object_value (arraybuffer_obj_p);
+} /* ecma_builtin_typedarray_prototype_buffer_getter */
+
+/**
+ * The %TypedArrayPrototype% object's 'byteLength' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.2
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_byte_length_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_builtin_typedarray_prototype_get_this_view (this_arg);
+
+  if (view_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Argument 'this' is not a typed array."));
+  }
+
+  uint32_t element_size = ecma_op_typedarray_element_size ((ecma_arraybuffer_view_type_t) view_p->type);
+
+  return ecma_make_number_value ((ecma_number_t) view_p->length * element_size);
+} /* ecma_builtin_typedarray_prototype_byte_length_getter */
+
+/**
+ * The %TypedArrayPrototype% object's 'byteOffset' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.3
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_byte_offset_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_builtin_typedarray_prototype_get_this_view (this_arg);
+
+  if (view_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Argument 'this' is not a typed array."));
+  }
+
+  return ecma_make_number_value ((ecma_number_t) view_p->byte_offset);
+} /* ecma_builtin_typedarray_prototype_byte_offset_getter */
+
+/**
+ * The %TypedArrayPrototype% object's 'length' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.17
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_length_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_builtin_typedarray_prototype_get_this_view (this_arg);
+
+  if (view_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Argument 'this' is not a typed array."));
+  }
+
+  return ecma_make_number_value ((ecma_number_t) view_p->length);
+} /* ecma_builtin_typedarray_prototype_length_getter */
+
+/**
+ * Copy elements of a typed array to the target typed array
+ *
+ * Note:
+ *      the arrays could share the backing store, so the source elements are copied
+ *      to a temporary buffer in the case
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.22.2
+ *
+ * @return ecma value - undefined, if the elements are copied,
+ *                      RangeError, if the temporary buffer can't be allocated
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_set_from_typedarray (ecma_arraybuffer_view_t *target_view_p, /**< target */
+                                                       uint32_t target_offset, /**< index of the first element
+                                                                                *   to store */
+                                                       ecma_arraybuffer_view_t *source_view_p) /**< source */
+{
+  ecma_arraybuffer_view_type_t target_type = (ecma_arraybuffer_view_type_t) target_view_p->type;
+  ecma_arraybuffer_view_type_t source_type = (ecma_arraybuffer_view_type_t) source_view_p->type;
+  uint32_t target_element_size = ecma_op_typedarray_element_size (target_type);
+  uint32_t source_element_size = ecma_op_typedarray_element_size (source_type);
+
+  uint8_t *target_p = (ecma_op_arraybuffer_view_get_arraybuffer (target_view_p)->buffer_p
+                       + target_view_p->byte_offset
+                       + target_offset * target_element_size);
+  uint8_t *source_p = (ecma_op_arraybuffer_view_get_arraybuffer (source_view_p)->buffer_p
+                       + source_view_p->byte_offset);
+  uint32_t source_byte_length = source_view_p->length * source_element_size;
+  uint8_t *copy_p = NULL;
+
+  if (source_byte_length == 0)
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  if (target_view_p->store_cp == source_view_p->store_cp)
+  {
+    copy_p = (uint8_t *) mem_heap_alloc_block_null_on_error (source_byte_length);
+
+    if (copy_p == NULL)
+    {
+      return ecma_raise_range_error (ECMA_ERR_MSG ("Not enough memory to copy the typed array."));
+    }
+
+    memcpy (copy_p, source_p, source_byte_length);
+    source_p = copy_p;
+  }
+
+  for (uint32_t index = 0; index < source_view_p->length; index++)
+  {
+    ecma_number_t num = ecma_op_typedarray_read (source_type, source_p + index * source_element_size);
+    ecma_op_typedarray_write (target_type, target_p + index * target_element_size, num);
+  }
+
+  if (copy_p != NULL)
+  {
+    mem_heap_free_block (copy_p, source_byte_length);
+  }
+
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+} /* ecma_builtin_typedarray_prototype_set_from_typedarray */
+
+/**
+ * The %TypedArrayPrototype% object's 'set' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.22
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_object_set (ecma_value_t this_arg, /**< this argument */
+                                              ecma_value_t arg1, /**< array or typed array */
+                                              ecma_value_t arg2) /**< offset */
+{
+  ecma_arraybuffer_view_t *target_view_p = ecma_builtin_typedarray_prototype_get_this_view (this_arg);
+
+  if (target_view_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Argument 'this' is not a typed array."));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t target_offset = 0;
+
+  ECMA_TRY_CATCH (offset_empty_value,
+                  ecma_op_to_byte_length (arg2, &target_offset),
+                  ret_value);
+
+  ECMA_TRY_CATCH (source_obj_value,
+                  ecma_op_to_object (arg1),
+                  ret_value);
+
+  ecma_object_t *source_obj_p = ecma_get_object_from_value (source_obj_value);
+  ecma_arraybuffer_view_t *source_view_p = ecma_op_typedarray_get (source_obj_p);
+
+  if (source_view_p != NULL)
+  {
+    if (target_offset > target_view_p->length
+        || source_view_p->length > target_view_p->length - target_offset)
+    {
+      ret_value = ecma_raise_range_error (ECMA_ERR_MSG ("Source is too large."));
+    }
+    else
+    {
+      ret_value = ecma_builtin_typedarray_prototype_set_from_typedarray (target_view_p,
+                                                                         target_offset,
+                                                                         source_view_p);
+    }
+  }
+  else
+  {
+    ecma_string_t *length_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+
+    ECMA_TRY_CATCH (length_value,
+                    ecma_op_object_get (source_obj_p, length_str_p),
+                    ret_value);
+
+    ECMA_OP_TO_NUMBER_TRY_CATCH (length_num, length_value, ret_value);
+
+    uint32_t source_length = ecma_number_to_uint32 (length_num);
+
+    if (target_offset > target_view_p->length
+        || source_length > target_view_p->length - target_offset)
+    {
+      ret_value = ecma_raise_range_error (ECMA_ERR_MSG ("Source is too large."));
+    }
+
+    ecma_object_t *target_obj_p = ecma_get_object_from_value (this_arg);
+
+    for (uint32_t index = 0; index < source_length && ecma_is_value_empty (ret_value); index++)
+    {
+      ecma_string_t *source_index_str_p = ecma_new_ecma_string_from_uint32 (index);
+      ecma_string_t *target_index_str_p = ecma_new_ecma_string_from_uint32 (target_offset + index);
+
+      ECMA_TRY_CATCH (element_value,
+                      ecma_op_object_get (source_obj_p, source_index_str_p),
+                      ret_value);
+
+      ECMA_TRY_CATCH (put_value,
+                      ecma_op_typedarray_put_element (target_obj_p, target_index_str_p, element_value),
+                      ret_value);
+
+      ECMA_FINALIZE (put_value);
+      ECMA_FINALIZE (element_value);
+
+      ecma_deref_ecma_string (target_index_str_p);
+      ecma_deref_ecma_string (source_index_str_p);
+    }
+
+    if (ecma_is_value_empty (ret_value))
+    {
+      ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
+
+    ECMA_OP_TO_NUMBER_FINALIZE (length_num);
+    ECMA_FINALIZE (length_value);
+
+    ecma_deref_ecma_string (length_str_p);
+  }
+
+  ECMA_FINALIZE (source_obj_value);
+  ECMA_FINALIZE (offset_empty_value);
+
+  return ret_value;
+} /* ecma_builtin_typedarray_prototype_object_set */
+
+/**
+ * The %TypedArrayPrototype% object's 'subarray' routine
+ *
+ * Note:
+ *      the new typed array views the same ArrayBuffer
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.26
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_object_subarray (ecma_value_t this_arg, /**< this argument */
+                                                   ecma_value_t arg1, /**< begin */
+                                                   ecma_value_t arg2) /**< end */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_builtin_typedarray_prototype_get_this_view (this_arg);
+
+  if (view_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Argument 'this' is not a typed array."));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t length = view_p->length;
+  uint32_t begin = 0;
+  uint32_t end = length;
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (begin_num, arg1, ret_value);
+
+  begin = ecma_builtin_helper_array_index_normalize (begin_num, length);
+
+  if (!ecma_is_value_undefined (arg2))
+  {
+    ECMA_OP_TO_NUMBER_TRY_CATCH (end_num, arg2, ret_value);
+
+    end = ecma_builtin_helper_array_index_normalize (end_num, length);
+
+    ECMA_OP_TO_NUMBER_FINALIZE (end_num);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (begin_num);
+
+  if (ecma_is_value_empty (ret_value))
+  {
+    ecma_arraybuffer_view_type_t type = (ecma_arraybuffer_view_type_t) view_p->type;
+    ecma_object_t *arraybuffer_obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, view_p->arraybuffer_cp);
+    uint32_t byte_offset = view_p->byte_offset + begin * ecma_op_typedarray_element_size (type);
+
+    ecma_object_t *new_view_obj_p = ecma_op_create_arraybuffer_view (arraybuffer_obj_p,
+                                                                     type,
+                                                                     byte_offset,
+                                                                     (end > begin) ? (end - begin) : 0);
+    ret_value = ecma_make_object_value (new_view_obj_p);
+  }
+
+  return ret_value;
+} /* ecma_builtin_typedarray_prototype_object_subarray */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
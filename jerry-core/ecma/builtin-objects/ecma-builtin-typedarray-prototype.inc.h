@@ -0,0 +1,74 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * %TypedArrayPrototype% built-in description
+ */
+
+#ifndef OBJECT_ID
+# define OBJECT_ID(builtin_object_id)
+#endif /* !OBJECT_ID */
+
+#ifndef ROUTINE
+# define ROUTINE(name, c_function_name, args_number, length_prop_value)
+#endif /* !ROUTINE */
+
+#ifndef ACCESSOR_READ_ONLY
+# define ACCESSOR_READ_ONLY(name, c_getter_func_name, prop_enumerable, prop_configurable)
+#endif /* !ACCESSOR_READ_ONLY */
+
+/* Object identifier */
+OBJECT_ID (ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE)
+
+/* Accessor properties:
+ *  (property name, C getter routine name, enumerable, configurable) */
+
+// ECMA-262 v6, 22.2.3.1
+ACCESSOR_READ_ONLY (LIT_MAGIC_STRING_BUFFER,
+                    ecma_builtin_typedarray_prototype_buffer_getter,
+                    ECMA_PROPERTY_NOT_ENUMERABLE,
+                    ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.3.2
+ACCESSOR_READ_ONLY (LIT_MAGIC_STRING_BYTE_LENGTH_UL,
+                    ecma_builtin_typedarray_prototype_byte_length_getter,
+                    ECMA_PROPERTY_NOT_ENUMERABLE,
+                    ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.3.3
+ACCESSOR_READ_ONLY (LIT_MAGIC_STRING_BYTE_OFFSET_UL,
+                    ecma_builtin_typedarray_prototype_byte_offset_getter,
+                    ECMA_PROPERTY_NOT_ENUMERABLE,
+                    ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.3.17
+ACCESSOR_READ_ONLY (LIT_MAGIC_STRING_LENGTH,
+                    ecma_builtin_typedarray_prototype_length_getter,
+                    ECMA_PROPERTY_NOT_ENUMERABLE,
+                    ECMA_PROPERTY_CONFIGURABLE)
+
+/* Routine properties:
+ *  (property name, C routine name, arguments number or NON_FIXED, value of the routine's length property) */
+ROUTINE (LIT_MAGIC_STRING_SET,      ecma_builtin_typedarray_prototype_object_set,      2, 1)
+ROUTINE (LIT_MAGIC_STRING_SUBARRAY, ecma_builtin_typedarray_prototype_object_subarray, 2, 2)
+
+#undef OBJECT_ID
+#undef SIMPLE_VALUE
+#undef NUMBER_VALUE
+#undef STRING_VALUE
+#undef OBJECT_VALUE
+#undef CP_UNIMPLEMENTED_VALUE
+#undef ROUTINE
+#undef ACCESSOR_READ_ONLY
@@ -25,6 +25,7 @@
 #include "ecma-number-arithmetic.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
+#include "lit-char-helpers.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -33,6 +34,459 @@
  * @{
  */
 
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+
+/**
+ * Get internal property, referencing dense storage of the array's elements
+ *
+ * @return pointer to the property - if the array's elements are stored densely,
+ *         NULL - otherwise
+ */
+static ecma_property_t *
+ecma_op_array_object_get_elements_property (ecma_object_t *obj_p) /**< the array object */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY);
+
+  ecma_property_t *property_p = ecma_get_property_list (obj_p);
+
+  if (property_p != NULL
+      && (property_p->flags & ECMA_PROPERTY_FLAG_INTERNAL)
+      && property_p->h.internal_property_type == ECMA_INTERNAL_PROPERTY_PROPERTY_HASHMAP)
+  {
+    property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p);
+  }
+
+  if (property_p != NULL
+      && (property_p->flags & ECMA_PROPERTY_FLAG_INTERNAL)
+      && property_p->h.internal_property_type == ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES)
+  {
+    return property_p;
+  }
+
+  JERRY_ASSERT (ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES) == NULL);
+
+  return NULL;
+} /* ecma_op_array_object_get_elements_property */
+
+/**
+ * Get dense storage of the array's elements
+ *
+ * @return pointer to the storage - if the array's elements are stored densely,
+ *         NULL - otherwise
+ */
+ecma_array_elements_t *
+ecma_op_array_object_get_elements (ecma_object_t *obj_p) /**< the array object */
+{
+  ecma_property_t *elements_prop_p = ecma_op_array_object_get_elements_property (obj_p);
+
+  if (elements_prop_p == NULL)
+  {
+    return NULL;
+  }
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t, elements_prop_p->v.internal_property.value);
+} /* ecma_op_array_object_get_elements */
+
+/**
+ * Create dense storage for the array's elements
+ *
+ * @return pointer to the storage
+ */
+static ecma_array_elements_t *
+ecma_op_array_object_create_elements (ecma_object_t *obj_p, /**< the array object */
+                                      uint32_t capacity) /**< number of values to allocate the storage for */
+{
+  JERRY_ASSERT (ecma_op_array_object_get_elements_property (obj_p) == NULL);
+
+  ecma_array_elements_t *elements_p;
+  elements_p = (ecma_array_elements_t *) mem_heap_alloc_block (ECMA_ARRAY_ELEMENTS_GET_SIZE (capacity));
+  elements_p->length = 0;
+  elements_p->capacity = capacity;
+
+  /* The storage is linked after it is initialized, as allocation of the internal property could run GC */
+  ecma_property_t *elements_prop_p = ecma_create_internal_property (obj_p,
+                                                                    ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES);
+  ECMA_SET_NON_NULL_POINTER (elements_prop_p->v.internal_property.value, elements_p);
+
+  JERRY_ASSERT (ecma_op_array_object_get_elements (obj_p) == elements_p);
+
+  return elements_p;
+} /* ecma_op_array_object_create_elements */
+
+/**
+ * Reallocate dense storage of the array's elements
+ *
+ * @return pointer to the reallocated storage
+ */
+static ecma_array_elements_t *
+ecma_op_array_object_resize_elements (ecma_property_t *elements_prop_p, /**< internal property,
+                                                                         *   referencing the storage */
+                                      uint32_t capacity) /**< new capacity */
+{
+  ecma_array_elements_t *elements_p = ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t,
+                                                                 elements_prop_p->v.internal_property.value);
+
+  JERRY_ASSERT (capacity >= elements_p->length);
+
+  ecma_array_elements_t *new_elements_p;
+  new_elements_p = (ecma_array_elements_t *) mem_heap_alloc_block (ECMA_ARRAY_ELEMENTS_GET_SIZE (capacity));
+
+  /* The allocation could run GC, that could not change the old storage, so it is copied afterwards */
+  new_elements_p->length = elements_p->length;
+  new_elements_p->capacity = capacity;
+  memcpy (ECMA_ARRAY_ELEMENTS_GET_VALUES (new_elements_p),
+          ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p),
+          elements_p->length * sizeof (ecma_value_t));
+
+  ECMA_SET_NON_NULL_POINTER (elements_prop_p->v.internal_property.value, new_elements_p);
+
+  mem_heap_free_block (elements_p, ECMA_ARRAY_ELEMENTS_GET_SIZE (elements_p->capacity));
+
+  return new_elements_p;
+} /* ecma_op_array_object_resize_elements */
+
+/**
+ * Store value of an element, that is not present in the array, to the array's dense storage
+ *
+ * Note:
+ *      the array's length is not updated
+ *
+ * @return true - if the value was stored,
+ *         false - if the element is too far from the storage's end, so it cannot be stored densely
+ */
+static bool
+ecma_op_array_object_store_element (ecma_object_t *obj_p, /**< the array object */
+                                    ecma_property_t *elements_prop_p, /**< internal property,
+                                                                       *   referencing the storage */
+                                    uint32_t index, /**< index of the element */
+                                    ecma_value_t value) /**< value of the element */
+{
+  ecma_array_elements_t *elements_p = ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t,
+                                                                 elements_prop_p->v.internal_property.value);
+
+  if (index >= elements_p->length)
+  {
+    if (index - elements_p->length > CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_MAX_GAP)
+    {
+      return false;
+    }
+
+    if (index >= elements_p->capacity)
+    {
+      uint32_t capacity = elements_p->capacity + elements_p->capacity / 2 + 4;
+
+      if (capacity <= index)
+      {
+        capacity = index + 1;
+      }
+
+      elements_p = ecma_op_array_object_resize_elements (elements_prop_p, capacity);
+    }
+
+    ecma_value_t *values_p = ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p);
+
+    while (elements_p->length <= index)
+    {
+      values_p[elements_p->length++] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_ARRAY_HOLE);
+    }
+  }
+
+  ecma_value_t *value_p = ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p) + index;
+
+  JERRY_ASSERT (ecma_is_value_array_hole (*value_p));
+
+  *value_p = ecma_copy_value_if_not_object (value);
+
+  if (ecma_is_value_object (value))
+  {
+    ecma_gc_write_barrier (obj_p);
+  }
+
+  return true;
+} /* ecma_op_array_object_store_element */
+
+/**
+ * Assign value to an element, that is present in the array's dense storage
+ */
+static void
+ecma_op_array_object_assign_element (ecma_object_t *obj_p, /**< the array object */
+                                     ecma_value_t *value_p, /**< stored value of the element */
+                                     ecma_value_t value) /**< value to assign */
+{
+  JERRY_ASSERT (!ecma_is_value_array_hole (*value_p));
+
+  if (ecma_is_value_heap_number (value)
+      && ecma_is_value_heap_number (*value_p))
+  {
+    ecma_update_heap_number_value (*value_p, ecma_get_number_from_value (value));
+  }
+  else
+  {
+    ecma_free_value_if_not_object (*value_p);
+
+    *value_p = ecma_copy_value_if_not_object (value);
+
+    if (ecma_is_value_object (value))
+    {
+      ecma_gc_write_barrier (obj_p);
+    }
+  }
+} /* ecma_op_array_object_assign_element */
+
+/**
+ * Find value of an element in the array's dense storage
+ *
+ * @return pointer to the stored value - if the array's elements are stored densely,
+ *                                       and the element is present in the array,
+ *         NULL - otherwise
+ */
+ecma_value_t *
+ecma_op_array_object_find_element (ecma_object_t *obj_p, /**< the array object */
+                                   ecma_string_t *property_name_p) /**< property name */
+{
+  ecma_array_elements_t *elements_p = ecma_op_array_object_get_elements (obj_p);
+  uint32_t index;
+
+  if (elements_p == NULL
+      || !ecma_string_get_array_index (property_name_p, &index)
+      || index >= elements_p->length)
+  {
+    return NULL;
+  }
+
+  ecma_value_t *value_p = ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p) + index;
+
+  return ecma_is_value_array_hole (*value_p) ? NULL : value_p;
+} /* ecma_op_array_object_find_element */
+
+/**
+ * [[Put]] operation for elements of arrays, which elements are stored densely
+ *
+ * The element is put directly to the dense storage, if [[Put]] would assign to or create
+ * a writable, enumerable and configurable own data property.
+ *
+ * See also:
+ *          ECMA-262 v5, 8.12.4; ECMA-262 v5, 8.12.5; ECMA-262 v5, 15.4.5.1
+ *
+ * @return true - if the element was put,
+ *         false - if general [[Put]] should be performed
+ */
+bool
+ecma_op_array_object_put_element (ecma_object_t *obj_p, /**< the array object */
+                                  ecma_string_t *property_name_p, /**< property name */
+                                  ecma_value_t value) /**< ecma value */
+{
+  ecma_property_t *elements_prop_p = ecma_op_array_object_get_elements_property (obj_p);
+  uint32_t index;
+
+  if (elements_prop_p == NULL
+      || !ecma_string_get_array_index (property_name_p, &index))
+  {
+    return false;
+  }
+
+  ecma_array_elements_t *elements_p = ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t,
+                                                                 elements_prop_p->v.internal_property.value);
+
+  if (index < elements_p->length
+      && !ecma_is_value_array_hole (ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p)[index]))
+  {
+    ecma_op_array_object_assign_element (obj_p, ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p) + index, value);
+
+    return true;
+  }
+
+  /* [[CanPut]] of a property, that is not an own property */
+  if (!ecma_get_object_extensible (obj_p))
+  {
+    return false;
+  }
+
+  ecma_object_t *proto_p = ecma_get_object_prototype (obj_p);
+
+  if (proto_p != NULL
+      && ecma_op_object_has_property (proto_p, property_name_p))
+  {
+    return false;
+  }
+
+  ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+  ecma_property_t *len_prop_p = ecma_get_named_data_property (obj_p, magic_string_length_p);
+  ecma_deref_ecma_string (magic_string_length_p);
+
+  ecma_number_t len_num = ecma_get_number_from_value (ecma_get_named_data_property_value (len_prop_p));
+  uint32_t old_len_uint32 = ecma_number_to_uint32 (len_num);
+
+  /* 15.4.5.1, 4.b */
+  if (index >= old_len_uint32
+      && !ecma_is_property_writable (len_prop_p))
+  {
+    return false;
+  }
+
+  if (!ecma_op_array_object_store_element (obj_p, elements_prop_p, index, value))
+  {
+    return false;
+  }
+
+  /* 15.4.5.1, 4.e */
+  if (index >= old_len_uint32)
+  {
+    ecma_value_t len_value = ecma_make_uint32_value (index + 1u);
+    ecma_named_data_property_assign_value (obj_p, len_prop_p, len_value);
+    ecma_free_value (len_value);
+  }
+
+  return true;
+} /* ecma_op_array_object_put_element */
+
+/**
+ * [[Delete]] operation for elements of arrays, which elements are stored densely
+ *
+ * @return true - if the property is an element, and the array's elements are stored densely
+ *                (the element is not present in the array after the call),
+ *         false - if general [[Delete]] should be performed
+ */
+bool
+ecma_op_array_object_delete_element (ecma_object_t *obj_p, /**< the array object */
+                                     ecma_string_t *property_name_p) /**< property name */
+{
+  ecma_array_elements_t *elements_p = ecma_op_array_object_get_elements (obj_p);
+  uint32_t index;
+
+  if (elements_p == NULL
+      || !ecma_string_get_array_index (property_name_p, &index))
+  {
+    return false;
+  }
+
+  if (index < elements_p->length)
+  {
+    ecma_value_t *value_p = ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p) + index;
+
+    ecma_free_value_if_not_object (*value_p);
+    *value_p = ecma_make_simple_value (ECMA_SIMPLE_VALUE_ARRAY_HOLE);
+  }
+
+  return true;
+} /* ecma_op_array_object_delete_element */
+
+/**
+ * Move the array's elements from the dense storage to named data properties of the array
+ *
+ * Note:
+ *      the array's elements are never stored densely after the conversion
+ */
+void
+ecma_op_array_object_convert_to_sparse (ecma_object_t *obj_p) /**< the array object */
+{
+  ecma_property_t *elements_prop_p = ecma_op_array_object_get_elements_property (obj_p);
+  JERRY_ASSERT (elements_prop_p != NULL);
+
+  ecma_array_elements_t *elements_p = ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t,
+                                                                 elements_prop_p->v.internal_property.value);
+
+  for (uint32_t index = 0; index < elements_p->length; index++)
+  {
+    ecma_value_t value = ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p)[index];
+
+    if (ecma_is_value_array_hole (value))
+    {
+      continue;
+    }
+
+    ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+    ecma_property_t *prop_p = ecma_create_named_data_property (obj_p, index_string_p, true, true, true);
+    ecma_deref_ecma_string (index_string_p);
+
+    /* The value is moved to the property, the storage is not changed by the allocations above */
+    ecma_set_named_data_property_value (prop_p, value);
+    ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p)[index] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_ARRAY_HOLE);
+  }
+
+  ecma_delete_property (obj_p, elements_prop_p);
+} /* ecma_op_array_object_convert_to_sparse */
+
+/**
+ * [[DefineOwnProperty]] operation for elements of arrays, which elements are stored densely
+ *
+ * Note:
+ *      the array's length is not updated
+ *
+ * @return true - if the element was defined in the dense storage,
+ *         false - if the element cannot be stored densely after the definition
+ */
+static bool
+ecma_op_array_object_define_element (ecma_object_t *obj_p, /**< the array object */
+                                     ecma_property_t *elements_prop_p, /**< internal property,
+                                                                        *   referencing the storage */
+                                     uint32_t index, /**< index of the element */
+                                     const ecma_property_descriptor_t *property_desc_p) /**< property descriptor */
+{
+  if (property_desc_p->is_get_defined
+      || property_desc_p->is_set_defined
+      || (property_desc_p->is_writable_defined && !property_desc_p->is_writable)
+      || (property_desc_p->is_enumerable_defined && !property_desc_p->is_enumerable)
+      || (property_desc_p->is_configurable_defined && !property_desc_p->is_configurable))
+  {
+    return false;
+  }
+
+  ecma_array_elements_t *elements_p = ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t,
+                                                                 elements_prop_p->v.internal_property.value);
+
+  if (index < elements_p->length
+      && !ecma_is_value_array_hole (ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p)[index]))
+  {
+    if (property_desc_p->is_value_defined)
+    {
+      ecma_op_array_object_assign_element (obj_p,
+                                           ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p) + index,
+                                           property_desc_p->value);
+    }
+
+    return true;
+  }
+
+  /* Absent attributes of new properties are set to false (ECMA-262 v5, 8.12.9, 4.a) */
+  if (!ecma_get_object_extensible (obj_p)
+      || !property_desc_p->is_writable_defined
+      || !property_desc_p->is_enumerable_defined
+      || !property_desc_p->is_configurable_defined)
+  {
+    return false;
+  }
+
+  ecma_value_t value = (property_desc_p->is_value_defined ? property_desc_p->value
+                                                          : ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+
+  return ecma_op_array_object_store_element (obj_p, elements_prop_p, index, value);
+} /* ecma_op_array_object_define_element */
+
+/**
+ * Remove elements with indices, that are not less than the new length, from the array's dense storage
+ */
+static void
+ecma_op_array_object_truncate_elements (ecma_property_t *elements_prop_p, /**< internal property,
+                                                                           *   referencing the storage */
+                                        uint32_t new_length) /**< new length of the array */
+{
+  ecma_array_elements_t *elements_p = ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t,
+                                                                 elements_prop_p->v.internal_property.value);
+
+  while (elements_p->length > new_length)
+  {
+    ecma_free_value_if_not_object (ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p)[--elements_p->length]);
+  }
+
+  if (elements_p->length < elements_p->capacity / 2)
+  {
+    ecma_op_array_object_resize_elements (elements_prop_p, elements_p->length);
+  }
+} /* ecma_op_array_object_truncate_elements */
+
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+
 /**
  * Array object creation operation.
  *
@@ -64,9 +518,9 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
       && arguments_list_len == 1
       && ecma_is_value_number (arguments_list_p[0]))
   {
-    ecma_number_t *num_p = ecma_get_number_from_value (arguments_list_p[0]);
-    uint32_t num_uint32 = ecma_number_to_uint32 (*num_p);
-    if (*num_p != ((ecma_number_t) num_uint32))
+    ecma_number_t num = ecma_get_number_from_value (arguments_list_p[0]);
+    uint32_t num_uint32 = ecma_number_to_uint32 (num);
+    if (num != ((ecma_number_t) num_uint32))
     {
       return ecma_raise_range_error (ECMA_ERR_MSG (""));
     }
@@ -100,16 +554,32 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
    */
 
   ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
-  ecma_number_t *length_num_p = ecma_alloc_number ();
-  *length_num_p = ((ecma_number_t) length);
 
   ecma_property_t *length_prop_p = ecma_create_named_data_property (obj_p,
                                                                     length_magic_string_p,
                                                                     true, false, false);
-  ecma_set_named_data_property_value (length_prop_p, ecma_make_number_value (length_num_p));
+  ecma_set_named_data_property_value (length_prop_p, ecma_make_uint32_value (length));
 
   ecma_deref_ecma_string (length_magic_string_p);
 
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+  ecma_array_elements_t *elements_p = ecma_op_array_object_create_elements (obj_p, array_items_count);
+  ecma_value_t *values_p = ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p);
+
+  for (uint32_t index = 0;
+       index < array_items_count;
+       index++)
+  {
+    /* The value is copied first, as the copying could run GC, that marks the values up to the storage's length */
+    ecma_value_t value = ecma_copy_value_if_not_object (array_items_p[index]);
+    values_p[elements_p->length++] = value;
+
+    if (ecma_is_value_object (array_items_p[index]))
+    {
+      ecma_gc_write_barrier (obj_p);
+    }
+  }
+#else /* CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
   for (uint32_t index = 0;
        index < array_items_count;
        index++)
@@ -131,6 +601,7 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
 
     ecma_deref_ecma_string (item_name_string_p);
   }
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
 
   return ecma_make_object_value (obj_p);
 } /* ecma_op_create_array_object */
@@ -162,8 +633,7 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
   // 2.
   ecma_value_t old_len_value = ecma_get_named_data_property_value (len_prop_p);
 
-  ecma_number_t *num_p = ecma_get_number_from_value (old_len_value);
-  uint32_t old_len_uint32 = ecma_number_to_uint32 (*num_p);
+  uint32_t old_len_uint32 = ecma_number_to_uint32 (ecma_get_number_from_value (old_len_value));
 
   // 3.
   bool is_property_name_equal_length = ecma_compare_ecma_strings (property_name_p,
@@ -190,7 +660,7 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
     JERRY_ASSERT (!ecma_is_value_error (completion)
                   && ecma_is_value_number (completion));
 
-    ecma_number_t new_len_num = *ecma_get_number_from_value (completion);
+    ecma_number_t new_len_num = ecma_get_number_from_value (completion);
 
     ecma_free_value (completion);
 
@@ -204,11 +674,8 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
     else
     {
       // b., e.
-      ecma_number_t *new_len_num_p = ecma_alloc_number ();
-      *new_len_num_p = new_len_num;
-
       ecma_property_descriptor_t new_len_property_desc = *property_desc_p;
-      new_len_property_desc.value = ecma_make_number_value (new_len_num_p);
+      new_len_property_desc.value = ecma_make_number_value (new_len_num);
 
       ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
@@ -276,80 +743,91 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
              */
             bool is_reduce_succeeded = true;
 
-            ecma_collection_header_t *array_index_props_p = ecma_op_object_get_property_names (obj_p,
-                                                                                               true,
-                                                                                               false,
-                                                                                               false);
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+            ecma_property_t *elements_prop_p = ecma_op_array_object_get_elements_property (obj_p);
 
-            ecma_length_t array_index_props_num = array_index_props_p->unit_number;
-
-            MEM_DEFINE_LOCAL_ARRAY (array_index_values_p, array_index_props_num, uint32_t);
+            if (elements_prop_p != NULL)
+            {
+              /* Densely stored elements are configurable, so deletion of each of them succeeds */
+              ecma_op_array_object_truncate_elements (elements_prop_p, new_len_uint32);
+            }
+            else
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+            {
+              ecma_collection_header_t *array_index_props_p = ecma_op_object_get_property_names (obj_p,
+                                                                                                 true,
+                                                                                                 false,
+                                                                                                 false);
 
-            ecma_collection_iterator_t iter;
-            ecma_collection_iterator_init (&iter, array_index_props_p);
+              ecma_length_t array_index_props_num = array_index_props_p->unit_number;
 
-            uint32_t array_index_values_pos = 0;
+              MEM_DEFINE_LOCAL_ARRAY (array_index_values_p, array_index_props_num, uint32_t);
 
-            while (ecma_collection_iterator_next (&iter))
-            {
-              ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+              ecma_collection_iterator_t iter;
+              ecma_collection_iterator_init (&iter, array_index_props_p);
 
-              uint32_t index;
-              bool is_index = ecma_string_get_array_index (property_name_p, &index);
-              JERRY_ASSERT (is_index);
-              JERRY_ASSERT (index < old_len_uint32);
+              uint32_t array_index_values_pos = 0;
 
-              array_index_values_p[array_index_values_pos++] = index;
-            }
+              while (ecma_collection_iterator_next (&iter))
+              {
+                ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
 
-            JERRY_ASSERT (array_index_values_pos == array_index_props_num);
+                uint32_t index;
+                bool is_index = ecma_string_get_array_index (property_name_p, &index);
+                JERRY_ASSERT (is_index);
+                JERRY_ASSERT (index < old_len_uint32);
 
-            while (array_index_values_pos != 0
-                   && array_index_values_p[--array_index_values_pos] >= new_len_uint32)
-            {
-              uint32_t index = array_index_values_p[array_index_values_pos];
+                array_index_values_p[array_index_values_pos++] = index;
+              }
 
-              // ii.
-              ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
-              ecma_value_t delete_succeeded = ecma_op_object_delete (obj_p, index_string_p, false);
-              ecma_deref_ecma_string (index_string_p);
+              JERRY_ASSERT (array_index_values_pos == array_index_props_num);
 
-              if (ecma_is_value_false (delete_succeeded))
+              while (array_index_values_pos != 0
+                     && array_index_values_p[--array_index_values_pos] >= new_len_uint32)
               {
-                // iii.
-                new_len_uint32 = (index + 1u);
+                uint32_t index = array_index_values_p[array_index_values_pos];
 
-                ecma_number_t *new_len_num_p = ecma_get_number_from_value (new_len_property_desc.value);
+                // ii.
+                ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+                ecma_value_t delete_succeeded = ecma_op_object_delete (obj_p, index_string_p, false);
+                ecma_deref_ecma_string (index_string_p);
 
-                // 1.
-                *new_len_num_p = ((ecma_number_t) index + 1u);
-
-                // 2.
-                if (!new_writable)
+                if (ecma_is_value_false (delete_succeeded))
                 {
-                  new_len_property_desc.is_writable_defined = true;
-                  new_len_property_desc.is_writable = false;
-                }
+                  // iii.
+                  new_len_uint32 = (index + 1u);
 
-                // 3.
-                ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
-                ecma_value_t completion = ecma_op_general_object_define_own_property (obj_p,
-                                                                                      magic_string_length_p,
-                                                                                      &new_len_property_desc,
-                                                                                      false);
-                ecma_deref_ecma_string (magic_string_length_p);
+                  // 1.
+                  ecma_free_value (new_len_property_desc.value);
+                  new_len_property_desc.value = ecma_make_uint32_value (index + 1u);
+
+                  // 2.
+                  if (!new_writable)
+                  {
+                    new_len_property_desc.is_writable_defined = true;
+                    new_len_property_desc.is_writable = false;
+                  }
+
+                  // 3.
+                  ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+                  ecma_value_t completion = ecma_op_general_object_define_own_property (obj_p,
+                                                                                        magic_string_length_p,
+                                                                                        &new_len_property_desc,
+                                                                                        false);
+                  ecma_deref_ecma_string (magic_string_length_p);
 
-                JERRY_ASSERT (ecma_is_value_boolean (completion));
+                  JERRY_ASSERT (ecma_is_value_boolean (completion));
 
-                is_reduce_succeeded = false;
+                  is_reduce_succeeded = false;
 
-                break;
+                  break;
+                }
               }
-            }
 
-            MEM_FINALIZE_LOCAL_ARRAY (array_index_values_p);
+              MEM_FINALIZE_LOCAL_ARRAY (array_index_values_p);
 
-            ecma_free_values_collection (array_index_props_p, true);
+              ecma_free_values_collection (array_index_props_p, true);
+            }
 
             if (!is_reduce_succeeded)
             {
@@ -381,7 +859,7 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
         }
       }
 
-      ecma_dealloc_number (new_len_num_p);
+      ecma_free_value (new_len_property_desc.value);
 
       return ret_value;
     }
@@ -412,10 +890,35 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
     }
 
     // c.
-    ecma_value_t succeeded = ecma_op_general_object_define_own_property (obj_p,
-                                                                         property_name_p,
-                                                                         property_desc_p,
-                                                                         false);
+    ecma_value_t succeeded;
+
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+    ecma_property_t *elements_prop_p = ecma_op_array_object_get_elements_property (obj_p);
+
+    if (elements_prop_p != NULL
+        && ecma_op_array_object_define_element (obj_p, elements_prop_p, index, property_desc_p))
+    {
+      succeeded = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+    }
+    else
+    {
+      if (elements_prop_p != NULL)
+      {
+        ecma_op_array_object_convert_to_sparse (obj_p);
+      }
+
+      succeeded = ecma_op_general_object_define_own_property (obj_p,
+                                                              property_name_p,
+                                                              property_desc_p,
+                                                              false);
+    }
+#else /* CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+    succeeded = ecma_op_general_object_define_own_property (obj_p,
+                                                            property_name_p,
+                                                            property_desc_p,
+                                                            false);
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+
     // d.
     JERRY_ASSERT (ecma_is_value_boolean (succeeded));
 
@@ -428,12 +931,11 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
     if (index >= old_len_uint32)
     {
       // i., ii.
-      ecma_number_t *num_p = ecma_alloc_number ();
-      *num_p = ecma_number_add (((ecma_number_t) index), ECMA_NUMBER_ONE);
+      ecma_value_t len_value = ecma_make_uint32_value (index + 1u);
 
-      ecma_named_data_property_assign_value (obj_p, len_prop_p, ecma_make_number_value (num_p));
+      ecma_named_data_property_assign_value (obj_p, len_prop_p, len_value);
 
-      ecma_dealloc_number (num_p);
+      ecma_free_value (len_value);
     }
 
     // f.
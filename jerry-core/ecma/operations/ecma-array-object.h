@@ -31,6 +31,14 @@ ecma_op_create_array_object (const ecma_value_t *, ecma_length_t, bool);
 extern ecma_value_t
 ecma_op_array_object_define_own_property (ecma_object_t *, ecma_string_t *, const ecma_property_descriptor_t *, bool);
 
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+extern ecma_array_elements_t *ecma_op_array_object_get_elements (ecma_object_t *);
+extern ecma_value_t *ecma_op_array_object_find_element (ecma_object_t *, ecma_string_t *);
+extern bool ecma_op_array_object_put_element (ecma_object_t *, ecma_string_t *, ecma_value_t);
+extern bool ecma_op_array_object_delete_element (ecma_object_t *, ecma_string_t *);
+extern void ecma_op_array_object_convert_to_sparse (ecma_object_t *);
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+
 /**
  * @}
  * @}
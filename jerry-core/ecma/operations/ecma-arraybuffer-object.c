@@ -0,0 +1,179 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-arraybuffer-object.h"
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-try-catch-macro.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaarraybufferobject ECMA ArrayBuffer object related routines
+ * @{
+ */
+
+/**
+ * Create an ArrayBuffer object, referencing the backing store
+ *
+ * @return pointer to the object
+ */
+static ecma_object_t *
+ecma_op_create_arraybuffer_object_with_store (ecma_arraybuffer_t *arraybuffer_p) /**< backing store */
+{
+  ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_ARRAYBUFFER_PROTOTYPE);
+  ecma_object_t *obj_p = ecma_create_object (prototype_obj_p, true, ECMA_OBJECT_TYPE_GENERAL);
+  ecma_deref_object (prototype_obj_p);
+
+  ecma_property_t *class_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
+  class_prop_p->v.internal_property.value = LIT_MAGIC_STRING_ARRAY_BUFFER_UL;
+
+  ecma_property_t *arraybuffer_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARRAYBUFFER);
+  ECMA_SET_NON_NULL_POINTER (arraybuffer_prop_p->v.internal_property.value, arraybuffer_p);
+
+  return obj_p;
+} /* ecma_op_create_arraybuffer_object_with_store */
+
+/**
+ * ArrayBuffer object creation operation
+ *
+ * The bytes of the buffer are placed to the engine's heap, and are initialized with zeros.
+ *
+ * See also:
+ *          ECMA-262 v6, 24.1.1.1
+ *
+ * @return ecma value - the new object, or RangeError, if the buffer can't be allocated
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_create_arraybuffer_object (uint32_t length) /**< length of the buffer, in bytes */
+{
+  size_t size = ECMA_ARRAYBUFFER_GET_SIZE ((size_t) length);
+  ecma_arraybuffer_t *arraybuffer_p = (ecma_arraybuffer_t *) mem_heap_alloc_block_null_on_error (size);
+
+  if (arraybuffer_p == NULL)
+  {
+    return ecma_raise_range_error (ECMA_ERR_MSG ("Not enough memory for the ArrayBuffer."));
+  }
+
+  arraybuffer_p->buffer_p = (uint8_t *) (arraybuffer_p + 1);
+  arraybuffer_p->free_cb = 0;
+  arraybuffer_p->length = length;
+
+  memset (arraybuffer_p->buffer_p, 0, length);
+
+  return ecma_make_object_value (ecma_op_create_arraybuffer_object_with_store (arraybuffer_p));
+} /* ecma_op_create_arraybuffer_object */
+
+/**
+ * Create an ArrayBuffer object for a buffer, owned by the embedder
+ *
+ * Note:
+ *      the bytes are not copied, and the free callback (if any) is called with the buffer's pointer,
+ *      when the object is garbage collected
+ *
+ * @return pointer to the object
+ */
+ecma_object_t *
+ecma_op_create_external_arraybuffer_object (uint8_t *buffer_p, /**< the bytes */
+                                            uint32_t length, /**< length of the buffer, in bytes */
+                                            ecma_external_pointer_t free_cb) /**< free callback (or 0) */
+{
+  JERRY_ASSERT (buffer_p != NULL || length == 0);
+
+  ecma_arraybuffer_t *arraybuffer_p = (ecma_arraybuffer_t *) mem_heap_alloc_block (sizeof (ecma_arraybuffer_t));
+  arraybuffer_p->buffer_p = buffer_p;
+  arraybuffer_p->free_cb = free_cb;
+  arraybuffer_p->length = length;
+
+  return ecma_op_create_arraybuffer_object_with_store (arraybuffer_p);
+} /* ecma_op_create_external_arraybuffer_object */
+
+/**
+ * Get backing store of an ArrayBuffer object
+ *
+ * @return pointer to the store - if the object is an ArrayBuffer,
+ *         NULL - otherwise
+ */
+ecma_arraybuffer_t *
+ecma_op_arraybuffer_get (ecma_object_t *obj_p) /**< object */
+{
+  if (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_GENERAL
+      || ecma_get_object_is_builtin (obj_p))
+  {
+    return NULL;
+  }
+
+  ecma_property_t *arraybuffer_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARRAYBUFFER);
+
+  if (arraybuffer_prop_p == NULL)
+  {
+    return NULL;
+  }
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_arraybuffer_t, arraybuffer_prop_p->v.internal_property.value);
+} /* ecma_op_arraybuffer_get */
+
+/**
+ * Convert the value to length of a buffer (or to number of elements of a typed array)
+ *
+ * See also:
+ *          ECMA-262 v6, 7.1.15
+ *
+ * @return ecma value - empty, if the value is converted,
+ *                      error, if conversion to number throws, or the length is negative or too large
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_to_byte_length (ecma_value_t value, /**< ecma value */
+                        uint32_t *out_length_p) /**< [out] the length */
+{
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (num, value, ret_value);
+
+  *out_length_p = 0;
+
+  if (!ecma_number_is_nan (num))
+  {
+    num = ecma_number_trunc (num);
+
+    if (num < 0 || num >= (ecma_number_t) UINT32_MAX + 1)
+    {
+      ret_value = ecma_raise_range_error (ECMA_ERR_MSG ("Invalid length."));
+    }
+    else
+    {
+      *out_length_p = (uint32_t) num;
+    }
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (num);
+
+  return ret_value;
+} /* ecma_op_to_byte_length */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
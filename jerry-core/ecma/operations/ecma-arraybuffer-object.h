@@ -0,0 +1,42 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_ARRAYBUFFER_OBJECT_H
+#define ECMA_ARRAYBUFFER_OBJECT_H
+
+#include "ecma-globals.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaarraybufferobject ECMA ArrayBuffer object related routines
+ * @{
+ */
+
+extern ecma_value_t ecma_op_create_arraybuffer_object (uint32_t);
+extern ecma_object_t *ecma_op_create_external_arraybuffer_object (uint8_t *, uint32_t, ecma_external_pointer_t);
+extern ecma_arraybuffer_t *ecma_op_arraybuffer_get (ecma_object_t *);
+extern ecma_value_t ecma_op_to_byte_length (ecma_value_t, uint32_t *);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+#endif /* !ECMA_ARRAYBUFFER_OBJECT_H */
@@ -18,11 +18,13 @@
 #include "ecma-exceptions.h"
 #include "ecma-globals.h"
 #include "ecma-function-object.h"
+#include "ecma-intern.h"
 #include "ecma-lcache.h"
 #include "ecma-string-object.h"
 #include "ecma-objects-arguments.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects.h"
+#include "ecma-typedarray-object.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -31,6 +33,13 @@
  * @{
  */
 
+/**
+ * Number of bits in the bitmaps of property names' hashes, used upon listing of the property names
+ *
+ * The bitmaps are allocated on the stack, so the bits are indexed by the hashes modulo the number.
+ */
+#define ECMA_OBJECT_HASH_BITMAP_SIZE (256u)
+
 /**
  * Assert that specified object type value is valid
  */
@@ -67,6 +76,30 @@ ecma_op_object_get (ecma_object_t *obj_p, /**< the object */
   const ecma_object_type_t type = ecma_get_object_type (obj_p);
   ecma_assert_object_type_is_valid (type);
 
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+  if (type == ECMA_OBJECT_TYPE_ARRAY)
+  {
+    ecma_value_t *value_p = ecma_op_array_object_find_element (obj_p, property_name_p);
+
+    if (value_p != NULL)
+    {
+      return ecma_copy_value (*value_p);
+    }
+  }
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+  if (type == ECMA_OBJECT_TYPE_GENERAL)
+  {
+    ecma_value_t element_value = ecma_op_typedarray_get_element (obj_p, property_name_p);
+
+    if (!ecma_is_value_empty (element_value))
+    {
+      return element_value;
+    }
+  }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
   switch (type)
   {
     case ECMA_OBJECT_TYPE_GENERAL:
@@ -154,6 +187,45 @@ ecma_op_object_get_own_property_longpath (ecma_object_t *obj_p, /**< the object
   return prop_p;
 } /* ecma_op_object_get_own_property_longpath */
 
+/**
+ * Get own property with the specified name, checking LCache first
+ *
+ * See also:
+ *          ecma_op_object_get_own_property
+ *
+ * @return pointer to a property - if it exists,
+ *         NULL (i.e. ecma-undefined) - otherwise.
+ */
+static inline ecma_property_t * __attr_always_inline___
+ecma_op_object_get_own_property_by_name (ecma_object_t *obj_p, /**< the object */
+                                         ecma_string_t *property_name_p) /**< property name */
+{
+  ecma_property_t *prop_p = NULL;
+
+  if (likely (ecma_lcache_lookup (obj_p, property_name_p, &prop_p)))
+  {
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+    /* Absence of an array's element could be cached before the element was stored densely */
+    if (likely (prop_p != NULL)
+        || ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_ARRAY)
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+    {
+      return prop_p;
+    }
+  }
+
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+  if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY
+      && ecma_op_array_object_find_element (obj_p, property_name_p) != NULL)
+  {
+    /* Densely stored elements have no property records, so the elements are moved to named properties */
+    ecma_op_array_object_convert_to_sparse (obj_p);
+  }
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+
+  return ecma_op_object_get_own_property_longpath (obj_p, property_name_p);
+} /* ecma_op_object_get_own_property_by_name */
+
 /**
  * [[GetOwnProperty]] ecma object's operation
  *
@@ -171,16 +243,19 @@ ecma_op_object_get_own_property (ecma_object_t *obj_p, /**< the object */
                 && !ecma_is_lexical_environment (obj_p));
   JERRY_ASSERT (property_name_p != NULL);
 
-  ecma_property_t *prop_p = NULL;
+  ecma_string_t *interned_name_p = ecma_find_interned_property_name (property_name_p);
 
-  if (likely (ecma_lcache_lookup (obj_p, property_name_p, &prop_p)))
-  {
-    return prop_p;
-  }
-  else
+  if (likely (interned_name_p == NULL))
   {
-    return ecma_op_object_get_own_property_longpath (obj_p, property_name_p);
+    return ecma_op_object_get_own_property_by_name (obj_p, property_name_p);
   }
+
+  /* Names, built at runtime, are replaced with the interned strings, which are registered in LCache */
+  ecma_property_t *prop_p = ecma_op_object_get_own_property_by_name (obj_p, interned_name_p);
+
+  ecma_deref_ecma_string (interned_name_p);
+
+  return prop_p;
 } /* ecma_op_object_get_own_property */
 
 /**
@@ -223,6 +298,158 @@ ecma_op_object_get_property (ecma_object_t *obj_p, /**< the object */
   return ecma_op_general_object_get_property (obj_p, property_name_p);
 } /* ecma_op_object_get_property */
 
+/**
+ * Check whether the object has an own property with the specified name
+ *
+ * Unlike [[GetOwnProperty]], the operation keeps elements of arrays in the dense storage.
+ *
+ * @return true - if the property exists,
+ *         false - otherwise.
+ */
+bool
+ecma_op_object_has_own_property (ecma_object_t *obj_p, /**< the object */
+                                 ecma_string_t *property_name_p) /**< property name */
+{
+  JERRY_ASSERT (obj_p != NULL
+                && !ecma_is_lexical_environment (obj_p));
+  JERRY_ASSERT (property_name_p != NULL);
+
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+  if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY
+      && ecma_op_array_object_find_element (obj_p, property_name_p) != NULL)
+  {
+    return true;
+  }
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+  if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_GENERAL)
+  {
+    ecma_value_t element_value = ecma_op_typedarray_get_element (obj_p, property_name_p);
+
+    if (!ecma_is_value_empty (element_value))
+    {
+      bool is_element = !ecma_is_value_undefined (element_value);
+      ecma_free_value (element_value);
+
+      return is_element;
+    }
+  }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+  return (ecma_op_object_get_own_property (obj_p, property_name_p) != NULL);
+} /* ecma_op_object_has_own_property */
+
+/**
+ * Get descriptor of an own property of the object
+ *
+ * Unlike [[GetOwnProperty]], the operation also describes elements, which have no property records
+ * (elements of arrays, stored densely, and elements of typed arrays).
+ *
+ * Note:
+ *      the descriptor, if filled, should be freed with ecma_free_property_descriptor
+ *
+ * @return true - if the property exists (the descriptor is filled),
+ *         false - otherwise.
+ */
+bool
+ecma_op_object_get_own_property_descriptor (ecma_object_t *obj_p, /**< the object */
+                                            ecma_string_t *property_name_p, /**< property name */
+                                            ecma_property_descriptor_t *prop_desc_p) /**< [out] property
+                                                                                      *   descriptor */
+{
+  JERRY_ASSERT (obj_p != NULL
+                && !ecma_is_lexical_environment (obj_p));
+  JERRY_ASSERT (property_name_p != NULL);
+
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+  if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY)
+  {
+    ecma_value_t *value_p = ecma_op_array_object_find_element (obj_p, property_name_p);
+
+    if (value_p != NULL)
+    {
+      *prop_desc_p = ecma_make_empty_property_descriptor ();
+      prop_desc_p->is_value_defined = true;
+      prop_desc_p->value = ecma_copy_value (*value_p);
+      prop_desc_p->is_writable_defined = true;
+      prop_desc_p->is_writable = true;
+      prop_desc_p->is_enumerable_defined = true;
+      prop_desc_p->is_enumerable = true;
+      prop_desc_p->is_configurable_defined = true;
+      prop_desc_p->is_configurable = true;
+
+      return true;
+    }
+  }
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+  if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_GENERAL)
+  {
+    ecma_value_t element_value = ecma_op_typedarray_get_element (obj_p, property_name_p);
+
+    if (ecma_is_value_undefined (element_value))
+    {
+      /* the index is out of the typed array's range */
+      return false;
+    }
+
+    if (!ecma_is_value_empty (element_value))
+    {
+      *prop_desc_p = ecma_make_empty_property_descriptor ();
+      prop_desc_p->is_value_defined = true;
+      prop_desc_p->value = element_value;
+      prop_desc_p->is_writable_defined = true;
+      prop_desc_p->is_writable = true;
+      prop_desc_p->is_enumerable_defined = true;
+      prop_desc_p->is_enumerable = true;
+      prop_desc_p->is_configurable_defined = true;
+      prop_desc_p->is_configurable = false;
+
+      return true;
+    }
+  }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+  ecma_property_t *prop_p = ecma_op_object_get_own_property (obj_p, property_name_p);
+
+  if (prop_p == NULL)
+  {
+    return false;
+  }
+
+  *prop_desc_p = ecma_get_property_descriptor_from_property (prop_p);
+
+  return true;
+} /* ecma_op_object_get_own_property_descriptor */
+
+/**
+ * [[HasProperty]] ecma object's operation
+ *
+ * See also:
+ *          ECMA-262 v5, 8.6.2; ECMA-262 v5, Table 8; ECMA-262 v5, 8.12.6
+ *
+ * @return true - if the property exists in the object or its prototype chain,
+ *         false - otherwise.
+ */
+bool
+ecma_op_object_has_property (ecma_object_t *obj_p, /**< the object */
+                             ecma_string_t *property_name_p) /**< property name */
+{
+  for (ecma_object_t *prototype_chain_iter_p = obj_p;
+       prototype_chain_iter_p != NULL;
+       prototype_chain_iter_p = ecma_get_object_prototype (prototype_chain_iter_p))
+  {
+    if (ecma_op_object_has_own_property (prototype_chain_iter_p, property_name_p))
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* ecma_op_object_has_property */
+
 /**
  * [[Put]] ecma object's operation
  *
@@ -262,6 +489,26 @@ ecma_op_object_put (ecma_object_t *obj_p, /**< the object */
    * return put[type] (obj_p, property_name_p);
    */
 
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+  if (type == ECMA_OBJECT_TYPE_ARRAY
+      && ecma_op_array_object_put_element (obj_p, property_name_p, value))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+  if (type == ECMA_OBJECT_TYPE_GENERAL)
+  {
+    ecma_value_t put_value = ecma_op_typedarray_put_element (obj_p, property_name_p, value);
+
+    if (!ecma_is_value_empty (put_value))
+    {
+      return put_value;
+    }
+  }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
   return ecma_op_general_object_put (obj_p, property_name_p, value, is_throw);
 } /* ecma_op_object_put */
 
@@ -326,6 +573,26 @@ ecma_op_object_delete (ecma_object_t *obj_p, /**< the object */
   const ecma_object_type_t type = ecma_get_object_type (obj_p);
   ecma_assert_object_type_is_valid (type);
 
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+  if (type == ECMA_OBJECT_TYPE_ARRAY
+      && ecma_op_array_object_delete_element (obj_p, property_name_p))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+  if (type == ECMA_OBJECT_TYPE_GENERAL)
+  {
+    ecma_value_t delete_value = ecma_op_typedarray_delete_element (obj_p, property_name_p, is_throw);
+
+    if (!ecma_is_value_empty (delete_value))
+    {
+      return delete_value;
+    }
+  }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
   switch (type)
   {
     case ECMA_OBJECT_TYPE_GENERAL:
@@ -416,6 +683,21 @@ ecma_op_object_define_own_property (ecma_object_t *obj_p, /**< the object */
   const ecma_object_type_t type = ecma_get_object_type (obj_p);
   ecma_assert_object_type_is_valid (type);
 
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+  if (type == ECMA_OBJECT_TYPE_GENERAL)
+  {
+    ecma_value_t define_value = ecma_op_typedarray_define_element (obj_p,
+                                                                   property_name_p,
+                                                                   property_desc_p,
+                                                                   is_throw);
+
+    if (!ecma_is_value_empty (define_value))
+    {
+      return define_value;
+    }
+  }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
   switch (type)
   {
     case ECMA_OBJECT_TYPE_GENERAL:
@@ -550,7 +832,7 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
   ecma_assert_object_type_is_valid (type);
 
   const size_t bitmap_row_size = sizeof (uint32_t) * JERRY_BITSINBYTE;
-  uint32_t names_hashes_bitmap[(1u << LIT_STRING_HASH_BITS) / bitmap_row_size];
+  uint32_t names_hashes_bitmap[ECMA_OBJECT_HASH_BITMAP_SIZE / bitmap_row_size];
 
   memset (names_hashes_bitmap, 0, sizeof (names_hashes_bitmap));
 
@@ -607,14 +889,14 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
     ecma_collection_iterator_t iter;
     ecma_collection_iterator_init (&iter, prop_names_p);
 
-    uint32_t own_names_hashes_bitmap[(1u << LIT_STRING_HASH_BITS) / bitmap_row_size];
+    uint32_t own_names_hashes_bitmap[ECMA_OBJECT_HASH_BITMAP_SIZE / bitmap_row_size];
     memset (own_names_hashes_bitmap, 0, sizeof (own_names_hashes_bitmap));
 
     while (ecma_collection_iterator_next (&iter))
     {
       ecma_string_t *name_p = ecma_get_string_from_value (*iter.current_value_p);
 
-      lit_string_hash_t hash = name_p->hash;
+      uint32_t hash = ecma_string_hash (name_p) % ECMA_OBJECT_HASH_BITMAP_SIZE;
       uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
       uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
 
@@ -624,15 +906,38 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
       }
     }
 
-    for (ecma_property_t *prop_iter_p = ecma_get_property_list (prototype_chain_iter_p);
-         prop_iter_p != NULL;
-         prop_iter_p = ECMA_GET_POINTER (ecma_property_t, prop_iter_p->next_property_p))
+    /*
+     * Properties of the list are visited first, and then the slots, in reverse order,
+     * as the property list is ordered from the newest property to the oldest one.
+     */
+    ecma_property_slots_header_t *slots_header_p = ecma_get_property_slots (prototype_chain_iter_p);
+    uint32_t slot_index = (slots_header_p != NULL) ? slots_header_p->slots_number : 0;
+
+    ecma_property_t *next_prop_iter_p = ecma_get_property_list (prototype_chain_iter_p);
+
+    while (next_prop_iter_p != NULL || slot_index > 0)
     {
+      ecma_property_t *prop_iter_p;
+
+      if (next_prop_iter_p != NULL)
+      {
+        prop_iter_p = next_prop_iter_p;
+        next_prop_iter_p = ECMA_GET_POINTER (ecma_property_t, prop_iter_p->next_property_p);
+      }
+      else
+      {
+        prop_iter_p = ecma_get_property_slot (slots_header_p, --slot_index);
+      }
+
       if (prop_iter_p->flags & (ECMA_PROPERTY_FLAG_NAMEDDATA | ECMA_PROPERTY_FLAG_NAMEDACCESSOR))
       {
         ecma_string_t *name_p;
 
-        if (prop_iter_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
+        if (prop_iter_p->flags & ECMA_PROPERTY_FLAG_SHAPED)
+        {
+          name_p = ecma_get_property_slot_name (slots_header_p, slot_index);
+        }
+        else if (prop_iter_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
         {
           name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_iter_p->v.named_data_property.name_p);
         }
@@ -645,7 +950,7 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
 
         if (!(is_enumerable_only && !ecma_is_property_enumerable (prop_iter_p)))
         {
-          lit_string_hash_t hash = name_p->hash;
+          uint32_t hash = ecma_string_hash (name_p) % ECMA_OBJECT_HASH_BITMAP_SIZE;
           uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
           uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
 
@@ -684,7 +989,7 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
                                             ecma_make_string_value (name_p),
                                             true);
 
-          lit_string_hash_t hash = name_p->hash;
+          uint32_t hash = ecma_string_hash (name_p) % ECMA_OBJECT_HASH_BITMAP_SIZE;
           uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
           uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
 
@@ -696,7 +1001,10 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
       }
       else
       {
-        JERRY_ASSERT (prop_iter_p->flags & ECMA_PROPERTY_FLAG_INTERNAL);
+        /* internal property, header of the slots, or a slot of deleted property */
+        JERRY_ASSERT ((prop_iter_p->flags & ECMA_PROPERTY_FLAG_INTERNAL)
+                      || prop_iter_p->flags == ECMA_PROPERTY_FLAG_SHAPED
+                      || prop_iter_p->flags == 0);
       }
     }
 
@@ -718,13 +1026,52 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
       }
     }
 
+    /* Elements of arrays, stored densely, are not in the property list, and their names are listed separately */
+    ecma_length_t dense_elements_count = 0;
+
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+    ecma_array_elements_t *elements_p = NULL;
+
+    if (ecma_get_object_type (prototype_chain_iter_p) == ECMA_OBJECT_TYPE_ARRAY)
+    {
+      elements_p = ecma_op_array_object_get_elements (prototype_chain_iter_p);
+    }
+
+    if (elements_p != NULL)
+    {
+      JERRY_ASSERT (array_index_named_properties_count == 0);
+
+      for (uint32_t index = 0; index < elements_p->length; index++)
+      {
+        if (!ecma_is_value_array_hole (ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p)[index]))
+        {
+          dense_elements_count++;
+        }
+      }
+    }
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+    /* Elements of typed arrays are stored in the ArrayBuffer, and are not in the property list, as well */
+    ecma_arraybuffer_view_t *typedarray_view_p = ecma_op_typedarray_get (prototype_chain_iter_p);
+
+    if (typedarray_view_p != NULL)
+    {
+      JERRY_ASSERT (array_index_named_properties_count == 0);
+
+      dense_elements_count += typedarray_view_p->length;
+    }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
     /* Second pass: collecting properties names into arrays */
-    MEM_DEFINE_LOCAL_ARRAY (names_p,
-                            array_index_named_properties_count + string_named_properties_count,
-                            ecma_string_t *);
+    const ecma_length_t names_count = (dense_elements_count
+                                       + array_index_named_properties_count
+                                       + string_named_properties_count);
+
+    MEM_DEFINE_LOCAL_ARRAY (names_p, names_count, ecma_string_t *);
     MEM_DEFINE_LOCAL_ARRAY (array_index_names_p, array_index_named_properties_count, uint32_t);
 
-    uint32_t name_pos = array_index_named_properties_count + string_named_properties_count;
+    uint32_t name_pos = names_count;
     uint32_t array_index_name_pos = 0;
 
     ecma_collection_iterator_init (&iter, prop_names_p);
@@ -773,19 +1120,45 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
          * in order that is reverse to properties creation order
          */
 
-        JERRY_ASSERT (name_pos > 0
-                      && name_pos <= array_index_named_properties_count + string_named_properties_count);
+        JERRY_ASSERT (name_pos > 0 && name_pos <= names_count);
         names_p[--name_pos] = ecma_copy_or_ref_ecma_string (name_p);
       }
     }
 
     for (uint32_t i = 0; i < array_index_named_properties_count; i++)
     {
-      JERRY_ASSERT (name_pos > 0
-                    && name_pos <= array_index_named_properties_count + string_named_properties_count);
+      JERRY_ASSERT (name_pos > 0 && name_pos <= names_count);
       names_p[--name_pos] = ecma_new_ecma_string_from_uint32 (array_index_names_p[i]);
     }
 
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+    if (elements_p != NULL)
+    {
+      /* The storage is not changed by the allocations above */
+      JERRY_ASSERT (ecma_op_array_object_get_elements (prototype_chain_iter_p) == elements_p);
+
+      for (uint32_t index = elements_p->length; index > 0; index--)
+      {
+        if (!ecma_is_value_array_hole (ECMA_ARRAY_ELEMENTS_GET_VALUES (elements_p)[index - 1]))
+        {
+          JERRY_ASSERT (name_pos > 0 && name_pos <= names_count);
+          names_p[--name_pos] = ecma_new_ecma_string_from_uint32 (index - 1);
+        }
+      }
+    }
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+    if (typedarray_view_p != NULL)
+    {
+      for (uint32_t index = typedarray_view_p->length; index > 0; index--)
+      {
+        JERRY_ASSERT (name_pos > 0 && name_pos <= names_count);
+        names_p[--name_pos] = ecma_new_ecma_string_from_uint32 (index - 1);
+      }
+    }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
     JERRY_ASSERT (name_pos == 0);
 
     MEM_FINALIZE_LOCAL_ARRAY (array_index_names_p);
@@ -794,21 +1167,21 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
 
     /* Third pass:
      *   embedding own property names of current object of prototype chain to aggregate property names collection */
-    for (uint32_t i = 0;
-         i < array_index_named_properties_count + string_named_properties_count;
-         i++)
+    for (uint32_t i = 0; i < names_count; i++)
     {
       bool is_append;
 
       ecma_string_t *name_p = names_p[i];
 
-      lit_string_hash_t hash = name_p->hash;
+      uint32_t hash = ecma_string_hash (name_p) % ECMA_OBJECT_HASH_BITMAP_SIZE;
       uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
       uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
 
-      if ((names_hashes_bitmap[bitmap_row] & (1u << bitmap_column)) == 0)
+      if ((names_hashes_bitmap[bitmap_row] & (1u << bitmap_column)) == 0
+          || prototype_chain_iter_p == obj_p)
       {
-        /* no name with the hash is in constructed collection */
+        /* no name with the hash is in constructed collection,
+         * or the name is one of the object's own property names, which are unique */
         is_append = true;
 
         names_hashes_bitmap[bitmap_row] |= (1u << bitmap_column);
@@ -964,6 +1337,24 @@ ecma_object_get_class_name (ecma_object_t *obj_p) /**< object */
             return LIT_MAGIC_STRING_REGEXP_UL;
           }
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+          case ECMA_BUILTIN_ID_ARRAYBUFFER_PROTOTYPE:
+          case ECMA_BUILTIN_ID_DATAVIEW_PROTOTYPE:
+          case ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_INT8ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT8ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT8CLAMPEDARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_INT16ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT16ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_INT32ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT32ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_FLOAT32ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_FLOAT64ARRAY_PROTOTYPE:
+          {
+            /* the prototypes are ordinary objects (ECMA-262 v6, 22.2.3, 24.1.4, 24.2.4) */
+            return LIT_MAGIC_STRING_OBJECT_UL;
+          }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
           default:
           {
             JERRY_ASSERT (ecma_builtin_is (obj_p, ECMA_BUILTIN_ID_GLOBAL));
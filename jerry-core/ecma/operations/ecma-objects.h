@@ -29,6 +29,10 @@
 extern ecma_value_t ecma_op_object_get (ecma_object_t *, ecma_string_t *);
 extern ecma_property_t *ecma_op_object_get_own_property (ecma_object_t *, ecma_string_t *);
 extern ecma_property_t *ecma_op_object_get_property (ecma_object_t *, ecma_string_t *);
+extern bool ecma_op_object_has_own_property (ecma_object_t *, ecma_string_t *);
+extern bool ecma_op_object_get_own_property_descriptor (ecma_object_t *, ecma_string_t *,
+                                                        ecma_property_descriptor_t *);
+extern bool ecma_op_object_has_property (ecma_object_t *, ecma_string_t *);
 extern ecma_value_t ecma_op_object_put (ecma_object_t *, ecma_string_t *, ecma_value_t, bool);
 extern bool ecma_op_object_can_put (ecma_object_t *, ecma_string_t *);
 extern ecma_value_t ecma_op_object_delete (ecma_object_t *, ecma_string_t *, bool);
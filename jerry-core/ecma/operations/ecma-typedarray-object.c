@@ -0,0 +1,790 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-arraybuffer-object.h"
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-objects-general.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmatypedarrayobject ECMA typed array and DataView objects related routines
+ * @{
+ */
+
+/**
+ * Sizes of elements of typed arrays, in bytes, indexed by ecma_arraybuffer_view_type_t
+ */
+static const uint8_t ecma_typedarray_element_sizes[] =
+{
+  1, /* ECMA_ARRAYBUFFER_VIEW_INT8 */
+  1, /* ECMA_ARRAYBUFFER_VIEW_UINT8 */
+  1, /* ECMA_ARRAYBUFFER_VIEW_UINT8_CLAMPED */
+  2, /* ECMA_ARRAYBUFFER_VIEW_INT16 */
+  2, /* ECMA_ARRAYBUFFER_VIEW_UINT16 */
+  4, /* ECMA_ARRAYBUFFER_VIEW_INT32 */
+  4, /* ECMA_ARRAYBUFFER_VIEW_UINT32 */
+  4, /* ECMA_ARRAYBUFFER_VIEW_FLOAT32 */
+  8, /* ECMA_ARRAYBUFFER_VIEW_FLOAT64 */
+  1 /* ECMA_ARRAYBUFFER_VIEW_DATAVIEW */
+};
+
+/**
+ * Prototypes of views, indexed by ecma_arraybuffer_view_type_t
+ */
+static const ecma_builtin_id_t ecma_arraybuffer_view_prototype_ids[] =
+{
+  ECMA_BUILTIN_ID_INT8ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_UINT8ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_UINT8CLAMPEDARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_INT16ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_UINT16ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_INT32ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_UINT32ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_FLOAT32ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_FLOAT64ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_DATAVIEW_PROTOTYPE
+};
+
+/**
+ * [[Class]] names of views, indexed by ecma_arraybuffer_view_type_t
+ */
+static const lit_magic_string_id_t ecma_arraybuffer_view_class_names[] =
+{
+  LIT_MAGIC_STRING_INT8_ARRAY_UL,
+  LIT_MAGIC_STRING_UINT8_ARRAY_UL,
+  LIT_MAGIC_STRING_UINT8_CLAMPED_ARRAY_UL,
+  LIT_MAGIC_STRING_INT16_ARRAY_UL,
+  LIT_MAGIC_STRING_UINT16_ARRAY_UL,
+  LIT_MAGIC_STRING_INT32_ARRAY_UL,
+  LIT_MAGIC_STRING_UINT32_ARRAY_UL,
+  LIT_MAGIC_STRING_FLOAT32_ARRAY_UL,
+  LIT_MAGIC_STRING_FLOAT64_ARRAY_UL,
+  LIT_MAGIC_STRING_DATA_VIEW_UL
+};
+
+/**
+ * Get size of elements of a typed array
+ *
+ * @return size of an element, in bytes
+ */
+uint32_t
+ecma_op_typedarray_element_size (ecma_arraybuffer_view_type_t type) /**< type of the view */
+{
+  JERRY_ASSERT (type <= ECMA_ARRAYBUFFER_VIEW_DATAVIEW);
+
+  return ecma_typedarray_element_sizes[type];
+} /* ecma_op_typedarray_element_size */
+
+/**
+ * Read an element of the specified type
+ *
+ * Note:
+ *      the element is stored in the host's byte order, and may be unaligned
+ *
+ * @return value of the element
+ */
+ecma_number_t
+ecma_op_typedarray_read (ecma_arraybuffer_view_type_t type, /**< type of the element */
+                         const uint8_t *element_p) /**< the element's bytes */
+{
+  switch (type)
+  {
+    case ECMA_ARRAYBUFFER_VIEW_INT8:
+    {
+      return (ecma_number_t) *(const int8_t *) element_p;
+    }
+    case ECMA_ARRAYBUFFER_VIEW_UINT8:
+    case ECMA_ARRAYBUFFER_VIEW_UINT8_CLAMPED:
+    case ECMA_ARRAYBUFFER_VIEW_DATAVIEW:
+    {
+      return (ecma_number_t) *element_p;
+    }
+    case ECMA_ARRAYBUFFER_VIEW_INT16:
+    {
+      int16_t value;
+      memcpy (&value, element_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    case ECMA_ARRAYBUFFER_VIEW_UINT16:
+    {
+      uint16_t value;
+      memcpy (&value, element_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    case ECMA_ARRAYBUFFER_VIEW_INT32:
+    {
+      int32_t value;
+      memcpy (&value, element_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    case ECMA_ARRAYBUFFER_VIEW_UINT32:
+    {
+      uint32_t value;
+      memcpy (&value, element_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    case ECMA_ARRAYBUFFER_VIEW_FLOAT32:
+    {
+      float value;
+      memcpy (&value, element_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    default:
+    {
+      JERRY_ASSERT (type == ECMA_ARRAYBUFFER_VIEW_FLOAT64);
+
+      double value;
+      memcpy (&value, element_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+  }
+} /* ecma_op_typedarray_read */
+
+/**
+ * Convert the number to an element of Uint8ClampedArray
+ *
+ * See also:
+ *          ECMA-262 v6, 7.1.11
+ *
+ * @return the clamped value
+ */
+static uint8_t
+ecma_op_typedarray_clamp_uint8 (ecma_number_t num) /**< ecma-number */
+{
+  if (ecma_number_is_nan (num) || num <= 0)
+  {
+    return 0;
+  }
+
+  if (num >= 255)
+  {
+    return 255;
+  }
+
+  ecma_number_t trunc_num = ecma_number_trunc (num);
+  uint8_t value = (uint8_t) trunc_num;
+  ecma_number_t fraction = num - trunc_num;
+
+  /* round half to even */
+  if (fraction > 0.5f || (fraction == 0.5f && (value & 1u) != 0))
+  {
+    value++;
+  }
+
+  return value;
+} /* ecma_op_typedarray_clamp_uint8 */
+
+/**
+ * Write an element of the specified type
+ *
+ * Note:
+ *      the element is stored in the host's byte order, and may be unaligned
+ */
+void
+ecma_op_typedarray_write (ecma_arraybuffer_view_type_t type, /**< type of the element */
+                          uint8_t *element_p, /**< the element's bytes */
+                          ecma_number_t num) /**< value to convert and store */
+{
+  switch (type)
+  {
+    case ECMA_ARRAYBUFFER_VIEW_INT8:
+    case ECMA_ARRAYBUFFER_VIEW_UINT8:
+    case ECMA_ARRAYBUFFER_VIEW_DATAVIEW:
+    {
+      *element_p = (uint8_t) ecma_number_to_uint32 (num);
+      break;
+    }
+    case ECMA_ARRAYBUFFER_VIEW_UINT8_CLAMPED:
+    {
+      *element_p = ecma_op_typedarray_clamp_uint8 (num);
+      break;
+    }
+    case ECMA_ARRAYBUFFER_VIEW_INT16:
+    case ECMA_ARRAYBUFFER_VIEW_UINT16:
+    {
+      uint16_t value = (uint16_t) ecma_number_to_uint32 (num);
+      memcpy (element_p, &value, sizeof (value));
+      break;
+    }
+    case ECMA_ARRAYBUFFER_VIEW_INT32:
+    case ECMA_ARRAYBUFFER_VIEW_UINT32:
+    {
+      uint32_t value = ecma_number_to_uint32 (num);
+      memcpy (element_p, &value, sizeof (value));
+      break;
+    }
+    case ECMA_ARRAYBUFFER_VIEW_FLOAT32:
+    {
+      float value = (float) num;
+      memcpy (element_p, &value, sizeof (value));
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (type == ECMA_ARRAYBUFFER_VIEW_FLOAT64);
+
+      double value = (double) num;
+      memcpy (element_p, &value, sizeof (value));
+      break;
+    }
+  }
+} /* ecma_op_typedarray_write */
+
+/**
+ * Create a typed array or DataView object, viewing the ArrayBuffer
+ *
+ * Note:
+ *      the range of the view should be checked by the caller
+ *
+ * @return pointer to the object
+ */
+ecma_object_t *
+ecma_op_create_arraybuffer_view (ecma_object_t *arraybuffer_obj_p, /**< the ArrayBuffer object */
+                                 ecma_arraybuffer_view_type_t type, /**< type of the view */
+                                 uint32_t byte_offset, /**< offset of the view in the buffer */
+                                 uint32_t length) /**< number of elements (bytes of a DataView) */
+{
+  ecma_arraybuffer_t *arraybuffer_p = ecma_op_arraybuffer_get (arraybuffer_obj_p);
+
+  JERRY_ASSERT (arraybuffer_p != NULL);
+  JERRY_ASSERT (byte_offset <= arraybuffer_p->length
+                && length <= (arraybuffer_p->length - byte_offset) / ecma_op_typedarray_element_size (type));
+
+  ecma_object_t *prototype_obj_p = ecma_builtin_get (ecma_arraybuffer_view_prototype_ids[type]);
+  ecma_object_t *obj_p = ecma_create_object (prototype_obj_p, true, ECMA_OBJECT_TYPE_GENERAL);
+  ecma_deref_object (prototype_obj_p);
+
+  ecma_arraybuffer_view_t *view_p;
+  view_p = (ecma_arraybuffer_view_t *) mem_heap_alloc_block (sizeof (ecma_arraybuffer_view_t));
+  ECMA_SET_NON_NULL_POINTER (view_p->arraybuffer_cp, arraybuffer_obj_p);
+  ECMA_SET_NON_NULL_POINTER (view_p->store_cp, arraybuffer_p);
+  view_p->type = (uint8_t) type;
+  view_p->byte_offset = byte_offset;
+  view_p->length = length;
+
+  /* The description is the first property of the object, so it stays at the start of the property list */
+  ecma_property_t *view_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARRAYBUFFER_VIEW);
+  ECMA_SET_NON_NULL_POINTER (view_prop_p->v.internal_property.value, view_p);
+
+  ecma_property_t *class_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
+  class_prop_p->v.internal_property.value = ecma_arraybuffer_view_class_names[type];
+
+  JERRY_ASSERT (ecma_op_arraybuffer_view_get (obj_p) == view_p);
+
+  return obj_p;
+} /* ecma_op_create_arraybuffer_view */
+
+/**
+ * Get description of a typed array or DataView object
+ *
+ * @return pointer to the description - if the object is a typed array or a DataView,
+ *         NULL - otherwise
+ */
+ecma_arraybuffer_view_t *
+ecma_op_arraybuffer_view_get (ecma_object_t *obj_p) /**< object */
+{
+  if (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_GENERAL)
+  {
+    return NULL;
+  }
+
+  ecma_property_t *property_p = ecma_get_property_list (obj_p);
+
+  if (property_p != NULL
+      && property_p->flags == ECMA_PROPERTY_FLAG_SHAPED)
+  {
+    property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p);
+  }
+
+  if (property_p != NULL
+      && (property_p->flags & ECMA_PROPERTY_FLAG_INTERNAL)
+      && property_p->h.internal_property_type == ECMA_INTERNAL_PROPERTY_PROPERTY_HASHMAP)
+  {
+    property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p);
+  }
+
+  if (property_p != NULL
+      && (property_p->flags & ECMA_PROPERTY_FLAG_INTERNAL)
+      && property_p->h.internal_property_type == ECMA_INTERNAL_PROPERTY_ARRAYBUFFER_VIEW)
+  {
+    return ECMA_GET_NON_NULL_POINTER (ecma_arraybuffer_view_t, property_p->v.internal_property.value);
+  }
+
+  return NULL;
+} /* ecma_op_arraybuffer_view_get */
+
+/**
+ * Get description of a typed array object
+ *
+ * @return pointer to the description - if the object is a typed array,
+ *         NULL - otherwise
+ */
+ecma_arraybuffer_view_t *
+ecma_op_typedarray_get (ecma_object_t *obj_p) /**< object */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_op_arraybuffer_view_get (obj_p);
+
+  if (view_p == NULL || view_p->type == ECMA_ARRAYBUFFER_VIEW_DATAVIEW)
+  {
+    return NULL;
+  }
+
+  return view_p;
+} /* ecma_op_typedarray_get */
+
+/**
+ * Get backing store of the viewed ArrayBuffer
+ *
+ * @return pointer to the store
+ */
+ecma_arraybuffer_t *
+ecma_op_arraybuffer_view_get_arraybuffer (ecma_arraybuffer_view_t *view_p) /**< description of the view */
+{
+  return ECMA_GET_NON_NULL_POINTER (ecma_arraybuffer_t, view_p->store_cp);
+} /* ecma_op_arraybuffer_view_get_arraybuffer */
+
+/**
+ * Get pointer to the element of a typed array
+ *
+ * @return pointer to the element's bytes
+ */
+static uint8_t *
+ecma_op_typedarray_get_element_pointer (ecma_arraybuffer_view_t *view_p, /**< description of the typed array */
+                                        uint32_t index) /**< index of the element */
+{
+  JERRY_ASSERT (index < view_p->length);
+
+  ecma_arraybuffer_t *arraybuffer_p = ecma_op_arraybuffer_view_get_arraybuffer (view_p);
+  uint32_t element_size = ecma_op_typedarray_element_size ((ecma_arraybuffer_view_type_t) view_p->type);
+
+  return arraybuffer_p->buffer_p + view_p->byte_offset + index * element_size;
+} /* ecma_op_typedarray_get_element_pointer */
+
+/**
+ * Copy elements of the source object to the new typed array
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.1.3
+ *
+ * @return ecma value - empty, if the elements are copied,
+ *                      error, if getting or conversion of an element throws
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+ecma_op_typedarray_copy_elements (ecma_arraybuffer_view_t *view_p, /**< description of the new typed array */
+                                  ecma_object_t *source_obj_p) /**< the source object */
+{
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  ecma_arraybuffer_view_type_t type = (ecma_arraybuffer_view_type_t) view_p->type;
+  ecma_arraybuffer_view_t *source_view_p = ecma_op_typedarray_get (source_obj_p);
+
+  for (uint32_t index = 0; index < view_p->length && ecma_is_value_empty (ret_value); index++)
+  {
+    uint8_t *element_p = ecma_op_typedarray_get_element_pointer (view_p, index);
+
+    if (source_view_p != NULL)
+    {
+      ecma_arraybuffer_view_type_t source_type = (ecma_arraybuffer_view_type_t) source_view_p->type;
+      uint8_t *source_element_p = ecma_op_typedarray_get_element_pointer (source_view_p, index);
+
+      ecma_op_typedarray_write (type, element_p, ecma_op_typedarray_read (source_type, source_element_p));
+      continue;
+    }
+
+    ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+
+    ECMA_TRY_CATCH (element_value,
+                    ecma_op_object_get (source_obj_p, index_str_p),
+                    ret_value);
+
+    ECMA_OP_TO_NUMBER_TRY_CATCH (element_num, element_value, ret_value);
+
+    ecma_op_typedarray_write (type, element_p, element_num);
+
+    ECMA_OP_TO_NUMBER_FINALIZE (element_num);
+    ECMA_FINALIZE (element_value);
+
+    ecma_deref_ecma_string (index_str_p);
+  }
+
+  return ret_value;
+} /* ecma_op_typedarray_copy_elements */
+
+/**
+ * Create a typed array of the specified type, with a new ArrayBuffer of the specified length
+ *
+ * @return ecma value - the new object, or RangeError, if the buffer can't be allocated
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+ecma_op_create_typedarray_with_length (uint32_t length, /**< number of elements */
+                                       ecma_arraybuffer_view_type_t type) /**< type of the typed array */
+{
+  uint32_t element_size = ecma_op_typedarray_element_size (type);
+
+  if (length > UINT32_MAX / element_size)
+  {
+    return ecma_raise_range_error (ECMA_ERR_MSG ("Invalid typed array length."));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ECMA_TRY_CATCH (arraybuffer_value,
+                  ecma_op_create_arraybuffer_object (length * element_size),
+                  ret_value);
+
+  ecma_object_t *obj_p = ecma_op_create_arraybuffer_view (ecma_get_object_from_value (arraybuffer_value),
+                                                          type,
+                                                          0,
+                                                          length);
+  ret_value = ecma_make_object_value (obj_p);
+
+  ECMA_FINALIZE (arraybuffer_value);
+
+  return ret_value;
+} /* ecma_op_create_typedarray_with_length */
+
+/**
+ * Create a typed array, viewing the ArrayBuffer
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.1.4
+ *
+ * @return ecma value - the new object, or RangeError, if the range is not valid
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+ecma_op_create_typedarray_for_arraybuffer (ecma_object_t *arraybuffer_obj_p, /**< the ArrayBuffer object */
+                                           ecma_value_t byte_offset_value, /**< offset of the view */
+                                           ecma_value_t length_value, /**< number of elements */
+                                           ecma_arraybuffer_view_type_t type) /**< type of the typed array */
+{
+  ecma_arraybuffer_t *arraybuffer_p = ecma_op_arraybuffer_get (arraybuffer_obj_p);
+  uint32_t element_size = ecma_op_typedarray_element_size (type);
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t byte_offset = 0;
+  uint32_t length = 0;
+
+  ECMA_TRY_CATCH (byte_offset_empty_value,
+                  ecma_op_to_byte_length (byte_offset_value, &byte_offset),
+                  ret_value);
+
+  if (byte_offset % element_size != 0 || byte_offset > arraybuffer_p->length)
+  {
+    ret_value = ecma_raise_range_error (ECMA_ERR_MSG ("Invalid typed array offset."));
+  }
+  else if (ecma_is_value_undefined (length_value))
+  {
+    if ((arraybuffer_p->length - byte_offset) % element_size != 0)
+    {
+      ret_value = ecma_raise_range_error (ECMA_ERR_MSG ("Invalid typed array length."));
+    }
+    else
+    {
+      length = (arraybuffer_p->length - byte_offset) / element_size;
+    }
+  }
+  else
+  {
+    ECMA_TRY_CATCH (length_empty_value,
+                    ecma_op_to_byte_length (length_value, &length),
+                    ret_value);
+
+    if (length > (arraybuffer_p->length - byte_offset) / element_size)
+    {
+      ret_value = ecma_raise_range_error (ECMA_ERR_MSG ("Invalid typed array length."));
+    }
+
+    ECMA_FINALIZE (length_empty_value);
+  }
+
+  if (ecma_is_value_empty (ret_value))
+  {
+    ret_value = ecma_make_object_value (ecma_op_create_arraybuffer_view (arraybuffer_obj_p,
+                                                                         type,
+                                                                         byte_offset,
+                                                                         length));
+  }
+
+  ECMA_FINALIZE (byte_offset_empty_value);
+
+  return ret_value;
+} /* ecma_op_create_typedarray_for_arraybuffer */
+
+/**
+ * Typed array object creation operation
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_create_typedarray (const ecma_value_t *arguments_list_p, /**< arguments list */
+                           ecma_length_t arguments_list_len, /**< number of arguments */
+                           ecma_arraybuffer_view_type_t type) /**< type of the typed array */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+  JERRY_ASSERT (type < ECMA_ARRAYBUFFER_VIEW_DATAVIEW);
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  if (arguments_list_len == 0 || !ecma_is_value_object (arguments_list_p[0]))
+  {
+    /* 22.2.1.2: new TypedArray (length) */
+    uint32_t length = 0;
+    ecma_value_t length_value = ((arguments_list_len == 0) ? ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED)
+                                                           : arguments_list_p[0]);
+
+    ECMA_TRY_CATCH (length_empty_value,
+                    ecma_op_to_byte_length (length_value, &length),
+                    ret_value);
+
+    ret_value = ecma_op_create_typedarray_with_length (length, type);
+
+    ECMA_FINALIZE (length_empty_value);
+
+    return ret_value;
+  }
+
+  ecma_object_t *source_obj_p = ecma_get_object_from_value (arguments_list_p[0]);
+
+  if (ecma_op_arraybuffer_get (source_obj_p) != NULL)
+  {
+    /* 22.2.1.4: new TypedArray (buffer [, byteOffset [, length]]) */
+    ecma_value_t undefined_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+
+    return ecma_op_create_typedarray_for_arraybuffer (source_obj_p,
+                                                      arguments_list_len > 1 ? arguments_list_p[1] : undefined_value,
+                                                      arguments_list_len > 2 ? arguments_list_p[2] : undefined_value,
+                                                      type);
+  }
+
+  /* 22.2.1.3: new TypedArray (typedArray), or new TypedArray (object) */
+  ecma_arraybuffer_view_t *source_view_p = ecma_op_typedarray_get (source_obj_p);
+
+  if (source_view_p != NULL)
+  {
+    ret_value = ecma_op_create_typedarray_with_length (source_view_p->length, type);
+  }
+  else
+  {
+    ecma_string_t *length_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+
+    ECMA_TRY_CATCH (length_value,
+                    ecma_op_object_get (source_obj_p, length_str_p),
+                    ret_value);
+
+    ECMA_OP_TO_NUMBER_TRY_CATCH (length_num, length_value, ret_value);
+
+    ret_value = ecma_op_create_typedarray_with_length (ecma_number_to_uint32 (length_num), type);
+
+    ECMA_OP_TO_NUMBER_FINALIZE (length_num);
+    ECMA_FINALIZE (length_value);
+
+    ecma_deref_ecma_string (length_str_p);
+  }
+
+  if (!ecma_is_value_error (ret_value))
+  {
+    ecma_object_t *obj_p = ecma_get_object_from_value (ret_value);
+    ecma_value_t copy_value = ecma_op_typedarray_copy_elements (ecma_op_typedarray_get (obj_p), source_obj_p);
+
+    if (ecma_is_value_error (copy_value))
+    {
+      ecma_deref_object (obj_p);
+      ret_value = copy_value;
+    }
+  }
+
+  return ret_value;
+} /* ecma_op_create_typedarray */
+
+/**
+ * Get the element of a typed array
+ *
+ * See also:
+ *          ECMA-262 v6, 9.4.5.8
+ *
+ * @return ecma value - value of the element, or undefined, if the index is out of the typed array's range,
+ *                      empty, if the object is not a typed array, or the name is not an array index
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_typedarray_get_element (ecma_object_t *obj_p, /**< the object */
+                                ecma_string_t *property_name_p) /**< property name */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_op_typedarray_get (obj_p);
+  uint32_t index;
+
+  if (likely (view_p == NULL)
+      || !ecma_string_get_array_index (property_name_p, &index))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  }
+
+  if (index >= view_p->length)
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  return ecma_make_number_value (ecma_op_typedarray_read ((ecma_arraybuffer_view_type_t) view_p->type,
+                                    ecma_op_typedarray_get_element_pointer (view_p, index)));
+} /* ecma_op_typedarray_get_element */
+
+/**
+ * Set the element of a typed array
+ *
+ * Note:
+ *      assignments to indices, that are out of the typed array's range, are ignored
+ *
+ * See also:
+ *          ECMA-262 v6, 9.4.5.9
+ *
+ * @return ecma value - true, if the value is stored or ignored,
+ *                      error, if conversion of the value to number throws,
+ *                      empty, if the object is not a typed array, or the name is not an array index
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_typedarray_put_element (ecma_object_t *obj_p, /**< the object */
+                                ecma_string_t *property_name_p, /**< property name */
+                                ecma_value_t value) /**< ecma value */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_op_typedarray_get (obj_p);
+  uint32_t index;
+
+  if (likely (view_p == NULL)
+      || !ecma_string_get_array_index (property_name_p, &index))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (num, value, ret_value);
+
+  if (index < view_p->length)
+  {
+    ecma_op_typedarray_write ((ecma_arraybuffer_view_type_t) view_p->type,
+                              ecma_op_typedarray_get_element_pointer (view_p, index),
+                              num);
+  }
+
+  ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+
+  ECMA_OP_TO_NUMBER_FINALIZE (num);
+
+  return ret_value;
+} /* ecma_op_typedarray_put_element */
+
+/**
+ * Define the element of a typed array
+ *
+ * Elements are writable, enumerable and non-configurable data properties, which can't be redefined,
+ * and no other properties, named by array indices, could be defined for a typed array.
+ *
+ * See also:
+ *          ECMA-262 v6, 9.4.5.3
+ *
+ * @return ecma value - true, if the element is defined,
+ *                      false or TypeError (depending on the throw flag), if the definition is rejected,
+ *                      error, if conversion of the value to number throws,
+ *                      empty, if the object is not a typed array, or the name is not an array index
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_typedarray_define_element (ecma_object_t *obj_p, /**< the object */
+                                   ecma_string_t *property_name_p, /**< property name */
+                                   const ecma_property_descriptor_t *property_desc_p, /**< property descriptor */
+                                   bool is_throw) /**< flag that controls failure handling */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_op_typedarray_get (obj_p);
+  uint32_t index;
+
+  if (likely (view_p == NULL)
+      || !ecma_string_get_array_index (property_name_p, &index))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  }
+
+  if (index >= view_p->length
+      || property_desc_p->is_get_defined
+      || property_desc_p->is_set_defined
+      || (property_desc_p->is_configurable_defined && property_desc_p->is_configurable)
+      || (property_desc_p->is_enumerable_defined && !property_desc_p->is_enumerable)
+      || (property_desc_p->is_writable_defined && !property_desc_p->is_writable))
+  {
+    return ecma_reject (is_throw);
+  }
+
+  if (property_desc_p->is_value_defined)
+  {
+    return ecma_op_typedarray_put_element (obj_p, property_name_p, property_desc_p->value);
+  }
+
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+} /* ecma_op_typedarray_define_element */
+
+/**
+ * Delete the element of a typed array
+ *
+ * @return ecma value - false or TypeError (depending on the throw flag), if the element exists,
+ *                      as the elements are not configurable,
+ *                      true, if the index is out of the typed array's range,
+ *                      empty, if the object is not a typed array, or the name is not an array index
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_typedarray_delete_element (ecma_object_t *obj_p, /**< the object */
+                                   ecma_string_t *property_name_p, /**< property name */
+                                   bool is_throw) /**< flag that controls failure handling */
+{
+  ecma_arraybuffer_view_t *view_p = ecma_op_typedarray_get (obj_p);
+  uint32_t index;
+
+  if (likely (view_p == NULL)
+      || !ecma_string_get_array_index (property_name_p, &index))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  }
+
+  if (index < view_p->length)
+  {
+    return ecma_reject (is_throw);
+  }
+
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+} /* ecma_op_typedarray_delete_element */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
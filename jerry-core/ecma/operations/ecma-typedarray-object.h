@@ -0,0 +1,54 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_TYPEDARRAY_OBJECT_H
+#define ECMA_TYPEDARRAY_OBJECT_H
+
+#include "ecma-globals.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmatypedarrayobject ECMA typed array and DataView objects related routines
+ * @{
+ */
+
+extern uint32_t ecma_op_typedarray_element_size (ecma_arraybuffer_view_type_t);
+extern ecma_number_t ecma_op_typedarray_read (ecma_arraybuffer_view_type_t, const uint8_t *);
+extern void ecma_op_typedarray_write (ecma_arraybuffer_view_type_t, uint8_t *, ecma_number_t);
+
+extern ecma_object_t *
+ecma_op_create_arraybuffer_view (ecma_object_t *, ecma_arraybuffer_view_type_t, uint32_t, uint32_t);
+extern ecma_arraybuffer_view_t *ecma_op_arraybuffer_view_get (ecma_object_t *);
+extern ecma_arraybuffer_view_t *ecma_op_typedarray_get (ecma_object_t *);
+extern ecma_arraybuffer_t *ecma_op_arraybuffer_view_get_arraybuffer (ecma_arraybuffer_view_t *);
+extern ecma_value_t ecma_op_create_typedarray (const ecma_value_t *, ecma_length_t, ecma_arraybuffer_view_type_t);
+
+extern ecma_value_t ecma_op_typedarray_get_element (ecma_object_t *, ecma_string_t *);
+extern ecma_value_t ecma_op_typedarray_put_element (ecma_object_t *, ecma_string_t *, ecma_value_t);
+extern ecma_value_t
+ecma_op_typedarray_define_element (ecma_object_t *, ecma_string_t *, const ecma_property_descriptor_t *, bool);
+extern ecma_value_t ecma_op_typedarray_delete_element (ecma_object_t *, ecma_string_t *, bool);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+#endif /* !ECMA_TYPEDARRAY_OBJECT_H */
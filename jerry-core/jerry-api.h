@@ -138,6 +138,50 @@ typedef bool (*jerry_external_handler_t) (const jerry_api_object_t *function_obj
  */
 typedef void (*jerry_object_free_callback_t) (const uintptr_t native_p);
 
+/**
+ * Kinds of garbage collector's pauses
+ */
+typedef enum
+{
+  JERRY_API_GC_PAUSE_MINOR, /**< collection of young objects */
+  JERRY_API_GC_PAUSE_MAJOR, /**< collection of all objects, performed at once */
+  JERRY_API_GC_PAUSE_INCREMENTAL_SLICE /**< slice of an incremental collection of all objects */
+} jerry_api_gc_pause_kind_t;
+
+/**
+ * Number of buckets in the histogram of garbage collector's pause times
+ */
+#define JERRY_API_GC_PAUSE_HISTOGRAM_SIZE (10)
+
+/**
+ * Upper bound of the first bucket of the histogram of garbage collector's pause times, in microseconds
+ *
+ * Bound of each next bucket is twice the previous one's, and the last bucket counts all longer pauses.
+ */
+#define JERRY_API_GC_PAUSE_HISTOGRAM_MIN_US (16)
+
+/**
+ * Garbage collector's statistics, accumulated since engine initialization
+ */
+typedef struct
+{
+  size_t minor_gc_count; /**< number of minor collections */
+  size_t major_gc_count; /**< number of major collections, performed at once */
+  size_t incremental_gc_count; /**< number of major collections, completed by incremental slices */
+  size_t incremental_slice_count; /**< number of incremental slices */
+  size_t pause_sum_us; /**< sum of all pauses' times, in microseconds */
+  size_t pause_max_us; /**< maximum pause time, in microseconds */
+  size_t pause_histogram[JERRY_API_GC_PAUSE_HISTOGRAM_SIZE]; /**< numbers of pauses, by pause time */
+  size_t marked_objects; /**< number of objects, marked as live */
+  size_t swept_objects; /**< number of freed objects */
+  size_t reclaimed_bytes; /**< size of memory, freed during the pauses, in bytes */
+} jerry_api_gc_stats_t;
+
+/**
+ * Callback, invoked at start and at end of each garbage collector's pause
+ */
+typedef void (*jerry_api_gc_callback_t) (jerry_api_gc_pause_kind_t kind, void *user_data_p);
+
 /**
  * function type applied for each fields in objects
  */
@@ -280,8 +324,12 @@ void jerry_api_release_value (jerry_api_value_t *);
 
 jerry_api_object_t *jerry_api_create_array_object (jerry_api_size_t);
 jerry_api_object_t *jerry_api_create_object (void);
+jerry_api_object_t *jerry_api_create_external_arraybuffer (uint8_t *, jerry_api_length_t,
+                                                           jerry_object_free_callback_t);
 jerry_api_string_t *jerry_api_create_string (const jerry_api_char_t *);
 jerry_api_string_t *jerry_api_create_string_sz (const jerry_api_char_t *, jerry_api_size_t);
+jerry_api_string_t *jerry_api_create_external_string_sz (const jerry_api_char_t *, jerry_api_size_t,
+                                                         jerry_object_free_callback_t);
 
 bool jerry_api_set_array_index_value (jerry_api_object_t *, jerry_api_length_t, jerry_api_value_t *);
 bool jerry_api_get_array_index_value (jerry_api_object_t *, jerry_api_length_t, jerry_api_value_t *);
@@ -315,6 +363,9 @@ jerry_completion_code_t jerry_api_eval (const jerry_api_char_t *, size_t, bool,
 jerry_api_object_t *jerry_api_get_global (void);
 
 void jerry_api_gc (void);
+bool jerry_api_gc_step (uint32_t);
+void jerry_api_get_gc_stats (jerry_api_gc_stats_t *);
+void jerry_api_set_gc_callbacks (jerry_api_gc_callback_t, jerry_api_gc_callback_t, void *);
 void jerry_register_external_magic_strings (const jerry_api_char_ptr_t *, uint32_t, const jerry_api_length_t *);
 
 size_t jerry_parse_and_save_snapshot (const jerry_api_char_t *, size_t, bool, uint8_t *, size_t);
@@ -322,6 +373,7 @@ jerry_completion_code_t jerry_exec_snapshot (const void *, size_t, bool, jerry_a
 
 jerry_api_size_t jerry_api_get_string_size (const jerry_api_string_t *);
 jerry_api_length_t jerry_api_get_string_length (const jerry_api_string_t *);
+const jerry_api_char_t *jerry_api_get_string_chars (const jerry_api_string_t *, jerry_api_size_t *);
 
 jerry_api_string_t *jerry_api_value_to_string (const jerry_api_value_t *);
 
@@ -36,7 +36,14 @@ typedef struct
 
 /**
  * Jerry snapshot format version
+ *
+ * Byte code layout depends on width of compressed pointers,
+ * so snapshots of 32-bit compressed pointer builds are marked with a separate version.
  */
-#define JERRY_SNAPSHOT_VERSION (4u)
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+# define JERRY_SNAPSHOT_VERSION (5u)
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+# define JERRY_SNAPSHOT_VERSION (0x80000006u)
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
 
 #endif /* !JERRY_SNAPSHOT_H */
@@ -18,6 +18,7 @@
 
 #include "ecma-alloc.h"
 #include "ecma-array-object.h"
+#include "ecma-arraybuffer-object.h"
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
 #include "ecma-eval.h"
@@ -25,15 +26,18 @@
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
+#include "ecma-lcache.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
 #include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
 #include "jerry-snapshot.h"
 #include "lit-literal.h"
 #include "lit-magic-strings.h"
 #include "lit-snapshot.h"
 #include "js-parser.h"
 #include "re-compiler.h"
+#include "vm-inline-cache.h"
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
@@ -63,6 +67,21 @@ static jerry_flag_t jerry_flags;
  */
 static bool jerry_api_available;
 
+/**
+ * Callback, invoked at start of each garbage collector's pause
+ */
+static jerry_api_gc_callback_t jerry_gc_start_callback;
+
+/**
+ * Callback, invoked at end of each garbage collector's pause
+ */
+static jerry_api_gc_callback_t jerry_gc_end_callback;
+
+/**
+ * User data, passed to the garbage collector's callbacks
+ */
+static void *jerry_gc_callbacks_user_data_p;
+
 /** \addtogroup jerry_extension Jerry engine extension interface
  * @{
  */
@@ -396,14 +415,14 @@ jerry_api_convert_ecma_value_to_api_value (jerry_api_value_t *out_value_p, /**<
   }
   else if (ecma_is_value_number (value))
   {
-    ecma_number_t *num = ecma_get_number_from_value (value);
+    ecma_number_t num = ecma_get_number_from_value (value);
 
 #if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
     out_value_p->type = JERRY_API_DATA_TYPE_FLOAT32;
-    out_value_p->u.v_float32 = *num;
+    out_value_p->u.v_float32 = num;
 #elif CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
     out_value_p->type = JERRY_API_DATA_TYPE_FLOAT64;
-    out_value_p->u.v_float64 = *num;
+    out_value_p->u.v_float64 = num;
 #endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
   }
   else if (ecma_is_value_string (value))
@@ -460,28 +479,19 @@ jerry_api_convert_api_value_to_ecma_value (ecma_value_t *out_value_p, /**< [out]
     }
     case JERRY_API_DATA_TYPE_FLOAT32:
     {
-      ecma_number_t *num = ecma_alloc_number ();
-      *num = (ecma_number_t) (api_value_p->u.v_float32);
-
-      *out_value_p = ecma_make_number_value (num);
+      *out_value_p = ecma_make_number_value ((ecma_number_t) (api_value_p->u.v_float32));
 
       break;
     }
     case JERRY_API_DATA_TYPE_FLOAT64:
     {
-      ecma_number_t *num = ecma_alloc_number ();
-      *num = (ecma_number_t) (api_value_p->u.v_float64);
-
-      *out_value_p = ecma_make_number_value (num);
+      *out_value_p = ecma_make_number_value ((ecma_number_t) (api_value_p->u.v_float64));
 
       break;
     }
     case JERRY_API_DATA_TYPE_UINT32:
     {
-      ecma_number_t *num = ecma_alloc_number ();
-      *num = (ecma_number_t) (api_value_p->u.v_uint32);
-
-      *out_value_p = ecma_make_number_value (num);
+      *out_value_p = ecma_make_number_value ((ecma_number_t) (api_value_p->u.v_uint32));
 
       break;
     }
@@ -719,6 +729,30 @@ jerry_api_create_string_sz (const jerry_api_char_t *v, /**< string value */
                                          (lit_utf8_size_t) v_size);
 } /* jerry_api_create_string_sz */
 
+/**
+ * Create a string, which refers to the characters of a buffer, owned by the application
+ *
+ * Note:
+ *      the characters are not copied, so the buffer should be kept alive and unchanged, until the free callback
+ *      is called; the callback (if not NULL) is called with the buffer's pointer, when the string is freed
+ *      (short strings are copied, and the callback is called before the function returns).
+ *
+ *      caller should release the string with jerry_api_release_string, just when the value becomes unnecessary.
+ *
+ * @return pointer to created string
+ */
+jerry_api_string_t *
+jerry_api_create_external_string_sz (const jerry_api_char_t *v, /**< string value */
+                                     jerry_api_size_t v_size, /**< string size */
+                                     jerry_object_free_callback_t freecb_p) /**< free callback or NULL */
+{
+  jerry_assert_api_available ();
+
+  return ecma_new_ecma_external_string_from_utf8 ((const lit_utf8_byte_t *) v,
+                                                  (lit_utf8_size_t) v_size,
+                                                  (ecma_external_pointer_t) freecb_p);
+} /* jerry_api_create_external_string_sz */
+
 /**
  * Create an object
  *
@@ -735,6 +769,35 @@ jerry_api_create_object (void)
   return ecma_op_create_object_object_noarg ();
 } /* jerry_api_create_object */
 
+/**
+ * Create an ArrayBuffer object for a buffer, owned by the application
+ *
+ * Note:
+ *      the bytes are not copied, so the buffer should be kept alive, until the free callback is called;
+ *      the callback (if not NULL) is called with the buffer's pointer, when the object is garbage collected.
+ *
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created ArrayBuffer object
+ */
+jerry_api_object_t *
+jerry_api_create_external_arraybuffer (uint8_t *buffer_p, /**< the bytes (or NULL, if the length is 0) */
+                                       jerry_api_length_t length, /**< length of the buffer, in bytes */
+                                       jerry_object_free_callback_t freecb_p) /**< free callback or NULL */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+  JERRY_ASSERT (buffer_p != NULL || length == 0);
+
+  return ecma_op_create_external_arraybuffer_object (buffer_p,
+                                                     (uint32_t) length,
+                                                     (ecma_external_pointer_t) freecb_p);
+#else /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+  JERRY_UNIMPLEMENTED_REF_UNUSED_VARS ("ArrayBuffer is not supported in compact profile.", buffer_p, length, freecb_p);
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+} /* jerry_api_create_external_arraybuffer */
+
 /**
  * Create an array object
  *
@@ -748,9 +811,7 @@ jerry_api_create_array_object (jerry_api_size_t size) /* size of array */
 {
   JERRY_ASSERT (size > 0);
 
-  ecma_number_t *length_num_p = ecma_alloc_number ();
-  *length_num_p = ((ecma_number_t) size);
-  ecma_value_t array_length = ecma_make_number_value (length_num_p);
+  ecma_value_t array_length = ecma_make_number_value ((ecma_number_t) size);
 
   jerry_api_length_t argument_size = 1;
   ecma_value_t new_array_completion = ecma_op_create_array_object (&array_length, argument_size, true);
@@ -1016,6 +1077,30 @@ jerry_dispatch_object_free_callback (ecma_external_pointer_t freecb_p, /**< poin
   jerry_make_api_available ();
 } /* jerry_dispatch_object_free_callback */
 
+/**
+ * Dispatch call to garbage collector's start or end callback, if it is registered
+ *
+ * Note:
+ *       the callback is called during critical GC phase,
+ *       so, should not perform any requests to engine
+ */
+void
+jerry_dispatch_gc_callback (bool is_start, /**< true - if the pause is started,
+                                            *   false - if the pause is finished */
+                            jerry_api_gc_pause_kind_t kind) /**< kind of the pause */
+{
+  jerry_api_gc_callback_t callback = is_start ? jerry_gc_start_callback : jerry_gc_end_callback;
+
+  if (callback != NULL)
+  {
+    jerry_make_api_unavailable ();
+
+    callback (kind, jerry_gc_callbacks_user_data_p);
+
+    jerry_make_api_available ();
+  }
+} /* jerry_dispatch_gc_callback */
+
 /**
  * Check if the specified object is a function object.
  *
@@ -1076,21 +1161,66 @@ jerry_api_add_object_field (jerry_api_object_t *object_p, /**< object to add fie
     ecma_string_t *field_name_str_p = ecma_new_ecma_string_from_utf8 ((lit_utf8_byte_t *) field_name_p,
                                                                       (lit_utf8_size_t) field_name_size);
 
-    ecma_property_t *prop_p = ecma_op_object_get_own_property (object_p, field_name_str_p);
+    bool is_defined = ecma_op_object_has_own_property (object_p, field_name_str_p);
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+    uint32_t index;
 
-    if (prop_p == NULL)
+    if (ecma_op_typedarray_get (object_p) != NULL
+        && ecma_string_get_array_index (field_name_str_p, &index))
     {
-      is_successful = true;
+      /* Names of a typed array's elements can't be used for other properties */
+      is_defined = true;
+    }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
 
+    if (!is_defined)
+    {
       ecma_value_t value_to_put;
       jerry_api_convert_api_value_to_ecma_value (&value_to_put, field_value_p);
 
-      prop_p = ecma_create_named_data_property (object_p,
-                                                field_name_str_p,
-                                                is_writable,
-                                                true,
-                                                true);
-      ecma_named_data_property_assign_value (object_p, prop_p, value_to_put);
+#ifndef CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE
+      uint32_t element_index;
+
+      if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_ARRAY
+          && ecma_op_array_object_get_elements (object_p) != NULL
+          && ecma_string_get_array_index (field_name_str_p, &element_index))
+      {
+        /* The element is stored densely, unless it is not writable */
+        ecma_property_descriptor_t prop_desc = ecma_make_empty_property_descriptor ();
+
+        prop_desc.is_value_defined = true;
+        prop_desc.value = value_to_put;
+
+        prop_desc.is_writable_defined = true;
+        prop_desc.is_writable = is_writable;
+
+        prop_desc.is_enumerable_defined = true;
+        prop_desc.is_enumerable = true;
+
+        prop_desc.is_configurable_defined = true;
+        prop_desc.is_configurable = true;
+
+        ecma_value_t completion = ecma_op_object_define_own_property (object_p,
+                                                                      field_name_str_p,
+                                                                      &prop_desc,
+                                                                      false);
+        JERRY_ASSERT (ecma_is_value_boolean (completion));
+
+        is_successful = ecma_is_value_true (completion);
+      }
+      else
+#endif /* !CONFIG_ECMA_ARRAY_DENSE_ELEMENTS_DISABLE */
+      {
+        ecma_property_t *prop_p = ecma_create_named_data_property (object_p,
+                                                                   field_name_str_p,
+                                                                   is_writable,
+                                                                   true,
+                                                                   true);
+        ecma_named_data_property_assign_value (object_p, prop_p, value_to_put);
+
+        is_successful = true;
+      }
 
       ecma_free_value (value_to_put);
     }
@@ -1639,11 +1769,70 @@ jerry_api_gc (void)
   ecma_gc_run ();
 } /* jerry_api_gc */
 
+/**
+ * Perform a step of incremental GC, which takes approximately the specified time
+ *
+ * Note:
+ *      if no garbage collection is in progress, a new one is started,
+ *      so the function can be called upon each idle period of the embedder
+ *
+ * @return true - if the garbage collection was completed during the step,
+ *         false - otherwise (further steps are required to complete it)
+ */
+bool
+jerry_api_gc_step (uint32_t budget_us) /**< time budget of the step, in microseconds */
+{
+  jerry_assert_api_available ();
+
+  return ecma_gc_step (budget_us);
+} /* jerry_api_gc_step */
+
+/**
+ * Get garbage collector's statistics, accumulated since engine initialization
+ */
+void
+jerry_api_get_gc_stats (jerry_api_gc_stats_t *out_stats_p) /**< [out] statistics */
+{
+  jerry_assert_api_available ();
+
+  ecma_gc_get_stats (out_stats_p);
+} /* jerry_api_get_gc_stats */
+
+/**
+ * Register callbacks, invoked at start and at end of each garbage collector's pause
+ *
+ * Note:
+ *      the callbacks are called during critical GC phase, so they should not perform any requests to engine;
+ *      a callback could be NULL, if the corresponding event is not of interest
+ */
+void
+jerry_api_set_gc_callbacks (jerry_api_gc_callback_t start_callback, /**< callback, invoked at start of a pause */
+                            jerry_api_gc_callback_t end_callback, /**< callback, invoked at end of a pause */
+                            void *user_data_p) /**< user data, passed to the callbacks */
+{
+  jerry_assert_api_available ();
+
+  jerry_gc_start_callback = start_callback;
+  jerry_gc_end_callback = end_callback;
+  jerry_gc_callbacks_user_data_p = user_data_p;
+} /* jerry_api_set_gc_callbacks */
+
 /**
  * Jerry engine initialization
  */
 void
 jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
+{
+  jerry_init_with_gc_policy (flags, NULL);
+} /* jerry_init */
+
+/**
+ * Jerry engine initialization with specified garbage collection policy
+ */
+void
+jerry_init_with_gc_policy (jerry_flag_t flags, /**< combination of Jerry flags */
+                           const jerry_gc_policy_t *gc_policy_p) /**< garbage collection policy,
+                                                                  *   or NULL - to use the default policy */
 {
   if (flags & (JERRY_FLAG_ENABLE_LOG))
   {
@@ -1670,10 +1859,20 @@ jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
 
   jerry_make_api_available ();
 
+  jerry_gc_start_callback = NULL;
+  jerry_gc_end_callback = NULL;
+  jerry_gc_callbacks_user_data_p = NULL;
+
   mem_init ();
   lit_init ();
   ecma_init ();
-} /* jerry_init */
+  vm_inline_cache_init ();
+
+  if (gc_policy_p != NULL)
+  {
+    ecma_gc_set_policy (gc_policy_p->heap_growth_percent, gc_policy_p->min_heap_growth);
+  }
+} /* jerry_init_with_gc_policy */
 
 /**
  * Terminate Jerry engine
@@ -1685,6 +1884,15 @@ jerry_cleanup (void)
 
   bool is_show_mem_stats = ((jerry_flags & JERRY_FLAG_MEM_STATS) != 0);
 
+#ifdef MEM_STATS
+  if (is_show_mem_stats)
+  {
+    ecma_gc_stats_print ();
+    ecma_lcache_stats_print ();
+    vm_inline_cache_stats_print ();
+  }
+#endif /* MEM_STATS */
+
   vm_finalize ();
   ecma_finalize ();
   lit_finalize ();
@@ -1929,14 +2137,14 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p) /**< compiled
   uint8_t *src_buffer_p = (uint8_t *) compiled_code_p;
   uint8_t *dst_buffer_p = (uint8_t *) copied_compiled_code_p;
   lit_cpointer_t *src_literal_start_p;
-  uint16_t *dst_literal_start_p;
+  lit_cpointer_t *dst_literal_start_p;
   uint32_t const_literal_end;
   uint32_t literal_end;
 
   if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
   {
     src_literal_start_p = (lit_cpointer_t *) (src_buffer_p + sizeof (cbc_uint16_arguments_t));
-    dst_literal_start_p = (uint16_t *) (dst_buffer_p + sizeof (cbc_uint16_arguments_t));
+    dst_literal_start_p = (lit_cpointer_t *) (dst_buffer_p + sizeof (cbc_uint16_arguments_t));
 
     cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) src_buffer_p;
     literal_end = args_p->literal_end;
@@ -1945,7 +2153,7 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p) /**< compiled
   else
   {
     src_literal_start_p = (lit_cpointer_t *) (src_buffer_p + sizeof (cbc_uint8_arguments_t));
-    dst_literal_start_p = (uint16_t *) (dst_buffer_p + sizeof (cbc_uint8_arguments_t));
+    dst_literal_start_p = (lit_cpointer_t *) (dst_buffer_p + sizeof (cbc_uint8_arguments_t));
 
     cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) src_buffer_p;
     literal_end = args_p->literal_end;
@@ -2030,7 +2238,7 @@ jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
               current_p++;
             }
 
-            literal_start_p[i] = (uint16_t) current_p->literal_offset;
+            literal_start_p[i] = (lit_cpointer_t) current_p->literal_offset;
           }
         }
       }
@@ -2046,7 +2254,7 @@ jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
             current_p++;
           }
 
-          literal_start_p[i] = (uint16_t) current_p->literal_offset;
+          literal_start_p[i] = (lit_cpointer_t) current_p->literal_offset;
         }
       }
 
@@ -2473,3 +2681,29 @@ jerry_api_get_string_length (const jerry_api_string_t *str_p) /**< input string
 
   return ecma_string_get_length ((ecma_string_t *) str_p);
 } /* jerry_api_get_string_length */
+
+/**
+ * Get read-only pointer to the characters of Jerry string, without copying them
+ *
+ * Note:
+ *      the pointer is valid, while the string is not released;
+ *      strings, which are stored without a character buffer (e.g. numbers), should be
+ *      copied with jerry_api_string_to_char_buffer.
+ *
+ * @return pointer to the characters (size of the string is returned through size_p), if available
+ *         NULL - otherwise
+ */
+const jerry_api_char_t *
+jerry_api_get_string_chars (const jerry_api_string_t *str_p, /**< input string */
+                            jerry_api_size_t *size_p) /**< [out] size of the string in bytes */
+{
+  jerry_assert_api_available ();
+
+  lit_utf8_size_t size;
+  bool is_ascii;
+  const lit_utf8_byte_t *chars_p = ecma_string_raw_chars ((ecma_string_t *) str_p, &size, &is_ascii);
+
+  *size_p = (jerry_api_size_t) size;
+
+  return (const jerry_api_char_t *) chars_p;
+} /* jerry_api_get_string_chars */
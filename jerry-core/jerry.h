@@ -84,8 +84,20 @@ extern FILE *jerry_log_file;
  */
 typedef void (*jerry_error_callback_t) (jerry_fatal_code_t);
 
+/**
+ * Policy of starting garbage collection upon growth of the engine's heap usage
+ *
+ * A collection is started, when heap usage has grown since last collection by the specified share
+ * of the heap usage, that remained after the collection, and by at least the specified number of bytes.
+ */
+typedef struct
+{
+  uint32_t heap_growth_percent; /**< share of the heap usage after last collection, in percents */
+  uint32_t min_heap_growth; /**< minimum growth of the heap usage, in bytes */
+} jerry_gc_policy_t;
 
 void jerry_init (jerry_flag_t);
+void jerry_init_with_gc_policy (jerry_flag_t, const jerry_gc_policy_t *);
 void jerry_cleanup (void);
 
 void jerry_get_memory_limits (size_t *, size_t *);
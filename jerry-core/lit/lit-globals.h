@@ -125,17 +125,15 @@ typedef uint32_t lit_code_point_t;
 
 /**
  * ECMA string hash
+ *
+ * The hash is calculated from all characters of the string, and is truncated to 16 bits,
+ * so that it fits into the string descriptor (see also: ecma_string_t) without increasing its size.
  */
-typedef uint8_t lit_string_hash_t;
+typedef uint16_t lit_string_hash_t;
 
 /**
  * ECMA string hash value length, in bits
  */
 #define LIT_STRING_HASH_BITS (sizeof (lit_string_hash_t) * JERRY_BITSINBYTE)
 
-/**
- * Number of string's last characters to use for hash calculation
- */
-#define LIT_STRING_HASH_LAST_BYTES_COUNT (2)
-
 #endif /* !LIT_GLOBALS_H */
@@ -38,7 +38,7 @@ typedef enum
  */
 typedef struct
 {
-  uint16_t next; /* Compressed pointer to next record */
+  mem_cpointer_t next; /* Compressed pointer to next record */
   uint8_t type; /* Type of record */
 } lit_record_t;
 
@@ -56,9 +56,9 @@ typedef lit_record_t *lit_literal_t;
  */
 typedef struct
 {
-  uint16_t next; /* Compressed pointer to next record */
+  mem_cpointer_t next; /* Compressed pointer to next record */
   uint8_t type; /* Type of record */
-  uint8_t hash; /* Hash of the string */
+  lit_string_hash_t hash; /* Hash of the string */
   uint16_t size; /* Size of the string in bytes */
   uint16_t length; /* Number of character in the string */
 } lit_charset_record_t;
@@ -68,7 +68,7 @@ typedef struct
  */
 typedef struct
 {
-  uint16_t next; /* Compressed pointer to next record */
+  mem_cpointer_t next; /* Compressed pointer to next record */
   uint8_t type; /* Type of record */
   ecma_number_t number; /* Number stored in the record */
 } lit_number_record_t;
@@ -78,7 +78,7 @@ typedef struct
  */
 typedef struct
 {
-  uint16_t next; /* Compressed pointer to next record */
+  mem_cpointer_t next; /* Compressed pointer to next record */
   uint8_t type; /* Type of record */
   uint32_t magic_id; /* Magic ID stored in the record */
 } lit_magic_record_t;
@@ -569,7 +569,7 @@ lit_charset_literal_get_hash (lit_literal_t lit) /**< literal */
 
   const lit_charset_record_t *const rec_p = (const lit_charset_record_t *) lit;
 
-  return (lit_string_hash_t) rec_p->hash;
+  return rec_p->hash;
 } /* lit_charset_literal_get_hash */
 
 lit_magic_string_id_t
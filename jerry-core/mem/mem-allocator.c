@@ -119,12 +119,28 @@ void
 mem_run_try_to_give_memory_back_callbacks (mem_try_give_memory_back_severity_t severity) /**< severity of
                                                                                               the request */
 {
+#ifdef MEM_STATS
+  uint32_t fragmentation_before = 0;
+
+  if (severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_HIGH)
+  {
+    fragmentation_before = mem_heap_get_fragmentation ();
+  }
+#endif /* MEM_STATS */
+
   if (mem_try_give_memory_back_callback != NULL)
   {
     mem_try_give_memory_back_callback (severity);
   }
 
   mem_pools_collect_empty ();
+
+#ifdef MEM_STATS
+  if (severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_HIGH)
+  {
+    mem_heap_stats_give_back (fragmentation_before, mem_heap_get_fragmentation ());
+  }
+#endif /* MEM_STATS */
 } /* mem_run_try_to_give_memory_back_callbacks */
 
 #ifdef MEM_STATS
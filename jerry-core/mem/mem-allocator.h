@@ -31,7 +31,11 @@
 /**
  * Compressed pointer
  */
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
 typedef uint16_t mem_cpointer_t;
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+typedef uint32_t mem_cpointer_t;
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
 
 /**
  * Representation of NULL value for compressed pointers
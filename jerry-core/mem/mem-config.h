@@ -36,6 +36,10 @@
 /**
  * Logarithm of required alignment for allocated units/blocks
  */
-#define MEM_ALIGNMENT_LOG   3
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+# define MEM_ALIGNMENT_LOG   3
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+# define MEM_ALIGNMENT_LOG   4
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
 
 #endif /* !MEM_CONFIG_H */
@@ -90,44 +90,100 @@ void mem_heap_valgrind_freya_mempool_request (void)
 # define VALGRIND_FREYA_FREELIKE_SPACE(p)
 #endif /* JERRY_VALGRIND_FREYA */
 
-/* Calculate heap area size, leaving space for a pointer to the free list */
-#define MEM_HEAP_AREA_SIZE (MEM_HEAP_SIZE - MEM_ALIGNMENT)
-#define MEM_HEAP_END_OF_LIST ((mem_heap_free_t *const) ~((uint32_t) 0x0))
+/**
+ * Offset of a unit (MEM_ALIGNMENT bytes) in the heap area
+ */
+#ifndef CONFIG_MEM_CPOINTER_32_BIT
+typedef uint16_t mem_heap_offset_t;
+#else /* CONFIG_MEM_CPOINTER_32_BIT */
+typedef uint32_t mem_heap_offset_t;
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
+
+/**
+ * Offset, indicating end of a free region list
+ */
+#define MEM_HEAP_END_OF_LIST_OFFSET ((mem_heap_offset_t) ~((mem_heap_offset_t) 0))
 
 /**
  *  Free region node
+ *
+ * The last mem_heap_offset_t of a free region is its footer, containing size of the region in units,
+ * so the region can be found from its right neighbour.
  */
 typedef struct
 {
-  uint32_t next_offset; /* Offset of next region in list */
-  uint32_t size; /* Size of region */
+  mem_heap_offset_t next_offset; /* Offset of next region in list */
+  mem_heap_offset_t prev_offset; /* Offset of previous region in list */
+  mem_heap_offset_t units; /* Size of region in units */
 } mem_heap_free_t;
 
-#if UINTPTR_MAX > UINT32_MAX
-#define MEM_HEAP_GET_OFFSET_FROM_ADDR(p) ((uint32_t) ((uint8_t *) (p) - (uint8_t *) mem_heap.area))
-#define MEM_HEAP_GET_ADDR_FROM_OFFSET(u) ((mem_heap_free_t *) &mem_heap.area[u])
-#else
-/* In this case we simply store the pointer, since it fits anyway. */
-#define MEM_HEAP_GET_OFFSET_FROM_ADDR(p) ((uint32_t) (p))
-#define MEM_HEAP_GET_ADDR_FROM_OFFSET(u) ((mem_heap_free_t *)(u))
-#endif
+/**
+ * Free region node and footer should fit into a unit
+ */
+JERRY_STATIC_ASSERT (sizeof (mem_heap_free_t) + sizeof (mem_heap_offset_t) <= MEM_ALIGNMENT,
+                     size_of_mem_heap_free_t_with_footer_must_be_less_than_or_equal_to_MEM_ALIGNMENT);
+
+/**
+ * Number of bits in a word of the heap's bitmaps
+ */
+#define MEM_HEAP_BITMAP_WORD_BITS (32u)
+
+/**
+ * Number of words in the non-empty size classes' bitmap
+ */
+#define MEM_HEAP_CLASS_BITMAP_WORDS \
+  ((MEM_HEAP_CLASS_COUNT + MEM_HEAP_BITMAP_WORD_BITS - 1) / MEM_HEAP_BITMAP_WORD_BITS)
+
+/**
+ * Number of words in the bitmap of free regions' boundaries
+ */
+#define MEM_HEAP_BOUNDARY_BITMAP_WORDS \
+  ((MEM_HEAP_SIZE / MEM_ALIGNMENT + MEM_HEAP_BITMAP_WORD_BITS - 1) / MEM_HEAP_BITMAP_WORD_BITS)
 
 /**
- * Get end of region
+ * Segregated free region lists
  */
-static inline mem_heap_free_t *  __attr_always_inline___ __attr_pure___
-mem_heap_get_region_end (mem_heap_free_t *curr_p) /**< current region */
+typedef struct
 {
-  return (mem_heap_free_t *)((uint8_t *) curr_p + curr_p->size);
-} /* mem_heap_get_region_end */
+  uint32_t class_bitmap[MEM_HEAP_CLASS_BITMAP_WORDS]; /**< bitmap of size classes with non-empty free lists */
+  mem_heap_offset_t first_offset[MEM_HEAP_CLASS_COUNT]; /**< offsets of first free regions of the size classes */
+} mem_heap_free_lists_t;
+
+/**
+ * Size of the heap's header, containing the free region lists and the boundary bitmap
+ */
+#define MEM_HEAP_HEADER_SIZE \
+  JERRY_ALIGNUP (sizeof (mem_heap_free_lists_t) + MEM_HEAP_BOUNDARY_BITMAP_WORDS * sizeof (uint32_t), MEM_ALIGNMENT)
+
+/* Calculate heap area size, leaving space for the heap's header */
+#define MEM_HEAP_AREA_SIZE (MEM_HEAP_SIZE - MEM_HEAP_HEADER_SIZE)
+
+/**
+ * Number of units in the heap area
+ */
+#define MEM_HEAP_AREA_UNITS (MEM_HEAP_AREA_SIZE / MEM_ALIGNMENT)
+
+JERRY_STATIC_ASSERT (MEM_HEAP_AREA_UNITS < MEM_HEAP_END_OF_LIST_OFFSET,
+                     mem_heap_area_units_must_be_representable_with_mem_heap_offset_t);
+
+#define MEM_HEAP_GET_OFFSET_FROM_ADDR(p) \
+  ((mem_heap_offset_t) (((uint8_t *) (p) - (uint8_t *) mem_heap.area) >> MEM_ALIGNMENT_LOG))
+#define MEM_HEAP_GET_ADDR_FROM_OFFSET(u) ((mem_heap_free_t *) &mem_heap.area[(size_t) (u) << MEM_ALIGNMENT_LOG])
 
 /**
  * Heap structure
  */
 typedef struct
 {
-  /** First node in free region list */
-  mem_heap_free_t first;
+  /** Free region lists */
+  mem_heap_free_lists_t free_lists __attribute__ ((aligned (MEM_ALIGNMENT)));
+
+  /**
+   * Bitmap, in which first and last units of free regions are marked
+   *
+   * Bits of all other units, including units of allocated blocks, are cleared.
+   */
+  uint32_t boundary_bitmap[MEM_HEAP_BOUNDARY_BITMAP_WORDS];
 
   /**
    * Heap area
@@ -160,9 +216,6 @@ size_t mem_heap_allocated_size;
  */
 size_t mem_heap_limit;
 
-/* This is used to speed up deallocation. */
-mem_heap_free_t *mem_heap_list_skip_p;
-
 #ifdef MEM_STATS
 /**
  * Heap's memory usage statistics
@@ -172,28 +225,237 @@ static mem_heap_stats_t mem_heap_stats;
 static void mem_heap_stat_init (void);
 static void mem_heap_stat_alloc (size_t num);
 static void mem_heap_stat_free (size_t num);
-static void mem_heap_stat_skip ();
-static void mem_heap_stat_nonskip ();
 static void mem_heap_stat_alloc_iter ();
-static void mem_heap_stat_free_iter ();
+static void mem_heap_stat_insert_free_region (uint32_t class_idx, size_t size);
+static void mem_heap_stat_remove_free_region (uint32_t class_idx, size_t size);
+static void mem_heap_stat_merge ();
 
 #  define MEM_HEAP_STAT_INIT() mem_heap_stat_init ()
 #  define MEM_HEAP_STAT_ALLOC(v1) mem_heap_stat_alloc (v1)
 #  define MEM_HEAP_STAT_FREE(v1) mem_heap_stat_free (v1)
-#  define MEM_HEAP_STAT_SKIP() mem_heap_stat_skip ()
-#  define MEM_HEAP_STAT_NONSKIP() mem_heap_stat_nonskip ()
 #  define MEM_HEAP_STAT_ALLOC_ITER() mem_heap_stat_alloc_iter ()
-#  define MEM_HEAP_STAT_FREE_ITER() mem_heap_stat_free_iter ()
+#  define MEM_HEAP_STAT_INSERT_FREE_REGION(v1, v2) mem_heap_stat_insert_free_region (v1, v2)
+#  define MEM_HEAP_STAT_REMOVE_FREE_REGION(v1, v2) mem_heap_stat_remove_free_region (v1, v2)
+#  define MEM_HEAP_STAT_MERGE() mem_heap_stat_merge ()
 #else /* !MEM_STATS */
 #  define MEM_HEAP_STAT_INIT()
 #  define MEM_HEAP_STAT_ALLOC(v1)
 #  define MEM_HEAP_STAT_FREE(v1)
-#  define MEM_HEAP_STAT_SKIP()
-#  define MEM_HEAP_STAT_NONSKIP()
 #  define MEM_HEAP_STAT_ALLOC_ITER()
-#  define MEM_HEAP_STAT_FREE_ITER()
+#  define MEM_HEAP_STAT_INSERT_FREE_REGION(v1, v2)
+#  define MEM_HEAP_STAT_REMOVE_FREE_REGION(v1, v2)
+#  define MEM_HEAP_STAT_MERGE()
 #endif /* !MEM_STATS */
 
+/**
+ * Get size class of free regions consisting of the specified number of units
+ *
+ * @return index of the size class
+ */
+static inline uint32_t __attr_always_inline___ __attr_const___
+mem_heap_get_units_class (uint32_t units) /**< number of MEM_ALIGNMENT-sized units */
+{
+  JERRY_ASSERT (units > 0);
+
+  if (units <= MEM_HEAP_EXACT_CLASS_COUNT)
+  {
+    return units - 1;
+  }
+
+  const uint32_t units_log = (uint32_t) (31 - __builtin_clz (units));
+  const uint32_t subclass = (units >> (units_log - MEM_HEAP_SUBCLASS_LOG)) & (MEM_HEAP_SUBCLASS_COUNT - 1);
+
+  return (MEM_HEAP_EXACT_CLASS_COUNT
+          + (units_log - MEM_HEAP_EXACT_CLASS_LOG) * MEM_HEAP_SUBCLASS_COUNT
+          + subclass);
+} /* mem_heap_get_units_class */
+
+/**
+ * Get the smallest size class, all regions of which are large enough for the specified number of units
+ *
+ * @return index of the size class (MEM_HEAP_CLASS_COUNT or greater - if there is no such class)
+ */
+static inline uint32_t __attr_always_inline___ __attr_const___
+mem_heap_get_fit_units_class (uint32_t units) /**< required number of units */
+{
+  if (units > MEM_HEAP_EXACT_CLASS_COUNT)
+  {
+    /* Round up to the lower bound of the next subclass */
+    const uint32_t units_log = (uint32_t) (31 - __builtin_clz (units));
+    units += (1u << (units_log - MEM_HEAP_SUBCLASS_LOG)) - 1;
+  }
+
+  return mem_heap_get_units_class (units);
+} /* mem_heap_get_fit_units_class */
+
+/**
+ * Find the first size class with non-empty free list, starting from the specified one
+ *
+ * @return index of the size class - if found,
+ *         MEM_HEAP_CLASS_COUNT - otherwise
+ */
+static inline uint32_t __attr_always_inline___
+mem_heap_find_non_empty_class (uint32_t class_idx) /**< index of size class to start search from */
+{
+  if (unlikely (class_idx >= MEM_HEAP_CLASS_COUNT))
+  {
+    return MEM_HEAP_CLASS_COUNT;
+  }
+
+  uint32_t word_idx = class_idx / MEM_HEAP_BITMAP_WORD_BITS;
+  uint32_t bits = mem_heap.free_lists.class_bitmap[word_idx] & (~0u << (class_idx % MEM_HEAP_BITMAP_WORD_BITS));
+
+  while (bits == 0)
+  {
+    if (++word_idx == MEM_HEAP_CLASS_BITMAP_WORDS)
+    {
+      return MEM_HEAP_CLASS_COUNT;
+    }
+
+    bits = mem_heap.free_lists.class_bitmap[word_idx];
+  }
+
+  return word_idx * MEM_HEAP_BITMAP_WORD_BITS + (uint32_t) __builtin_ctz (bits);
+} /* mem_heap_find_non_empty_class */
+
+/**
+ * Check whether the unit is the first or the last unit of a free region
+ *
+ * @return true / false
+ */
+static inline bool __attr_always_inline___
+mem_heap_is_boundary_unit (uint32_t unit_offset) /**< offset of the unit */
+{
+  return ((mem_heap.boundary_bitmap[unit_offset / MEM_HEAP_BITMAP_WORD_BITS]
+           >> (unit_offset % MEM_HEAP_BITMAP_WORD_BITS)) & 1u) != 0;
+} /* mem_heap_is_boundary_unit */
+
+/**
+ * Set or clear bits of the first and the last units of a free region in the boundary bitmap
+ */
+static inline void __attr_always_inline___
+mem_heap_toggle_boundary_units (uint32_t first_unit_offset, /**< offset of the first unit of the region */
+                                uint32_t last_unit_offset) /**< offset of the last unit of the region */
+{
+  mem_heap.boundary_bitmap[first_unit_offset / MEM_HEAP_BITMAP_WORD_BITS] ^=
+    (1u << (first_unit_offset % MEM_HEAP_BITMAP_WORD_BITS));
+
+  if (last_unit_offset != first_unit_offset)
+  {
+    mem_heap.boundary_bitmap[last_unit_offset / MEM_HEAP_BITMAP_WORD_BITS] ^=
+      (1u << (last_unit_offset % MEM_HEAP_BITMAP_WORD_BITS));
+  }
+} /* mem_heap_toggle_boundary_units */
+
+/**
+ * Get footer of the free region, ending before the specified unit
+ *
+ * @return pointer to the footer
+ */
+static inline mem_heap_offset_t * __attr_always_inline___
+mem_heap_get_region_footer (uint32_t end_unit_offset) /**< offset of the unit, following the region */
+{
+  return ((mem_heap_offset_t *) MEM_HEAP_GET_ADDR_FROM_OFFSET (end_unit_offset)) - 1;
+} /* mem_heap_get_region_footer */
+
+/**
+ * Put free region to the free list of its size class
+ */
+static void
+mem_heap_insert_free_region (uint32_t unit_offset, /**< offset of the region's first unit */
+                             uint32_t units) /**< size of the region in units */
+{
+  JERRY_ASSERT (units > 0 && unit_offset + units <= MEM_HEAP_AREA_UNITS);
+
+  const uint32_t class_idx = mem_heap_get_units_class (units);
+  const mem_heap_offset_t first_offset = mem_heap.free_lists.first_offset[class_idx];
+  mem_heap_free_t *const region_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (unit_offset);
+  mem_heap_offset_t *const footer_p = mem_heap_get_region_footer (unit_offset + units);
+
+  VALGRIND_DEFINED_SPACE (region_p, sizeof (mem_heap_free_t));
+  region_p->units = (mem_heap_offset_t) units;
+  region_p->next_offset = first_offset;
+  region_p->prev_offset = MEM_HEAP_END_OF_LIST_OFFSET;
+  VALGRIND_NOACCESS_SPACE (region_p, sizeof (mem_heap_free_t));
+
+  VALGRIND_DEFINED_SPACE (footer_p, sizeof (mem_heap_offset_t));
+  *footer_p = (mem_heap_offset_t) units;
+  VALGRIND_NOACCESS_SPACE (footer_p, sizeof (mem_heap_offset_t));
+
+  if (first_offset != MEM_HEAP_END_OF_LIST_OFFSET)
+  {
+    mem_heap_free_t *const first_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (first_offset);
+
+    VALGRIND_DEFINED_SPACE (first_p, sizeof (mem_heap_free_t));
+    first_p->prev_offset = (mem_heap_offset_t) unit_offset;
+    VALGRIND_NOACCESS_SPACE (first_p, sizeof (mem_heap_free_t));
+  }
+
+  mem_heap.free_lists.first_offset[class_idx] = (mem_heap_offset_t) unit_offset;
+  mem_heap.free_lists.class_bitmap[class_idx / MEM_HEAP_BITMAP_WORD_BITS] |=
+    (1u << (class_idx % MEM_HEAP_BITMAP_WORD_BITS));
+
+  JERRY_ASSERT (!mem_heap_is_boundary_unit (unit_offset)
+                && !mem_heap_is_boundary_unit (unit_offset + units - 1));
+  mem_heap_toggle_boundary_units (unit_offset, unit_offset + units - 1);
+
+  MEM_HEAP_STAT_INSERT_FREE_REGION (class_idx, (size_t) units << MEM_ALIGNMENT_LOG);
+} /* mem_heap_insert_free_region */
+
+/**
+ * Remove free region from the free list of its size class
+ *
+ * @return size of the region in units
+ */
+static uint32_t
+mem_heap_remove_free_region (uint32_t unit_offset) /**< offset of the region's first unit */
+{
+  mem_heap_free_t *const region_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (unit_offset);
+
+  VALGRIND_DEFINED_SPACE (region_p, sizeof (mem_heap_free_t));
+  const uint32_t units = region_p->units;
+  const mem_heap_offset_t next_offset = region_p->next_offset;
+  const mem_heap_offset_t prev_offset = region_p->prev_offset;
+  VALGRIND_NOACCESS_SPACE (region_p, sizeof (mem_heap_free_t));
+
+  const uint32_t class_idx = mem_heap_get_units_class (units);
+
+  if (prev_offset == MEM_HEAP_END_OF_LIST_OFFSET)
+  {
+    JERRY_ASSERT (mem_heap.free_lists.first_offset[class_idx] == unit_offset);
+    mem_heap.free_lists.first_offset[class_idx] = next_offset;
+
+    if (next_offset == MEM_HEAP_END_OF_LIST_OFFSET)
+    {
+      mem_heap.free_lists.class_bitmap[class_idx / MEM_HEAP_BITMAP_WORD_BITS] &=
+        ~(1u << (class_idx % MEM_HEAP_BITMAP_WORD_BITS));
+    }
+  }
+  else
+  {
+    mem_heap_free_t *const prev_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (prev_offset);
+
+    VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
+    prev_p->next_offset = next_offset;
+    VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
+  }
+
+  if (next_offset != MEM_HEAP_END_OF_LIST_OFFSET)
+  {
+    mem_heap_free_t *const next_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset);
+
+    VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
+    next_p->prev_offset = prev_offset;
+    VALGRIND_NOACCESS_SPACE (next_p, sizeof (mem_heap_free_t));
+  }
+
+  mem_heap_toggle_boundary_units (unit_offset, unit_offset + units - 1);
+
+  MEM_HEAP_STAT_REMOVE_FREE_REGION (class_idx, (size_t) units << MEM_ALIGNMENT_LOG);
+
+  return units;
+} /* mem_heap_remove_free_region */
+
 /**
  * Startup initialization of heap
  */
@@ -202,20 +464,27 @@ mem_heap_init (void)
 {
   JERRY_STATIC_ASSERT ((uintptr_t) mem_heap.area % MEM_ALIGNMENT == 0,
                        mem_heap_area_must_be_multiple_of_MEM_ALIGNMENT);
+  JERRY_STATIC_ASSERT (MEM_HEAP_AREA_SIZE % MEM_ALIGNMENT == 0,
+                       mem_heap_area_size_must_be_multiple_of_MEM_ALIGNMENT);
 
   mem_heap_allocated_size = 0;
   mem_heap_limit = CONFIG_MEM_HEAP_DESIRED_LIMIT;
-  mem_heap.first.size = 0;
-  mem_heap_free_t *const region_p = (mem_heap_free_t *) mem_heap.area;
-  mem_heap.first.next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (region_p);
-  region_p->size = sizeof (mem_heap.area);
-  region_p->next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST);
 
-  mem_heap_list_skip_p = &mem_heap.first;
+  MEM_HEAP_STAT_INIT ();
+
+  memset (mem_heap.free_lists.class_bitmap, 0, sizeof (mem_heap.free_lists.class_bitmap));
+  memset (mem_heap.boundary_bitmap, 0, sizeof (mem_heap.boundary_bitmap));
+
+  for (uint32_t class_idx = 0; class_idx < MEM_HEAP_CLASS_COUNT; class_idx++)
+  {
+    mem_heap.free_lists.first_offset[class_idx] = MEM_HEAP_END_OF_LIST_OFFSET;
+  }
 
   VALGRIND_NOACCESS_SPACE (mem_heap.area, MEM_HEAP_AREA_SIZE);
 
-  MEM_HEAP_STAT_INIT ();
+  mem_heap_insert_free_region (0, MEM_HEAP_AREA_UNITS);
+
+  VALGRIND_NOACCESS_SPACE (&mem_heap.free_lists, sizeof (mem_heap.free_lists));
 } /* mem_heap_init */
 
 /**
@@ -224,12 +493,26 @@ mem_heap_init (void)
 void mem_heap_finalize (void)
 {
   JERRY_ASSERT (mem_heap_allocated_size == 0);
+
+#ifndef JERRY_NDEBUG
+  /* All of the heap area should be merged back into a single free region */
+  VALGRIND_DEFINED_SPACE (&mem_heap.free_lists, sizeof (mem_heap.free_lists));
+  const uint32_t class_idx = mem_heap_find_non_empty_class (0);
+  JERRY_ASSERT (class_idx == mem_heap_get_units_class (MEM_HEAP_AREA_UNITS));
+  JERRY_ASSERT (mem_heap.free_lists.first_offset[class_idx] == 0);
+  JERRY_ASSERT (mem_heap_find_non_empty_class (class_idx + 1) == MEM_HEAP_CLASS_COUNT);
+#endif /* !JERRY_NDEBUG */
+
   VALGRIND_NOACCESS_SPACE (&mem_heap, sizeof (mem_heap));
 } /* mem_heap_finalize */
 
 /**
  * Allocation of memory region.
  *
+ * A region of a size class, all regions of which are large enough, is taken,
+ * so the search is a constant time lookup in the non-empty size classes' bitmap.
+ * Only if there are no such regions, the size class of the required size is searched first-fit.
+ *
  * See also:
  *          mem_heap_alloc_block
  *
@@ -240,135 +523,88 @@ static __attribute__((hot))
 void *mem_heap_alloc_block_internal (const size_t size)
 {
   // Align size
-  const size_t required_size = ((size + MEM_ALIGNMENT - 1) / MEM_ALIGNMENT) * MEM_ALIGNMENT;
-  mem_heap_free_t *data_space_p = NULL;
+  const uint32_t required_units = (uint32_t) (JERRY_ALIGNUP (size, MEM_ALIGNMENT) >> MEM_ALIGNMENT_LOG);
+  uint32_t data_space_offset = MEM_HEAP_END_OF_LIST_OFFSET;
 
-  VALGRIND_DEFINED_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
+  VALGRIND_DEFINED_SPACE (&mem_heap.free_lists, sizeof (mem_heap.free_lists));
 
-  // Fast path for 8 byte chunks, first region is guaranteed to be sufficient
-  if (required_size == MEM_ALIGNMENT
-      && likely (mem_heap.first.next_offset != MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST)))
+  uint32_t class_idx = mem_heap_find_non_empty_class (mem_heap_get_fit_units_class (required_units));
+
+  if (likely (class_idx < MEM_HEAP_CLASS_COUNT))
   {
-    data_space_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (mem_heap.first.next_offset);
-    VALGRIND_DEFINED_SPACE (data_space_p, sizeof (mem_heap_free_t));
-    mem_heap_allocated_size += MEM_ALIGNMENT;
     MEM_HEAP_STAT_ALLOC_ITER ();
-
-    if (data_space_p->size == MEM_ALIGNMENT)
-    {
-      mem_heap.first.next_offset = data_space_p->next_offset;
-    }
-    else
-    {
-      JERRY_ASSERT (data_space_p->size > MEM_ALIGNMENT);
-      mem_heap_free_t *const remaining_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (mem_heap.first.next_offset) + 1;
-
-      VALGRIND_DEFINED_SPACE (remaining_p, sizeof (mem_heap_free_t));
-      remaining_p->size = data_space_p->size - MEM_ALIGNMENT;
-      remaining_p->next_offset = data_space_p->next_offset;
-      VALGRIND_NOACCESS_SPACE (remaining_p, sizeof (mem_heap_free_t));
-
-      mem_heap.first.next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (remaining_p);
-    }
-
-    VALGRIND_UNDEFINED_SPACE (data_space_p, sizeof (mem_heap_free_t));
-
-    if (unlikely (data_space_p == mem_heap_list_skip_p))
-    {
-      mem_heap_list_skip_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (mem_heap.first.next_offset);
-    }
+    data_space_offset = mem_heap.free_lists.first_offset[class_idx];
   }
-  // Slow path for larger regions
-  else
+  else if (required_units < MEM_HEAP_AREA_UNITS)
   {
-    mem_heap_free_t *current_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (mem_heap.first.next_offset);
-    mem_heap_free_t *prev_p = &mem_heap.first;
-    while (current_p != MEM_HEAP_END_OF_LIST)
+    // Slow path: only regions of the required size's own class could be sufficient
+    class_idx = mem_heap_get_units_class (required_units);
+
+    mem_heap_offset_t current_offset = mem_heap.free_lists.first_offset[class_idx];
+
+    while (current_offset != MEM_HEAP_END_OF_LIST_OFFSET)
     {
+      mem_heap_free_t *const current_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (current_offset);
       VALGRIND_DEFINED_SPACE (current_p, sizeof (mem_heap_free_t));
       MEM_HEAP_STAT_ALLOC_ITER ();
-      const uint32_t next_offset = current_p->next_offset;
 
-      if (current_p->size >= required_size)
+      const mem_heap_offset_t next_offset = current_p->next_offset;
+      const bool is_sufficient = (current_p->units >= required_units);
+      VALGRIND_NOACCESS_SPACE (current_p, sizeof (mem_heap_free_t));
+
+      if (is_sufficient)
       {
-        // Region is sufficiently big, store address
-        data_space_p = current_p;
-        mem_heap_allocated_size += required_size;
-
-        // Region was larger than necessary
-        if (current_p->size > required_size)
-        {
-          // Get address of remaining space
-          mem_heap_free_t *const remaining_p = (mem_heap_free_t *) ((uint8_t *) current_p + required_size);
-
-          // Update metadata
-          VALGRIND_DEFINED_SPACE (remaining_p, sizeof (mem_heap_free_t));
-          remaining_p->size = current_p->size - (uint32_t) required_size;
-          remaining_p->next_offset = next_offset;
-          VALGRIND_NOACCESS_SPACE (remaining_p, sizeof (mem_heap_free_t));
-
-          // Update list
-          VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
-          prev_p->next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (remaining_p);
-          VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
-        }
-        // Block is an exact fit
-        else
-        {
-          // Remove the region from the list
-          VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
-          prev_p->next_offset = next_offset;
-          VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
-        }
-
-        mem_heap_list_skip_p = prev_p;
-
-        // Found enough space
+        data_space_offset = current_offset;
         break;
       }
 
-      VALGRIND_NOACCESS_SPACE (current_p, sizeof (mem_heap_free_t));
       // Next in list
-      prev_p = current_p;
-      current_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset);
+      current_offset = next_offset;
     }
   }
 
-  while (mem_heap_allocated_size >= mem_heap_limit)
+  if (unlikely (data_space_offset == MEM_HEAP_END_OF_LIST_OFFSET))
   {
-    mem_heap_limit += CONFIG_MEM_HEAP_DESIRED_LIMIT;
+    VALGRIND_NOACCESS_SPACE (&mem_heap.free_lists, sizeof (mem_heap.free_lists));
+    return NULL;
   }
 
-  VALGRIND_NOACCESS_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
+  const uint32_t region_units = mem_heap_remove_free_region (data_space_offset);
+  JERRY_ASSERT (region_units >= required_units);
 
-  if (unlikely (!data_space_p))
+  // Region was larger than necessary, return the remaining space to the free lists
+  if (region_units > required_units)
   {
-    return NULL;
+    mem_heap_insert_free_region (data_space_offset + required_units, region_units - required_units);
+  }
+
+  mem_heap_allocated_size += (size_t) required_units << MEM_ALIGNMENT_LOG;
+
+  while (mem_heap_allocated_size >= mem_heap_limit)
+  {
+    mem_heap_limit += CONFIG_MEM_HEAP_DESIRED_LIMIT;
   }
 
+  VALGRIND_NOACCESS_SPACE (&mem_heap.free_lists, sizeof (mem_heap.free_lists));
+
+  void *data_space_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (data_space_offset);
+
   JERRY_ASSERT ((uintptr_t) data_space_p % MEM_ALIGNMENT == 0);
   VALGRIND_UNDEFINED_SPACE (data_space_p, size);
   MEM_HEAP_STAT_ALLOC (size);
 
-  return (void *) data_space_p;
-} /* mem_heap_finalize */
+  return data_space_p;
+} /* mem_heap_alloc_block_internal */
 
 /**
  * Allocation of memory block, running 'try to give memory back' callbacks, if there is not enough memory.
  *
- * Note:
- *      if after running the callbacks, there is still not enough memory, engine is terminated with ERR_OUT_OF_MEMORY.
- *
- * @return pointer to allocated memory block
+ * @return pointer to allocated memory block - if allocation is successful,
+ *         NULL - if there is not enough memory even after running the callbacks.
  */
-void * __attribute__((hot))
-mem_heap_alloc_block (const size_t size)
+static inline void * __attr_always_inline___
+mem_heap_gc_and_alloc_block (const size_t size) /**< required size */
 {
-  if (unlikely (size == 0))
-  {
-    return NULL;
-  }
-
   VALGRIND_FREYA_CHECK_MEMPOOL_REQUEST;
 
 #ifdef MEM_GC_BEFORE_EACH_ALLOC
@@ -403,15 +639,60 @@ mem_heap_alloc_block (const size_t size)
     }
   }
 
-  JERRY_ASSERT (data_space_p == NULL);
+  return NULL;
+} /* mem_heap_gc_and_alloc_block */
+
+/**
+ * Allocation of memory block, running 'try to give memory back' callbacks, if there is not enough memory.
+ *
+ * Note:
+ *      if after running the callbacks, there is still not enough memory, engine is terminated with ERR_OUT_OF_MEMORY.
+ *
+ * @return pointer to allocated memory block
+ */
+void * __attribute__((hot))
+mem_heap_alloc_block (const size_t size)
+{
+  if (unlikely (size == 0))
+  {
+    return NULL;
+  }
+
+  void *data_space_p = mem_heap_gc_and_alloc_block (size);
+
+  if (unlikely (data_space_p == NULL))
+  {
+    jerry_fatal (ERR_OUT_OF_MEMORY);
+  }
 
-  jerry_fatal (ERR_OUT_OF_MEMORY);
+  return data_space_p;
 } /* mem_heap_alloc_block */
 
+/**
+ * Allocation of memory block, running 'try to give memory back' callbacks, if there is not enough memory.
+ *
+ * Note:
+ *      unlike mem_heap_alloc_block, the engine is not terminated, if there is not enough memory,
+ *      so the routine is used for allocations, which size is controlled by the script.
+ *
+ * @return pointer to allocated memory block - if allocation is successful,
+ *         NULL - otherwise.
+ */
+void *
+mem_heap_alloc_block_null_on_error (const size_t size)
+{
+  if (unlikely (size == 0 || size >= MEM_HEAP_AREA_SIZE))
+  {
+    return NULL;
+  }
+
+  return mem_heap_gc_and_alloc_block (size);
+} /* mem_heap_alloc_block_null_on_error */
+
 /**
  *  Allocate block and store block size.
  *
- * Note: block will only be aligned to 4 bytes.
+ * Note: block is aligned to MEM_ALIGNMENT, as the size is stored in a MEM_ALIGNMENT-sized prefix.
  */
 inline void * __attr_always_inline___
 mem_heap_alloc_block_store_size (size_t size) /**< required size */
@@ -421,15 +702,18 @@ mem_heap_alloc_block_store_size (size_t size) /**< required size */
     return NULL;
   }
 
-  size += sizeof (mem_heap_free_t);
+  size += MEM_ALIGNMENT;
 
-  mem_heap_free_t *const data_space_p = (mem_heap_free_t *) mem_heap_alloc_block (size);
-  data_space_p->size = (uint32_t) size;
-  return (void *) (data_space_p + 1);
+  uint32_t *const data_space_p = (uint32_t *) mem_heap_alloc_block (size);
+  *data_space_p = (uint32_t) size;
+  return (void *) ((uint8_t *) data_space_p + MEM_ALIGNMENT);
 } /* mem_heap_alloc_block_store_size */
 
 /**
  * Free the memory block.
+ *
+ * The block is merged with its neighbours, if they are free. The neighbours are found
+ * in constant time with help of the boundary bitmap and footers of free regions.
  */
 void __attribute__((hot))
 mem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the block */
@@ -444,82 +728,48 @@ mem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the b
 
   VALGRIND_FREYA_FREELIKE_SPACE (ptr);
   VALGRIND_NOACCESS_SPACE (ptr, size);
-  MEM_HEAP_STAT_FREE_ITER ();
 
-  mem_heap_free_t *block_p = (mem_heap_free_t *) ptr;
-  mem_heap_free_t *prev_p;
-  mem_heap_free_t *next_p;
+  /* Realign size */
+  const size_t aligned_size = JERRY_ALIGNUP (size, MEM_ALIGNMENT);
 
-  VALGRIND_DEFINED_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
+  uint32_t unit_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (ptr);
+  uint32_t units = (uint32_t) (aligned_size >> MEM_ALIGNMENT_LOG);
 
-  if (block_p > mem_heap_list_skip_p)
-  {
-    prev_p = mem_heap_list_skip_p;
-    MEM_HEAP_STAT_SKIP ();
-  }
-  else
-  {
-    prev_p = &mem_heap.first;
-    MEM_HEAP_STAT_NONSKIP ();
-  }
+  JERRY_ASSERT (unit_offset + units <= MEM_HEAP_AREA_UNITS);
 
-  const uint32_t block_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
-  VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
-  // Find position of region in the list
-  while (prev_p->next_offset < block_offset)
-  {
-    mem_heap_free_t *const next_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
-    VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
-    VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
-    prev_p = next_p;
-    MEM_HEAP_STAT_FREE_ITER ();
-  }
-  next_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
-  VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
+  VALGRIND_DEFINED_SPACE (&mem_heap.free_lists, sizeof (mem_heap.free_lists));
 
-  /* Realign size */
-  const size_t aligned_size = (size + MEM_ALIGNMENT - 1) / MEM_ALIGNMENT * MEM_ALIGNMENT;
-
-  VALGRIND_DEFINED_SPACE (block_p, sizeof (mem_heap_free_t));
-  VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
-  // Update prev
-  if (mem_heap_get_region_end (prev_p) == block_p)
-  {
-    // Can be merged
-    prev_p->size += (uint32_t) aligned_size;
-    VALGRIND_NOACCESS_SPACE (block_p, sizeof (mem_heap_free_t));
-    block_p = prev_p;
-  }
-  else
+  // Merge with the preceding free region
+  if (unit_offset > 0 && mem_heap_is_boundary_unit (unit_offset - 1))
   {
-    block_p->size = (uint32_t) aligned_size;
-    prev_p->next_offset = block_offset;
-  }
+    mem_heap_offset_t *const footer_p = mem_heap_get_region_footer (unit_offset);
 
-  VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
-  // Update next
-  if (mem_heap_get_region_end (block_p) == next_p)
-  {
-    if (unlikely (next_p == mem_heap_list_skip_p))
-    {
-      mem_heap_list_skip_p = block_p;
-    }
+    VALGRIND_DEFINED_SPACE (footer_p, sizeof (mem_heap_offset_t));
+    const uint32_t prev_units = *footer_p;
+    VALGRIND_NOACCESS_SPACE (footer_p, sizeof (mem_heap_offset_t));
+
+    JERRY_ASSERT (prev_units > 0 && prev_units <= unit_offset);
+    unit_offset -= prev_units;
 
-    // Can be merged
-    block_p->size += next_p->size;
-    block_p->next_offset = next_p->next_offset;
+    mem_heap_remove_free_region (unit_offset);
+    units += prev_units;
 
+    MEM_HEAP_STAT_MERGE ();
   }
-  else
+
+  // Merge with the following free region
+  const uint32_t end_offset = unit_offset + units;
+
+  if (end_offset < MEM_HEAP_AREA_UNITS && mem_heap_is_boundary_unit (end_offset))
   {
-    block_p->next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (next_p);
+    units += mem_heap_remove_free_region (end_offset);
+
+    MEM_HEAP_STAT_MERGE ();
   }
 
-  mem_heap_list_skip_p = prev_p;
+  mem_heap_insert_free_region (unit_offset, units);
 
-  VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
-  VALGRIND_NOACCESS_SPACE (block_p, size);
-  VALGRIND_NOACCESS_SPACE (next_p, sizeof (mem_heap_free_t));
+  VALGRIND_NOACCESS_SPACE (&mem_heap.free_lists, sizeof (mem_heap.free_lists));
 
   JERRY_ASSERT (mem_heap_allocated_size > 0);
   mem_heap_allocated_size -= aligned_size;
@@ -529,20 +779,132 @@ mem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the b
     mem_heap_limit -= CONFIG_MEM_HEAP_DESIRED_LIMIT;
   }
 
-  VALGRIND_NOACCESS_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
   JERRY_ASSERT (mem_heap_limit >= mem_heap_allocated_size);
   MEM_HEAP_STAT_FREE (size);
 } /* mem_heap_free_block */
 
+/**
+ * Shrink the memory block in place, returning its tail to the heap.
+ *
+ * Note:
+ *      the beginning of the block, and so the block's pointer, are not changed
+ */
+void
+mem_heap_shrink_block (void *ptr, /**< pointer to beginning of data space of the block */
+                       const size_t old_size, /**< size of allocated region */
+                       const size_t new_size) /**< new size of the region */
+{
+  JERRY_ASSERT (new_size > 0 && new_size <= old_size);
+
+  const size_t aligned_old_size = JERRY_ALIGNUP (old_size, MEM_ALIGNMENT);
+  const size_t aligned_new_size = JERRY_ALIGNUP (new_size, MEM_ALIGNMENT);
+
+#ifdef MEM_STATS
+  mem_heap_stats.waste_bytes -= aligned_old_size - old_size;
+  mem_heap_stats.waste_bytes += aligned_new_size - new_size;
+#endif /* MEM_STATS */
+
+  if (aligned_new_size == aligned_old_size)
+  {
+    return;
+  }
+
+  uint8_t *tail_p = (uint8_t *) ptr + aligned_new_size;
+  const size_t tail_size = aligned_old_size - aligned_new_size;
+
+  VALGRIND_FREYA_CHECK_MEMPOOL_REQUEST;
+  VALGRIND_FREYA_FREELIKE_SPACE (ptr);
+  VALGRIND_FREYA_MALLOCLIKE_SPACE (ptr, new_size);
+  VALGRIND_FREYA_MALLOCLIKE_SPACE (tail_p, tail_size);
+
+  mem_heap_free_block (tail_p, tail_size);
+} /* mem_heap_shrink_block */
+
+/**
+ * Try to grow the memory block in place, taking the beginning of the free region, which follows the block.
+ *
+ * Note:
+ *      'try to give memory back' callbacks are not run
+ *
+ * @return true - if the block is grown,
+ *         false - otherwise (the block is not changed).
+ */
+bool
+mem_heap_try_grow_block (void *ptr, /**< pointer to beginning of data space of the block */
+                         const size_t old_size, /**< size of allocated region */
+                         const size_t new_size) /**< new size of the region */
+{
+  JERRY_ASSERT (old_size > 0 && new_size >= old_size);
+
+  const uint32_t old_units = (uint32_t) (JERRY_ALIGNUP (old_size, MEM_ALIGNMENT) >> MEM_ALIGNMENT_LOG);
+  const uint32_t new_units = (uint32_t) (JERRY_ALIGNUP (new_size, MEM_ALIGNMENT) >> MEM_ALIGNMENT_LOG);
+
+  if (new_units > old_units)
+  {
+    const uint32_t next_unit_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (ptr) + old_units;
+
+    /* The unit, following the block, can only be the first unit of a free region, if it is a boundary unit. */
+    if (next_unit_offset >= MEM_HEAP_AREA_UNITS || !mem_heap_is_boundary_unit (next_unit_offset))
+    {
+      return false;
+    }
+
+    mem_heap_free_t *const region_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (next_unit_offset);
+
+    VALGRIND_DEFINED_SPACE (region_p, sizeof (mem_heap_free_t));
+    const uint32_t region_units = region_p->units;
+    VALGRIND_NOACCESS_SPACE (region_p, sizeof (mem_heap_free_t));
+
+    const uint32_t grow_units = new_units - old_units;
+
+    if (region_units < grow_units)
+    {
+      return false;
+    }
+
+    VALGRIND_DEFINED_SPACE (&mem_heap.free_lists, sizeof (mem_heap.free_lists));
+
+    mem_heap_remove_free_region (next_unit_offset);
+
+    if (region_units > grow_units)
+    {
+      mem_heap_insert_free_region (next_unit_offset + grow_units, region_units - grow_units);
+    }
+
+    VALGRIND_NOACCESS_SPACE (&mem_heap.free_lists, sizeof (mem_heap.free_lists));
+
+    const size_t grow_size = (size_t) grow_units << MEM_ALIGNMENT_LOG;
+    mem_heap_allocated_size += grow_size;
+
+    while (mem_heap_allocated_size >= mem_heap_limit)
+    {
+      mem_heap_limit += CONFIG_MEM_HEAP_DESIRED_LIMIT;
+    }
+
+    VALGRIND_UNDEFINED_SPACE (MEM_HEAP_GET_ADDR_FROM_OFFSET (next_unit_offset), grow_size);
+    MEM_HEAP_STAT_ALLOC (grow_size);
+  }
+
+#ifdef MEM_STATS
+  mem_heap_stats.waste_bytes -= JERRY_ALIGNUP (old_size, MEM_ALIGNMENT) - old_size;
+  mem_heap_stats.waste_bytes += JERRY_ALIGNUP (new_size, MEM_ALIGNMENT) - new_size;
+#endif /* MEM_STATS */
+
+  VALGRIND_FREYA_CHECK_MEMPOOL_REQUEST;
+  VALGRIND_FREYA_FREELIKE_SPACE (ptr);
+  VALGRIND_FREYA_MALLOCLIKE_SPACE (ptr, new_size);
+
+  return true;
+} /* mem_heap_try_grow_block */
+
 /**
  * Free block with stored size
  */
 inline void __attr_always_inline___
 mem_heap_free_block_size_stored (void *ptr) /**< pointer to the memory block */
 {
-  mem_heap_free_t *const original_p = ((mem_heap_free_t *) ptr) - 1;
-  JERRY_ASSERT (original_p + 1 == ptr);
-  mem_heap_free_block (original_p, original_p->size);
+  uint32_t *const original_p = (uint32_t *) ((uint8_t *) ptr - MEM_ALIGNMENT);
+  mem_heap_free_block (original_p, *original_p);
 } /* mem_heap_free_block_size_stored */
 
 /**
@@ -607,6 +969,92 @@ mem_is_heap_pointer (const void *pointer) /**< pointer */
 } /* mem_is_heap_pointer */
 #endif /* !JERRY_NDEBUG */
 
+/**
+ * Get number of bytes, currently allocated in the heap
+ *
+ * @return allocated size, in bytes
+ */
+size_t
+mem_heap_get_allocated_size (void)
+{
+  return mem_heap_allocated_size;
+} /* mem_heap_get_allocated_size */
+
+/**
+ * Get size of the largest free region of the heap
+ *
+ * Only the free list of the highest non-empty size class is scanned.
+ *
+ * @return size of the region, in bytes
+ */
+size_t
+mem_heap_get_largest_free_region_size (void)
+{
+  uint32_t word_idx = MEM_HEAP_CLASS_BITMAP_WORDS;
+
+  VALGRIND_DEFINED_SPACE (&mem_heap.free_lists, sizeof (mem_heap.free_lists));
+
+  do
+  {
+    if (word_idx-- == 0)
+    {
+      VALGRIND_NOACCESS_SPACE (&mem_heap.free_lists, sizeof (mem_heap.free_lists));
+
+      return 0;
+    }
+  }
+  while (mem_heap.free_lists.class_bitmap[word_idx] == 0);
+
+  const uint32_t class_idx = (word_idx * MEM_HEAP_BITMAP_WORD_BITS
+                              + (MEM_HEAP_BITMAP_WORD_BITS - 1u)
+                              - (uint32_t) __builtin_clz (mem_heap.free_lists.class_bitmap[word_idx]));
+  JERRY_ASSERT (class_idx < MEM_HEAP_CLASS_COUNT);
+
+  uint32_t largest_units = 0;
+  mem_heap_offset_t current_offset = mem_heap.free_lists.first_offset[class_idx];
+
+  VALGRIND_NOACCESS_SPACE (&mem_heap.free_lists, sizeof (mem_heap.free_lists));
+
+  while (current_offset != MEM_HEAP_END_OF_LIST_OFFSET)
+  {
+    mem_heap_free_t *const current_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (current_offset);
+    VALGRIND_DEFINED_SPACE (current_p, sizeof (mem_heap_free_t));
+
+    largest_units = JERRY_MAX (largest_units, (uint32_t) current_p->units);
+    current_offset = current_p->next_offset;
+
+    VALGRIND_NOACCESS_SPACE (current_p, sizeof (mem_heap_free_t));
+  }
+
+  return (size_t) largest_units << MEM_ALIGNMENT_LOG;
+} /* mem_heap_get_largest_free_region_size */
+
+/**
+ * Get fragmentation of the heap's free space
+ *
+ * Fragmentation is the share of free bytes, that are not in the largest free region,
+ * i.e. the share of free memory, that could not be used for a single large allocation.
+ *
+ * @return fragmentation, in percents
+ */
+uint32_t
+mem_heap_get_fragmentation (void)
+{
+  JERRY_ASSERT (mem_heap_allocated_size <= MEM_HEAP_AREA_SIZE);
+
+  const size_t free_size = MEM_HEAP_AREA_SIZE - mem_heap_allocated_size;
+
+  if (free_size == 0)
+  {
+    return 0;
+  }
+
+  const size_t largest_free_region_size = mem_heap_get_largest_free_region_size ();
+  JERRY_ASSERT (largest_free_region_size <= free_size);
+
+  return (uint32_t) ((free_size - largest_free_region_size) * 100u / free_size);
+} /* mem_heap_get_fragmentation */
+
 #ifdef MEM_STATS
 /**
  * Get heap memory usage statistics
@@ -629,33 +1077,106 @@ mem_heap_stats_reset_peak (void)
   mem_heap_stats.peak_waste_bytes = mem_heap_stats.waste_bytes;
 } /* mem_heap_stats_reset_peak */
 
+/**
+ * Account high severity 'try to give memory back' pass
+ */
+void
+mem_heap_stats_give_back (uint32_t fragmentation_before, /**< fragmentation before the pass, in percents */
+                          uint32_t fragmentation_after) /**< fragmentation after the pass, in percents */
+{
+  mem_heap_stats.give_back_count++;
+
+  mem_heap_stats.fragmentation_before_give_back = fragmentation_before;
+  mem_heap_stats.fragmentation_after_give_back = fragmentation_after;
+  mem_heap_stats.fragmentation_before_give_back_sum += fragmentation_before;
+  mem_heap_stats.fragmentation_after_give_back_sum += fragmentation_after;
+
+  if (fragmentation_before > mem_heap_stats.peak_fragmentation)
+  {
+    mem_heap_stats.peak_fragmentation = fragmentation_before;
+  }
+} /* mem_heap_stats_give_back */
+
+/**
+ * Get lower bound of sizes of regions in the size class
+ *
+ * @return size in bytes
+ */
+static size_t
+mem_heap_get_size_class_lower_bound (uint32_t class_idx) /**< index of size class */
+{
+  if (class_idx < MEM_HEAP_EXACT_CLASS_COUNT)
+  {
+    return (size_t) (class_idx + 1) << MEM_ALIGNMENT_LOG;
+  }
+
+  const uint32_t range_idx = (class_idx - MEM_HEAP_EXACT_CLASS_COUNT) / MEM_HEAP_SUBCLASS_COUNT;
+  const uint32_t subclass = (class_idx - MEM_HEAP_EXACT_CLASS_COUNT) % MEM_HEAP_SUBCLASS_COUNT;
+  const uint32_t units_log = MEM_HEAP_EXACT_CLASS_LOG + range_idx;
+
+  return (size_t) ((MEM_HEAP_SUBCLASS_COUNT + subclass) << (units_log - MEM_HEAP_SUBCLASS_LOG)) << MEM_ALIGNMENT_LOG;
+} /* mem_heap_get_size_class_lower_bound */
+
 /**
  * Print heap memory usage statistics
  */
 void
 mem_heap_stats_print (void)
 {
+  const size_t alloc_count = JERRY_MAX (mem_heap_stats.alloc_count, 1);
+
   printf ("Heap stats:\n"
           "  Heap size = %zu bytes\n"
           "  Allocated = %zu bytes\n"
           "  Waste = %zu bytes\n"
           "  Peak allocated = %zu bytes\n"
           "  Peak waste = %zu bytes\n"
-          "  Skip-ahead ratio = %zu.%04zu\n"
           "  Average alloc iteration = %zu.%04zu\n"
-          "  Average free iteration = %zu.%04zu\n"
-          "\n",
+          "  Free count = %zu\n"
+          "  Merges with free neighbours = %zu\n",
           mem_heap_stats.size,
           mem_heap_stats.allocated_bytes,
           mem_heap_stats.waste_bytes,
           mem_heap_stats.peak_allocated_bytes,
           mem_heap_stats.peak_waste_bytes,
-          mem_heap_stats.skip_count / mem_heap_stats.nonskip_count,
-          mem_heap_stats.skip_count % mem_heap_stats.nonskip_count * 10000 / mem_heap_stats.nonskip_count,
-          mem_heap_stats.alloc_iter_count / mem_heap_stats.alloc_count,
-          mem_heap_stats.alloc_iter_count % mem_heap_stats.alloc_count * 10000 / mem_heap_stats.alloc_count,
-          mem_heap_stats.free_iter_count / mem_heap_stats.free_count,
-          mem_heap_stats.free_iter_count % mem_heap_stats.free_count * 10000 / mem_heap_stats.free_count);
+          mem_heap_stats.alloc_iter_count / alloc_count,
+          mem_heap_stats.alloc_iter_count % alloc_count * 10000 / alloc_count,
+          mem_heap_stats.free_count,
+          mem_heap_stats.merge_count);
+
+  if (mem_heap_stats.give_back_count != 0)
+  {
+    printf ("  High severity give back passes = %zu\n"
+            "  Fragmentation before / after last pass = %zu / %zu percent\n"
+            "  Average fragmentation before / after pass = %zu / %zu percent\n"
+            "  Peak fragmentation = %zu percent\n",
+            mem_heap_stats.give_back_count,
+            mem_heap_stats.fragmentation_before_give_back,
+            mem_heap_stats.fragmentation_after_give_back,
+            mem_heap_stats.fragmentation_before_give_back_sum / mem_heap_stats.give_back_count,
+            mem_heap_stats.fragmentation_after_give_back_sum / mem_heap_stats.give_back_count,
+            mem_heap_stats.peak_fragmentation);
+  }
+
+  printf ("  Size classes:\n");
+
+  for (uint32_t class_idx = 0; class_idx < MEM_HEAP_CLASS_COUNT; class_idx++)
+  {
+    if (mem_heap_stats.class_alloc_count[class_idx] == 0
+        && mem_heap_stats.class_free_regions[class_idx] == 0)
+    {
+      continue;
+    }
+
+    printf ("    %6zu .. %6zu bytes: allocs = %zu, free regions = %zu (%zu bytes)\n",
+            mem_heap_get_size_class_lower_bound (class_idx),
+            mem_heap_get_size_class_lower_bound (class_idx + 1) - MEM_ALIGNMENT,
+            mem_heap_stats.class_alloc_count[class_idx],
+            mem_heap_stats.class_free_regions[class_idx],
+            mem_heap_stats.class_free_bytes[class_idx]);
+  }
+
+  printf ("\n");
 } /* mem_heap_stats_print */
 
 /**
@@ -681,6 +1202,7 @@ mem_heap_stat_alloc (size_t size) /**< Size of allocated block */
   mem_heap_stats.allocated_bytes += aligned_size;
   mem_heap_stats.waste_bytes += waste_bytes;
   mem_heap_stats.alloc_count++;
+  mem_heap_stats.class_alloc_count[mem_heap_get_units_class ((uint32_t) (aligned_size >> MEM_ALIGNMENT_LOG))]++;
 
 
   if (mem_heap_stats.allocated_bytes > mem_heap_stats.peak_allocated_bytes)
@@ -717,40 +1239,47 @@ mem_heap_stat_free (size_t size) /**< Size of freed block */
 } /* mem_heap_stat_free */
 
 /**
- * Counts number of skip-aheads during insertion of free block
+ * Count number of iterations required for allocations
  */
 static void
-mem_heap_stat_skip ()
+mem_heap_stat_alloc_iter ()
 {
-  mem_heap_stats.skip_count++;
-} /* mem_heap_stat_skip  */
+  mem_heap_stats.alloc_iter_count++;
+} /* mem_heap_stat_alloc_iter */
 
 /**
- * Counts number of times we could not skip ahead during free block insertion
+ * Account insertion of a region to free list
  */
 static void
-mem_heap_stat_nonskip ()
+mem_heap_stat_insert_free_region (uint32_t class_idx, /**< size class of the region */
+                                  size_t size) /**< size of the region */
 {
-  mem_heap_stats.nonskip_count++;
-} /* mem_heap_stat_nonskip */
+  mem_heap_stats.class_free_regions[class_idx]++;
+  mem_heap_stats.class_free_bytes[class_idx] += size;
+} /* mem_heap_stat_insert_free_region */
 
 /**
- * Count number of iterations required for allocations
+ * Account removal of a region from free list
  */
 static void
-mem_heap_stat_alloc_iter ()
+mem_heap_stat_remove_free_region (uint32_t class_idx, /**< size class of the region */
+                                  size_t size) /**< size of the region */
 {
-  mem_heap_stats.alloc_iter_count++;
-} /* mem_heap_stat_alloc_iter */
+  JERRY_ASSERT (mem_heap_stats.class_free_regions[class_idx] > 0);
+  JERRY_ASSERT (mem_heap_stats.class_free_bytes[class_idx] >= size);
+
+  mem_heap_stats.class_free_regions[class_idx]--;
+  mem_heap_stats.class_free_bytes[class_idx] -= size;
+} /* mem_heap_stat_remove_free_region */
 
 /**
- * Counts number of iterations required for inserting free blocks
+ * Counts number of merges of freed blocks with neighbour free regions
  */
 static void
-mem_heap_stat_free_iter ()
+mem_heap_stat_merge ()
 {
-  mem_heap_stats.free_iter_count++;
-} /* mem_heap_stat_free_iter */
+  mem_heap_stats.merge_count++;
+} /* mem_heap_stat_merge */
 #endif /* MEM_STATS */
 
 /**
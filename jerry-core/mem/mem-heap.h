@@ -28,17 +28,43 @@
 #define MEM_HEAP_H
 
 #include "jrt.h"
+#include "mem-config.h"
+
+/**
+ * Size classes of free regions
+ *
+ * Regions of up to MEM_HEAP_EXACT_CLASS_COUNT units (of MEM_ALIGNMENT bytes) have
+ * a separate class for each size. Larger regions are grouped by power-of-two ranges,
+ * each range being split into MEM_HEAP_SUBCLASS_COUNT equally sized subclasses.
+ */
+#define MEM_HEAP_EXACT_CLASS_LOG 4
+#define MEM_HEAP_EXACT_CLASS_COUNT ((1u << MEM_HEAP_EXACT_CLASS_LOG) - 1u)
+#define MEM_HEAP_SUBCLASS_LOG 2
+#define MEM_HEAP_SUBCLASS_COUNT (1u << MEM_HEAP_SUBCLASS_LOG)
+
+/**
+ * Number of size classes
+ */
+#define MEM_HEAP_CLASS_COUNT \
+  (MEM_HEAP_EXACT_CLASS_COUNT \
+   + (MEM_HEAP_OFFSET_LOG - MEM_ALIGNMENT_LOG - MEM_HEAP_EXACT_CLASS_LOG) * MEM_HEAP_SUBCLASS_COUNT)
 
 
 extern void mem_heap_init (void);
 extern void mem_heap_finalize (void);
 extern void *mem_heap_alloc_block (const size_t);
+extern void *mem_heap_alloc_block_null_on_error (const size_t);
 extern void mem_heap_free_block (void *, const size_t);
+extern void mem_heap_shrink_block (void *, const size_t, const size_t);
+extern bool mem_heap_try_grow_block (void *, const size_t, const size_t);
 extern void *mem_heap_alloc_block_store_size (size_t);
 extern void mem_heap_free_block_size_stored (void *);
 extern uintptr_t mem_heap_compress_pointer (const void *);
 extern void *mem_heap_decompress_pointer (uintptr_t);
 extern bool mem_is_heap_pointer (const void *);
+extern size_t mem_heap_get_allocated_size (void);
+extern size_t mem_heap_get_largest_free_region_size (void);
+extern uint32_t mem_heap_get_fragmentation (void);
 
 #ifdef MEM_STATS
 /**
@@ -57,19 +83,29 @@ typedef struct
   size_t peak_waste_bytes; /**< peak bytes waste */
   size_t global_peak_waste_bytes; /**< non-resettable peak bytes waste */
 
-  size_t skip_count;
-  size_t nonskip_count;
+  size_t alloc_count; /**< number of allocations */
+  size_t alloc_iter_count; /**< number of free regions examined during allocations */
+
+  size_t free_count; /**< number of deallocations */
+
+  size_t merge_count; /**< number of merges of freed blocks with neighbour free regions */
 
-  size_t alloc_count;
-  size_t alloc_iter_count;
+  size_t give_back_count; /**< number of high severity 'try to give memory back' passes */
+  size_t fragmentation_before_give_back; /**< fragmentation (in percents) before last of the passes */
+  size_t fragmentation_after_give_back; /**< fragmentation (in percents) after last of the passes */
+  size_t fragmentation_before_give_back_sum; /**< sum of fragmentation values before the passes */
+  size_t fragmentation_after_give_back_sum; /**< sum of fragmentation values after the passes */
+  size_t peak_fragmentation; /**< peak fragmentation (in percents) before the passes */
 
-  size_t free_count;
-  size_t free_iter_count;
+  size_t class_alloc_count[MEM_HEAP_CLASS_COUNT]; /**< allocations per size class */
+  size_t class_free_regions[MEM_HEAP_CLASS_COUNT]; /**< free regions per size class */
+  size_t class_free_bytes[MEM_HEAP_CLASS_COUNT]; /**< free bytes per size class */
 } mem_heap_stats_t;
 
 extern void mem_heap_get_stats (mem_heap_stats_t *);
 extern void mem_heap_stats_reset_peak (void);
 extern void mem_heap_stats_print (void);
+extern void mem_heap_stats_give_back (uint32_t, uint32_t);
 #endif /* MEM_STATS */
 
 #ifdef JERRY_VALGRIND_FREYA
@@ -47,6 +47,11 @@ typedef struct mem_pools_chunk
  */
 mem_pools_chunk_t *mem_free_chunk_p;
 
+/**
+ * Number of chunks in the list of free pool chunks
+ */
+static size_t mem_free_chunks_number;
+
 #ifdef MEM_STATS
 
 /**
@@ -108,6 +113,7 @@ mem_pools_init (void)
                        size_of_mem_pools_chunk_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
 
   mem_free_chunk_p = NULL;
+  mem_free_chunks_number = 0;
 
   MEM_POOLS_STAT_INIT ();
 } /* mem_pools_init */
@@ -145,6 +151,7 @@ mem_pools_alloc (void)
     VALGRIND_DEFINED_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
 
     mem_free_chunk_p = chunk_p->next_p;
+    mem_free_chunks_number--;
 
     VALGRIND_UNDEFINED_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
 
@@ -169,6 +176,7 @@ mem_pools_free (void *chunk_p) /**< pointer to the chunk */
 
   chunk_to_free_p->next_p = mem_free_chunk_p;
   mem_free_chunk_p = chunk_to_free_p;
+  mem_free_chunks_number++;
 
   VALGRIND_NOACCESS_SPACE (chunk_to_free_p, MEM_POOL_CHUNK_SIZE);
 
@@ -191,8 +199,21 @@ mem_pools_collect_empty ()
     MEM_POOLS_STAT_DEALLOC ();
     mem_free_chunk_p = next_p;
   }
+
+  mem_free_chunks_number = 0;
 } /* mem_pools_collect_empty */
 
+/**
+ * Get size of memory, occupied by free pool chunks, that are not returned to the heap yet
+ *
+ * @return size, in bytes
+ */
+size_t
+mem_pools_get_free_size (void)
+{
+  return mem_free_chunks_number * MEM_POOL_CHUNK_SIZE;
+} /* mem_pools_get_free_size */
+
 #ifdef MEM_STATS
 /**
  * Get pools memory usage statistics
@@ -35,6 +35,7 @@ extern void mem_pools_finalize (void);
 extern void *mem_pools_alloc (void);
 extern void mem_pools_free (void *);
 extern void mem_pools_collect_empty (void);
+extern size_t mem_pools_get_free_size (void);
 
 #ifdef MEM_STATS
 /**
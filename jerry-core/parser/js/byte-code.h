@@ -638,6 +638,10 @@ typedef struct
   uint16_t ident_end;               /**< end position of the identifier group */
   uint16_t const_literal_end;       /**< end position of the const literal group */
   uint16_t literal_end;             /**< end position of the literal group */
+#ifdef CONFIG_MEM_CPOINTER_32_BIT
+  uint16_t padding;                 /**< aligns the literal pool, which follows the arguments,
+                                     *   to the size of 32-bit compressed pointers */
+#endif /* CONFIG_MEM_CPOINTER_32_BIT */
 } cbc_uint16_arguments_t;
 
 /* When CBC_CODE_FLAGS_FULL_LITERAL_ENCODING
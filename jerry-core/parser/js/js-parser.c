@@ -20,6 +20,12 @@
 #include "lit-literal.h"
 #include "lit-cpointer.h"
 
+/* The literal pool follows the arguments of the compiled code, so its items must stay aligned */
+JERRY_STATIC_ASSERT (sizeof (cbc_uint8_arguments_t) % sizeof (lit_cpointer_t) == 0,
+                     size_of_cbc_uint8_arguments_t_must_be_multiple_of_size_of_lit_cpointer_t);
+JERRY_STATIC_ASSERT (sizeof (cbc_uint16_arguments_t) % sizeof (lit_cpointer_t) == 0,
+                     size_of_cbc_uint16_arguments_t_must_be_multiple_of_size_of_lit_cpointer_t);
+
 #ifdef PARSER_DUMP_BYTE_CODE
 static int parser_show_instrs = PARSER_FALSE;
 #endif /* PARSER_DUMP_BYTE_CODE */
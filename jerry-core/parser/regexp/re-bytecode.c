@@ -127,7 +127,10 @@ re_bytecode_list_insert (re_bytecode_ctx_t *bc_ctx_p, /**< RegExp bytecode conte
 ecma_char_t __attr_always_inline___
 re_get_char (uint8_t **bc_p) /**< pointer to bytecode start */
 {
-  ecma_char_t chr = *((ecma_char_t *) *bc_p);
+  ecma_char_t chr;
+
+  /* Characters follow one byte opcodes, so they are not aligned */
+  memcpy (&chr, *bc_p, sizeof (ecma_char_t));
   (*bc_p) += sizeof (ecma_char_t);
   return chr;
 } /* re_get_char */
@@ -153,7 +156,10 @@ re_get_opcode (uint8_t **bc_p) /**< pointer to bytecode start */
 uint32_t __attr_always_inline___
 re_get_value (uint8_t **bc_p) /**< pointer to bytecode start */
 {
-  uint32_t value = *((uint32_t *) *bc_p);
+  uint32_t value;
+
+  /* Parameters follow one byte opcodes, so they are not aligned */
+  memcpy (&value, *bc_p, sizeof (uint32_t));
   (*bc_p) += sizeof (uint32_t);
   return value;
 } /* re_get_value */
@@ -0,0 +1,442 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Implementation of inline caches of property get / put byte codes
+ *
+ * Each cache row is owned by a byte code instruction (the site) and holds a few entries (ways),
+ * describing where a named data property was found in the receiver objects, which the site accessed recently:
+ *  - for a shaped object - the shape and the index of the slot, so the entry is shared by all objects
+ *    of the same layout (see also: ecma-shapes.c);
+ *  - for any other object - the object itself and the property record.
+ *
+ * A site starts monomorphic, with one entry, and becomes polymorphic, as receivers of other layouts are seen,
+ * replacing the entries in round-robin order, when all ways are used.
+ *
+ * Entries are valid only during the epoch, in which they were created. The epoch is advanced, whenever
+ * a property or a shape is freed, and when the garbage collector starts to free unreachable objects, so
+ * a compressed pointer, referenced by an entry, can't be reused by another object, property or shape,
+ * while the entry is valid. Changes of a property's attributes
+ * and of a slot's state are checked upon each hit.
+ */
+
+#include "ecma-helpers.h"
+#include "jrt-libc-includes.h"
+#include "vm-inline-cache.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_inline_cache Inline caches
+ * @{
+ */
+
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+JERRY_STATIC_ASSERT ((CONFIG_VM_INLINE_CACHE_SITES & (CONFIG_VM_INLINE_CACHE_SITES - 1)) == 0,
+                     CONFIG_VM_INLINE_CACHE_SITES_must_be_power_of_2);
+
+JERRY_STATIC_ASSERT (CONFIG_VM_INLINE_CACHE_WAYS > 0 && CONFIG_VM_INLINE_CACHE_WAYS <= UINT8_MAX,
+                     CONFIG_VM_INLINE_CACHE_WAYS_must_be_in_range_1_255);
+
+/**
+ * Entry of an inline cache
+ */
+typedef struct
+{
+  uint32_t epoch; /**< epoch, in which the entry was created (zero - if the entry is empty) */
+  uint32_t name_field; /**< identifier of the property's name (see also: vm_inline_cache_is_name_cacheable) */
+  mem_cpointer_t layout_cp; /**< compressed pointer to the shape (if is_shaped is true),
+                             *   or to the object - otherwise */
+  mem_cpointer_t location; /**< index of the property's slot (if is_shaped is true),
+                            *   or compressed pointer to the property - otherwise */
+  uint8_t name_container; /**< container of the property's name */
+  uint8_t is_shaped; /**< flag, indicating whether the property is stored in a slot of a shaped object */
+} vm_inline_cache_entry_t;
+
+/**
+ * Row of the inline caches' table, owned by one site
+ */
+typedef struct
+{
+  const uint8_t *site_p; /**< byte code instruction, owning the row */
+  vm_inline_cache_entry_t ways[CONFIG_VM_INLINE_CACHE_WAYS]; /**< entries */
+  uint8_t next_way; /**< way to replace, if all ways are used */
+} vm_inline_cache_row_t;
+
+/**
+ * Table of inline caches
+ */
+static vm_inline_cache_row_t vm_inline_cache_table[CONFIG_VM_INLINE_CACHE_SITES];
+
+/**
+ * Current epoch of the inline caches
+ */
+static uint32_t vm_inline_cache_epoch;
+
+#ifdef MEM_STATS
+/**
+ * Inline caches' statistics
+ */
+typedef struct
+{
+  size_t get_hits; /**< number of property gets, served by the caches */
+  size_t get_misses; /**< number of property gets, performed through the generic path */
+  size_t put_hits; /**< number of property puts, served by the caches */
+  size_t put_misses; /**< number of property puts, performed through the generic path */
+  size_t polymorphic_updates; /**< number of entries, added to sites, that already had a valid entry */
+  size_t invalidations; /**< number of epoch advancements */
+} vm_inline_cache_stats_t;
+
+/**
+ * Inline caches' statistics
+ */
+static vm_inline_cache_stats_t vm_inline_cache_stats;
+
+/**
+ * Increase the specified inline caches' statistics counter
+ */
+# define VM_INLINE_CACHE_STAT(counter) (vm_inline_cache_stats.counter++)
+#else /* MEM_STATS */
+# define VM_INLINE_CACHE_STAT(counter)
+#endif /* !MEM_STATS */
+
+/**
+ * Get the inline caches' table row of a site
+ *
+ * @return pointer to the row
+ */
+static inline vm_inline_cache_row_t * __attr_always_inline___
+vm_inline_cache_get_row (const uint8_t *site_p) /**< byte code instruction */
+{
+  uintptr_t site = (uintptr_t) site_p;
+
+  return vm_inline_cache_table + ((site ^ (site >> 8)) & (CONFIG_VM_INLINE_CACHE_SITES - 1));
+} /* vm_inline_cache_get_row */
+
+/**
+ * Check whether lookups of the property name can be cached
+ *
+ * Only names, identified by the container and the common field of the descriptor, are cached,
+ * i.e. literals and magic strings. Array indices are not cached, as they are usually different on each access.
+ *
+ * @return true - if the name can be cached,
+ *         false - otherwise
+ */
+static inline bool __attr_always_inline___
+vm_inline_cache_is_name_cacheable (const ecma_string_t *name_p) /**< property name */
+{
+  ecma_string_container_t container = ECMA_STRING_GET_CONTAINER (name_p);
+
+  return (container == ECMA_STRING_CONTAINER_LIT_TABLE
+          || container == ECMA_STRING_CONTAINER_MAGIC_STRING
+          || container == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
+} /* vm_inline_cache_is_name_cacheable */
+
+/**
+ * Find the property, described by a valid entry of the site's row, matching the receiver and the name
+ *
+ * @return pointer to the property - if it was found,
+ *         NULL - otherwise
+ */
+static ecma_property_t *
+vm_inline_cache_lookup (const uint8_t *site_p, /**< byte code instruction */
+                        ecma_object_t *object_p, /**< receiver object */
+                        ecma_string_t *name_p) /**< property name */
+{
+  vm_inline_cache_row_t *row_p = vm_inline_cache_get_row (site_p);
+
+  if (row_p->site_p != site_p
+      || !vm_inline_cache_is_name_cacheable (name_p))
+  {
+    return NULL;
+  }
+
+  uint8_t name_container = (uint8_t) ECMA_STRING_GET_CONTAINER (name_p);
+  ecma_property_slots_header_t *slots_header_p = ecma_get_property_slots (object_p);
+
+  mem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  for (uint32_t way = 0; way < CONFIG_VM_INLINE_CACHE_WAYS; way++)
+  {
+    vm_inline_cache_entry_t *entry_p = row_p->ways + way;
+
+    if (entry_p->epoch != vm_inline_cache_epoch
+        || entry_p->name_field != name_p->u.common_field
+        || entry_p->name_container != name_container)
+    {
+      continue;
+    }
+
+    ecma_property_t *property_p;
+
+    if (entry_p->is_shaped)
+    {
+      if (slots_header_p == NULL
+          || slots_header_p->shape_cp != entry_p->layout_cp
+          || entry_p->location >= slots_header_p->slots_number)
+      {
+        continue;
+      }
+
+      property_p = ecma_get_property_slot (slots_header_p, entry_p->location);
+    }
+    else
+    {
+      if (entry_p->layout_cp != object_cp)
+      {
+        continue;
+      }
+
+      property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_t, entry_p->location);
+    }
+
+    /* Deleted slots are zeroed, and the data properties may be redefined as accessors */
+    if (property_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA)
+    {
+      return property_p;
+    }
+  }
+
+  return NULL;
+} /* vm_inline_cache_lookup */
+#endif /* !CONFIG_VM_INLINE_CACHE_DISABLE */
+
+/**
+ * Initialize inline caches
+ */
+void
+vm_inline_cache_init (void)
+{
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+  memset (vm_inline_cache_table, 0, sizeof (vm_inline_cache_table));
+  vm_inline_cache_epoch = 1;
+
+#ifdef MEM_STATS
+  memset (&vm_inline_cache_stats, 0, sizeof (vm_inline_cache_stats));
+#endif /* MEM_STATS */
+#endif /* !CONFIG_VM_INLINE_CACHE_DISABLE */
+} /* vm_inline_cache_init */
+
+/**
+ * Invalidate all entries of the inline caches
+ *
+ * Note:
+ *      must be called, when a property or a shape is freed, and before objects are swept by the garbage collector
+ */
+void
+vm_inline_cache_invalidate_all (void)
+{
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+  VM_INLINE_CACHE_STAT (invalidations);
+
+  if (unlikely (++vm_inline_cache_epoch == 0))
+  {
+    /* Entries of the first epoch could become valid again */
+    vm_inline_cache_init ();
+  }
+#endif /* !CONFIG_VM_INLINE_CACHE_DISABLE */
+} /* vm_inline_cache_invalidate_all */
+
+/**
+ * Get value of an own named data property of the receiver, using the site's inline cache
+ *
+ * @return true - if the property was found in the cache (the value is copied to out_value_p),
+ *         false - otherwise (the generic [[Get]] should be performed, and the cache updated afterwards)
+ */
+bool
+vm_inline_cache_get (const uint8_t *site_p, /**< byte code instruction */
+                     ecma_object_t *object_p, /**< receiver object */
+                     ecma_string_t *name_p, /**< property name */
+                     ecma_value_t *out_value_p) /**< [out] value of the property */
+{
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+  if (ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_ARGUMENTS)
+  {
+    ecma_property_t *property_p = vm_inline_cache_lookup (site_p, object_p, name_p);
+
+    if (property_p != NULL)
+    {
+      VM_INLINE_CACHE_STAT (get_hits);
+
+      *out_value_p = ecma_copy_value (ecma_get_named_data_property_value (property_p));
+      return true;
+    }
+  }
+
+  VM_INLINE_CACHE_STAT (get_misses);
+#else /* CONFIG_VM_INLINE_CACHE_DISABLE */
+  (void) site_p;
+  (void) object_p;
+  (void) name_p;
+  (void) out_value_p;
+#endif /* CONFIG_VM_INLINE_CACHE_DISABLE */
+
+  return false;
+} /* vm_inline_cache_get */
+
+/**
+ * Assign value to an own writable named data property of the receiver, using the site's inline cache
+ *
+ * @return true - if the property was found in the cache, and the value was assigned,
+ *         false - otherwise (the generic [[Put]] should be performed, and the cache updated afterwards)
+ */
+bool
+vm_inline_cache_put (const uint8_t *site_p, /**< byte code instruction */
+                     ecma_object_t *object_p, /**< receiver object */
+                     ecma_string_t *name_p, /**< property name */
+                     ecma_value_t value) /**< value to assign */
+{
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+  /* [[DefineOwnProperty]] of other object types may have side effects (e.g. Array's 'length') */
+  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL)
+  {
+    ecma_property_t *property_p = vm_inline_cache_lookup (site_p, object_p, name_p);
+
+    if (property_p != NULL
+        && ecma_is_property_writable (property_p))
+    {
+      VM_INLINE_CACHE_STAT (put_hits);
+
+      ecma_named_data_property_assign_value (object_p, property_p, value);
+      return true;
+    }
+  }
+
+  VM_INLINE_CACHE_STAT (put_misses);
+#else /* CONFIG_VM_INLINE_CACHE_DISABLE */
+  (void) site_p;
+  (void) object_p;
+  (void) name_p;
+  (void) value;
+#endif /* CONFIG_VM_INLINE_CACHE_DISABLE */
+
+  return false;
+} /* vm_inline_cache_put */
+
+/**
+ * Add an entry, describing the receiver's own named data property, to the site's inline cache
+ *
+ * Note:
+ *      should be called after a generic property get or put, which was not served by the cache
+ */
+void
+vm_inline_cache_update (const uint8_t *site_p, /**< byte code instruction */
+                        ecma_object_t *object_p, /**< receiver object */
+                        ecma_string_t *name_p) /**< property name */
+{
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+  if (!vm_inline_cache_is_name_cacheable (name_p))
+  {
+    return;
+  }
+
+  ecma_property_t *property_p = ecma_find_named_property (object_p, name_p);
+
+  if (property_p == NULL
+      || !(property_p->flags & ECMA_PROPERTY_FLAG_NAMEDDATA))
+  {
+    return;
+  }
+
+  /* The lookup could run GC, so the row is accessed afterwards */
+  vm_inline_cache_row_t *row_p = vm_inline_cache_get_row (site_p);
+
+  if (row_p->site_p != site_p)
+  {
+    memset (row_p, 0, sizeof (vm_inline_cache_row_t));
+    row_p->site_p = site_p;
+  }
+
+  uint32_t way;
+
+  for (way = 0; way < CONFIG_VM_INLINE_CACHE_WAYS; way++)
+  {
+    if (row_p->ways[way].epoch != vm_inline_cache_epoch)
+    {
+      break;
+    }
+  }
+
+  if (way == CONFIG_VM_INLINE_CACHE_WAYS)
+  {
+    way = row_p->next_way;
+    row_p->next_way = (uint8_t) ((way + 1u) % CONFIG_VM_INLINE_CACHE_WAYS);
+
+    VM_INLINE_CACHE_STAT (polymorphic_updates);
+  }
+  else if (way > 0)
+  {
+    VM_INLINE_CACHE_STAT (polymorphic_updates);
+  }
+
+  vm_inline_cache_entry_t *entry_p = row_p->ways + way;
+
+  if (property_p->flags & ECMA_PROPERTY_FLAG_SHAPED)
+  {
+    ecma_property_slots_header_t *slots_header_p = ecma_get_property_slots (object_p);
+    JERRY_ASSERT (slots_header_p != NULL && slots_header_p->shape_cp != ECMA_NULL_POINTER);
+
+    entry_p->layout_cp = slots_header_p->shape_cp;
+    entry_p->location = (mem_cpointer_t) ecma_get_property_slot_index (slots_header_p, property_p);
+    entry_p->is_shaped = true;
+  }
+  else
+  {
+    ECMA_SET_NON_NULL_POINTER (entry_p->layout_cp, object_p);
+    ECMA_SET_NON_NULL_POINTER (entry_p->location, property_p);
+    entry_p->is_shaped = false;
+  }
+
+  entry_p->epoch = vm_inline_cache_epoch;
+  entry_p->name_field = name_p->u.common_field;
+  entry_p->name_container = (uint8_t) ECMA_STRING_GET_CONTAINER (name_p);
+#else /* CONFIG_VM_INLINE_CACHE_DISABLE */
+  (void) site_p;
+  (void) object_p;
+  (void) name_p;
+#endif /* CONFIG_VM_INLINE_CACHE_DISABLE */
+} /* vm_inline_cache_update */
+
+#ifdef MEM_STATS
+/**
+ * Print the inline caches' statistics
+ */
+void
+vm_inline_cache_stats_print (void)
+{
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+  printf ("Inline cache stats:\n"
+          "  Sites = %u, ways = %u\n"
+          "  Get: hits = %zu, misses = %zu\n"
+          "  Put: hits = %zu, misses = %zu\n"
+          "  Polymorphic updates = %zu\n"
+          "  Invalidations = %zu\n\n",
+          (unsigned int) CONFIG_VM_INLINE_CACHE_SITES,
+          (unsigned int) CONFIG_VM_INLINE_CACHE_WAYS,
+          vm_inline_cache_stats.get_hits,
+          vm_inline_cache_stats.get_misses,
+          vm_inline_cache_stats.put_hits,
+          vm_inline_cache_stats.put_misses,
+          vm_inline_cache_stats.polymorphic_updates,
+          vm_inline_cache_stats.invalidations);
+#endif /* !CONFIG_VM_INLINE_CACHE_DISABLE */
+} /* vm_inline_cache_stats_print */
+#endif /* MEM_STATS */
+
+/**
+ * @}
+ * @}
+ */
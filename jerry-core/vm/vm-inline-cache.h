@@ -0,0 +1,44 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_INLINE_CACHE_H
+#define VM_INLINE_CACHE_H
+
+#include "config.h"
+#include "ecma-globals.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_inline_cache Inline caches
+ * @{
+ */
+
+extern void vm_inline_cache_init (void);
+extern void vm_inline_cache_invalidate_all (void);
+extern bool vm_inline_cache_get (const uint8_t *, ecma_object_t *, ecma_string_t *, ecma_value_t *);
+extern bool vm_inline_cache_put (const uint8_t *, ecma_object_t *, ecma_string_t *, ecma_value_t);
+extern void vm_inline_cache_update (const uint8_t *, ecma_object_t *, ecma_string_t *);
+
+#ifdef MEM_STATS
+extern void vm_inline_cache_stats_print (void);
+#endif /* MEM_STATS */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !VM_INLINE_CACHE_H */
@@ -68,7 +68,7 @@ vm_stack_context_abort (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
     }
     case VM_CONTEXT_FOR_IN:
     {
-      mem_cpointer_t current = (uint16_t) vm_stack_top_p[-2];
+      mem_cpointer_t current = (mem_cpointer_t) vm_stack_top_p[-2];
 
       while (current != MEM_CP_NULL)
       {
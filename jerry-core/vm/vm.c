@@ -32,6 +32,7 @@
 #include "lit-literal-storage.h"
 #include "opcodes.h"
 #include "vm.h"
+#include "vm-inline-cache.h"
 #include "vm-stack.h"
 
 #include <alloca.h>
@@ -64,7 +65,8 @@ static ecma_compiled_code_t *__program = NULL;
  * @return ecma value
  */
 static ecma_value_t
-vm_op_get_value (ecma_value_t object, /**< base object */
+vm_op_get_value (const uint8_t *site_p, /**< byte code instruction */
+                 ecma_value_t object, /**< base object */
                  ecma_value_t property, /**< property name */
                  bool is_strict) /**< strict mode */
 {
@@ -73,6 +75,21 @@ vm_op_get_value (ecma_value_t object, /**< base object */
     return ecma_raise_type_error (ECMA_ERR_MSG (""));
   }
 
+  bool is_cacheable = (ecma_is_value_object (object) && ecma_is_value_string (property));
+
+  if (is_cacheable)
+  {
+    ecma_value_t value;
+
+    if (vm_inline_cache_get (site_p,
+                             ecma_get_object_from_value (object),
+                             ecma_get_string_from_value (property),
+                             &value))
+    {
+      return value;
+    }
+  }
+
   ecma_value_t completion_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (property_val,
@@ -87,6 +104,11 @@ vm_op_get_value (ecma_value_t object, /**< base object */
 
   ecma_free_reference (reference);
 
+  if (is_cacheable && !ecma_is_value_error (completion_value))
+  {
+    vm_inline_cache_update (site_p, ecma_get_object_from_value (object), property_p);
+  }
+
   ECMA_FINALIZE (property_val);
 
   return completion_value;
@@ -98,11 +120,25 @@ vm_op_get_value (ecma_value_t object, /**< base object */
  * @return ecma value
  */
 static ecma_value_t
-vm_op_set_value (ecma_value_t object, /**< base object */
+vm_op_set_value (const uint8_t *site_p, /**< byte code instruction */
+                 ecma_value_t object, /**< base object */
                  ecma_value_t property, /**< property name */
                  ecma_value_t value, /**< ecma value */
                  bool is_strict) /**< strict mode */
 {
+  bool is_cacheable = (ecma_is_value_object (object)
+                       && ecma_is_value_string (property)
+                       && !ecma_is_lexical_environment (ecma_get_object_from_value (object)));
+
+  if (is_cacheable
+      && vm_inline_cache_put (site_p,
+                              ecma_get_object_from_value (object),
+                              ecma_get_string_from_value (property),
+                              value))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+
   ecma_value_t completion_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (obj_val,
@@ -129,6 +165,11 @@ vm_op_set_value (ecma_value_t object, /**< base object */
                                            property_p,
                                            value,
                                            is_strict);
+
+    if (is_cacheable && !ecma_is_value_error (completion_value))
+    {
+      vm_inline_cache_update (site_p, object_p, property_p);
+    }
   }
 
   ECMA_FINALIZE (property_val);
@@ -512,9 +553,7 @@ enum
       lit_literal_t lit = lit_cpointer_decompress (lit_cpointer); \
       if (unlikely (LIT_RECORD_IS_NUMBER (lit))) \
       { \
-        ecma_number_t *number_p = ecma_alloc_number (); \
-        *number_p = lit_number_literal_get_number (lit); \
-        (target_value) = ecma_make_number_value (number_p); \
+        (target_value) = ecma_make_number_value (lit_number_literal_get_number (lit)); \
       } \
       else \
       { \
@@ -952,11 +991,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_PUSH_NUMBER:
         {
-          ecma_number_t *number_p = ecma_alloc_number ();
-
           if (opcode == CBC_PUSH_NUMBER_0)
           {
-            *number_p = 0;
+            result = ecma_make_number_value (ECMA_NUMBER_ZERO);
           }
           else
           {
@@ -968,10 +1005,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             {
               value = -(value - CBC_PUSH_NUMBER_1_RANGE_END);
             }
-            *number_p = (ecma_number_t) value;
+            result = ecma_make_number_value ((ecma_number_t) value);
           }
-
-          result = ecma_make_number_value (number_p);
           break;
         }
         case VM_OC_PUSH_OBJECT:
@@ -1061,7 +1096,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_object_t *array_obj_p;
           ecma_string_t *length_str_p;
           ecma_property_t *length_prop_p;
-          ecma_number_t *length_num_p;
+          uint32_t length;
           ecma_property_descriptor_t prop_desc;
 
           prop_desc = ecma_make_empty_property_descriptor ();
@@ -1085,29 +1120,34 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (length_prop_p != NULL);
 
           left_value = ecma_get_named_data_property_value (length_prop_p);
-          length_num_p = ecma_get_number_from_value (left_value);
+          length = ecma_number_to_uint32 (ecma_get_number_from_value (left_value));
 
           ecma_deref_ecma_string (length_str_p);
 
           for (uint32_t i = 0; i < right_value; i++)
           {
+            /* The length is increased first, so that definition of the element does not change it */
+            uint32_t index = length++;
+
+            left_value = ecma_make_uint32_value (length);
+            ecma_named_data_property_assign_value (array_obj_p, length_prop_p, left_value);
+            ecma_free_value (left_value);
+
             if (!ecma_is_value_array_hole (stack_top_p[i]))
             {
-              ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 ((uint32_t) *length_num_p);
+              ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
 
               prop_desc.value = stack_top_p[i];
 
-              ecma_op_general_object_define_own_property (array_obj_p,
-                                                          index_str_p,
-                                                          &prop_desc,
-                                                          false);
+              ecma_op_object_define_own_property (array_obj_p,
+                                                  index_str_p,
+                                                  &prop_desc,
+                                                  false);
 
               ecma_deref_ecma_string (index_str_p);
 
               ecma_free_value (stack_top_p[i]);
             }
-
-            (*length_num_p)++;
           }
 
           break;
@@ -1196,7 +1236,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         case VM_OC_PROP_POST_INCR:
         case VM_OC_PROP_POST_DECR:
         {
-          last_completion_value = vm_op_get_value (left_value,
+          last_completion_value = vm_op_get_value (byte_code_start_p,
+                                                   left_value,
                                                    right_value,
                                                    is_strict);
 
@@ -1224,7 +1265,6 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         {
           uint32_t base = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
           ecma_number_t increase = ECMA_NUMBER_ONE;
-          ecma_number_t *result_p;
 
           last_completion_value = ecma_op_to_number (left_value);
 
@@ -1235,7 +1275,6 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           byte_code_p = byte_code_start_p + 1;
           result = last_completion_value;
-          result_p = ecma_get_number_from_value (result);
 
           if (base & 0x2)
           {
@@ -1278,7 +1317,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             }
           }
 
-          *result_p = ecma_number_add (*result_p, increase);
+          if (ecma_is_value_integer_number (result))
+          {
+            ecma_integer_value_t int_value = ecma_get_integer_from_value (result);
+            int_value += (base & 0x2) ? -1 : 1;
+
+            if (likely (int_value >= ECMA_INTEGER_NUMBER_MIN && int_value <= ECMA_INTEGER_NUMBER_MAX))
+            {
+              result = ecma_make_integer_value (int_value);
+              break;
+            }
+          }
+
+          ecma_number_t number = ecma_get_number_from_value (result);
+          ecma_free_value (result);
+          result = ecma_make_number_value (ecma_number_add (number, increase));
           break;
         }
         case VM_OC_ASSIGN:
@@ -1590,6 +1643,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_ADD:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            result = ecma_make_int32_value (ecma_get_integer_from_value (left_value)
+                                            + ecma_get_integer_from_value (right_value));
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            result = ecma_make_number_value (ecma_number_add (ecma_get_number_from_value (left_value),
+                                                              ecma_get_number_from_value (right_value)));
+            break;
+          }
+
           last_completion_value = opfunc_addition (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1602,6 +1669,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_SUB:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            result = ecma_make_int32_value (ecma_get_integer_from_value (left_value)
+                                            - ecma_get_integer_from_value (right_value));
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            result = ecma_make_number_value (ecma_number_substract (ecma_get_number_from_value (left_value),
+                                                                    ecma_get_number_from_value (right_value)));
+            break;
+          }
+
           last_completion_value = do_number_arithmetic (NUMBER_ARITHMETIC_SUBSTRACTION,
                                                         left_value,
                                                         right_value);
@@ -1616,6 +1697,29 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_MUL:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+            int64_t int_result = (int64_t) left_integer * (int64_t) right_integer;
+
+            /* Zero result of a negative operand is -0, which is not an integer value */
+            if (int_result >= ECMA_INTEGER_NUMBER_MIN
+                && int_result <= ECMA_INTEGER_NUMBER_MAX
+                && (int_result != 0 || (left_integer >= 0 && right_integer >= 0)))
+            {
+              result = ecma_make_integer_value ((ecma_integer_value_t) int_result);
+              break;
+            }
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            result = ecma_make_number_value (ecma_number_multiply (ecma_get_number_from_value (left_value),
+                                                                   ecma_get_number_from_value (right_value)));
+            break;
+          }
+
           last_completion_value = do_number_arithmetic (NUMBER_ARITHMETIC_MULTIPLICATION,
                                                         left_value,
                                                         right_value);
@@ -1630,6 +1734,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_DIV:
         {
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            result = ecma_make_number_value (ecma_number_divide (ecma_get_number_from_value (left_value),
+                                                                 ecma_get_number_from_value (right_value)));
+            break;
+          }
+
           last_completion_value = do_number_arithmetic (NUMBER_ARITHMETIC_DIVISION,
                                                         left_value,
                                                         right_value);
@@ -1658,6 +1769,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_EQUAL:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            /* Equal integers are stored in equal values */
+            result = ecma_make_simple_value ((left_value == right_value) ? ECMA_SIMPLE_VALUE_TRUE
+                                                                         : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            bool is_true = ecma_get_number_from_value (left_value) == ecma_get_number_from_value (right_value);
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_equal_value (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1670,6 +1796,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_NOT_EQUAL:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            /* Equal integers are stored in equal values */
+            result = ecma_make_simple_value ((left_value != right_value) ? ECMA_SIMPLE_VALUE_TRUE
+                                                                         : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            bool is_true = ecma_get_number_from_value (left_value) != ecma_get_number_from_value (right_value);
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_not_equal_value (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1682,6 +1823,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_STRICT_EQUAL:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            /* Equal integers are stored in equal values */
+            result = ecma_make_simple_value ((left_value == right_value) ? ECMA_SIMPLE_VALUE_TRUE
+                                                                         : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            bool is_true = ecma_get_number_from_value (left_value) == ecma_get_number_from_value (right_value);
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_equal_value_type (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1694,6 +1850,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_STRICT_NOT_EQUAL:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            /* Equal integers are stored in equal values */
+            result = ecma_make_simple_value ((left_value != right_value) ? ECMA_SIMPLE_VALUE_TRUE
+                                                                         : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            bool is_true = ecma_get_number_from_value (left_value) != ecma_get_number_from_value (right_value);
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_not_equal_value_type (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1790,6 +1961,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_LESS:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_true = ecma_get_integer_from_value (left_value) < ecma_get_integer_from_value (right_value);
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            bool is_true = ecma_get_number_from_value (left_value) < ecma_get_number_from_value (right_value);
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_less_than (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1802,6 +1987,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_GREATER:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_true = ecma_get_integer_from_value (left_value) > ecma_get_integer_from_value (right_value);
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            bool is_true = ecma_get_number_from_value (left_value) > ecma_get_number_from_value (right_value);
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_greater_than (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1814,6 +2013,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_LESS_EQUAL:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_true = ecma_get_integer_from_value (left_value) <= ecma_get_integer_from_value (right_value);
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            bool is_true = ecma_get_number_from_value (left_value) <= ecma_get_number_from_value (right_value);
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_less_or_equal_than (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1826,6 +2039,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_GREATER_EQUAL:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_true = ecma_get_integer_from_value (left_value) >= ecma_get_integer_from_value (right_value);
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            bool is_true = ecma_get_number_from_value (left_value) >= ecma_get_number_from_value (right_value);
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_greater_or_equal_than (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1951,8 +2178,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             lit_utf8_byte_t *data_ptr = chunk_p->data;
             ecma_string_t *prop_name_p = ecma_get_string_from_value (*(ecma_value_t *) data_ptr);
 
-            if (ecma_op_object_get_property (ecma_get_object_from_value (stack_top_p[-3]),
-                                             prop_name_p) == NULL)
+            if (!ecma_op_object_has_property (ecma_get_object_from_value (stack_top_p[-3]),
+                                              prop_name_p))
             {
               stack_top_p[-2] = chunk_p->next_chunk_cp;
               ecma_deref_ecma_string (prop_name_p);
@@ -2016,7 +2243,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             case VM_CONTEXT_FINALLY_JUMP:
             {
-              uint32_t jump_target = stack_top_p[-2];
+              uint32_t jump_target = (uint32_t) stack_top_p[-2];
 
               VM_MINUS_EQUAL_U16 (frame_ctx_p->context_depth,
                                   PARSER_TRY_CONTEXT_STACK_ALLOCATION);
@@ -2159,7 +2386,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           else
           {
-            last_completion_value = vm_op_set_value (object,
+            last_completion_value = vm_op_set_value (byte_code_start_p,
+                                                     object,
                                                      property,
                                                      result,
                                                      is_strict);
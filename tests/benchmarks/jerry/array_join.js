@@ -0,0 +1,35 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Arrays of 10000 elements are joined, so the result strings grow by many small pieces
+// (the arrays do not fit in the default 256 KB heap, so the benchmark is run with the 32-bit compressed pointer build)
+var numbers = [];
+var words = [];
+
+for (var i = 0; i < 10000; i++)
+{
+  numbers.push (i);
+  words.push ("w" + (i % 100));
+}
+
+var size = 0;
+
+for (var round = 0; round < 5; round++)
+{
+  size += numbers.join ().length;
+  size += words.join (" ").length;
+  size += String (numbers).length;
+}
+
+assert (size === 5 * (48889 + 38999 + 48889));
@@ -0,0 +1,65 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function integrate (from, to, steps)
+{
+  var step = (to - from) / steps;
+  var sum = 0.5;
+
+  for (var i = 0; i < steps; i++)
+  {
+    var x = from + (i + 0.5) * step;
+    sum += (x * x * 0.25 - x / 3.5 + 1.125) * step;
+  }
+
+  return sum;
+}
+
+function mandelbrot (size, iterations)
+{
+  var inside = 0;
+
+  for (var y = 0; y < size; y++)
+  {
+    for (var x = 0; x < size; x++)
+    {
+      var cr = 2.5 * x / size - 2.0;
+      var ci = 2.25 * y / size - 1.125;
+      var zr = 0.0;
+      var zi = 0.0;
+      var n = 0;
+
+      while (n < iterations && zr * zr + zi * zi <= 4.0)
+      {
+        var tmp = zr * zr - zi * zi + cr;
+        zi = 2.0 * zr * zi + ci;
+        zr = tmp;
+        n++;
+      }
+
+      if (n == iterations)
+      {
+        inside++;
+      }
+    }
+  }
+
+  return inside;
+}
+
+var area = integrate (0.1, 10.1, 300000);
+assert (area > 83 && area < 83.1);
+
+var inside = mandelbrot (64, 50);
+assert (inside > 0 && inside < 64 * 64);
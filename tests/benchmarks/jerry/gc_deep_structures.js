@@ -0,0 +1,50 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Long-lived structures, in which objects reference objects allocated after them */
+var head = {}, tail = head;
+
+for (var i = 0; i < 1000; i++)
+{
+  tail.next = {};
+  tail = tail.next;
+}
+
+function build (node, depth)
+{
+  if (depth > 0)
+  {
+    node.left = {};
+    node.right = {};
+    build (node.left, depth - 1);
+    build (node.right, depth - 1);
+  }
+}
+
+var root = {};
+build (root, 8);
+
+/* Short-lived objects, triggering garbage collection */
+for (var i = 0; i < 20000; i++)
+{
+  var tmp = { a: {}, b: { c: i } };
+}
+
+var length = 0;
+for (var node = head; node.next !== undefined; node = node.next)
+{
+  length++;
+}
+
+assert (length == 1000);
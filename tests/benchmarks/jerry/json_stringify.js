@@ -0,0 +1,36 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Arrays and objects with 10000 elements are stringified, so the result strings grow by many small pieces
+// (the arrays do not fit in the default 256 KB heap, so the benchmark is run with the 32-bit compressed pointer build)
+var numbers = [];
+var records = [];
+
+for (var i = 0; i < 10000; i++)
+{
+  numbers.push (i);
+  records.push ({ id: i, name: "item" + (i % 100), tags: ["a", "b\n"] });
+}
+
+var size = 0;
+
+for (var round = 0; round < 3; round++)
+{
+  size += JSON.stringify (numbers).length;
+  size += JSON.stringify (records.slice (0, 2500)).length;
+}
+
+var parsed = JSON.parse (JSON.stringify (records.slice (0, 100)));
+assert (parsed.length === 100 && parsed[99].tags[1] === "b\n");
+assert (size > 0);
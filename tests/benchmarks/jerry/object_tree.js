@@ -0,0 +1,47 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function build (depth)
+{
+  if (depth == 0)
+  {
+    return null;
+  }
+
+  return { left: build (depth - 1), right: build (depth - 1), value: depth };
+}
+
+function sum (node)
+{
+  if (node === null)
+  {
+    return 0;
+  }
+
+  return node.value + sum (node.left) + sum (node.right);
+}
+
+var total = 0;
+
+for (var i = 0; i < 30; i++)
+{
+  var tree = build (10);
+
+  for (var k = 0; k < 5; k++)
+  {
+    total += sum (tree);
+  }
+}
+
+assert (total == 30 * 5 * 2036);
@@ -0,0 +1,101 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function Point (x, y)
+{
+  this.x = x;
+  this.y = y;
+}
+
+function Point3 (x, y, z)
+{
+  this.x = x;
+  this.y = y;
+  this.z = z;
+}
+
+function length (points)
+{
+  var sum = 0;
+
+  for (var i = 0; i < points.length; i++)
+  {
+    var point = points[i];
+    sum += point.x * point.x + point.y * point.y;
+  }
+
+  return sum;
+}
+
+function move (points, dx, dy)
+{
+  for (var i = 0; i < points.length; i++)
+  {
+    var point = points[i];
+    point.x += dx;
+    point.y += dy;
+  }
+}
+
+/* Monomorphic sites */
+var points = [];
+
+for (var i = 0; i < 100; i++)
+{
+  points.push (new Point (i, -i));
+}
+
+var total = 0;
+
+for (var k = 0; k < 300; k++)
+{
+  move (points, 1, -1);
+  total += length (points);
+  move (points, -1, 1);
+}
+
+/* Polymorphic sites */
+var mixed = [];
+
+for (var i = 0; i < 100; i++)
+{
+  mixed.push ((i % 2) ? new Point (i, -i) : new Point3 (i, -i, 0));
+}
+
+for (var k = 0; k < 300; k++)
+{
+  move (mixed, 1, -1);
+  total += length (mixed);
+  move (mixed, -1, 1);
+}
+
+/* Object, used as a record */
+var counters = { hits: 0, misses: 0, total: 0 };
+
+for (var i = 0; i < 30000; i++)
+{
+  if (i % 3)
+  {
+    counters.hits++;
+  }
+  else
+  {
+    counters.misses++;
+  }
+
+  counters.total = counters.hits + counters.misses;
+}
+
+assert (counters.total === 30000 && counters.hits === 20000);
+assert (total === 2 * 300 * 676700);
@@ -0,0 +1,44 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var prefix = "a_rather_long_prefix_of_field_names_";
+var obj = {};
+
+for (var i = 0; i < 64; i++)
+{
+  obj[prefix + i] = i;
+}
+
+var sum = 0;
+
+for (var round = 0; round < 200; round++)
+{
+  for (var i = 0; i < 64; i++)
+  {
+    sum += obj[prefix + i];
+  }
+}
+
+assert (sum === 200 * 63 * 64 / 2);
+
+var counts = {};
+var words = ["alpha", "beta", "gamma", "delta", "epsilon"];
+
+for (var i = 0; i < 10000; i++)
+{
+  var key = words[i % words.length] + "_" + (i % 7);
+  counts[key] = (counts[key] || 0) + 1;
+}
+
+assert (counts.alpha_0 > 0);
@@ -0,0 +1,38 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Characters of non-ASCII strings are scanned sequentially, as done by tokenizers written in JavaScript
+var text = "";
+
+for (var i = 0; i < 200; i++)
+{
+  text += "árvíztűrő tükörfúrógép " + i + " ";
+}
+
+var sum = 0;
+
+for (var round = 0; round < 3; round++)
+{
+  for (var i = 0; i < text.length; i++)
+  {
+    sum += text.charCodeAt (i);
+  }
+
+  for (var i = text.length - 1; i >= 0; i--)
+  {
+    sum -= text.charCodeAt (i);
+  }
+}
+
+assert (sum === 0);
@@ -0,0 +1,93 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function render (rows)
+{
+  var html = "<table>\n";
+
+  for (var i = 0; i < rows.length; i++)
+  {
+    var row = rows[i];
+    html += "  <tr class=\"" + (i % 2 ? "odd" : "even") + "\">";
+    html += "<td>" + row.id + "</td>";
+    html += "<td>" + row.name + "</td>";
+    html += "<td>" + row.value + "</td>";
+    html += "</tr>\n";
+  }
+
+  html += "</table>\n";
+  return html;
+}
+
+var rows = [];
+
+for (var i = 0; i < 300; i++)
+{
+  rows.push ({ id: i, name: "item number " + i, value: i * 3 });
+}
+
+var size = 0;
+
+for (var i = 0; i < 40; i++)
+{
+  size += render (rows).length;
+}
+
+assert (size === 40 * render (rows).length);
+assert (render (rows).indexOf ("<td>item number 299</td>") > 0);
+
+// Strings of growing sizes are built by appends and by prepends, repeatedly, so that the same number of pieces
+// is added for each size: if adding a piece takes constant time, each size takes the same time, otherwise
+// the largest size dominates the benchmark
+function build (count)
+{
+  var str = "";
+
+  for (var i = 0; i < count; i++)
+  {
+    str += "piece" + (i % 10);
+  }
+
+  return str;
+}
+
+function build_reversed (count)
+{
+  var str = "";
+
+  for (var i = 0; i < count; i++)
+  {
+    str = "piece" + (i % 10) + str;
+  }
+
+  return str;
+}
+
+var max_count = 8000;
+
+for (var count = max_count / 16; count <= max_count; count *= 2)
+{
+  for (var round = 0; round < max_count / count; round++)
+  {
+    var str = build (count);
+
+    assert (str.length === count * 6);
+    assert (str.slice (-12) === "piece" + ((count - 2) % 10) + "piece" + ((count - 1) % 10));
+
+    str = build_reversed (count);
+
+    assert (str.length === count * 6);
+    assert (str.slice (0, 12) === "piece" + ((count - 1) % 10) + "piece" + ((count - 2) % 10));
+  }
+}
@@ -0,0 +1,43 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Objects with many properties are looked up through hashmaps, which are indexed by hashes of the names,
+// so lookups, that visit many entries with the same hash, are measured
+var names = [];
+
+for (var i = 0; i < 1500; i++)
+{
+  names.push ("identifier_" + i.toString (36) + "_" + (i * 7919 % 1000));
+}
+
+var dict = {};
+
+for (var i = 0; i < names.length; i++)
+{
+  dict[names[i]] = i;
+}
+
+var sum = 0;
+
+for (var round = 0; round < 20; round++)
+{
+  for (var i = 0; i < names.length; i++)
+  {
+    sum += dict[names[i]];
+  }
+
+  sum -= ("missing_" + round) in dict ? 1 : 0;
+}
+
+assert (sum === 20 * 1499 * 1500 / 2);
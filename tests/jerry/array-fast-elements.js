@@ -0,0 +1,172 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Filling and reading
+var arr = [];
+for (var i = 0; i < 1000; i++) {
+  arr[i] = i * 2;
+}
+assert (arr.length === 1000);
+for (var i = 0; i < 1000; i++) {
+  assert (arr[i] === i * 2);
+}
+arr[5] = "five";
+assert (arr[5] === "five");
+arr[5] = { value: 5 };
+assert (arr[5].value === 5);
+
+// Holes
+var holes = [1, , 3];
+assert (holes.length === 3);
+assert (!(1 in holes));
+assert (holes[1] === undefined);
+assert (holes.hasOwnProperty (0) && !holes.hasOwnProperty (1));
+holes[5] = 6;
+assert (holes.length === 6);
+assert (!(4 in holes) && 5 in holes);
+assert (Object.keys (holes).join () === "0,2,5");
+
+var preallocated = new Array (10);
+assert (preallocated.length === 10 && !(0 in preallocated));
+preallocated[3] = 3;
+assert (preallocated.length === 10 && preallocated[3] === 3);
+
+// Elements far beyond the end
+var sparse = [1, 2];
+sparse[100000] = 3;
+assert (sparse.length === 100001);
+assert (sparse[0] === 1 && sparse[100000] === 3 && sparse[50] === undefined);
+sparse[2] = 4;
+assert (Object.keys (sparse).join () === "0,1,2,100000");
+
+// Delete
+var del = [1, 2, 3, 4];
+assert (delete del[1]);
+assert (del.length === 4 && !(1 in del));
+assert (delete del[10]);
+del[1] = 5;
+assert (del.join () === "1,5,3,4");
+
+// Length
+var len = [1, 2, 3, 4, 5];
+len.length = 2;
+assert (len.join () === "1,2" && len[3] === undefined);
+len.length = 4;
+assert (len.length === 4 && !(2 in len));
+len[2] = 3;
+assert (len.join () === "1,2,3,");
+len.length = 0;
+assert (len.length === 0 && len[0] === undefined);
+
+var big = [];
+for (var i = 0; i < 500; i++) {
+  big.push ({ value: i });
+}
+big.length = 10;
+assert (big.length === 10 && big[9].value === 9);
+
+// Attributes
+var attrs = [1, 2, 3];
+Object.defineProperty (attrs, "1", { writable: false });
+attrs[1] = 5;
+assert (attrs[1] === 2);
+assert (attrs.join () === "1,2,3");
+
+var enumerable = [1, 2, 3];
+Object.defineProperty (enumerable, "0", { enumerable: false });
+assert (Object.keys (enumerable).join () === "1,2");
+
+var desc = Object.getOwnPropertyDescriptor ([7], "0");
+assert (desc.value === 7 && desc.writable && desc.enumerable && desc.configurable);
+
+var defined = [];
+Object.defineProperty (defined, "0", { value: 1, writable: true, enumerable: true, configurable: true });
+Object.defineProperty (defined, "1", { value: 2 });
+assert (defined.length === 2);
+defined[1] = 3;
+assert (defined[1] === 2);
+assert (Object.keys (defined).join () === "0");
+
+var accessor = [1];
+Object.defineProperty (accessor, "1", { get: function () { return 42; }, enumerable: true });
+assert (accessor[1] === 42 && accessor.length === 2);
+
+var frozen = Object.freeze ([1, 2]);
+frozen[0] = 3;
+frozen[2] = 4;
+assert (frozen.join () === "1,2" && frozen.length === 2);
+assert (Object.isFrozen (frozen));
+
+var nonextensible = Object.preventExtensions ([1, , 3]);
+nonextensible[0] = 5;
+nonextensible[1] = 6;
+nonextensible[3] = 7;
+assert (nonextensible[0] === 5 && !(1 in nonextensible) && nonextensible.length === 3);
+
+var readonly_length = [1, 2];
+Object.defineProperty (readonly_length, "length", { writable: false });
+readonly_length[1] = 3;
+readonly_length[2] = 4;
+assert (readonly_length.join () === "1,3" && readonly_length.length === 2);
+
+// Prototype chain
+Object.defineProperty (Array.prototype, "3", {
+  set: function (v) { this.setter_value = v; },
+  configurable: true
+});
+var proto = [0, 1, 2];
+proto[3] = 3;
+assert (proto.setter_value === 3 && !proto.hasOwnProperty (3) && proto.length === 3);
+delete Array.prototype[3];
+
+Array.prototype[1] = "inherited";
+var inherited = [0, , 2];
+assert (inherited[1] === "inherited" && 1 in inherited);
+var names = [];
+for (var name in inherited) {
+  names.push (name);
+}
+assert (names.join () === "0,2,1");
+delete Array.prototype[1];
+
+// Builtins
+var builtins = [5, 3, 1, 4, 2];
+builtins.sort ();
+assert (builtins.join () === "1,2,3,4,5");
+builtins.reverse ();
+assert (builtins.join () === "5,4,3,2,1");
+assert (builtins.shift () === 5 && builtins.length === 4);
+builtins.unshift (0);
+assert (builtins.join () === "0,4,3,2,1");
+assert (builtins.splice (1, 2, "a").join () === "4,3");
+assert (builtins.join () === "0,a,2,1");
+assert (builtins.slice (1, 3).join () === "a,2");
+assert (builtins.concat ([7, , 8]).length === 7);
+assert (builtins.indexOf (2) === 2 && builtins.lastIndexOf ("a") === 1);
+assert ([1, , 3].map (function (v) { return v * 2; }).join () === "2,,6");
+assert ([1, 2, 3].reduce (function (a, b) { return a + b; }) === 6);
+assert (JSON.stringify ([1, "a", [2, {}], , null]) === '[1,"a",[2,{}],null,null]');
+assert (JSON.parse ("[1,[2,3]]")[1][1] === 3);
+assert (Object.getOwnPropertyNames ([1, 2]).join () === "0,1,length");
+
+var for_in = [];
+for (var i = 0; i < 100; i++) {
+  for_in[i] = i;
+}
+var count = 0;
+for (var name in for_in) {
+  assert (for_in[name] === count);
+  count++;
+}
+assert (count === 100);
@@ -0,0 +1,84 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Construction
+var buf = new ArrayBuffer (8);
+assert (buf.byteLength === 8);
+assert (Object.prototype.toString.call (buf) === "[object ArrayBuffer]");
+assert (buf instanceof ArrayBuffer);
+assert (ArrayBuffer.prototype.constructor === ArrayBuffer);
+assert (ArrayBuffer.length === 1);
+
+assert (new ArrayBuffer ().byteLength === 0);
+assert (new ArrayBuffer (3.7).byteLength === 3);
+assert (new ArrayBuffer ("16").byteLength === 16);
+assert (new ArrayBuffer (NaN).byteLength === 0);
+
+try {
+  new ArrayBuffer (-1);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  ArrayBuffer (8);
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+try {
+  ArrayBuffer.prototype.byteLength;
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+// The buffer is zero-filled and is not indexable
+var bytes = new Uint8Array (buf);
+for (var i = 0; i < 8; i++) {
+  assert (bytes[i] === 0);
+  bytes[i] = i + 1;
+}
+assert (buf[0] === undefined);
+
+// Slice
+var part = buf.slice (2, 5);
+assert (part.byteLength === 3);
+assert (Array.prototype.join.call (new Uint8Array (part)) === "3,4,5");
+assert (buf.slice (-2).byteLength === 2);
+assert (new Uint8Array (buf.slice (-2))[0] === 7);
+assert (buf.slice (5, 2).byteLength === 0);
+assert (buf.slice ().byteLength === 8);
+
+// The slice is a copy
+new Uint8Array (part)[0] = 100;
+assert (bytes[2] === 3);
+
+// isView
+assert (ArrayBuffer.isView (bytes));
+assert (ArrayBuffer.isView (new DataView (buf)));
+assert (!ArrayBuffer.isView (buf));
+assert (!ArrayBuffer.isView ([]));
+assert (!ArrayBuffer.isView (1));
+assert (!ArrayBuffer.isView ());
+
+// Too large buffer
+try {
+  new ArrayBuffer (0x7fffffff);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
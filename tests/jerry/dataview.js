@@ -0,0 +1,125 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+var buf = new ArrayBuffer (16);
+var view = new DataView (buf);
+
+assert (DataView.length === 3);
+assert (view.buffer === buf);
+assert (view.byteLength === 16);
+assert (view.byteOffset === 0);
+assert (Object.prototype.toString.call (view) === "[object DataView]");
+assert (view[0] === undefined);
+
+// Big endian is the default
+view.setUint16 (0, 0x1234);
+assert (view.getUint8 (0) === 0x12);
+assert (view.getUint8 (1) === 0x34);
+assert (view.getUint16 (0) === 0x1234);
+assert (view.getUint16 (0, true) === 0x3412);
+
+view.setUint32 (4, 0x12345678, true);
+assert (view.getUint8 (4) === 0x78);
+assert (view.getUint32 (4, true) === 0x12345678);
+assert (view.getUint32 (4) === 0x78563412);
+
+view.setInt8 (8, -1);
+assert (view.getInt8 (8) === -1);
+assert (view.getUint8 (8) === 255);
+
+view.setInt16 (8, -2, true);
+assert (view.getInt16 (8, true) === -2);
+
+view.setInt32 (8, -3);
+assert (view.getInt32 (8) === -3);
+assert (view.getUint32 (8) === 4294967293);
+
+view.setFloat32 (8, 1.5);
+assert (view.getFloat32 (8) === 1.5);
+
+view.setFloat64 (8, Math.PI, true);
+assert (view.getFloat64 (8, true) === Math.PI);
+assert (view.getFloat64 (8) !== Math.PI);
+
+// The bytes are shared with typed arrays
+var bytes = new Uint8Array (buf);
+view.setUint8 (15, 200);
+assert (bytes[15] === 200);
+
+// Views with offset and length
+var part = new DataView (buf, 4, 8);
+assert (part.byteOffset === 4);
+assert (part.byteLength === 8);
+assert (part.getUint32 (0, true) === 0x12345678);
+assert (new DataView (buf, 12).byteLength === 4);
+
+// Range checks
+try {
+  part.getUint32 (5);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  view.setFloat64 (-1, 0);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  new DataView (buf, 17);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  new DataView (buf, 8, 9);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  new DataView ({});
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+try {
+  DataView (buf);
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+try {
+  DataView.prototype.getInt8.call (new Uint8Array (4), 0);
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+// Named properties
+var named = new DataView (new ArrayBuffer (4));
+named.x = 1;
+named.y = 2;
+named.setInt8 (0, 5);
+assert (named.x === 1);
+assert (named.y === 2);
+assert (named.getInt8 (0) === 5);
+assert (named.byteLength === 4);
+assert (Object.keys (named).join () === "x,y");
@@ -0,0 +1,44 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Young objects stored into an object that was already promoted
+// should be kept alive by the remembered set during minor collections.
+
+var holder = {};
+
+function churn (count)
+{
+  var t;
+  for (var i = 0; i < count; i++)
+  {
+    t = { a: [] };
+  }
+}
+
+churn (1000);
+
+holder.x = { v: 42 };
+holder.y = [{ w: 1 }, { w: 2 }];
+holder.f = function () { return holder.x.v; };
+
+churn (1000);
+
+Object.defineProperty (holder, 'z', { get: function () { return { u: 3 }; } });
+
+churn (1000);
+
+assert (holder.x.v === 42);
+assert (holder.y[1].w === 2);
+assert (holder.f () === 42);
+assert (holder.z.u === 3);
@@ -0,0 +1,104 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function getX (obj) {
+  return obj.x;
+}
+
+function setX (obj, value) {
+  obj.x = value;
+}
+
+// Monomorphic and polymorphic sites
+var a = { x: 1 };
+var b = { y: 2, x: 3 };
+var c = { z: 4, y: 5, x: 6 };
+var d = { w: 7, z: 8, y: 9, x: 10 };
+var e = { v: 11, w: 12, z: 13, y: 14, x: 15 };
+
+for (var i = 0; i < 10; i++) {
+  assert (getX (a) === 1 && getX (b) === 3 && getX (c) === 6);
+  assert (getX (d) === 10 && getX (e) === 15);
+}
+
+setX (a, 16);
+setX (e, 17);
+assert (getX (a) === 16 && getX (e) === 17 && getX (b) === 3);
+
+// Deleted properties
+delete a.x;
+assert (getX (a) === undefined);
+setX (a, 18);
+assert (getX (a) === 18);
+
+// Inherited and shadowing properties
+function Base () {
+}
+Base.prototype.x = 19;
+
+var derived = new Base ();
+assert (getX (derived) === 19);
+setX (derived, 20);
+assert (getX (derived) === 20 && Base.prototype.x === 19);
+delete derived.x;
+assert (getX (derived) === 19);
+
+// Attributes
+var ro = { x: 21 };
+assert (getX (ro) === 21);
+setX (ro, 22);
+Object.defineProperty (ro, "x", { writable: false });
+setX (ro, 23);
+assert (getX (ro) === 22);
+
+var strict_set = function (obj, value) {
+  "use strict";
+  obj.x = value;
+};
+
+try {
+  strict_set (ro, 24);
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+// Data property, redefined as accessor
+var acc = { x: 25 };
+assert (getX (acc) === 25);
+var stored;
+Object.defineProperty (acc, "x", { get: function () { return 26; }, set: function (v) { stored = v; } });
+assert (getX (acc) === 26);
+setX (acc, 27);
+assert (stored === 27 && getX (acc) === 26);
+
+// Arrays and arguments
+var arr = [1, 2, 3];
+arr.x = 28;
+assert (getX (arr) === 28);
+setX (arr, 29);
+assert (getX (arr) === 29);
+
+function argsX () {
+  arguments.x = 30;
+  return getX (arguments);
+}
+assert (argsX () === 30);
+
+// Many receivers, created and collected in a loop
+for (var i = 0; i < 1000; i++) {
+  var obj = (i % 3 === 0) ? { x: i } : ((i % 3 === 1) ? { y: 0, x: i } : { x: i, y: 0 });
+  setX (obj, getX (obj) + 1);
+  assert (getX (obj) === i + 1);
+}
@@ -0,0 +1,50 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Strings above 64 KB
+
+function repeat (str, count)
+{
+  var result = "";
+
+  while (count > 0)
+  {
+    if (count & 1)
+    {
+      result += str;
+    }
+
+    str += str;
+    count >>= 1;
+  }
+
+  return result;
+}
+
+// Multi-byte characters: the size is above 64 KB, but the length is not
+var wide = repeat ("á☃", 13200);
+
+assert (wide.length === 26400);
+assert (wide.charAt (26398) === "á");
+assert (wide.charCodeAt (26399) === 0x2603);
+
+var json = JSON.stringify ([wide]);
+
+assert (json.length === 26404);
+
+var parsed = JSON.parse (json);
+
+assert (parsed.length === 1);
+assert (parsed[0] === wide);
+assert (parsed[0].substr (26397, 2) === "☃á");
@@ -0,0 +1,59 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Strings above 64 KB
+
+function repeat (str, count)
+{
+  var result = "";
+
+  while (count > 0)
+  {
+    if (count & 1)
+    {
+      result += str;
+    }
+
+    str += str;
+    count >>= 1;
+  }
+
+  return result;
+}
+
+var str = repeat ("0123456789", 6554) + "end";
+
+assert (str.length === 65543);
+assert (str.charAt (65535) === "5");
+assert (str.charAt (65536) === "6");
+assert (str.charCodeAt (65539) === 0x39);
+assert (str.indexOf ("end") === 65540);
+assert (str.lastIndexOf ("789") === 65537);
+assert (str.substring (65530, 65540) === "0123456789");
+assert (str.slice (-5) === "89end");
+
+// Round-trip through JSON
+var json = JSON.stringify ({ text: str, size: str.length });
+
+assert (json.length === 65543 + 24);
+
+var parsed = JSON.parse (json);
+
+assert (parsed.size === 65543);
+assert (parsed.text.length === 65543);
+assert (parsed.text === str);
+
+str = undefined;
+
+assert (JSON.stringify (parsed).length === json.length);
@@ -0,0 +1,96 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Small integers are stored directly in the values, others are allocated on the heap.
+// The boundaries depend on the build configuration, so all likely boundaries are checked.
+var bounds = [524287, 134217727, 1073741823, 2147483647];
+
+for (var k = 0; k < bounds.length; k++)
+{
+  var max = bounds[k];
+  var min = -max - 1;
+
+  var i = max;
+  i++;
+  assert (i === max + 1);
+  assert (i - 1 === max);
+  i--;
+  assert (i === max);
+  ++i;
+  assert (i > max);
+
+  var j = min;
+  j--;
+  assert (j === min - 1);
+  assert (j < min);
+  --j;
+  assert (j + 2 === min);
+
+  assert (max * 2 === max + max);
+  assert (min * -1 === max + 1);
+  assert (max - min === 2 * max + 1);
+  assert (max + 1 - 1 === max);
+}
+
+// -0 is not an integer value
+assert (1 / (0 * -5) === -Infinity);
+assert (1 / (-3 * 0) === -Infinity);
+assert (1 / (0 * 5) === Infinity);
+assert (1 / (-1 + 1) === Infinity);
+assert (1 / -0 === -Infinity);
+assert (0 === -0);
+assert (0 == -0);
+
+var z = -1;
+z++;
+assert (1 / z === Infinity);
+
+z = 0;
+z = -z;
+assert (1 / z === -Infinity);
+
+// Comparisons of integers and heap numbers
+assert (3 < 5 && !(5 < 3));
+assert (5 > 3 && !(3 > 5));
+assert (3 <= 3 && 3 >= 3);
+assert (-1 < 0 && -1 <= 0 && 0 > -1);
+assert (2 == 2.0);
+assert (2.5 !== 2);
+assert (7 != 8);
+assert (2147483648 > 2);
+assert (2 < 2147483648);
+assert (NaN != 1 && !(NaN < 1) && !(NaN >= 1));
+
+// Multiplication overflow
+assert (65536 * 65536 === 4294967296);
+assert (-65536 * 65536 === -4294967296);
+
+// Lengths of arrays
+var arr = [1, 2, 3];
+arr[524300] = 4;
+assert (arr.length === 524301);
+arr.length = 2;
+assert (arr.length === 2);
+assert (arr[1] === 2);
+
+// Numbers stored in properties keep their sign
+var obj = { a: -1, b: -524288, c: -134217728 };
+assert (obj.a === -1);
+assert (obj.b === -524288);
+assert (obj.c === -134217728);
+assert (obj.a + obj.b === -524289);
+
+assert (1 + 0.5 === 1.5);
+assert (0.5 + 0.5 === 1);
+assert (typeof (1 + 1) === "number");
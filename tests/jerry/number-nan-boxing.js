@@ -0,0 +1,73 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NaNs with any bit pattern are numbers
+var buffer = new ArrayBuffer (8);
+var bytes = new Uint8Array (buffer);
+var floats = new Float64Array (buffer);
+
+var patterns = [ [0, 0, 0, 0, 0, 0, 0xf8, 0xff],
+                 [0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff],
+                 [1, 0, 0, 0, 0, 0, 0xfb, 0xff],
+                 [1, 0, 0, 0, 0, 0, 0xf0, 0x7f] ];
+
+for (var i = 0; i < patterns.length; i++)
+{
+  for (var j = 0; j < 8; j++)
+  {
+    bytes[j] = patterns[i][j];
+  }
+
+  var value = floats[0];
+  assert (typeof value === "number");
+  assert (isNaN (value));
+  assert (value !== value);
+  assert (String (value) === "NaN");
+
+  var object = { a: value };
+  assert (isNaN (object.a));
+}
+
+// Numbers as error values
+function throw_number (number)
+{
+  throw number;
+}
+
+var numbers = [0, -0, 1.5, -1e300, Infinity, NaN, 4294967296];
+
+for (var i = 0; i < numbers.length; i++)
+{
+  try
+  {
+    throw_number (numbers[i]);
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (typeof e === "number");
+    assert (isNaN (numbers[i]) ? isNaN (e) : (e === numbers[i] && 1 / e === 1 / numbers[i]));
+  }
+}
+
+// Arithmetic on floating point numbers
+var sum = 0.5;
+for (var i = 0; i < 100; i++)
+{
+  sum = sum * 1.5 - i / 4;
+}
+assert (sum < -1e17);
+assert (0.1 + 0.2 !== 0.3);
+assert (1 / (-0 * 1.5) === -Infinity);
+assert (!(NaN < 1.5) && !(NaN >= 1.5) && NaN != NaN);
@@ -0,0 +1,86 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Objects used as dictionaries
+var dict = {};
+for (var i = 0; i < 500; i++) {
+  dict["key" + i] = i;
+}
+
+for (var i = 0; i < 500; i++) {
+  assert (dict["key" + i] === i);
+}
+assert (dict.key500 === undefined);
+
+for (var i = 0; i < 500; i += 2) {
+  delete dict["key" + i];
+}
+
+for (var i = 0; i < 500; i++) {
+  assert (dict["key" + i] === ((i % 2) ? i : undefined));
+  assert (dict.hasOwnProperty ("key" + i) === ((i % 2) === 1));
+}
+
+for (var i = 0; i < 500; i += 2) {
+  dict["key" + i] = -i;
+}
+
+for (var i = 0; i < 500; i++) {
+  assert (dict["key" + i] === ((i % 2) ? i : -i));
+}
+assert (Object.keys (dict).length === 500);
+
+// Accessors
+var getter_calls = 0;
+Object.defineProperty (dict, "accessor", { get: function () { getter_calls++; return 1; }, configurable: true });
+assert (dict.accessor === 1 && getter_calls === 1);
+delete dict.accessor;
+assert (dict.accessor === undefined && getter_calls === 1);
+
+// The object becomes small again
+for (var i = 0; i < 495; i++) {
+  delete dict["key" + i];
+}
+
+for (var i = 0; i < 20; i++) {
+  var garbage = [];
+  for (var j = 0; j < 100; j++) {
+    garbage.push ({ value: j });
+  }
+}
+
+assert (Object.keys (dict).join () === "key495,key497,key499,key496,key498");
+assert (dict.key499 === 499 && dict.key498 === -498 && dict.key0 === undefined);
+dict.key0 = 0;
+assert (dict.key0 === 0);
+
+// Global object
+var global = this;
+for (var i = 0; i < 300; i++) {
+  global["global" + i] = i;
+}
+
+var sum = 0;
+for (var i = 0; i < 300; i++) {
+  sum += eval ("global" + i);
+}
+assert (sum === 44850);
+
+// Declarative lexical environments
+function locals () {
+  var a0 = 0, a1 = 1, a2 = 2, a3 = 3, a4 = 4, a5 = 5, a6 = 6, a7 = 7, a8 = 8, a9 = 9;
+  var b0 = 0, b1 = 1, b2 = 2, b3 = 3, b4 = 4, b5 = 5, b6 = 6, b7 = 7, b8 = 8, b9 = 9;
+  return eval ("a1 + b9 + a5 + b5");
+}
+assert (locals () === 20);
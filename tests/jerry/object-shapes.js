@@ -0,0 +1,107 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Objects with the same properties share the shape
+function Point (x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+var points = [];
+for (var i = 0; i < 100; i++) {
+  points.push (new Point (i, { value: i }));
+}
+
+var sum = 0;
+for (var i = 0; i < 100; i++) {
+  sum += points[i].x + points[i].y.value;
+}
+assert (sum === 9900);
+assert (Object.keys (points[50]).join () === "x,y");
+
+// Delete and re-create
+var obj = { a: 1, b: 2, c: 3 };
+delete obj.b;
+assert (obj.b === undefined);
+assert (!obj.hasOwnProperty ("b"));
+assert (Object.keys (obj).join () === "a,c");
+
+obj.b = 4;
+obj.d = 5;
+assert (obj.b === 4);
+assert (Object.keys (obj).join () === "a,c,b,d");
+
+// Accessors
+var acc = {};
+Object.defineProperty (acc, "g", { get: function () { return 7; }, enumerable: true });
+acc.h = 1;
+assert (acc.g === 7 && acc.h === 1);
+assert (Object.keys (acc).join () === "g,h");
+
+acc = { p: 1 };
+Object.defineProperty (acc, "q", { get: function () { return 8; }, enumerable: true });
+acc.r = 2;
+assert (Object.keys (acc).join () === "p,q,r");
+
+// Attributes
+var attrs = { w: 1 };
+Object.defineProperty (attrs, "w", { writable: false });
+attrs.w = 2;
+assert (attrs.w === 1);
+Object.freeze (attrs);
+assert (Object.isFrozen (attrs));
+
+// More properties, than a shape describes
+var many = {};
+for (var i = 0; i < 100; i++) {
+  many["key" + i] = i;
+}
+
+var keys = Object.keys (many);
+assert (keys.length === 100);
+for (var i = 0; i < 100; i++) {
+  assert (keys[i] === "key" + i);
+  assert (many["key" + i] === i);
+}
+
+delete many.key10;
+delete many.key90;
+assert (Object.keys (many).length === 98);
+assert (many.key10 === undefined && many.key90 === undefined);
+
+// More transitions, than a shape has
+for (var i = 0; i < 100; i++) {
+  var single = {};
+  single["first" + i] = i;
+  single.second = { value: i };
+  assert (single["first" + i] === i);
+  assert (single.second.value === i);
+  assert (Object.keys (single).join () === "first" + i + ",second");
+}
+
+// Enumeration with prototype
+function Base () {
+  this.own = 1;
+}
+Base.prototype.inherited = 2;
+
+var names = [];
+for (var name in new Base ()) {
+  names.push (name);
+}
+assert (names.join () === "own,inherited");
+
+// JSON
+assert (JSON.stringify ({ a: 1, b: [2], c: { d: 3 } }) === '{"a":1,"b":[2],"c":{"d":3}}');
+assert (JSON.parse ('{"x":1,"y":2}').y === 2);
@@ -0,0 +1,83 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Names, built at runtime, match the properties, created with equal names of any kind
+var prefix = "key_";
+var obj = {};
+
+for (var i = 0; i < 300; i++)
+{
+  obj[prefix + i] = i;
+}
+
+var sum = 0;
+
+for (var i = 0; i < 300; i++)
+{
+  sum += obj[prefix + i];
+}
+
+assert (sum === 299 * 300 / 2);
+assert (obj.key_10 === 10);
+assert (obj["key_" + "299"] === 299);
+assert (Object.keys (obj).length === 300);
+
+var literal = { identifier: 1, another_identifier: 2 };
+assert (literal["ident" + "ifier"] === 1);
+assert (literal["another_" + "identifier"] === 2);
+
+literal["dynamic" + "_name"] = 3;
+assert (literal.dynamic_name === 3);
+
+// Long names are represented with ropes
+var long_name = "a_rather_long_property_name_" + "built_by_concatenation";
+obj[long_name] = "long";
+assert (obj.a_rather_long_property_name_built_by_concatenation === "long");
+assert (obj["a_rather_long_property_name_built_" + "by_concatenation"] === "long");
+
+// Deleted and re-created properties
+for (var i = 0; i < 300; i++)
+{
+  delete obj[prefix + i];
+}
+
+assert (Object.keys (obj).length === 1);
+assert (obj[prefix + 5] === undefined);
+
+for (var i = 0; i < 300; i++)
+{
+  obj[prefix + i] = -i;
+}
+
+assert (obj.key_7 === -7);
+assert (obj[prefix + 299] === -299);
+
+// Many objects, that are collected, with their names
+for (var j = 0; j < 20; j++)
+{
+  var tmp = {};
+
+  for (var i = 0; i < 100; i++)
+  {
+    tmp["tmp_" + j + "_" + i] = i;
+  }
+
+  assert (tmp["tmp_" + j + "_99"] === 99);
+}
+
+// Accessors
+var accessor_obj = {};
+Object.defineProperty (accessor_obj, "get" + "ter", { get: function () { return 42; } });
+assert (accessor_obj.getter === 42);
+assert (accessor_obj["ge" + "tter"] === 42);
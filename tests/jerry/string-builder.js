@@ -0,0 +1,145 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Array.prototype.join and toLocaleString
+assert ([].join () === "");
+assert ([undefined, null].join () === ",");
+assert (["len", "gth"].join ("") === "length");
+assert (["a", "b", "c"].join ("éé") === "aéébééc");
+assert ([1, [2, 3], "x"].toString () === "1,2,3,x");
+assert ([1, 2].toLocaleString () === "1,2");
+
+var joined = [];
+for (var i = 0; i < 100; i++)
+{
+  joined.push ("árvíz" + i);
+}
+joined = joined.join ("-");
+assert (joined.length === 6 * 10 + 7 * 90 + 99);
+assert (joined.charAt (joined.length - 1) === "9");
+assert (joined.split ("-")[42] === "árvíz42");
+
+var element = { toString: function () { throw "error"; } };
+
+try
+{
+  [1, 2, element, 4].join ();
+  assert (false);
+}
+catch (e)
+{
+  assert (e === "error");
+}
+
+try
+{
+  [1, 2, { toLocaleString: function () { throw "locale"; } }].toLocaleString ();
+  assert (false);
+}
+catch (e)
+{
+  assert (e === "locale");
+}
+
+// Results larger than 64 kilobytes
+var large = new Array (20000).join ("ab");
+assert (large.length === 2 * 19999);
+large = [large, large].join ("é");
+assert (large.length === 4 * 19999 + 1);
+assert (large.charAt (2 * 19999) === "é");
+assert (large.charAt (large.length - 1) === "b");
+
+// JSON.stringify
+assert (JSON.stringify ("") === '""');
+assert (JSON.stringify ("a\"b\\c\nd\u0001é") === '"a\\"b\\\\c\\nd\\u0001é"');
+assert (JSON.stringify ({}) === "{}");
+assert (JSON.stringify ([]) === "[]");
+assert (JSON.stringify ([1, "x", null, undefined, {}]) === '[1,"x",null,null,{}]');
+assert (JSON.stringify ({ a: [1, { b: "c" }], "d\n": true }) === '{"a":[1,{"b":"c"}],"d\\n":true}');
+assert (JSON.stringify ({ a: [1, { b: "c" }] }, null, 2)
+        === '{\n  "a": [\n    1,\n    {\n      "b": "c"\n    }\n  ]\n}');
+assert (JSON.stringify ([[]], null, "é") === '[\né[]\n]');
+
+var throwing = { a: 1, b: { toJSON: function () { throw "json"; } } };
+
+try
+{
+  JSON.stringify (throwing);
+  assert (false);
+}
+catch (e)
+{
+  assert (e === "json");
+}
+
+assert (JSON.stringify ({ a: undefined, b: function () {}, c: 1, d: undefined }) === '{"c":1}');
+assert (JSON.stringify ({ a: 1, b: 2 }, function (k, v) { return k === "a" ? undefined : v; }, 1) === '{\n "b": 2\n}');
+
+var text = new Array (3000).join ("xy");
+var json = JSON.stringify ({ text: text, n: [text.length] });
+assert (json === '{"text":"' + text + '","n":[5998]}');
+
+// JSON.parse
+assert (JSON.parse (json).text === text);
+assert (JSON.parse ('"a\\"b\\\\c\\nd\\u0001\\u00e9"') === "a\"b\\c\nd\u0001é");
+assert (JSON.parse ('{"\\u0061":1}').a === 1);
+assert (JSON.parse (12) === 12);
+assert (JSON.parse ("-0.5e1") === -5);
+
+var truncated = ['"abc', '"ab\\', '"\\u00', '1.', '1e', '1e+', 'tru', 'nul', '[1,', '{"a"', '{"a":', '[', '{'];
+
+for (var i = 0; i < truncated.length; i++)
+{
+  try
+  {
+    JSON.parse (truncated[i]);
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+// String.prototype.concat
+assert ("".concat () === "");
+assert ("le".concat ("ng", "th") === "length");
+assert ("a".concat (1, null, undefined, "é") === "a1nullundefinedé");
+
+try
+{
+  "a".concat ("b", element);
+  assert (false);
+}
+catch (e)
+{
+  assert (e === "error");
+}
+
+// String.prototype.replace
+assert ("len-th".replace ("-", "g") === "length");
+assert ("éaéaé".replace (/a/g, "[$&$`$']") === "é[aééaé]é[aéaéé]é");
+assert ("x1y2z".replace (/\d/g, function (m) { return "<" + m + ">"; }) === "x<1>y<2>z");
+assert ("abc".replace (/(b)/, "$$$1$2") === "a$b$2c");
+assert ("aaa".replace (/a/g, "") === "");
+
+try
+{
+  "abc".replace ("b", function () { throw "replace"; });
+  assert (false);
+}
+catch (e)
+{
+  assert (e === "replace");
+}
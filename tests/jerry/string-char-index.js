@@ -0,0 +1,78 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Non-ASCII strings
+var s1 = "aé€b😀cdő";
+var codes1 = [0x61, 0xe9, 0x20ac, 0x62, 0xd83d, 0xde00, 0x63, 0x64, 0x151];
+
+assert (s1.length === codes1.length);
+
+// Sequential, backward and random access
+for (var i = 0; i < s1.length; i++)
+{
+  assert (s1.charCodeAt (i) === codes1[i]);
+}
+
+for (var i = s1.length - 1; i >= 0; i--)
+{
+  assert (s1.charCodeAt (i) === codes1[i]);
+  assert (s1[i] === String.fromCharCode (codes1[i]));
+}
+
+var order = [4, 0, 8, 2, 7, 1, 5, 3, 6, 6, 0, 8];
+
+for (var i = 0; i < order.length; i++)
+{
+  assert (s1.charCodeAt (order[i]) === codes1[order[i]]);
+  assert (s1.charAt (order[i]) === String.fromCharCode (codes1[order[i]]));
+}
+
+assert (s1.substring (2, 5) === "€b\ud83d");
+assert (s1.substring (5) === "\ude00cdő");
+assert (s1.substr (8, 1) === "ő");
+assert (s1.slice (-3, -1) === "cd");
+
+// Interleaved access to more strings, than entries in the cache
+var strings = [];
+
+for (var i = 0; i < 10; i++)
+{
+  strings.push ("ű" + i + "árvíztűrő".substring (i % 5) + "é");
+}
+
+for (var j = 0; j < 12; j++)
+{
+  for (var i = 0; i < strings.length; i++)
+  {
+    var str = strings[i];
+    var k = j % str.length;
+    assert (str.charCodeAt (k) === str.substring (k, k + 1).charCodeAt (0));
+  }
+}
+
+// Strings, which are freed after being accessed, do not affect new strings
+for (var i = 0; i < 50; i++)
+{
+  var temp = "éő" + i + "ű" + (i * 3);
+  assert (temp.charCodeAt (0) === 0xe9);
+  assert (temp.charAt (temp.length - 1) === String (i * 3).charAt (String (i * 3).length - 1));
+  assert (temp.charCodeAt (2) === String (i).charCodeAt (0));
+}
+
+// ASCII strings are indexed directly
+var ascii = "the quick brown fox";
+
+assert (ascii.charAt (4) === "q");
+assert (ascii.charCodeAt (18) === 0x78);
+assert (ascii.substring (10, 15) === "brown");
@@ -0,0 +1,170 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Long concatenations are represented lazily, check that the represented strings are correct
+
+var piece = "0123456789abcdef";
+var str = "";
+
+for (var i = 0; i < 100; i++)
+{
+  str += piece;
+}
+
+assert (str.length === 1600);
+assert (str.charAt (0) === "0");
+assert (str.charAt (1599) === "f");
+assert (str.indexOf ("f0") === 15);
+assert (str.lastIndexOf ("ef") === 1598);
+
+// Comparison and hashing
+var a = "abcdefghijklmnopqrstuvwxyz" + "0123456789";
+var b = "abcdefghijklmnopq" + "rstuvwxyz0123456789";
+
+assert (a === "abcdefghijklmnopqrstuvwxyz0123456789");
+assert (a === b);
+assert (a == b);
+assert (!(a < b) && !(a > b));
+assert (a < a + "!");
+assert (a + "0" > a + "!");
+
+var obj = {};
+obj["abcdefghijklmnopqrstuvwxyz0123456789"] = 5;
+assert (obj[a] === 5);
+obj[b] = 6;
+assert (obj["abcdefghijklmnopqrstuvwxyz0123456789"] === 6);
+assert (Object.keys (obj).length === 1);
+
+// Shared operands
+var base = "The quick brown fox jumps over ";
+var dog = base + "the lazy dog";
+var cat = base + "the lazy cat";
+
+assert (dog === "The quick brown fox jumps over the lazy dog");
+assert (cat === "The quick brown fox jumps over the lazy cat");
+assert (base === "The quick brown fox jumps over ");
+
+// Nested concatenations on both sides
+var left = "left side of the concatenation, ";
+var right = "right side of the concatenation";
+var both = (left + left) + (right + right);
+
+assert (both.length === 2 * left.length + 2 * right.length);
+assert (both.substring (left.length, 2 * left.length) === left);
+assert (both.slice (-right.length) === right);
+
+// Numbers and multi-byte characters
+var mixed = "";
+for (var i = 0; i < 100; i++)
+{
+  mixed += i + "á☃" + 0.5;
+}
+
+assert (mixed.length === 690);
+assert (mixed.charAt (1) === "á");
+assert (mixed.charCodeAt (2) === 0x2603);
+assert (mixed.substr (mixed.length - 6) === "9á☃0.5");
+assert (mixed.split ("☃").length === 101);
+
+// Conversions
+var num = "12345678901234567890" + "123456789012";
+assert (Number (num) === 12345678901234567890123456789012);
+assert (parseInt ("   1234567890" + "1234567890 and more") === 12345678901234567890);
+assert (("   " + "padded string with leading and trailing spaces" + "   ").trim ().length === 46);
+
+// Long chains of concatenations
+var long = "";
+for (var i = 0; i < 1000; i++)
+{
+  long += String.fromCharCode (65 + i % 26);
+}
+
+assert (long.length === 1000);
+for (var i = 0; i < 1000; i += 37)
+{
+  assert (long.charCodeAt (i) === 65 + i % 26);
+}
+
+var copies = [];
+for (var i = 0; i < 100; i++)
+{
+  copies.push (str + i);
+}
+
+assert (copies[99] === str + "99");
+assert (copies[99].length === 1602);
+
+// Rebalanced concatenations
+var appended = "";
+var prepended = "";
+var elements = [];
+var snapshots = [];
+
+for (var i = 0; i < 2000; i++)
+{
+  var element = String.fromCharCode (97 + i % 26) + (i % 7 ? "" : piece);
+
+  elements.push (element);
+  appended += element;
+  prepended = element + prepended;
+
+  if (i % 250 === 0)
+  {
+    snapshots.push (appended);
+  }
+}
+
+assert (appended.length === 2000 + 286 * piece.length);
+assert (appended === elements.join (""));
+assert (prepended === elements.reverse ().join (""));
+
+for (var i = 0; i < snapshots.length; i++)
+{
+  assert (snapshots[i] === appended.substring (0, snapshots[i].length));
+}
+
+var keys = {};
+keys[appended] = 1;
+keys[snapshots[0] + appended.substring (snapshots[0].length)] = 2;
+assert (Object.keys (keys).length === 1);
+assert (keys[appended] === 2);
+
+// Hashes of concatenations are computed upon first use, also for prepended strings
+var reversed = {};
+var prefix = "";
+for (var i = 0; i < 300; i++)
+{
+  prefix = String.fromCharCode (97 + i % 26) + piece + prefix;
+
+  if (i % 100 === 99)
+  {
+    reversed[prefix] = i;
+  }
+}
+
+assert (reversed[prefix] === 299);
+assert (reversed[prefix.substring (0)] === 299);
+assert (reversed[prefix.slice (-100 * (piece.length + 1))] === 99);
+assert (reversed["z" + prefix] === undefined);
+assert (Object.keys (reversed).length === 3);
+
+var sandwich = "";
+for (var i = 0; i < 500; i++)
+{
+  sandwich = "<" + sandwich + ">";
+}
+
+assert (sandwich.length === 1000);
+assert (sandwich.lastIndexOf ("<") === 499);
+assert (sandwich.indexOf (">") === 500);
@@ -0,0 +1,217 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+var types = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+             Int32Array, Uint32Array, Float32Array, Float64Array];
+var sizes = [1, 1, 1, 2, 2, 4, 4, 4, 8];
+var names = ["Int8Array", "Uint8Array", "Uint8ClampedArray", "Int16Array", "Uint16Array",
+             "Int32Array", "Uint32Array", "Float32Array", "Float64Array"];
+
+for (var i = 0; i < types.length; i++) {
+  var T = types[i];
+  assert (T.length === 3);
+  assert (T.BYTES_PER_ELEMENT === sizes[i]);
+  assert (T.prototype.BYTES_PER_ELEMENT === sizes[i]);
+  assert (T.prototype.constructor === T);
+
+  var a = new T (4);
+  assert (a.length === 4);
+  assert (a.byteLength === 4 * sizes[i]);
+  assert (a.byteOffset === 0);
+  assert (a.buffer instanceof ArrayBuffer);
+  assert (a.buffer.byteLength === 4 * sizes[i]);
+  assert (a instanceof T);
+  assert (Object.prototype.toString.call (a) === "[object " + names[i] + "]");
+
+  for (var j = 0; j < 4; j++) {
+    assert (a[j] === 0);
+    a[j] = j + 1;
+  }
+  assert (Array.prototype.join.call (a) === "1,2,3,4");
+
+  /* Out of range accesses are ignored */
+  a[4] = 5;
+  assert (a[4] === undefined);
+  assert (a.length === 4);
+
+  try {
+    T (4);
+    assert (false);
+  } catch (e) {
+    assert (e instanceof TypeError);
+  }
+}
+
+// Conversions
+var i8 = new Int8Array ([127, 128, -129, 255, 1.9, -1.9, NaN, "3"]);
+assert (Array.prototype.join.call (i8) === "127,-128,127,-1,1,-1,0,3");
+
+var u8 = new Uint8Array ([256, -1, 257, 1.5]);
+assert (Array.prototype.join.call (u8) === "0,255,1,1");
+
+var u8c = new Uint8ClampedArray ([300, -5, 1.5, 2.5, 0.5, NaN, Infinity]);
+assert (Array.prototype.join.call (u8c) === "255,0,2,2,0,0,255");
+
+var i16 = new Int16Array ([32768, -32769, 65535]);
+assert (Array.prototype.join.call (i16) === "-32768,32767,-1");
+
+var u32 = new Uint32Array ([-1, 4294967296]);
+assert (u32[0] === 4294967295);
+assert (u32[1] === 0);
+
+var f32 = new Float32Array ([0.1, Infinity]);
+assert (f32[0] !== 0.1);
+assert (Math.abs (f32[0] - 0.1) < 1e-7);
+assert (f32[1] === Infinity);
+
+var f64 = new Float64Array ([0.1, -0]);
+assert (f64[0] === 0.1);
+assert (1 / f64[1] === -Infinity);
+
+// Views sharing a buffer
+var buf = new ArrayBuffer (8);
+var bytes = new Uint8Array (buf);
+var words = new Uint16Array (buf, 2, 2);
+assert (words.length === 2);
+assert (words.byteOffset === 2);
+assert (words.buffer === buf);
+words[0] = 0x0101;
+assert (bytes[2] === 1 && bytes[3] === 1);
+
+assert (new Uint16Array (buf, 4).length === 2);
+
+try {
+  new Uint16Array (buf, 1);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  new Uint32Array (new ArrayBuffer (6));
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  new Uint8Array (buf, 4, 5);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  new Uint8Array (buf, 9);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+// Copying from other objects
+var copy = new Float64Array (new Int8Array ([1, -2, 3]));
+assert (Array.prototype.join.call (copy) === "1,-2,3");
+var from_like = new Int32Array ({ length: 2, 0: 7, 1: "8" });
+assert (Array.prototype.join.call (from_like) === "7,8");
+
+// Properties of the elements
+var arr = new Int32Array (2);
+var desc = Object.getOwnPropertyDescriptor (arr, "1");
+assert (desc.value === 0);
+assert (desc.writable && desc.enumerable && !desc.configurable);
+assert (Object.getOwnPropertyDescriptor (arr, "2") === undefined);
+assert (arr.hasOwnProperty (0));
+assert (!arr.hasOwnProperty (2));
+assert (Object.keys (arr).join () === "0,1");
+assert (!delete arr[0]);
+assert (delete arr[5]);
+
+try {
+  Object.defineProperty (arr, "0", { get: function () { return 1; } });
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+Object.defineProperty (arr, "0", { value: 9 });
+assert (arr[0] === 9);
+
+var keys = [];
+for (var k in new Uint8Array (3)) {
+  keys.push (k);
+}
+assert (keys.join () === "0,1,2");
+
+// set
+var target = new Uint8Array (5);
+target.set ([1, 2]);
+target.set (new Int8Array ([3, 4]), 3);
+assert (Array.prototype.join.call (target) === "1,2,0,3,4");
+
+try {
+  target.set ([1, 2], 4);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+var overlap = new Uint8Array ([1, 2, 3, 4, 5, 6]);
+overlap.set (overlap.subarray (0, 4), 2);
+assert (Array.prototype.join.call (overlap) === "1,2,1,2,3,4");
+
+// subarray
+var whole = new Int16Array ([1, 2, 3, 4, 5]);
+var sub = whole.subarray (1, -1);
+assert (sub instanceof Int16Array);
+assert (Array.prototype.join.call (sub) === "2,3,4");
+assert (sub.byteOffset === 2);
+assert (sub.buffer === whole.buffer);
+sub[0] = 20;
+assert (whole[1] === 20);
+assert (whole.subarray (3).length === 2);
+assert (whole.subarray (4, 1).length === 0);
+
+// Accessors check their receivers
+try {
+  Uint8Array.prototype.length;
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+try {
+  Object.getOwnPropertyDescriptor (Object.getPrototypeOf (Int8Array.prototype), "length").get.call (new DataView (buf));
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+// Array.prototype methods are generic
+assert (Array.prototype.indexOf.call (new Uint8Array ([5, 6, 7]), 6) === 1);
+assert (Array.prototype.map.call (new Uint8Array ([1, 2]), function (x) { return x * 2; }).join () === "2,4");
+
+// Named properties
+var named = new Int8Array (4);
+named.foo = 3;
+named.bar = 4;
+named[1] = 7;
+assert (named.foo === 3);
+assert (named.bar === 4);
+assert (named[1] === 7);
+assert (named.length === 4);
+assert (Object.keys (named).join () === "0,1,2,3,foo,bar");
+delete named.foo;
+assert (named.foo === undefined);
+assert (named.bar === 4);
+named.subarray (1)[0] = 9;
+assert (named[1] === 9);
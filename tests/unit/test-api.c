@@ -165,6 +165,62 @@ handler_construct_freecb (uintptr_t native_p)
   test_api_is_free_callback_was_called = true;
 } /* handler_construct_freecb */
 
+static uint8_t external_arraybuffer_bytes[4] = { 1, 2, 3, 4 };
+static bool test_api_is_external_arraybuffer_freed = false;
+
+static void
+external_arraybuffer_freecb (uintptr_t native_p)
+{
+  JERRY_ASSERT (native_p == (uintptr_t) external_arraybuffer_bytes);
+
+  test_api_is_external_arraybuffer_freed = true;
+} /* external_arraybuffer_freecb */
+
+static const char external_string_chars[] = "characters of an external string, which are not copied";
+static const char external_short_string_chars[] = "short";
+static bool test_api_is_external_string_freed = false;
+static bool test_api_is_external_short_string_freed = false;
+
+static void
+external_string_freecb (uintptr_t native_p)
+{
+  JERRY_ASSERT (native_p == (uintptr_t) external_string_chars);
+
+  test_api_is_external_string_freed = true;
+} /* external_string_freecb */
+
+static void
+external_short_string_freecb (uintptr_t native_p)
+{
+  JERRY_ASSERT (native_p == (uintptr_t) external_short_string_chars);
+
+  test_api_is_external_short_string_freed = true;
+} /* external_short_string_freecb */
+
+static void
+gc_start_callback (jerry_api_gc_pause_kind_t kind,
+                   void *user_data_p)
+{
+  JERRY_ASSERT (kind <= JERRY_API_GC_PAUSE_INCREMENTAL_SLICE);
+
+  size_t *counters_p = (size_t *) user_data_p;
+  JERRY_ASSERT (counters_p[0] == counters_p[1]);
+
+  counters_p[0]++;
+} /* gc_start_callback */
+
+static void
+gc_end_callback (jerry_api_gc_pause_kind_t kind,
+                 void *user_data_p)
+{
+  JERRY_ASSERT (kind <= JERRY_API_GC_PAUSE_INCREMENTAL_SLICE);
+
+  size_t *counters_p = (size_t *) user_data_p;
+  counters_p[1]++;
+
+  JERRY_ASSERT (counters_p[0] == counters_p[1]);
+} /* gc_end_callback */
+
 static bool
 handler_construct (const jerry_api_object_t *function_obj_p,
                    const jerry_api_value_t *this_p,
@@ -641,6 +697,42 @@ main (void)
 
   JERRY_ASSERT (v_out.type == JERRY_API_DATA_TYPE_FLOAT64 && v_out.u.v_float64 == 10.5);
 
+  // Test: adding fields to an array keeps its elements
+  test_api_init_api_value_float64 (&v_in, 2.0);
+  is_ok = jerry_api_add_object_field (array_obj_p, (jerry_api_char_t *) "foo", 3, &v_in, true);
+  JERRY_ASSERT (is_ok);
+  test_api_init_api_value_float64 (&v_in, 3.0);
+  is_ok = jerry_api_add_object_field (array_obj_p, (jerry_api_char_t *) "6", 1, &v_in, true);
+  JERRY_ASSERT (is_ok);
+  test_api_init_api_value_float64 (&v_in, 4.0);
+  is_ok = jerry_api_add_object_field (array_obj_p, (jerry_api_char_t *) "12", 2, &v_in, true);
+  JERRY_ASSERT (is_ok);
+  is_ok = jerry_api_add_object_field (array_obj_p, (jerry_api_char_t *) "5", 1, &v_in, true);
+  JERRY_ASSERT (!is_ok);
+
+  jerry_api_get_array_index_value (array_obj_p, 5, &v_out);
+  JERRY_ASSERT (v_out.type == JERRY_API_DATA_TYPE_FLOAT64 && v_out.u.v_float64 == 10.5);
+  jerry_api_get_array_index_value (array_obj_p, 6, &v_out);
+  JERRY_ASSERT (v_out.type == JERRY_API_DATA_TYPE_FLOAT64 && v_out.u.v_float64 == 3.0);
+  jerry_api_get_array_index_value (array_obj_p, 12, &v_out);
+  JERRY_ASSERT (v_out.type == JERRY_API_DATA_TYPE_FLOAT64 && v_out.u.v_float64 == 4.0);
+  is_ok = jerry_api_get_object_field_value (array_obj_p, (jerry_api_char_t *) "foo", &v_out);
+  JERRY_ASSERT (is_ok && v_out.type == JERRY_API_DATA_TYPE_FLOAT64 && v_out.u.v_float64 == 2.0);
+  is_ok = jerry_api_get_object_field_value (array_obj_p, (jerry_api_char_t *) "length", &v_out);
+  JERRY_ASSERT (is_ok && v_out.type == JERRY_API_DATA_TYPE_FLOAT64 && v_out.u.v_float64 == 13.0);
+
+  // A field, that is not writable, moves the elements to named properties
+  test_api_init_api_value_float64 (&v_in, 5.0);
+  is_ok = jerry_api_add_object_field (array_obj_p, (jerry_api_char_t *) "7", 1, &v_in, false);
+  JERRY_ASSERT (is_ok);
+
+  jerry_api_get_array_index_value (array_obj_p, 5, &v_out);
+  JERRY_ASSERT (v_out.type == JERRY_API_DATA_TYPE_FLOAT64 && v_out.u.v_float64 == 10.5);
+  jerry_api_get_array_index_value (array_obj_p, 7, &v_out);
+  JERRY_ASSERT (v_out.type == JERRY_API_DATA_TYPE_FLOAT64 && v_out.u.v_float64 == 5.0);
+  jerry_api_get_array_index_value (array_obj_p, 12, &v_out);
+  JERRY_ASSERT (v_out.type == JERRY_API_DATA_TYPE_FLOAT64 && v_out.u.v_float64 == 4.0);
+
   jerry_api_release_object (array_obj_p);
 
 
@@ -669,9 +761,47 @@ main (void)
   // cleanup.
   jerry_api_release_object (global_obj_p);
 
+  // TEST: gc start / end callbacks and statistics.
+  size_t gc_callback_counters[2] = { 0, 0 };
+  jerry_api_gc_stats_t gc_stats_before, gc_stats_after;
+
+  jerry_api_get_gc_stats (&gc_stats_before);
+  jerry_api_set_gc_callbacks (gc_start_callback, gc_end_callback, gc_callback_counters);
+
   // TEST: run gc.
   jerry_api_gc ();
 
+  // TEST: run gc incrementally, with allocations between the steps.
+  bool is_gc_completed = jerry_api_gc_step (0);
+
+  while (!is_gc_completed)
+  {
+    jerry_api_object_t *obj_p = jerry_api_create_object ();
+    jerry_api_release_object (obj_p);
+
+    is_gc_completed = jerry_api_gc_step (0);
+  }
+
+  jerry_api_set_gc_callbacks (NULL, NULL, NULL);
+  jerry_api_get_gc_stats (&gc_stats_after);
+
+  size_t gc_pauses_number = 0;
+
+  for (uint32_t bucket = 0; bucket < JERRY_API_GC_PAUSE_HISTOGRAM_SIZE; bucket++)
+  {
+    gc_pauses_number += gc_stats_after.pause_histogram[bucket] - gc_stats_before.pause_histogram[bucket];
+  }
+
+  JERRY_ASSERT (gc_callback_counters[1] == gc_pauses_number);
+  JERRY_ASSERT (gc_pauses_number == ((gc_stats_after.minor_gc_count - gc_stats_before.minor_gc_count)
+                                     + (gc_stats_after.major_gc_count - gc_stats_before.major_gc_count)
+                                     + (gc_stats_after.incremental_slice_count
+                                        - gc_stats_before.incremental_slice_count)));
+  JERRY_ASSERT (gc_stats_after.major_gc_count > gc_stats_before.major_gc_count);
+  JERRY_ASSERT (gc_stats_after.incremental_gc_count > gc_stats_before.incremental_gc_count);
+  JERRY_ASSERT (gc_stats_after.marked_objects > gc_stats_before.marked_objects);
+  JERRY_ASSERT (gc_stats_after.pause_max_us >= gc_stats_before.pause_max_us);
+
   jerry_cleanup ();
 
   JERRY_ASSERT (test_api_is_free_callback_was_called);
@@ -693,6 +823,143 @@ main (void)
 
   jerry_cleanup ();
 
+  // ArrayBuffer over an external buffer
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  jerry_api_object_t *arraybuffer_p = jerry_api_create_external_arraybuffer (external_arraybuffer_bytes,
+                                                                             sizeof (external_arraybuffer_bytes),
+                                                                             external_arraybuffer_freecb);
+  JERRY_ASSERT (arraybuffer_p != NULL);
+
+  jerry_api_value_t arraybuffer_value;
+  arraybuffer_value.type = JERRY_API_DATA_TYPE_OBJECT;
+  arraybuffer_value.u.v_object = arraybuffer_p;
+
+  global_obj_p = jerry_api_get_global ();
+  is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "external", &arraybuffer_value);
+  JERRY_ASSERT (is_ok);
+  jerry_api_release_object (global_obj_p);
+  jerry_api_release_object (arraybuffer_p);
+
+  const char *arraybuffer_code_p = ("var bytes = new Uint8Array (external);\n"
+                                    "bytes[0] += bytes[3];\n"
+                                    "bytes[1] = 0x1ff;\n"
+                                    "external.byteLength;\n");
+  jerry_completion_code_t arraybuffer_status = jerry_api_eval ((jerry_api_char_t *) arraybuffer_code_p,
+                                                               strlen (arraybuffer_code_p),
+                                                               false,
+                                                               false,
+                                                               &res);
+  JERRY_ASSERT (arraybuffer_status == JERRY_COMPLETION_CODE_OK
+                && res.type == JERRY_API_DATA_TYPE_FLOAT64
+                && res.u.v_float64 == 4.0);
+  jerry_api_release_value (&res);
+
+  /* The bytes are accessed in place */
+  JERRY_ASSERT (external_arraybuffer_bytes[0] == 5 && external_arraybuffer_bytes[1] == 0xff);
+  JERRY_ASSERT (!test_api_is_external_arraybuffer_freed);
+
+  jerry_cleanup ();
+
+  JERRY_ASSERT (test_api_is_external_arraybuffer_freed);
+
+  // External strings
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  jerry_api_string_t *external_str_p;
+  external_str_p = jerry_api_create_external_string_sz ((jerry_api_char_t *) external_string_chars,
+                                                        (jerry_api_size_t) strlen (external_string_chars),
+                                                        external_string_freecb);
+  JERRY_ASSERT (external_str_p != NULL);
+
+  /* The characters are accessed in place */
+  jerry_api_size_t chars_size;
+  const jerry_api_char_t *chars_p = jerry_api_get_string_chars (external_str_p, &chars_size);
+  JERRY_ASSERT (chars_p == (const jerry_api_char_t *) external_string_chars
+                && chars_size == strlen (external_string_chars));
+  JERRY_ASSERT (jerry_api_get_string_length (external_str_p) == strlen (external_string_chars));
+
+  jerry_api_value_t external_str_value = jerry_api_create_string_value (external_str_p);
+
+  global_obj_p = jerry_api_get_global ();
+  is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "external", &external_str_value);
+  JERRY_ASSERT (is_ok);
+  jerry_api_release_object (global_obj_p);
+  jerry_api_release_string (external_str_p);
+
+  const char *external_str_code_p = ("var s = 'characters of an ' + 'external string, which are not copied';\n"
+                                     "(external === s && external[18] === 'x') ? external.substring (17, 25) : '';\n");
+  jerry_completion_code_t external_str_status = jerry_api_eval ((jerry_api_char_t *) external_str_code_p,
+                                                                strlen (external_str_code_p),
+                                                                false,
+                                                                false,
+                                                                &res);
+  JERRY_ASSERT (external_str_status == JERRY_COMPLETION_CODE_OK
+                && res.type == JERRY_API_DATA_TYPE_STRING);
+  chars_p = jerry_api_get_string_chars (res.u.v_string, &chars_size);
+  JERRY_ASSERT (chars_p != NULL && chars_size == 8 && !memcmp (chars_p, "external", 8));
+  jerry_api_release_value (&res);
+
+  JERRY_ASSERT (!test_api_is_external_string_freed);
+
+  /* Short strings are copied, and the buffer is released at once */
+  jerry_api_string_t *external_short_str_p;
+  external_short_str_p = jerry_api_create_external_string_sz ((jerry_api_char_t *) external_short_string_chars,
+                                                              (jerry_api_size_t) strlen (external_short_string_chars),
+                                                              external_short_string_freecb);
+  JERRY_ASSERT (test_api_is_external_short_string_freed);
+  chars_p = jerry_api_get_string_chars (external_short_str_p, &chars_size);
+  JERRY_ASSERT (chars_p != (const jerry_api_char_t *) external_short_string_chars
+                && chars_size == strlen (external_short_string_chars)
+                && !memcmp (chars_p, external_short_string_chars, chars_size));
+  jerry_api_release_string (external_short_str_p);
+
+  /* Numbers have no character buffer */
+  jerry_api_value_t number_value = jerry_api_create_number_value (1234.0);
+  jerry_api_string_t *number_str_p = jerry_api_value_to_string (&number_value);
+  JERRY_ASSERT (jerry_api_get_string_chars (number_str_p, &chars_size) == NULL && chars_size == 4);
+  jerry_api_release_string (number_str_p);
+
+  jerry_cleanup ();
+
+  JERRY_ASSERT (test_api_is_external_string_freed);
+
+  // Garbage collection policy: collect upon each growth of heap usage, and upon large growth only
+  const uint32_t heap_growth_percents[] = { 0, 1000 };
+  size_t gc_collections_numbers[] = { 0, 0 };
+
+  for (uint32_t i = 0; i < sizeof (heap_growth_percents) / sizeof (heap_growth_percents[0]); i++)
+  {
+    jerry_gc_policy_t gc_policy;
+    gc_policy.heap_growth_percent = heap_growth_percents[i];
+    gc_policy.min_heap_growth = 0;
+
+    jerry_init_with_gc_policy (JERRY_FLAG_EMPTY, &gc_policy);
+
+    const char *gc_policy_code_p = ("var s = '', a = [];\n"
+                                    "for (var i = 0; i < 500; i++) {\n"
+                                    "  s += 'string ' + i;\n"
+                                    "  a[i % 10] = { s: s.substring (i) };\n"
+                                    "}\n");
+    is_ok = jerry_parse ((jerry_api_char_t *) gc_policy_code_p, strlen (gc_policy_code_p), &err_obj_p);
+    JERRY_ASSERT (is_ok && err_obj_p == NULL);
+
+    is_ok = (jerry_run (&err_obj_p) == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (is_ok && err_obj_p == NULL);
+
+    jerry_api_gc_stats_t gc_stats;
+    jerry_api_get_gc_stats (&gc_stats);
+
+    gc_collections_numbers[i] = (gc_stats.minor_gc_count
+                                 + gc_stats.major_gc_count
+                                 + gc_stats.incremental_gc_count);
+
+    jerry_cleanup ();
+  }
+
+  // Larger growth of heap usage is allowed between collections, so fewer collections are performed
+  JERRY_ASSERT (gc_collections_numbers[0] > gc_collections_numbers[1]);
+
   // Dump / execute snapshot
   // FIXME: support save/load snapshot for optimized parser
   if (false)
@@ -116,5 +116,38 @@ main (int __attr_unused___ argc,
   mem_heap_stats_print ();
 #endif /* MEM_STATS */
 
+  mem_unregister_a_try_give_memory_back_callback (test_heap_give_some_memory_back);
+
+  // All free space is a single region, so there is no fragmentation
+  JERRY_ASSERT (mem_heap_get_fragmentation () == 0);
+  const size_t free_size = mem_heap_get_largest_free_region_size ();
+  const size_t block_size = free_size / test_sub_iters / MEM_ALIGNMENT * MEM_ALIGNMENT;
+
+  for (uint32_t j = 0; j < test_sub_iters; j++)
+  {
+    ptrs[j] = (uint8_t *) mem_heap_alloc_block (block_size);
+    JERRY_ASSERT (ptrs[j] != NULL);
+  }
+
+  for (uint32_t j = 0; j < test_sub_iters; j += 2)
+  {
+    mem_heap_free_block (ptrs[j], block_size);
+    ptrs[j] = NULL;
+  }
+
+  JERRY_ASSERT (mem_heap_get_fragmentation () > 0);
+  JERRY_ASSERT (mem_heap_get_largest_free_region_size () < free_size);
+
+  for (uint32_t j = 1; j < test_sub_iters; j += 2)
+  {
+    mem_heap_free_block (ptrs[j], block_size);
+    ptrs[j] = NULL;
+  }
+
+  JERRY_ASSERT (mem_heap_get_fragmentation () == 0);
+  JERRY_ASSERT (mem_heap_get_largest_free_region_size () == free_size);
+
+  mem_heap_finalize ();
+
   return 0;
 } /* main */